@@ -11,6 +11,7 @@
 #include "Components/SpotLightComponent.h"
 #include "Components/SphereComp.h"
 #include "Components/ParticleSubUVComponent.h"
+#include "Components/ParticleSystemComponent.h"
 #include "Components/TextComponent.h"
 #include "Components/ProjectileMovementComponent.h"
 
@@ -272,6 +273,7 @@ void ControlEditorPanel::CreateModifyButton(ImVec2 ButtonSize, ImFont* IconFont)
             { .label= "PointLight", .obj= OBJ_PointLight },
             { .label= "SpotLight", .obj=OBJ_SpotLight},
             { .label= "Particle",  .obj= OBJ_PARTICLE },
+            { .label= "ParticleSystem", .obj= OBJ_ParticleSystem },
             { .label= "Text",      .obj= OBJ_Text },
             { .label= "Fireball",  .obj = OBJ_Fireball},
             { .label= "Fog",       .obj= OBJ_Fog }
@@ -358,6 +360,21 @@ void ControlEditorPanel::CreateModifyButton(ImVec2 ButtonSize, ImFont* IconFont)
                     SpawnedActor->SetActorTickInEditor(true);
                     break;
                 }
+                case OBJ_ParticleSystem:
+                {
+                    SpawnedActor = World->SpawnActor<AActor>();
+                    SpawnedActor->SetActorLabel(TEXT("OBJ_ParticleSystem"));
+                    UParticleSystemComponent* ParticleSystemComponent = SpawnedActor->AddComponent<UParticleSystemComponent>();
+                    ParticleSystemComponent->SetTexture(L"Assets/Texture/T_Explosion_SubUV.png");
+                    FParticleEmitterSettings Settings;
+                    Settings.SpawnRate = 500.0f;
+                    Settings.MaxParticles = 2000;
+                    Settings.SubUVRows = 6;
+                    Settings.SubUVColumns = 6;
+                    ParticleSystemComponent->SetEmitterSettings(Settings);
+                    SpawnedActor->SetActorTickInEditor(true);
+                    break;
+                }
                 case OBJ_Text:
                 {
                     SpawnedActor = World->SpawnActor<AActor>();
@@ -474,7 +491,7 @@ void ControlEditorPanel::CreateFlagButton() const
         ImGui::OpenPopup("ShowControl");
     }
 
-    const char* items[] = { "AABB", "Primitive", "BillBoard", "UUID", "Fog"};
+    const char* items[] = { "AABB", "Primitive", "BillBoard", "UUID", "Fog", "Particles"};
     uint64 ActiveViewportFlags = ActiveViewport->GetShowFlag();
 
     if (ImGui::BeginPopup("ShowControl"))
@@ -485,7 +502,8 @@ void ControlEditorPanel::CreateFlagButton() const
             (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_Primitives)) != 0,
             (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_BillboardText)) != 0,
             (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_UUIDText)) != 0,
-            (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_Fog)) !=0
+            (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_Fog)) !=0,
+            (ActiveViewportFlags & static_cast<uint64>(EEngineShowFlags::SF_Particles)) != 0
         };  // 각 항목의 체크 상태 저장
 
         for (int i = 0; i < IM_ARRAYSIZE(items); i++)
@@ -592,6 +610,8 @@ uint64 ControlEditorPanel::ConvertSelectionToFlags(const bool selected[]) const
         flags |= static_cast<uint64>(EEngineShowFlags::SF_UUIDText);
     if (selected[4])
         flags |= static_cast<uint64>(EEngineShowFlags::SF_Fog);
+    if (selected[5])
+        flags |= static_cast<uint64>(EEngineShowFlags::SF_Particles);
     return flags;
 }
 
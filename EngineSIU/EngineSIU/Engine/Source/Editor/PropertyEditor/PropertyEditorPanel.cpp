@@ -455,11 +455,7 @@ void PropertyEditorPanel::RenderForStaticMesh(UStaticMeshComponent* StaticMeshCo
                 if (ImGui::Selectable(GetData(Asset.Value.AssetName.ToString()), false))
                 {
                     FString MeshName = Asset.Value.PackagePath.ToString() + "/" + Asset.Value.AssetName.ToString();
-                    UStaticMesh* StaticMesh = FManagerOBJ::GetStaticMesh(MeshName.ToWideString());
-                    if (StaticMesh)
-                    {
-                        StaticMeshComp->SetStaticMesh(StaticMesh);
-                    }
+                    StaticMeshComp->SetStaticMeshAsync(MeshName);
                 }
             }
             ImGui::EndCombo();
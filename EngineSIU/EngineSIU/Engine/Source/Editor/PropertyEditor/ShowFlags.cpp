@@ -1,7 +1,7 @@
 #include "PropertyEditor/ShowFlags.h"
 
 ShowFlags::ShowFlags()
-    : currentFlags(31)
+    : currentFlags(63)
 {
 }
 
@@ -25,14 +25,15 @@ void ShowFlags::Draw(const std::shared_ptr<FEditorViewportClient>& ActiveViewpor
 
     if (ImGui::Begin("ShowFlags"))
     {
-        const char* items[] = { "AABB", "Primitives", "BillBoardText", "UUID", "Fog" };
+        const char* items[] = { "AABB", "Primitives", "BillBoardText", "UUID", "Fog", "Particles" };
         uint64 curFlag = ActiveViewport->GetShowFlag();
         bool selected[IM_ARRAYSIZE(items)] = {
             static_cast<bool>(curFlag & EEngineShowFlags::SF_AABB),
             static_cast<bool>(curFlag & EEngineShowFlags::SF_Primitives),
             static_cast<bool>(curFlag & EEngineShowFlags::SF_BillboardText),
             static_cast<bool>(curFlag & EEngineShowFlags::SF_UUIDText),
-            static_cast<bool>(curFlag & EEngineShowFlags::SF_Fog)
+            static_cast<bool>(curFlag & EEngineShowFlags::SF_Fog),
+            static_cast<bool>(curFlag & EEngineShowFlags::SF_Particles)
         }; // 각 항목의 체크 상태 저장
 
         if (ImGui::BeginCombo("Show Flags", "Select Show Flags"))
@@ -63,6 +64,8 @@ uint64 ShowFlags::ConvertSelectionToFlags(const bool selected[]) const
         flags |= static_cast<uint64>(EEngineShowFlags::SF_UUIDText);
     if (selected[4])
         flags |= static_cast<uint64>(EEngineShowFlags::SF_Fog);
+    if (selected[5])
+        flags |= static_cast<uint64>(EEngineShowFlags::SF_Particles);
     return flags;
 }
 
@@ -13,6 +13,7 @@ enum Type : uint64
     SF_BillboardText = 1ULL << 2,
     SF_UUIDText = 1ULL << 3,
     SF_Fog = 1ULL << 4,
+    SF_Particles = 1ULL << 5,
 };
 }
 
@@ -0,0 +1,61 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+#include "QueuedThreadPool.h"
+
+
+/**
+ * [0, Num) 범위의 인덱스마다 Body(Index)를 FQueuedThreadPool의 워커와 호출한 스레드에서 나눠 실행합니다.
+ * 모든 Body 호출이 끝난 뒤에 반환합니다.
+ *
+ * @note Body는 여러 스레드에서 동시에 호출되므로, 서로 다른 인덱스가 같은 데이터를 쓰지 않아야 합니다.
+ */
+template <typename FuncType>
+void ParallelFor(int32 Num, const FuncType& Body)
+{
+    FQueuedThreadPool& ThreadPool = FQueuedThreadPool::Get();
+    const int32 NumHelpers = std::min(Num - 1, static_cast<int32>(ThreadPool.GetNumThreads()));
+    if (NumHelpers <= 0)
+    {
+        for (int32 Index = 0; Index < Num; ++Index)
+        {
+            Body(Index);
+        }
+        return;
+    }
+
+    struct FParallelForState
+    {
+        std::atomic<int32> NextIndex = 0;
+        std::atomic<int32> NumCompleted = 0;
+    };
+    // 워커가 늦게 시작해서 호출한 스레드가 먼저 반환하더라도 State는 유효해야 함
+    std::shared_ptr<FParallelForState> State = std::make_shared<FParallelForState>();
+
+    auto Work = [State, Num, BodyPtr = &Body]()
+    {
+        int32 Index;
+        while ((Index = State->NextIndex.fetch_add(1)) < Num)
+        {
+            (*BodyPtr)(Index);
+            if (State->NumCompleted.fetch_add(1) + 1 == Num)
+            {
+                State->NumCompleted.notify_all();
+            }
+        }
+    };
+
+    for (int32 i = 0; i < NumHelpers; ++i)
+    {
+        ThreadPool.AddTask(Work);
+    }
+    Work();
+
+    int32 NumCompleted;
+    while ((NumCompleted = State->NumCompleted.load()) != Num)
+    {
+        State->NumCompleted.wait(NumCompleted);
+    }
+}
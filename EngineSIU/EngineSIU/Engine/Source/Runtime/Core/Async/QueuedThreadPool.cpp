@@ -0,0 +1,91 @@
+#include "QueuedThreadPool.h"
+
+
+FQueuedThreadPool& FQueuedThreadPool::Get()
+{
+    static FQueuedThreadPool Instance;
+    return Instance;
+}
+
+FQueuedThreadPool::~FQueuedThreadPool()
+{
+    Shutdown();
+}
+
+void FQueuedThreadPool::Startup(uint32 InNumThreads)
+{
+    if (!Threads.IsEmpty())
+    {
+        return;
+    }
+
+    if (InNumThreads == 0)
+    {
+        const uint32 NumCores = std::thread::hardware_concurrency();
+        InNumThreads = NumCores > 1 ? NumCores - 1 : 0;
+    }
+
+    bShuttingDown = false;
+    Threads.Reserve(static_cast<int32>(InNumThreads));
+    for (uint32 i = 0; i < InNumThreads; ++i)
+    {
+        Threads.Emplace(&FQueuedThreadPool::WorkerMain, this);
+    }
+}
+
+void FQueuedThreadPool::Shutdown()
+{
+    {
+        std::lock_guard Lock(Mutex);
+        bShuttingDown = true;
+    }
+    Condition.notify_all();
+
+    for (std::thread& Thread : Threads)
+    {
+        Thread.join();
+    }
+    Threads.Empty();
+}
+
+void FQueuedThreadPool::AddTask(std::function<void()> Task)
+{
+    {
+        std::lock_guard Lock(Mutex);
+        if (!Threads.IsEmpty() && !bShuttingDown)
+        {
+            Tasks.push_back(std::move(Task));
+            Task = nullptr;
+        }
+    }
+
+    if (Task)
+    {
+        Task();
+        return;
+    }
+    Condition.notify_one();
+}
+
+void FQueuedThreadPool::WorkerMain()
+{
+    while (true)
+    {
+        std::function<void()> Task;
+        {
+            std::unique_lock Lock(Mutex);
+            Condition.wait(Lock, [this] { return bShuttingDown || !Tasks.empty(); });
+
+            if (Tasks.empty())
+            {
+                // bShuttingDown이면서 남은 작업이 없음
+                return;
+            }
+
+            Task = std::move(Tasks.front());
+            Tasks.pop_front();
+        }
+
+        Task();
+    }
+}
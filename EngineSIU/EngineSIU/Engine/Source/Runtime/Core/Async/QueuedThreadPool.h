@@ -0,0 +1,54 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+
+/**
+ * 작업 큐를 공유하는 워커 스레드 풀
+ *
+ * @note Startup() 전이나 Shutdown() 후에 추가된 작업은 호출한 스레드에서 바로 실행됩니다.
+ */
+class FQueuedThreadPool
+{
+public:
+    static FQueuedThreadPool& Get();
+
+    ~FQueuedThreadPool();
+
+    // 복사 & 이동 생성자 제거
+    FQueuedThreadPool(const FQueuedThreadPool&) = delete;
+    FQueuedThreadPool& operator=(const FQueuedThreadPool&) = delete;
+    FQueuedThreadPool(FQueuedThreadPool&&) = delete;
+    FQueuedThreadPool& operator=(FQueuedThreadPool&&) = delete;
+
+    /**
+     * 워커 스레드를 생성합니다.
+     * @param InNumThreads 워커 스레드 수, 0이면 (논리 코어 수 - 1)개를 생성합니다.
+     */
+    void Startup(uint32 InNumThreads = 0);
+
+    /** 남은 작업을 모두 처리한 뒤 워커 스레드를 종료합니다. */
+    void Shutdown();
+
+    void AddTask(std::function<void()> Task);
+
+    uint32 GetNumThreads() const { return static_cast<uint32>(Threads.Num()); }
+
+private:
+    FQueuedThreadPool() = default;
+
+    void WorkerMain();
+
+private:
+    TArray<std::thread> Threads;
+    std::deque<std::function<void()>> Tasks;
+    std::mutex Mutex;
+    std::condition_variable Condition;
+    bool bShuttingDown = false;
+};
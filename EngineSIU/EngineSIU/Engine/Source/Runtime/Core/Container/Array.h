@@ -75,6 +75,9 @@ public:
 	/** 특정 위치에 있는 요소를 제거합니다. */
     void RemoveAt(SizeType Index);
 
+	/** 특정 위치의 요소를 마지막 요소로 덮어쓰고 제거합니다. 순서가 유지되지 않는 대신 나머지 요소를 옮기지 않습니다. */
+    void RemoveAtSwap(SizeType Index);
+
 	/** Predicate에 부합하는 모든 요소를 제거합니다. */
     template <typename Predicate>
         requires std::is_invocable_r_v<bool, Predicate, const T&>
@@ -261,6 +264,19 @@ void TArray<T, Allocator>::RemoveAt(SizeType Index)
     }
 }
 
+template <typename T, typename Allocator>
+void TArray<T, Allocator>::RemoveAtSwap(SizeType Index)
+{
+    if (Index >= 0 && static_cast<SizeType>(Index) < ContainerPrivate.size())
+    {
+        if (static_cast<SizeType>(Index) != ContainerPrivate.size() - 1)
+        {
+            ContainerPrivate[Index] = std::move(ContainerPrivate.back());
+        }
+        ContainerPrivate.pop_back();
+    }
+}
+
 template <typename T, typename Allocator>
 template <typename Predicate>
     requires std::is_invocable_r_v<bool, Predicate, const T&>
@@ -3,6 +3,7 @@
 
 #include "Core/HAL/PlatformType.h"
 #include "Core/HAL/PlatformMemory.h"
+#include "Core/HAL/FrameArena.h"
 
 
 /**
@@ -93,3 +94,51 @@ constexpr void TContainerAllocator<T, IndexSize>::deallocate(T* p, size_type n)
 
 template <typename T> using FDefaultAllocator = TContainerAllocator<T, 32>;
 template <typename T> using FDefaultAllocator64 = TContainerAllocator<T, 64>;
+
+
+/**
+ * FFrameArena에서 할당하는 Allocator
+ *
+ * 해제는 하지 않으며, 할당한 메모리는 다음 프레임이 끝날 때까지만 유효합니다.
+ * 함수 안의 지역 변수처럼 한 프레임 안에서 만들고 버리는 컨테이너에만 사용해야 합니다.
+ */
+template <typename T, int IndexSize>
+struct TFrameAllocator
+{
+public:
+    using SizeType = typename TBitsToSizeType<IndexSize>::Type;
+
+    //~ std::allocator_traits 관련 타입
+    using value_type = T;
+    using size_type = std::make_unsigned_t<SizeType>;
+    using difference_type = std::make_signed_t<SizeType>;
+    using propagate_on_container_move_assignment = std::true_type;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = TFrameAllocator<U, IndexSize>;
+    };
+    //~ std::allocator_traits 관련 타입
+
+public:
+    constexpr TFrameAllocator() noexcept = default;
+
+    template <class U>
+    constexpr TFrameAllocator(const TFrameAllocator<U, IndexSize>&) noexcept {}
+
+public:
+    T* allocate(size_type n) noexcept
+    {
+        return static_cast<T*>(FFrameArena::Get().Allocate(sizeof(T) * n, alignof(T)));
+    }
+
+    // 프레임이 끝날 때 한꺼번에 해제됨
+    void deallocate(T*, size_type) noexcept {}
+
+    template <class U>
+    constexpr bool operator==(const TFrameAllocator<U, IndexSize>&) const noexcept { return true; }
+};
+
+template <typename T> using FFrameAllocator = TFrameAllocator<T, 32>;
@@ -0,0 +1,357 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <new>
+#include <utility>
+#include <emmintrin.h>
+
+#include "ContainerAllocator.h"
+#include "CoreMiscDefines.h"
+
+
+/**
+ * TFlatMap, TFlatSet이 사용하는 Open Addressing 해시 테이블
+ *
+ * 원소를 노드 없이 한 배열에 저장하고, 슬롯마다 1바이트 제어 값(비었음, 삭제됨, 해시의 상위 7비트)을 따로 둡니다.
+ * 탐색은 제어 값 16개를 SSE2로 한 번에 비교해서 해시가 같은 슬롯만 키를 비교하며, 그룹 단위 이차 탐사를 사용합니다.
+ * 원소를 추가하거나 제거하면 다른 원소의 주소가 바뀔 수 있습니다.
+ *
+ * @tparam KeyFuncs static const KeyType& GetKey(const ElementType&)를 제공하는 타입
+ */
+template <typename ElementType, typename KeyType, typename KeyFuncs, typename Hasher, typename Allocator>
+class TFlatHashTable
+{
+public:
+    using SizeType = typename Allocator::SizeType;
+
+    // 한 번에 비교하는 제어 값 수
+    static constexpr SizeType GroupWidth = 16;
+
+private:
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ElementType>;
+    using CtrlAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<int8>;
+
+    static constexpr int8 CtrlEmpty = -128;
+    static constexpr int8 CtrlDeleted = -2;
+    // 0 이상이면 사용 중이며, 값은 해시의 상위 7비트
+
+    ElementType* Slots = nullptr;
+    int8* Ctrl = nullptr;           // Capacity + GroupWidth개, 마지막 GroupWidth개는 앞쪽 GroupWidth개의 복사본
+    SizeType Capacity = 0;          // 0 또는 GroupWidth 이상의 2의 거듭제곱
+    SizeType NumElements = 0;
+    SizeType NumDeleted = 0;
+
+public:
+    TFlatHashTable() = default;
+
+    ~TFlatHashTable()
+    {
+        DestroyAndFree();
+    }
+
+    TFlatHashTable(const TFlatHashTable& Other)
+    {
+        CopyFrom(Other);
+    }
+
+    TFlatHashTable(TFlatHashTable&& Other) noexcept
+        : Slots(Other.Slots), Ctrl(Other.Ctrl), Capacity(Other.Capacity), NumElements(Other.NumElements), NumDeleted(Other.NumDeleted)
+    {
+        Other.Slots = nullptr;
+        Other.Ctrl = nullptr;
+        Other.Capacity = Other.NumElements = Other.NumDeleted = 0;
+    }
+
+    TFlatHashTable& operator=(const TFlatHashTable& Other)
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            CopyFrom(Other);
+        }
+        return *this;
+    }
+
+    TFlatHashTable& operator=(TFlatHashTable&& Other) noexcept
+    {
+        if (this != &Other)
+        {
+            DestroyAndFree();
+            Slots = Other.Slots;
+            Ctrl = Other.Ctrl;
+            Capacity = Other.Capacity;
+            NumElements = Other.NumElements;
+            NumDeleted = Other.NumDeleted;
+            Other.Slots = nullptr;
+            Other.Ctrl = nullptr;
+            Other.Capacity = Other.NumElements = Other.NumDeleted = 0;
+        }
+        return *this;
+    }
+
+    SizeType Num() const { return NumElements; }
+    SizeType GetCapacity() const { return Capacity; }
+
+    ElementType& GetElement(SizeType Index) { return Slots[Index]; }
+    const ElementType& GetElement(SizeType Index) const { return Slots[Index]; }
+
+    /** Key가 있는 슬롯의 인덱스, 없으면 INDEX_NONE */
+    SizeType FindIndex(const KeyType& Key) const
+    {
+        if (NumElements == 0)
+        {
+            return INDEX_NONE;
+        }
+
+        const uint64 Hash = HashKey(Key);
+        const __m128i H2 = _mm_set1_epi8(GetH2(Hash));
+        const __m128i Empty = _mm_set1_epi8(CtrlEmpty);
+        const SizeType Mask = Capacity - 1;
+
+        SizeType Pos = static_cast<SizeType>(Hash) & Mask;
+        for (SizeType Step = GroupWidth;; Step += GroupWidth)
+        {
+            const __m128i Group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Ctrl + Pos));
+            for (uint32 Match = _mm_movemask_epi8(_mm_cmpeq_epi8(Group, H2)); Match; Match &= Match - 1)
+            {
+                const SizeType Index = (Pos + std::countr_zero(Match)) & Mask;
+                if (KeyFuncs::GetKey(Slots[Index]) == Key)
+                {
+                    return Index;
+                }
+            }
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(Group, Empty)))
+            {
+                return INDEX_NONE;
+            }
+            Pos = (Pos + Step) & Mask;
+        }
+    }
+
+    /**
+     * Key가 없으면 Args로 원소를 만들어 추가합니다.
+     * Args로 만든 원소의 키는 Key와 같아야 하며, Args는 Key를 참조해도 됩니다.
+     * @return 원소의 인덱스와 새로 추가했는지 여부
+     */
+    template <typename... ArgTypes>
+    std::pair<SizeType, bool> FindOrEmplace(const KeyType& Key, ArgTypes&&... Args)
+    {
+        const SizeType Existing = FindIndex(Key);
+        if (Existing != INDEX_NONE)
+        {
+            return { Existing, false };
+        }
+
+        // 최대 7/8까지 채우며, 삭제된 슬롯이 많아서 넘친 경우에는 크기를 유지한 채 다시 배치
+        if (Capacity == 0 || (NumElements + NumDeleted + 1) > Capacity / 8 * 7)
+        {
+            const bool bGrow = Capacity == 0 || (NumElements + 1) > Capacity / 16 * 7;
+            Rehash(bGrow ? std::max<SizeType>(Capacity * 2, GroupWidth) : Capacity);
+        }
+
+        const uint64 Hash = HashKey(Key);
+        const SizeType Index = FindFreeSlot(Hash);
+        if (Ctrl[Index] == CtrlDeleted)
+        {
+            --NumDeleted;
+        }
+        ::new (static_cast<void*>(Slots + Index)) ElementType(std::forward<ArgTypes>(Args)...);
+        SetCtrl(Index, GetH2(Hash));
+        ++NumElements;
+        return { Index, true };
+    }
+
+    void RemoveAt(SizeType Index)
+    {
+        std::destroy_at(Slots + Index);
+        SetCtrl(Index, CtrlDeleted);
+        --NumElements;
+        ++NumDeleted;
+    }
+
+    bool Remove(const KeyType& Key)
+    {
+        const SizeType Index = FindIndex(Key);
+        if (Index == INDEX_NONE)
+        {
+            return false;
+        }
+        RemoveAt(Index);
+        return true;
+    }
+
+    /** 모든 원소를 제거합니다. 할당한 메모리는 유지합니다. */
+    void Empty()
+    {
+        DestroyElements();
+        if (Capacity > 0)
+        {
+            std::fill_n(Ctrl, Capacity + GroupWidth, CtrlEmpty);
+        }
+        NumElements = 0;
+        NumDeleted = 0;
+    }
+
+    /** Number개를 다시 배치하지 않고 추가할 수 있도록 공간을 확보합니다. */
+    void Reserve(SizeType Number)
+    {
+        SizeType NewCapacity = GroupWidth;
+        while (NewCapacity / 8 * 7 < Number)
+        {
+            NewCapacity *= 2;
+        }
+        if (NewCapacity > Capacity)
+        {
+            Rehash(NewCapacity);
+        }
+    }
+
+    /** Index 다음의 사용 중인 슬롯, 없으면 Capacity */
+    SizeType NextIndex(SizeType Index) const
+    {
+        // 제어 값 16개씩 보면서 사용 중(0 이상)인 슬롯을 찾음, 끝의 복사본은 범위 검사로 제외
+        for (++Index; Index < Capacity; Index += GroupWidth)
+        {
+            const __m128i Group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Ctrl + Index));
+            const uint32 Full = ~static_cast<uint32>(_mm_movemask_epi8(Group)) & 0xFFFF;
+            if (Full)
+            {
+                const SizeType Found = Index + std::countr_zero(Full);
+                return Found < Capacity ? Found : Capacity;
+            }
+        }
+        return Capacity;
+    }
+
+    SizeType FirstIndex() const
+    {
+        return Capacity > 0 ? NextIndex(static_cast<SizeType>(-1)) : 0;
+    }
+
+private:
+    static uint64 HashKey(const KeyType& Key)
+    {
+        // std::hash가 정수를 그대로 반환하는 경우에도 모든 비트가 섞이도록 곱한 뒤 상위 비트를 내림
+        uint64 Hash = static_cast<uint64>(Hasher()(Key)) * 0x9E3779B97F4A7C15ull;
+        Hash ^= Hash >> 29;
+        return Hash;
+    }
+
+    static int8 GetH2(uint64 Hash)
+    {
+        return static_cast<int8>(Hash >> 57);
+    }
+
+    void SetCtrl(SizeType Index, int8 Value)
+    {
+        Ctrl[Index] = Value;
+        if (Index < GroupWidth)
+        {
+            Ctrl[Capacity + Index] = Value;
+        }
+    }
+
+    /** 비었거나 삭제된 첫 슬롯을 찾습니다. 테이블에 빈 슬롯이 반드시 있어야 합니다. */
+    SizeType FindFreeSlot(uint64 Hash) const
+    {
+        const SizeType Mask = Capacity - 1;
+        SizeType Pos = static_cast<SizeType>(Hash) & Mask;
+        for (SizeType Step = GroupWidth;; Step += GroupWidth)
+        {
+            const __m128i Group = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Ctrl + Pos));
+            // 비었음과 삭제됨은 음수라서 부호 비트만 보면 됨
+            if (const uint32 Free = _mm_movemask_epi8(Group))
+            {
+                return (Pos + std::countr_zero(Free)) & Mask;
+            }
+            Pos = (Pos + Step) & Mask;
+        }
+    }
+
+    void Rehash(SizeType NewCapacity)
+    {
+        ElementType* OldSlots = Slots;
+        int8* OldCtrl = Ctrl;
+        const SizeType OldCapacity = Capacity;
+
+        SlotAllocator SlotAlloc;
+        CtrlAllocator CtrlAlloc;
+        Slots = SlotAlloc.allocate(NewCapacity);
+        Ctrl = CtrlAlloc.allocate(NewCapacity + GroupWidth);
+        Capacity = NewCapacity;
+        NumDeleted = 0;
+        std::fill_n(Ctrl, NewCapacity + GroupWidth, CtrlEmpty);
+
+        for (SizeType Index = 0; Index < OldCapacity; ++Index)
+        {
+            if (OldCtrl[Index] >= 0)
+            {
+                ElementType& Element = OldSlots[Index];
+                const uint64 Hash = HashKey(KeyFuncs::GetKey(Element));
+                const SizeType NewIndex = FindFreeSlot(Hash);
+                ::new (static_cast<void*>(Slots + NewIndex)) ElementType(std::move(Element));
+                std::destroy_at(&Element);
+                SetCtrl(NewIndex, GetH2(Hash));
+            }
+        }
+
+        if (OldCapacity > 0)
+        {
+            SlotAlloc.deallocate(OldSlots, OldCapacity);
+            CtrlAlloc.deallocate(OldCtrl, OldCapacity + GroupWidth);
+        }
+    }
+
+    void CopyFrom(const TFlatHashTable& Other)
+    {
+        if (Other.NumElements == 0)
+        {
+            return;
+        }
+
+        SlotAllocator SlotAlloc;
+        CtrlAllocator CtrlAlloc;
+        Slots = SlotAlloc.allocate(Other.Capacity);
+        Ctrl = CtrlAlloc.allocate(Other.Capacity + GroupWidth);
+        Capacity = Other.Capacity;
+        NumElements = Other.NumElements;
+        NumDeleted = Other.NumDeleted;
+        std::copy_n(Other.Ctrl, Capacity + GroupWidth, Ctrl);
+
+        for (SizeType Index = 0; Index < Capacity; ++Index)
+        {
+            if (Ctrl[Index] >= 0)
+            {
+                ::new (static_cast<void*>(Slots + Index)) ElementType(Other.Slots[Index]);
+            }
+        }
+    }
+
+    void DestroyElements()
+    {
+        if constexpr (!std::is_trivially_destructible_v<ElementType>)
+        {
+            for (SizeType Index = 0; Index < Capacity && NumElements > 0; ++Index)
+            {
+                if (Ctrl[Index] >= 0)
+                {
+                    std::destroy_at(Slots + Index);
+                }
+            }
+        }
+    }
+
+    void DestroyAndFree()
+    {
+        DestroyElements();
+        if (Capacity > 0)
+        {
+            SlotAllocator().deallocate(Slots, Capacity);
+            CtrlAllocator().deallocate(Ctrl, Capacity + GroupWidth);
+        }
+        Slots = nullptr;
+        Ctrl = nullptr;
+        Capacity = NumElements = NumDeleted = 0;
+    }
+};
@@ -0,0 +1,218 @@
+#pragma once
+#include <stdexcept>
+
+#include "FlatHashTable.h"
+#include "Pair.h"
+#include "Serialization/Archive.h"
+
+
+/**
+ * TMap과 같은 인터페이스를 가진 Open Addressing 해시 맵
+ *
+ * 원소마다 노드를 할당하지 않고 한 배열에 저장하므로 추가할 때 할당이 적고, 조회와 순회가 메모리를 덜 건너뜁니다.
+ * 대신 원소를 추가하거나 제거하면 다른 원소의 주소가 바뀔 수 있으므로, Find로 얻은 포인터를 오래 들고 있으면 안 됩니다.
+ */
+template <typename KeyType, typename ValueType, typename Allocator = FDefaultAllocator<TPair<KeyType, ValueType>>>
+class TFlatMap
+{
+public:
+    using PairType = TPair<const KeyType, ValueType>;
+
+private:
+    // 다시 배치할 때 키를 이동할 수 있도록 const가 아닌 키로 저장하고, 밖으로는 PairType으로 보여줌
+    using StoredPairType = TPair<KeyType, ValueType>;
+
+    struct FKeyFuncs
+    {
+        static const KeyType& GetKey(const StoredPairType& Pair) { return Pair.Key; }
+    };
+
+    using TableType = TFlatHashTable<StoredPairType, KeyType, FKeyFuncs, std::hash<KeyType>, Allocator>;
+
+    TableType Table;
+
+public:
+    using SizeType = typename TableType::SizeType;
+
+    class Iterator
+    {
+    private:
+        TableType* Table;
+        SizeType Index;
+    public:
+        Iterator(TableType* InTable, SizeType InIndex) : Table(InTable), Index(InIndex) {}
+        PairType& operator*() { return reinterpret_cast<PairType&>(Table->GetElement(Index)); }
+        PairType* operator->() { return reinterpret_cast<PairType*>(&Table->GetElement(Index)); }
+        Iterator& operator++() { Index = Table->NextIndex(Index); return *this; }
+        bool operator!=(const Iterator& other) const { return Index != other.Index; }
+    };
+
+    class ConstIterator
+    {
+    private:
+        const TableType* Table;
+        SizeType Index;
+    public:
+        ConstIterator(const TableType* InTable, SizeType InIndex) : Table(InTable), Index(InIndex) {}
+        const PairType& operator*() const { return reinterpret_cast<const PairType&>(Table->GetElement(Index)); }
+        const PairType* operator->() const { return reinterpret_cast<const PairType*>(&Table->GetElement(Index)); }
+        ConstIterator& operator++() { Index = Table->NextIndex(Index); return *this; }
+        bool operator!=(const ConstIterator& other) const { return Index != other.Index; }
+    };
+
+public:
+    // TPair를 반환하는 커스텀 반복자
+    Iterator begin() noexcept { return Iterator(&Table, Table.FirstIndex()); }
+    Iterator end() noexcept { return Iterator(&Table, Table.GetCapacity()); }
+    ConstIterator begin() const noexcept { return ConstIterator(&Table, Table.FirstIndex()); }
+    ConstIterator end() const noexcept { return ConstIterator(&Table, Table.GetCapacity()); }
+
+    TFlatMap() = default;
+    ~TFlatMap() = default;
+
+    TFlatMap(const TFlatMap& Other) = default;
+    TFlatMap(TFlatMap&& Other) noexcept = default;
+    TFlatMap& operator=(const TFlatMap& Other) = default;
+    TFlatMap& operator=(TFlatMap&& Other) noexcept = default;
+
+    // 요소 접근 및 수정
+    ValueType& operator[](const KeyType& Key)
+    {
+        return FindOrAdd(Key);
+    }
+
+    const ValueType& operator[](const KeyType& Key) const
+    {
+        const ValueType* Value = Find(Key);
+        if (Value == nullptr)
+        {
+            throw std::out_of_range("TFlatMap: key not found");
+        }
+        return *Value;
+    }
+
+    /** Key가 이미 있으면 값을 Value로 바꿉니다. */
+    void Add(const KeyType& Key, const ValueType& Value)
+    {
+        const auto [Index, bAdded] = Table.FindOrEmplace(Key, Key, Value);
+        if (!bAdded)
+        {
+            Table.GetElement(Index).Value = Value;
+        }
+    }
+
+    /**
+     * Map에 새로운 Key-Value를 삽입합니다. 이미 있는 Key면 기존 값을 유지합니다.
+     * @param InKey 삽입할 키
+     * @param InValue 삽입할 값
+     * @return Key에 해당하는 값의 참조
+     */
+    template <typename InitKeyType = KeyType, typename InitValueType = ValueType>
+    ValueType& Emplace(InitKeyType&& InKey, InitValueType&& InValue)
+    {
+        KeyType Key(std::forward<InitKeyType>(InKey));
+        const SizeType Index = Table.FindOrEmplace(Key, std::move(Key), ValueType(std::forward<InitValueType>(InValue))).first;
+        return Table.GetElement(Index).Value;
+    }
+
+    // Key만 넣고, Value는 기본값으로 삽입
+    template <typename InitKeyType = KeyType>
+    ValueType& Emplace(InitKeyType&& InKey)
+    {
+        return Emplace(std::forward<InitKeyType>(InKey), ValueType{});
+    }
+
+    void Remove(const KeyType& Key)
+    {
+        Table.Remove(Key);
+    }
+
+    void Empty()
+    {
+        Table.Empty();
+    }
+
+    void Empty(SizeType Number)
+    {
+        Table.Empty();
+        Table.Reserve(Number);
+    }
+
+    // 검색 및 조회
+    bool Contains(const KeyType& Key) const
+    {
+        return Table.FindIndex(Key) != INDEX_NONE;
+    }
+
+    const ValueType* Find(const KeyType& Key) const
+    {
+        const SizeType Index = Table.FindIndex(Key);
+        return Index != INDEX_NONE ? &Table.GetElement(Index).Value : nullptr;
+    }
+
+    ValueType* Find(const KeyType& Key)
+    {
+        const SizeType Index = Table.FindIndex(Key);
+        return Index != INDEX_NONE ? &Table.GetElement(Index).Value : nullptr;
+    }
+
+    ValueType& FindOrAdd(const KeyType& Key)
+    {
+        const SizeType Index = Table.FindOrEmplace(Key, Key, ValueType{}).first;
+        return Table.GetElement(Index).Value;
+    }
+
+    // 크기 관련
+    SizeType Num() const
+    {
+        return Table.Num();
+    }
+
+    bool IsEmpty() const
+    {
+        return Table.Num() == 0;
+    }
+
+    // 용량 관련
+    void Reserve(SizeType Number)
+    {
+        Table.Reserve(Number);
+    }
+};
+
+template <typename KeyType, typename ValueType, typename Allocator>
+FArchive& operator<<(FArchive& Ar, TFlatMap<KeyType, ValueType, Allocator>& Map)
+{
+    using SizeType = typename TFlatMap<KeyType, ValueType, Allocator>::SizeType;
+
+    // 맵 크기 직렬화
+    SizeType MapSize = Map.Num();
+    Ar << MapSize;
+
+    if (Ar.IsLoading())
+    {
+        // 로드 시 맵 초기화
+        Map.Empty(MapSize);
+
+        for (SizeType i = 0; i < MapSize; ++i)
+        {
+            KeyType TempKey;
+            ValueType TempValue;
+            Ar << TempKey;
+            Ar << TempValue;
+
+            Map.Emplace(std::move(TempKey), std::move(TempValue));
+        }
+    }
+    else
+    {
+        // 맵의 각 키-값 쌍 직렬화
+        for (auto& [Key, Value] : Map)
+        {
+            Ar << const_cast<KeyType&>(Key);
+            Ar << Value;
+        }
+    }
+
+    return Ar;
+}
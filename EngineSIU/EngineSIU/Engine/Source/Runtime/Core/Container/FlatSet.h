@@ -0,0 +1,142 @@
+#pragma once
+#include "Array.h"
+#include "FlatHashTable.h"
+#include "Serialization/Archive.h"
+
+
+/**
+ * TSet과 같은 인터페이스를 가진 Open Addressing 해시 셋
+ *
+ * 원소를 추가하거나 제거하면 다른 원소의 주소와 Index가 바뀔 수 있습니다.
+ */
+template <typename T, typename Hasher = std::hash<T>, typename Allocator = FDefaultAllocator<T>>
+class TFlatSet
+{
+private:
+    using ElementType = T;
+
+    struct FKeyFuncs
+    {
+        static const T& GetKey(const T& Element) { return Element; }
+    };
+
+    using TableType = TFlatHashTable<T, T, FKeyFuncs, Hasher, Allocator>;
+
+    TableType Table;
+
+public:
+    using SizeType = typename TableType::SizeType;
+
+    // 원소를 바꾸면 해시가 달라지므로 const 참조만 제공
+    class ConstIterator
+    {
+    private:
+        const TableType* Table;
+        SizeType Index;
+    public:
+        ConstIterator(const TableType* InTable, SizeType InIndex) : Table(InTable), Index(InIndex) {}
+        const T& operator*() const { return Table->GetElement(Index); }
+        const T* operator->() const { return &Table->GetElement(Index); }
+        ConstIterator& operator++() { Index = Table->NextIndex(Index); return *this; }
+        bool operator==(const ConstIterator& other) const { return Index == other.Index; }
+        bool operator!=(const ConstIterator& other) const { return Index != other.Index; }
+    };
+    using Iterator = ConstIterator;
+
+    // 기본 생성자
+    TFlatSet() = default;
+
+    // Iterator 관련 메서드
+    ConstIterator begin() const noexcept { return ConstIterator(&Table, Table.FirstIndex()); }
+    ConstIterator end() const noexcept { return ConstIterator(&Table, Table.GetCapacity()); }
+
+    // Add
+    int32 Add(const T& Item) { return Emplace(Item); }
+    int32 Add(T&& Item) { return Emplace(std::move(Item)); }
+
+    /**
+     * 값을 새로 만들어 Set에 추가합니다.
+     * @return 새로 추가된 Element의 Index, 이미 존재하는 경우 기존 Element의 Index를 반환
+     */
+    template<typename ArgsType = T>
+    int32 Emplace(ArgsType&& Args)
+    {
+        T Item(std::forward<ArgsType>(Args));
+        return static_cast<int32>(Table.FindOrEmplace(Item, std::move(Item)).first);
+    }
+
+    // Num (개수)
+    SizeType Num() const { return Table.Num(); }
+
+    // Find
+    ConstIterator Find(const T& Item) const
+    {
+        const SizeType Index = Table.FindIndex(Item);
+        return Index != INDEX_NONE ? ConstIterator(&Table, Index) : end();
+    }
+
+    // Contains
+    bool Contains(const T& Item) const { return Table.FindIndex(Item) != INDEX_NONE; }
+
+    // Array (TArray로 반환)
+    TArray<T, Allocator> Array() const
+    {
+        TArray<T, Allocator> Result;
+        Result.Reserve(Num());
+        for (const T& Item : *this)
+        {
+            Result.Add(Item);
+        }
+        return Result;
+    }
+
+    // Remove
+    SizeType Remove(const T& Item) { return Table.Remove(Item) ? 1 : 0; }
+
+    // Empty
+    void Empty() { Table.Empty(); }
+    void Empty(SizeType Number)
+    {
+        Table.Empty();
+        Table.Reserve(Number);
+    }
+
+    // IsEmpty
+    bool IsEmpty() const { return Table.Num() == 0; }
+
+    // 용량 관련
+    void Reserve(SizeType Number) { Table.Reserve(Number); }
+};
+
+template <typename ElementType, typename Hasher, class Allocator>
+FArchive& operator<<(FArchive& Ar, TFlatSet<ElementType, Hasher, Allocator>& Set)
+{
+    using SizeType = typename TFlatSet<ElementType, Hasher, Allocator>::SizeType;
+
+    // 집합 크기 직렬화
+    SizeType SetSize = Set.Num();
+    Ar << SetSize;
+
+    // 집합 요소 직렬화
+    if (Ar.IsLoading())
+    {
+        // 로드 시 집합 초기화
+        Set.Empty(SetSize);
+
+        for (SizeType i = 0; i < SetSize; ++i)
+        {
+            ElementType Temp;
+            Ar << Temp;
+            Set.Emplace(std::move(Temp));
+        }
+    }
+    else
+    {
+        for (const ElementType& Element : Set)
+        {
+            Ar << const_cast<ElementType&>(Element);
+        }
+    }
+
+    return Ar;
+}
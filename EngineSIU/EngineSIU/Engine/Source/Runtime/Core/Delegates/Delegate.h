@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <functional>
 #include "Core/Container/Map.h"
+#include "Core/Container/FlatMap.h"
 
 #define FUNC_DECLARE_DELEGATE(DelegateName, ReturnType, ...) \
 	using DelegateName = TDelegate<ReturnType(__VA_ARGS__)>;
@@ -113,7 +114,7 @@ template <typename ReturnType, typename... ParamTypes>
 class TMulticastDelegate<ReturnType(ParamTypes...)>
 {
 	using FuncType = std::function<ReturnType(ParamTypes...)>;
-	TMap<FDelegateHandle, FuncType> DelegateHandles;
+	TFlatMap<FDelegateHandle, FuncType> DelegateHandles;
 
 public:
 	template <typename FunctorType, typename... Args>
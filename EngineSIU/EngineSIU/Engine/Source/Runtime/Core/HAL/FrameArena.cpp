@@ -0,0 +1,157 @@
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <bit>
+#include <mutex>
+
+#include "Core/HAL/PlatformMemory.h"
+#include "Container/Array.h"
+
+namespace
+{
+struct FOverflowBlock
+{
+    void* Data;
+    size_t Size;
+};
+
+size_t AlignUp(size_t Value, size_t Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+}
+
+struct FFrameArena::FFrameBuffer
+{
+    uint8* Data = nullptr;
+    size_t Capacity = 0;
+    std::atomic<size_t> Offset = 0;
+
+    std::atomic<uint64> AllocatedBytes = 0;
+    std::atomic<uint64> AllocationCount = 0;
+
+    // 버퍼가 부족할 때 힙에서 따로 할당한 블록, OverflowMutex로 보호
+    TArray<FOverflowBlock> OverflowBlocks;
+    size_t OverflowBytes = 0;
+    std::mutex OverflowMutex;
+
+    /** 버퍼를 비웁니다. 지난번 사용량이 버퍼를 넘었으면 다음에는 넘지 않도록 키웁니다. */
+    void Reset()
+    {
+        const size_t Required = std::min(Offset.load(std::memory_order_relaxed), Capacity) + OverflowBytes;
+        if (OverflowBytes > 0 || Data == nullptr)
+        {
+            FPlatformMemory::AlignedFree<EAT_Frame>(Data, Capacity);
+            Capacity = std::bit_ceil(std::max(Required, FFrameArena::MinBufferSize));
+            Data = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Frame>(Capacity, FFrameArena::BufferAlignment));
+        }
+
+        FreeOverflowBlocks();
+    }
+
+    /** 버퍼와 남은 블록을 모두 해제합니다. */
+    void Release()
+    {
+        FreeOverflowBlocks();
+        FPlatformMemory::AlignedFree<EAT_Frame>(Data, Capacity);
+        Data = nullptr;
+        Capacity = 0;
+    }
+
+    void FreeOverflowBlocks()
+    {
+        for (const FOverflowBlock& Block : OverflowBlocks)
+        {
+            FPlatformMemory::AlignedFree<EAT_Frame>(Block.Data, Block.Size);
+        }
+        OverflowBlocks.Empty();
+        OverflowBytes = 0;
+
+        Offset.store(0, std::memory_order_relaxed);
+        AllocatedBytes.store(0, std::memory_order_relaxed);
+        AllocationCount.store(0, std::memory_order_relaxed);
+    }
+};
+
+FFrameArena& FFrameArena::Get()
+{
+    static FFrameArena Instance;
+    return Instance;
+}
+
+FFrameArena::FFrameArena()
+    : FrameBuffers(std::make_unique<FFrameBuffer[]>(2))
+{
+}
+
+FFrameArena::~FFrameArena()
+{
+    ReleaseMemory();
+}
+
+void* FFrameArena::AllocateOverflow(FFrameBuffer& Buffer, size_t Size, size_t Alignment)
+{
+    Alignment = std::max(Alignment, BufferAlignment);
+    void* Data = FPlatformMemory::AlignedMalloc<EAT_Frame>(Size, Alignment);
+
+    std::scoped_lock Lock(Buffer.OverflowMutex);
+    Buffer.OverflowBlocks.Add({ Data, Size });
+    // 다음에 버퍼를 키울 때 정렬로 생기는 빈 공간까지 들어가도록 여유를 둠
+    Buffer.OverflowBytes += Size + Alignment;
+    return Data;
+}
+
+void* FFrameArena::Allocate(size_t Size, size_t Alignment)
+{
+    FFrameBuffer& Buffer = FrameBuffers[CurrentBufferIndex.load(std::memory_order_relaxed)];
+    Size = std::max<size_t>(Size, 1);
+    Buffer.AllocatedBytes.fetch_add(Size, std::memory_order_relaxed);
+    Buffer.AllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    if (Alignment > BufferAlignment)
+    {
+        return AllocateOverflow(Buffer, Size, Alignment);
+    }
+
+    // 버퍼 시작 주소가 BufferAlignment로 정렬되어 있으므로 오프셋만 정렬하면 됨
+    size_t Offset = Buffer.Offset.load(std::memory_order_relaxed);
+    while (true)
+    {
+        const size_t AlignedOffset = AlignUp(Offset, Alignment);
+        const size_t NewOffset = AlignedOffset + Size;
+        if (NewOffset > Buffer.Capacity)
+        {
+            return AllocateOverflow(Buffer, Size, Alignment);
+        }
+        if (Buffer.Offset.compare_exchange_weak(Offset, NewOffset, std::memory_order_relaxed))
+        {
+            return Buffer.Data + AlignedOffset;
+        }
+    }
+}
+
+void FFrameArena::EndFrame()
+{
+    const int32 FinishedIndex = CurrentBufferIndex.load(std::memory_order_relaxed);
+    const FFrameBuffer& Finished = FrameBuffers[FinishedIndex];
+    LastFrameAllocatedBytes = Finished.AllocatedBytes.load(std::memory_order_relaxed);
+    LastFrameAllocationCount = Finished.AllocationCount.load(std::memory_order_relaxed);
+    LastFrameOverflowCount = Finished.OverflowBlocks.Num();
+
+    const uint64 HeapAllocationCalls = FPlatformMemory::GetTotalHeapAllocationCalls();
+    LastFrameHeapAllocationCalls = HeapAllocationCalls - FrameStartHeapAllocationCalls;
+
+    // 두 프레임 전에 쓴 버퍼를 비워서 다음 프레임에 사용
+    const int32 NextIndex = FinishedIndex ^ 1;
+    FrameBuffers[NextIndex].Reset();
+    CurrentBufferIndex.store(NextIndex, std::memory_order_relaxed);
+
+    // 버퍼를 키우면서 생긴 할당은 다음 프레임에 세지 않음
+    FrameStartHeapAllocationCalls = FPlatformMemory::GetTotalHeapAllocationCalls();
+}
+
+void FFrameArena::ReleaseMemory()
+{
+    FrameBuffers[0].Release();
+    FrameBuffers[1].Release();
+}
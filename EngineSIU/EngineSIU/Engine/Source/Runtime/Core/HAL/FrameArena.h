@@ -0,0 +1,70 @@
+#pragma once
+#include <atomic>
+#include <memory>
+
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 한 프레임 동안만 쓰는 데이터를 위한 선형 할당기
+ *
+ * 버퍼 두 개를 번갈아 사용하며, 할당은 현재 버퍼의 오프셋을 밀어 올리기만 하고 개별 해제는 하지 않습니다.
+ * EndFrame에서 다른 버퍼로 바꾸고 그 버퍼를 통째로 비우므로, 프레임 N에 할당한 메모리는 프레임 N + 1이 끝날 때까지 유효합니다.
+ * 버퍼가 부족하면 힙에서 따로 할당하고, 다음에 그 버퍼를 비울 때 그만큼 버퍼를 키웁니다.
+ *
+ * @note 할당은 여러 스레드에서 해도 되지만, EndFrame은 다른 스레드가 할당하지 않을 때 메인 스레드에서 호출해야 합니다.
+ */
+class FFrameArena
+{
+public:
+    // 버퍼 하나의 최소 크기
+    static constexpr size_t MinBufferSize = 64 * 1024;
+
+    // 버퍼의 시작 주소 정렬, 이보다 큰 정렬을 요구하면 힙에서 따로 할당
+    static constexpr size_t BufferAlignment = 64;
+
+    /** 엔진의 프레임 컨테이너(FFrameAllocator)가 사용하는 할당기, 엔진 루프가 프레임마다 EndFrame을 호출합니다. */
+    static FFrameArena& Get();
+
+    FFrameArena();
+    ~FFrameArena();
+
+    // 복사 & 이동 생성자 제거
+    FFrameArena(const FFrameArena&) = delete;
+    FFrameArena& operator=(const FFrameArena&) = delete;
+    FFrameArena(FFrameArena&&) = delete;
+    FFrameArena& operator=(FFrameArena&&) = delete;
+
+    void* Allocate(size_t Size, size_t Alignment);
+
+    /** 프레임이 끝날 때 호출합니다. 이번 프레임의 통계를 남기고 지난 프레임에 쓴 버퍼를 비워 다음 프레임에 사용합니다. */
+    void EndFrame();
+
+    /** 두 버퍼를 모두 해제합니다. 이 할당기로 만든 컨테이너가 남아있지 않아야 합니다. */
+    void ReleaseMemory();
+
+    /** 지난 프레임에 이 할당기에서 할당한 바이트 수와 횟수 */
+    uint64 GetLastFrameAllocatedBytes() const { return LastFrameAllocatedBytes; }
+    uint64 GetLastFrameAllocationCount() const { return LastFrameAllocationCount; }
+
+    /** 지난 프레임에 버퍼가 부족해 힙에서 따로 할당한 횟수 */
+    uint64 GetLastFrameOverflowCount() const { return LastFrameOverflowCount; }
+
+    /** 지난 프레임 동안 FPlatformMemory로 힙에서 할당한 횟수, 다른 스레드나 다른 할당기의 할당도 포함 */
+    uint64 GetLastFrameHeapAllocationCalls() const { return LastFrameHeapAllocationCalls; }
+
+private:
+    struct FFrameBuffer;
+
+    void* AllocateOverflow(FFrameBuffer& Buffer, size_t Size, size_t Alignment);
+
+    // 컨테이너 헤더가 이 헤더를 포함하므로 버퍼는 cpp에서 정의
+    std::unique_ptr<FFrameBuffer[]> FrameBuffers;
+    std::atomic<int32> CurrentBufferIndex = 0;
+
+    uint64 FrameStartHeapAllocationCalls = 0;
+
+    uint64 LastFrameAllocatedBytes = 0;
+    uint64 LastFrameAllocationCount = 0;
+    uint64 LastFrameOverflowCount = 0;
+    uint64 LastFrameHeapAllocationCalls = 0;
+};
@@ -0,0 +1,332 @@
+#include "MallocBinned.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <mutex>
+
+namespace
+{
+// 128까지 16, 256까지 32, 512까지 64, 1024까지 128 단위, 모두 16의 배수라서 블록이 16바이트로 정렬됨
+constexpr uint32 BlockSizes[FMallocBinned::NumSizeClasses] = {
+    16, 32, 48, 64, 80, 96, 112, 128,
+    160, 192, 224, 256,
+    320, 384, 448, 512,
+    640, 768, 896, 1024,
+};
+
+int32 GetSizeClass(size_t Size)
+{
+    if (Size <= 128)
+    {
+        return Size == 0 ? 0 : static_cast<int32>((Size - 1) / 16);
+    }
+    if (Size <= 256)
+    {
+        return 8 + static_cast<int32>((Size - 129) / 32);
+    }
+    if (Size <= 512)
+    {
+        return 12 + static_cast<int32>((Size - 257) / 64);
+    }
+    return 16 + static_cast<int32>((Size - 513) / 128);
+}
+
+// 스레드 캐시가 Bin마다 들고 있을 최대 바이트, 넘치면 절반을 전역 Bin으로 돌려줌
+constexpr uint32 MaxCachedBytesPerClass = 32 * 1024;
+
+uint32 GetMaxCachedBlocks(int32 SizeClass)
+{
+    return std::max<uint32>(MaxCachedBytesPerClass / BlockSizes[SizeClass], 8);
+}
+
+struct FFreeBlock
+{
+    FFreeBlock* Next;
+};
+
+struct FGlobalBin
+{
+    std::mutex Mutex;
+    FFreeBlock* FreeList = nullptr;
+    uint64 NumPages = 0;
+};
+
+FGlobalBin GlobalBins[FMallocBinned::NumSizeClasses];
+
+/**
+ * 스레드마다의 Free List
+ *
+ * 소멸자가 없는 타입이라서 스레드가 끝나는 중이나 정적 객체가 소멸하는 중에도 접근할 수 있습니다.
+ * 통계는 이 스레드만 쓰고 다른 스레드는 읽기만 하므로 원자적 증가 대신 load, store를 사용합니다.
+ */
+struct FThreadCache
+{
+    FFreeBlock* FreeLists[FMallocBinned::NumSizeClasses];
+    uint32 NumFree[FMallocBinned::NumSizeClasses];
+
+    std::atomic<uint64> NumAllocations[FMallocBinned::NumSizeClasses];
+    std::atomic<uint64> NumFrees[FMallocBinned::NumSizeClasses];
+
+    FThreadCache* NextCache;
+    bool bRegistered;
+    bool bDead;             // 스레드가 끝나서 캐시를 비웠으면 true, 이후에는 전역 Bin을 직접 사용
+};
+
+thread_local FThreadCache ThreadCache;
+
+// 살아있는 스레드 캐시 목록과, 끝난 스레드나 캐시 없이 처리한 요청의 통계
+std::mutex CacheListMutex;
+FThreadCache* CacheList = nullptr;
+std::atomic<uint64> RetiredAllocations[FMallocBinned::NumSizeClasses];
+std::atomic<uint64> RetiredFrees[FMallocBinned::NumSizeClasses];
+
+void Increment(std::atomic<uint64>& Counter)
+{
+    Counter.store(Counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+/** 전역 Bin에서 최대 Count개의 블록을 가져옵니다. 남은 블록이 없으면 페이지를 새로 잘라 채웁니다. */
+FFreeBlock* TakeFromGlobal(int32 SizeClass, uint32 Count, uint32& OutNumTaken)
+{
+    FGlobalBin& Bin = GlobalBins[SizeClass];
+    std::scoped_lock Lock(Bin.Mutex);
+
+    if (Bin.FreeList == nullptr)
+    {
+        const uint32 BlockSize = BlockSizes[SizeClass];
+        uint8* Page = static_cast<uint8*>(std::malloc(FMallocBinned::PageSize));
+        if (Page == nullptr)
+        {
+            OutNumTaken = 0;
+            return nullptr;
+        }
+        ++Bin.NumPages;
+
+        // 페이지 앞쪽 블록이 먼저 나가도록 뒤에서부터 연결
+        const uint32 NumBlocks = static_cast<uint32>(FMallocBinned::PageSize / BlockSize);
+        for (uint32 i = NumBlocks; i-- > 0;)
+        {
+            FFreeBlock* Block = reinterpret_cast<FFreeBlock*>(Page + i * BlockSize);
+            Block->Next = Bin.FreeList;
+            Bin.FreeList = Block;
+        }
+    }
+
+    FFreeBlock* Head = Bin.FreeList;
+    FFreeBlock* Tail = Head;
+    uint32 NumTaken = 1;
+    while (NumTaken < Count && Tail->Next)
+    {
+        Tail = Tail->Next;
+        ++NumTaken;
+    }
+    Bin.FreeList = Tail->Next;
+    Tail->Next = nullptr;
+
+    OutNumTaken = NumTaken;
+    return Head;
+}
+
+/** Head부터 Count개가 이어진 블록 목록을 전역 Bin에 돌려줍니다. */
+void ReturnToGlobal(int32 SizeClass, FFreeBlock* Head, uint32 Count)
+{
+    if (Head == nullptr)
+    {
+        return;
+    }
+    FFreeBlock* Tail = Head;
+    for (uint32 i = 1; i < Count; ++i)
+    {
+        Tail = Tail->Next;
+    }
+
+    FGlobalBin& Bin = GlobalBins[SizeClass];
+    std::scoped_lock Lock(Bin.Mutex);
+    Tail->Next = Bin.FreeList;
+    Bin.FreeList = Head;
+}
+
+void UnregisterThreadCache(FThreadCache& Cache);
+
+/** 스레드가 끝날 때 그 스레드의 캐시를 비웁니다. */
+struct FThreadCacheGuard
+{
+    ~FThreadCacheGuard()
+    {
+        UnregisterThreadCache(ThreadCache);
+    }
+};
+
+thread_local FThreadCacheGuard ThreadCacheGuard;
+
+void RegisterThreadCache(FThreadCache& Cache)
+{
+    // Guard는 처음 사용될 때 만들어지므로 주소를 사용해서 이 스레드에 만들어지게 함
+    static_cast<void>(&ThreadCacheGuard);
+
+    std::scoped_lock Lock(CacheListMutex);
+    Cache.NextCache = CacheList;
+    CacheList = &Cache;
+    Cache.bRegistered = true;
+}
+
+void UnregisterThreadCache(FThreadCache& Cache)
+{
+    if (!Cache.bRegistered)
+    {
+        return;
+    }
+
+    for (int32 SizeClass = 0; SizeClass < FMallocBinned::NumSizeClasses; ++SizeClass)
+    {
+        ReturnToGlobal(SizeClass, Cache.FreeLists[SizeClass], Cache.NumFree[SizeClass]);
+        Cache.FreeLists[SizeClass] = nullptr;
+        Cache.NumFree[SizeClass] = 0;
+    }
+
+    std::scoped_lock Lock(CacheListMutex);
+    for (FThreadCache** Link = &CacheList; *Link; Link = &(*Link)->NextCache)
+    {
+        if (*Link == &Cache)
+        {
+            *Link = Cache.NextCache;
+            break;
+        }
+    }
+    for (int32 SizeClass = 0; SizeClass < FMallocBinned::NumSizeClasses; ++SizeClass)
+    {
+        RetiredAllocations[SizeClass].fetch_add(Cache.NumAllocations[SizeClass].load(std::memory_order_relaxed), std::memory_order_relaxed);
+        RetiredFrees[SizeClass].fetch_add(Cache.NumFrees[SizeClass].load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    Cache.bRegistered = false;
+    Cache.bDead = true;
+}
+}
+
+bool FMallocBinned::ReadEnabledFromCommandLine()
+{
+    const char* CommandLine = GetCommandLineA();
+    return CommandLine && std::strstr(CommandLine, "-binnedmalloc") != nullptr;
+}
+
+uint32 FMallocBinned::GetBlockSize(int32 SizeClass)
+{
+    return BlockSizes[SizeClass];
+}
+
+void* FMallocBinned::Malloc(size_t Size)
+{
+    const int32 SizeClass = GetSizeClass(Size);
+    FThreadCache& Cache = ThreadCache;
+
+    if (Cache.bDead)
+    {
+        uint32 NumTaken;
+        FFreeBlock* Block = TakeFromGlobal(SizeClass, 1, NumTaken);
+        RetiredAllocations[SizeClass].fetch_add(1, std::memory_order_relaxed);
+        return Block;
+    }
+    if (!Cache.bRegistered)
+    {
+        RegisterThreadCache(Cache);
+    }
+
+    FFreeBlock* Block = Cache.FreeLists[SizeClass];
+    if (Block == nullptr)
+    {
+        // 캐시 최대치의 절반을 한 번에 가져옴
+        uint32 NumTaken;
+        Block = TakeFromGlobal(SizeClass, std::max<uint32>(GetMaxCachedBlocks(SizeClass) / 2, 1), NumTaken);
+        if (Block == nullptr)
+        {
+            return nullptr;
+        }
+        Cache.NumFree[SizeClass] = NumTaken;
+    }
+
+    Cache.FreeLists[SizeClass] = Block->Next;
+    --Cache.NumFree[SizeClass];
+    Increment(Cache.NumAllocations[SizeClass]);
+    return Block;
+}
+
+void FMallocBinned::Free(void* Address, size_t Size)
+{
+    if (Address == nullptr)
+    {
+        return;
+    }
+
+    const int32 SizeClass = GetSizeClass(Size);
+    FFreeBlock* Block = static_cast<FFreeBlock*>(Address);
+    FThreadCache& Cache = ThreadCache;
+
+    if (Cache.bDead)
+    {
+        ReturnToGlobal(SizeClass, Block, 1);
+        RetiredFrees[SizeClass].fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!Cache.bRegistered)
+    {
+        RegisterThreadCache(Cache);
+    }
+
+    Block->Next = Cache.FreeLists[SizeClass];
+    Cache.FreeLists[SizeClass] = Block;
+    ++Cache.NumFree[SizeClass];
+    Increment(Cache.NumFrees[SizeClass]);
+
+    // 다른 스레드에서 할당한 블록을 계속 해제하는 경우 캐시가 한없이 커지지 않도록 절반을 돌려줌
+    const uint32 MaxCached = GetMaxCachedBlocks(SizeClass);
+    if (Cache.NumFree[SizeClass] > MaxCached)
+    {
+        const uint32 NumToReturn = Cache.NumFree[SizeClass] / 2;
+        FFreeBlock* Head = Cache.FreeLists[SizeClass];
+        FFreeBlock* Tail = Head;
+        for (uint32 i = 1; i < NumToReturn; ++i)
+        {
+            Tail = Tail->Next;
+        }
+        Cache.FreeLists[SizeClass] = Tail->Next;
+        Cache.NumFree[SizeClass] -= NumToReturn;
+        Tail->Next = nullptr;
+        ReturnToGlobal(SizeClass, Head, NumToReturn);
+    }
+}
+
+void FMallocBinned::GetStats(FSizeClassStats* OutStats)
+{
+    uint64 NumAllocations[NumSizeClasses];
+    uint64 NumFrees[NumSizeClasses];
+    for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+    {
+        NumAllocations[SizeClass] = RetiredAllocations[SizeClass].load(std::memory_order_relaxed);
+        NumFrees[SizeClass] = RetiredFrees[SizeClass].load(std::memory_order_relaxed);
+    }
+    {
+        std::scoped_lock Lock(CacheListMutex);
+        for (const FThreadCache* Cache = CacheList; Cache; Cache = Cache->NextCache)
+        {
+            for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+            {
+                NumAllocations[SizeClass] += Cache->NumAllocations[SizeClass].load(std::memory_order_relaxed);
+                NumFrees[SizeClass] += Cache->NumFrees[SizeClass].load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    for (int32 SizeClass = 0; SizeClass < NumSizeClasses; ++SizeClass)
+    {
+        FSizeClassStats& Stats = OutStats[SizeClass];
+        Stats.BlockSize = BlockSizes[SizeClass];
+        Stats.NumAllocations = NumAllocations[SizeClass];
+        // 다른 스레드가 동시에 할당, 해제하면 잠깐 해제 수가 더 클 수 있음
+        Stats.NumLiveBlocks = NumAllocations[SizeClass] > NumFrees[SizeClass] ? NumAllocations[SizeClass] - NumFrees[SizeClass] : 0;
+
+        FGlobalBin& Bin = GlobalBins[SizeClass];
+        std::scoped_lock Lock(Bin.Mutex);
+        Stats.ReservedBytes = Bin.NumPages * PageSize;
+    }
+}
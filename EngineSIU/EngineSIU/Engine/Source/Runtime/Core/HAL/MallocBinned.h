@@ -0,0 +1,51 @@
+#pragma once
+#include "Core/HAL/PlatformType.h"
+
+/**
+ * 작은 블록을 크기별 Bin으로 나눠 할당하는 할당기
+ *
+ * 요청 크기를 16바이트 단위로 올린 Bin마다 64KB 페이지를 같은 크기의 블록으로 잘라 두고,
+ * 스레드마다 Bin별 Free List를 캐시해서 대부분의 할당과 해제를 잠금 없이 처리합니다.
+ * 캐시가 비거나 넘치면 묶음 단위로 전역 Bin과 주고받습니다. 페이지는 프로세스가 끝날 때까지 반환하지 않습니다.
+ *
+ * FPlatformMemory::Malloc, Free는 실행 인자에 -binnedmalloc이 있을 때만 MaxSmallSize 이하의 요청을 이 할당기로 보냅니다.
+ * 해제할 때 할당한 크기를 알려줘야 하므로 블록에 헤더가 없습니다.
+ */
+class FMallocBinned
+{
+public:
+    // 이보다 큰 요청은 시스템 할당기로 보냄
+    static constexpr size_t MaxSmallSize = 1024;
+
+    static constexpr int32 NumSizeClasses = 20;
+    static constexpr size_t PageSize = 64 * 1024;
+
+    struct FSizeClassStats
+    {
+        uint32 BlockSize = 0;
+        uint64 NumLiveBlocks = 0;      // 할당되어 사용 중인 블록
+        uint64 NumAllocations = 0;     // 지금까지 할당한 횟수
+        uint64 ReservedBytes = 0;      // 이 Bin이 예약한 페이지 크기의 합
+    };
+
+    /** 실행 인자에 -binnedmalloc이 있는지를 처음 호출할 때 정하며, 이후에는 바뀌지 않습니다. */
+    static bool IsEnabled()
+    {
+        static const bool bEnabled = ReadEnabledFromCommandLine();
+        return bEnabled;
+    }
+
+    /** Size는 MaxSmallSize 이하여야 합니다. 반환하는 주소는 16바이트로 정렬되어 있습니다. */
+    static void* Malloc(size_t Size);
+
+    /** Malloc에 전달한 것과 같은 Size를 전달해야 합니다. */
+    static void Free(void* Address, size_t Size);
+
+    static uint32 GetBlockSize(int32 SizeClass);
+
+    /** Bin마다의 통계를 OutStats에 채웁니다. OutStats는 NumSizeClasses개의 원소를 가져야 합니다. */
+    static void GetStats(FSizeClassStats* OutStats);
+
+private:
+    static bool ReadEnabledFromCommandLine();
+};
@@ -0,0 +1,74 @@
+#include "MemoryMappedFile.h"
+
+
+FMemoryMappedFile::~FMemoryMappedFile()
+{
+    Close();
+}
+
+bool FMemoryMappedFile::Open(const FWString& FilePath)
+{
+    Close();
+
+    FileHandle = CreateFileW(
+        FilePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr
+    );
+    if (FileHandle == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER FileSize;
+    if (!GetFileSizeEx(FileHandle, &FileSize))
+    {
+        Close();
+        return false;
+    }
+
+    Size = static_cast<uint64>(FileSize.QuadPart);
+    if (Size == 0)
+    {
+        // 크기가 0인 파일은 매핑할 수 없으므로 빈 데이터로 취급
+        return true;
+    }
+
+    MappingHandle = CreateFileMappingW(FileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (MappingHandle == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    Data = static_cast<const uint8*>(MapViewOfFile(MappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (Data == nullptr)
+    {
+        Close();
+        return false;
+    }
+
+    return true;
+}
+
+void FMemoryMappedFile::Close()
+{
+    if (Data)
+    {
+        UnmapViewOfFile(Data);
+        Data = nullptr;
+    }
+
+    if (MappingHandle)
+    {
+        CloseHandle(MappingHandle);
+        MappingHandle = nullptr;
+    }
+
+    if (FileHandle != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(FileHandle);
+        FileHandle = INVALID_HANDLE_VALUE;
+    }
+
+    Size = 0;
+}
@@ -0,0 +1,42 @@
+#pragma once
+#include "Core/HAL/PlatformType.h"
+
+
+/**
+ * 파일 전체를 읽기 전용으로 메모리에 매핑하는 클래스
+ *
+ * @note 매핑된 메모리는 Close() 또는 소멸자가 호출되기 전까지 유효합니다.
+ */
+class FMemoryMappedFile
+{
+public:
+    FMemoryMappedFile() = default;
+    ~FMemoryMappedFile();
+
+    // 복사 & 이동 생성자 제거
+    FMemoryMappedFile(const FMemoryMappedFile&) = delete;
+    FMemoryMappedFile& operator=(const FMemoryMappedFile&) = delete;
+    FMemoryMappedFile(FMemoryMappedFile&&) = delete;
+    FMemoryMappedFile& operator=(FMemoryMappedFile&&) = delete;
+
+    /**
+     * 파일을 열고 메모리에 매핑합니다.
+     * @param FilePath 매핑할 파일의 경로
+     * @return 성공 여부, 크기가 0인 파일도 성공으로 처리합니다.
+     */
+    bool Open(const FWString& FilePath);
+
+    /** 매핑을 해제하고 파일을 닫습니다. */
+    void Close();
+
+    bool IsOpen() const { return FileHandle != INVALID_HANDLE_VALUE; }
+
+    const uint8* GetData() const { return Data; }
+    uint64 GetSize() const { return Size; }
+
+private:
+    HANDLE FileHandle = INVALID_HANDLE_VALUE;
+    HANDLE MappingHandle = nullptr;
+    const uint8* Data = nullptr;
+    uint64 Size = 0;
+};
@@ -4,3 +4,6 @@ std::atomic<uint64> FPlatformMemory::ObjectAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ObjectAllocationCount = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationBytes = 0;
 std::atomic<uint64> FPlatformMemory::ContainerAllocationCount = 0;
+std::atomic<uint64> FPlatformMemory::FrameAllocationBytes = 0;
+std::atomic<uint64> FPlatformMemory::FrameAllocationCount = 0;
+std::atomic<uint64> FPlatformMemory::TotalHeapAllocationCalls = 0;
@@ -3,16 +3,20 @@
 #include <iostream>
 
 #include "Core/HAL/PlatformType.h"
+#include "Core/HAL/MallocBinned.h"
 
 enum EAllocationType : uint8
 {
     EAT_Object,
-    EAT_Container
+    EAT_Container,
+    EAT_Frame       // FFrameArena가 힙에서 예약한 블록
 };
 
 /**
  * 엔진의 Heap 메모리의 할당량을 추적하는 클래스
  *
+ * 실행 인자에 -binnedmalloc이 있으면 Malloc, Free의 작은 요청은 FMallocBinned에서 처리합니다.
+ *
  * @note new로 생성한 객체는 추적하지 않습니다.
  */
 struct FPlatformMemory
@@ -22,6 +26,11 @@ private:
     static std::atomic<uint64> ObjectAllocationCount;
     static std::atomic<uint64> ContainerAllocationBytes;
     static std::atomic<uint64> ContainerAllocationCount;
+    static std::atomic<uint64> FrameAllocationBytes;
+    static std::atomic<uint64> FrameAllocationCount;
+
+    // 지금까지 Malloc, AlignedMalloc이 호출된 횟수, 프레임 사이의 차이로 프레임당 힙 할당 수를 구함
+    static std::atomic<uint64> TotalHeapAllocationCalls;
 
     template <EAllocationType AllocType>
     static void IncrementStats(size_t Size);
@@ -55,6 +64,8 @@ public:
 
     template <EAllocationType AllocType>
     static uint64 GetAllocationCount();
+
+    static uint64 GetTotalHeapAllocationCalls() { return TotalHeapAllocationCalls.load(std::memory_order_relaxed); }
 };
 
 
@@ -74,6 +85,11 @@ void FPlatformMemory::IncrementStats(size_t Size)
         ObjectAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_add(1, std::memory_order_relaxed);
     }
+    else if constexpr (AllocType == EAT_Frame)
+    {
+        FrameAllocationBytes.fetch_add(Size, std::memory_order_relaxed);
+        FrameAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    }
     else
     {
         //static_assert(false, "Unknown allocation type");
@@ -97,6 +113,11 @@ void FPlatformMemory::DecrementStats(size_t Size)
         ObjectAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
         ObjectAllocationCount.fetch_sub(1, std::memory_order_relaxed);
     }
+    else if constexpr (AllocType == EAT_Frame)
+    {
+        FrameAllocationBytes.fetch_sub(Size, std::memory_order_relaxed);
+        FrameAllocationCount.fetch_sub(1, std::memory_order_relaxed);
+    }
     else
     {
         //static_assert(false, "Unknown allocation type");
@@ -112,10 +133,11 @@ void FPlatformMemory::Memcpy(T& Dest, const T& Src)
 template <EAllocationType AllocType>
 void* FPlatformMemory::Malloc(size_t Size)
 {
-    void* Ptr = std::malloc(Size);
+    void* Ptr = (Size <= FMallocBinned::MaxSmallSize && FMallocBinned::IsEnabled()) ? FMallocBinned::Malloc(Size) : std::malloc(Size);
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
+        TotalHeapAllocationCalls.fetch_add(1, std::memory_order_relaxed);
     }
     return Ptr;
 }
@@ -127,6 +149,7 @@ void* FPlatformMemory::AlignedMalloc(size_t Size, size_t Alignment)
     if (Ptr)
     {
         IncrementStats<AllocType>(Size);
+        TotalHeapAllocationCalls.fetch_add(1, std::memory_order_relaxed);
     }
     return Ptr;
 }
@@ -137,7 +160,14 @@ void FPlatformMemory::Free(void* Address, size_t Size)
     if (Address)
     {
         DecrementStats<AllocType>(Size);
-        std::free(Address);
+        if (Size <= FMallocBinned::MaxSmallSize && FMallocBinned::IsEnabled())
+        {
+            FMallocBinned::Free(Address, Size);
+        }
+        else
+        {
+            std::free(Address);
+        }
     }
 }
 
@@ -162,6 +192,10 @@ uint64 FPlatformMemory::GetAllocationBytes()
     {
         return ObjectAllocationBytes;
     }
+    else if constexpr (AllocType == EAT_Frame)
+    {
+        return FrameAllocationBytes;
+    }
     else
     {
         //static_assert(false, "Unknown AllocationType");
@@ -180,6 +214,10 @@ uint64 FPlatformMemory::GetAllocationCount()
     {
         return ObjectAllocationCount;
     }
+    else if constexpr (AllocType == EAT_Frame)
+    {
+        return FrameAllocationCount;
+    }
     else
     {
         //static_assert(false, "Unknown AllocationType");
@@ -0,0 +1,105 @@
+#include "XxHash.h"
+#include <bit>
+#include <cstring>
+
+
+namespace
+{
+    constexpr uint64 Prime1 = 11400714785074694791ull;
+    constexpr uint64 Prime2 = 14029467366897019727ull;
+    constexpr uint64 Prime3 = 1609587929392839161ull;
+    constexpr uint64 Prime4 = 9650029242287828579ull;
+    constexpr uint64 Prime5 = 2870177450012600261ull;
+
+    FORCEINLINE uint64 Read64(const uint8* Ptr)
+    {
+        uint64 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    FORCEINLINE uint32 Read32(const uint8* Ptr)
+    {
+        uint32 Value;
+        std::memcpy(&Value, Ptr, sizeof(Value));
+        return Value;
+    }
+
+    FORCEINLINE uint64 Round(uint64 Acc, uint64 Input)
+    {
+        Acc += Input * Prime2;
+        Acc = std::rotl(Acc, 31);
+        return Acc * Prime1;
+    }
+
+    FORCEINLINE uint64 MergeRound(uint64 Acc, uint64 Value)
+    {
+        Acc ^= Round(0, Value);
+        return Acc * Prime1 + Prime4;
+    }
+}
+
+uint64 FXxHash64::HashBuffer(const void* Data, uint64 Size, uint64 Seed)
+{
+    const uint8* Ptr = static_cast<const uint8*>(Data);
+    const uint8* const End = Ptr + Size;
+    uint64 Hash;
+
+    if (Size >= 32)
+    {
+        uint64 V1 = Seed + Prime1 + Prime2;
+        uint64 V2 = Seed + Prime2;
+        uint64 V3 = Seed;
+        uint64 V4 = Seed - Prime1;
+
+        const uint8* const Limit = End - 32;
+        do
+        {
+            V1 = Round(V1, Read64(Ptr));
+            V2 = Round(V2, Read64(Ptr + 8));
+            V3 = Round(V3, Read64(Ptr + 16));
+            V4 = Round(V4, Read64(Ptr + 24));
+            Ptr += 32;
+        } while (Ptr <= Limit);
+
+        Hash = std::rotl(V1, 1) + std::rotl(V2, 7) + std::rotl(V3, 12) + std::rotl(V4, 18);
+        Hash = MergeRound(Hash, V1);
+        Hash = MergeRound(Hash, V2);
+        Hash = MergeRound(Hash, V3);
+        Hash = MergeRound(Hash, V4);
+    }
+    else
+    {
+        Hash = Seed + Prime5;
+    }
+
+    Hash += Size;
+
+    while (Ptr + 8 <= End)
+    {
+        Hash ^= Round(0, Read64(Ptr));
+        Hash = std::rotl(Hash, 27) * Prime1 + Prime4;
+        Ptr += 8;
+    }
+
+    if (Ptr + 4 <= End)
+    {
+        Hash ^= static_cast<uint64>(Read32(Ptr)) * Prime1;
+        Hash = std::rotl(Hash, 23) * Prime2 + Prime3;
+        Ptr += 4;
+    }
+
+    while (Ptr < End)
+    {
+        Hash ^= static_cast<uint64>(*Ptr) * Prime5;
+        Hash = std::rotl(Hash, 11) * Prime1;
+        ++Ptr;
+    }
+
+    Hash ^= Hash >> 33;
+    Hash *= Prime2;
+    Hash ^= Hash >> 29;
+    Hash *= Prime3;
+    Hash ^= Hash >> 32;
+    return Hash;
+}
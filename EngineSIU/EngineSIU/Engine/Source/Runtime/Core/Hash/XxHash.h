@@ -0,0 +1,12 @@
+#pragma once
+#include "HAL/PlatformType.h"
+
+
+/**
+ * xxHash64 구현
+ * 캐시 파일의 체크섬이나 파일 내용 비교처럼, 암호학적 안전성은 필요 없지만 빠른 64비트 해시가 필요할 때 사용합니다.
+ */
+struct FXxHash64
+{
+    static uint64 HashBuffer(const void* Data, uint64 Size, uint64 Seed = 0);
+};
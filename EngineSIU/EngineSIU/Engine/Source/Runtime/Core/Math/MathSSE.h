@@ -54,6 +54,67 @@ FORCEINLINE VectorRegister4Float VectorMultiplyAdd(
     return VectorAdd(VectorMultiply(Vec1, Vec2), Vec3);
 }
 
+FORCEINLINE VectorRegister4Float VectorSubtract(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_sub_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorDivide(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_div_ps(Vec1, Vec2);
+}
+
+/** 4개의 원소를 모두 Value로 채웁니다. */
+FORCEINLINE VectorRegister4Float VectorSetFloat1(float Value)
+{
+    return _mm_set1_ps(Value);
+}
+
+/** 16바이트 정렬된 주소에서 4개의 float를 읽습니다. */
+FORCEINLINE VectorRegister4Float VectorLoadAligned(const float* Ptr)
+{
+    return _mm_load_ps(Ptr);
+}
+
+FORCEINLINE void VectorStoreAligned(const VectorRegister4Float& Vec, float* Ptr)
+{
+    _mm_store_ps(Ptr, Vec);
+}
+
+FORCEINLINE VectorRegister4Float VectorAbs(const VectorRegister4Float& Vec)
+{
+    return _mm_andnot_ps(_mm_set1_ps(-0.0f), Vec);
+}
+
+/** 원소별로 Vec1 < Vec2이면 모든 비트가 1, 아니면 0 */
+FORCEINLINE VectorRegister4Float VectorCompareLT(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmplt_ps(Vec1, Vec2);
+}
+
+/** 원소별로 Vec1 > Vec2이면 모든 비트가 1, 아니면 0 */
+FORCEINLINE VectorRegister4Float VectorCompareGT(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_cmpgt_ps(Vec1, Vec2);
+}
+
+FORCEINLINE VectorRegister4Float VectorBitwiseOr(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_or_ps(Vec1, Vec2);
+}
+
+/** ~Vec1 & Vec2 */
+FORCEINLINE VectorRegister4Float VectorBitwiseAndNot(const VectorRegister4Float& Vec1, const VectorRegister4Float& Vec2)
+{
+    return _mm_andnot_ps(Vec1, Vec2);
+}
+
+/** 각 원소의 최상위 비트를 모아 4비트 마스크로 만듭니다. */
+FORCEINLINE uint32 VectorMaskBits(const VectorRegister4Float& Vec)
+{
+    return static_cast<uint32>(_mm_movemask_ps(Vec));
+}
+
 inline void VectorMatrixMultiply(FMatrix* Result, const FMatrix* Matrix1, const FMatrix* Matrix2)
 {
     // 레지스터에 값 로드
@@ -0,0 +1,190 @@
+#pragma once
+#include "MathSSE.h"
+#include "Vector.h"
+
+// SSE2를 보장할 수 없는 플랫폼에서는 스칼라 버전을 사용
+#ifndef RAY_TRIANGLE_USE_SSE
+    #if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+        #define RAY_TRIANGLE_USE_SSE 1
+    #else
+        #define RAY_TRIANGLE_USE_SSE 0
+    #endif
+#endif
+
+
+/**
+ * 레이 하나와 한 번에 검사할 삼각형 4개를 SoA로 담는 패킷
+ * 삼각형은 V0와 두 변 Edge1 = V1 - V0, Edge2 = V2 - V0로 저장되며, 채우지 않은 자리는 0이라 어떤 레이와도 교차하지 않습니다.
+ */
+struct alignas(16) FTrianglePacket4
+{
+    static constexpr int32 Width = 4;
+
+    float V0X[Width] = {};
+    float V0Y[Width] = {};
+    float V0Z[Width] = {};
+    float Edge1X[Width] = {};
+    float Edge1Y[Width] = {};
+    float Edge1Z[Width] = {};
+    float Edge2X[Width] = {};
+    float Edge2Y[Width] = {};
+    float Edge2Z[Width] = {};
+
+    void SetTriangle(int32 Lane, const FVector& V0, const FVector& V1, const FVector& V2)
+    {
+        const FVector Edge1 = V1 - V0;
+        const FVector Edge2 = V2 - V0;
+        V0X[Lane] = V0.X;
+        V0Y[Lane] = V0.Y;
+        V0Z[Lane] = V0.Z;
+        Edge1X[Lane] = Edge1.X;
+        Edge1Y[Lane] = Edge1.Y;
+        Edge1Z[Lane] = Edge1.Z;
+        Edge2X[Lane] = Edge2.X;
+        Edge2Y[Lane] = Edge2.Y;
+        Edge2Z[Lane] = Edge2.Z;
+    }
+};
+
+
+/** 여러 패킷을 검사할 때 매번 복제하지 않도록 레이를 미리 4개 레인에 복제해 둔 것 */
+struct FRay4
+{
+    FRay4(const FVector& InOrigin, const FVector& InDirection)
+        : Origin(InOrigin)
+        , Direction(InDirection)
+#if RAY_TRIANGLE_USE_SSE
+        , OriginX(SSE::VectorSetFloat1(InOrigin.X))
+        , OriginY(SSE::VectorSetFloat1(InOrigin.Y))
+        , OriginZ(SSE::VectorSetFloat1(InOrigin.Z))
+        , DirectionX(SSE::VectorSetFloat1(InDirection.X))
+        , DirectionY(SSE::VectorSetFloat1(InDirection.Y))
+        , DirectionZ(SSE::VectorSetFloat1(InDirection.Z))
+#endif
+    {
+    }
+
+    FVector Origin;
+    FVector Direction;
+
+#if RAY_TRIANGLE_USE_SSE
+    VectorRegister4Float OriginX, OriginY, OriginZ;
+    VectorRegister4Float DirectionX, DirectionY, DirectionZ;
+#endif
+};
+
+
+/**
+ * 레이 하나와 삼각형 4개의 Möller-Trumbore 교차 검사
+ *
+ * UPrimitiveComponent::IntersectRayTriangle과 같은 순서로 연산하므로 레인마다 같은 결과(교차 여부, 거리)를 냅니다.
+ * 반환값의 i번째 비트가 1이면 i번째 삼각형과 교차하며, 그 거리가 OutDistances[i]에 들어갑니다.
+ */
+namespace RayTriangle
+{
+constexpr float Epsilon = 1e-6f;
+
+FORCEINLINE uint32 IntersectPacketScalar(const FRay4& Ray, const FTrianglePacket4& Packet, float OutDistances[FTrianglePacket4::Width])
+{
+    const FVector& Origin = Ray.Origin;
+    const FVector& Direction = Ray.Direction;
+
+    uint32 HitMask = 0;
+    for (int32 Lane = 0; Lane < FTrianglePacket4::Width; ++Lane)
+    {
+        const FVector Edge1(Packet.Edge1X[Lane], Packet.Edge1Y[Lane], Packet.Edge1Z[Lane]);
+        const FVector Edge2(Packet.Edge2X[Lane], Packet.Edge2Y[Lane], Packet.Edge2Z[Lane]);
+
+        const FVector H = Direction.Cross(Edge2);
+        const float A = Edge1.Dot(H);
+        if (fabs(A) < Epsilon)
+        {
+            continue;
+        }
+
+        const float F = 1.0f / A;
+        const FVector S = Origin - FVector(Packet.V0X[Lane], Packet.V0Y[Lane], Packet.V0Z[Lane]);
+        const float U = F * S.Dot(H);
+        if (U < 0.0f || U > 1.0f)
+        {
+            continue;
+        }
+
+        const FVector Q = S.Cross(Edge1);
+        const float V = F * Direction.Dot(Q);
+        if (V < 0.0f || (U + V) > 1.0f)
+        {
+            continue;
+        }
+
+        const float T = F * Edge2.Dot(Q);
+        if (T > Epsilon)
+        {
+            OutDistances[Lane] = T;
+            HitMask |= 1u << Lane;
+        }
+    }
+    return HitMask;
+}
+
+#if RAY_TRIANGLE_USE_SSE
+/** @param OutDistances 16바이트 정렬된 배열 */
+FORCEINLINE uint32 IntersectPacketSSE(const FRay4& Ray, const FTrianglePacket4& Packet, float OutDistances[FTrianglePacket4::Width])
+{
+    using namespace SSE;
+
+    const VectorRegister4Float Edge1X = VectorLoadAligned(Packet.Edge1X);
+    const VectorRegister4Float Edge1Y = VectorLoadAligned(Packet.Edge1Y);
+    const VectorRegister4Float Edge1Z = VectorLoadAligned(Packet.Edge1Z);
+    const VectorRegister4Float Edge2X = VectorLoadAligned(Packet.Edge2X);
+    const VectorRegister4Float Edge2Y = VectorLoadAligned(Packet.Edge2Y);
+    const VectorRegister4Float Edge2Z = VectorLoadAligned(Packet.Edge2Z);
+
+    // H = Direction x Edge2
+    const VectorRegister4Float HX = VectorSubtract(VectorMultiply(Ray.DirectionY, Edge2Z), VectorMultiply(Ray.DirectionZ, Edge2Y));
+    const VectorRegister4Float HY = VectorSubtract(VectorMultiply(Ray.DirectionZ, Edge2X), VectorMultiply(Ray.DirectionX, Edge2Z));
+    const VectorRegister4Float HZ = VectorSubtract(VectorMultiply(Ray.DirectionX, Edge2Y), VectorMultiply(Ray.DirectionY, Edge2X));
+
+    // A = Edge1 . H
+    const VectorRegister4Float A = VectorMultiplyAdd(Edge1Z, HZ, VectorAdd(VectorMultiply(Edge1X, HX), VectorMultiply(Edge1Y, HY)));
+    const VectorRegister4Float F = VectorDivide(VectorSetFloat1(1.0f), A);
+
+    // S = Origin - V0
+    const VectorRegister4Float SX = VectorSubtract(Ray.OriginX, VectorLoadAligned(Packet.V0X));
+    const VectorRegister4Float SY = VectorSubtract(Ray.OriginY, VectorLoadAligned(Packet.V0Y));
+    const VectorRegister4Float SZ = VectorSubtract(Ray.OriginZ, VectorLoadAligned(Packet.V0Z));
+
+    const VectorRegister4Float U = VectorMultiply(F, VectorMultiplyAdd(SZ, HZ, VectorAdd(VectorMultiply(SX, HX), VectorMultiply(SY, HY))));
+
+    // Q = S x Edge1
+    const VectorRegister4Float QX = VectorSubtract(VectorMultiply(SY, Edge1Z), VectorMultiply(SZ, Edge1Y));
+    const VectorRegister4Float QY = VectorSubtract(VectorMultiply(SZ, Edge1X), VectorMultiply(SX, Edge1Z));
+    const VectorRegister4Float QZ = VectorSubtract(VectorMultiply(SX, Edge1Y), VectorMultiply(SY, Edge1X));
+
+    const VectorRegister4Float V = VectorMultiply(F, VectorMultiplyAdd(Ray.DirectionZ, QZ, VectorAdd(VectorMultiply(Ray.DirectionX, QX), VectorMultiply(Ray.DirectionY, QY))));
+    const VectorRegister4Float T = VectorMultiply(F, VectorMultiplyAdd(Edge2Z, QZ, VectorAdd(VectorMultiply(Edge2X, QX), VectorMultiply(Edge2Y, QY))));
+
+    const VectorRegister4Float Zero = VectorSetFloat1(0.0f);
+    const VectorRegister4Float One = VectorSetFloat1(1.0f);
+    const VectorRegister4Float EpsilonVector = VectorSetFloat1(Epsilon);
+
+    VectorRegister4Float Miss = VectorCompareLT(VectorAbs(A), EpsilonVector);
+    Miss = VectorBitwiseOr(Miss, VectorBitwiseOr(VectorCompareLT(U, Zero), VectorCompareGT(U, One)));
+    Miss = VectorBitwiseOr(Miss, VectorBitwiseOr(VectorCompareLT(V, Zero), VectorCompareGT(VectorAdd(U, V), One)));
+    const VectorRegister4Float Hit = VectorBitwiseAndNot(Miss, VectorCompareGT(T, EpsilonVector));
+
+    VectorStoreAligned(T, OutDistances);
+    return VectorMaskBits(Hit);
+}
+#endif
+
+/** 가능하면 SSE로, 아니면 스칼라로 검사합니다. OutDistances는 16바이트 정렬되어야 합니다. */
+FORCEINLINE uint32 IntersectPacket(const FRay4& Ray, const FTrianglePacket4& Packet, float OutDistances[FTrianglePacket4::Width])
+{
+#if RAY_TRIANGLE_USE_SSE
+    return IntersectPacketSSE(Ray, Packet, OutDistances);
+#else
+    return IntersectPacketScalar(Ray, Packet, OutDistances);
+#endif
+}
+}
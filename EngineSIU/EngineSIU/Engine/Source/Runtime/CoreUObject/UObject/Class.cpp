@@ -3,6 +3,7 @@
 
 #include "EngineStatics.h"
 #include "UObjectArray.h"
+#include "UObjectHash.h"
 #include "Serialization/Archive.h"
 
 
@@ -17,24 +18,17 @@ UClass::UClass(
     , ClassSize(InClassSize)
     , ClassAlignment(InAlignment)
     , SuperClass(InSuperClass)
+    , ObjectPool(InClassSize, InAlignment)
 {
     NamePrivate = InClassName;
-}
-
-bool UClass::IsChildOf(const UClass* SomeBase) const
-{
-    assert(this);
-    if (!SomeBase) return false;
 
-    // Super의 Super를 반복하면서 
-    for (const UClass* TempClass = this; TempClass; TempClass=TempClass->GetSuperClass())
+    // 부모 클래스의 StaticClass가 먼저 생성되므로 부모의 체인은 이미 완성되어 있음
+    if (SuperClass)
     {
-        if (TempClass == SomeBase)
-        {
-            return true;
-        }
+        ClassBaseChain = SuperClass->ClassBaseChain;
+        ClassDepth = SuperClass->ClassDepth + 1;
     }
-    return false;
+    ClassBaseChain.Add(this);
 }
 
 UObject* UClass::GetDefaultObject() const
@@ -81,6 +75,7 @@ UObject* UClass::CreateDefaultObject()
         ClassDefaultObject->NamePrivate = GetName() + "_CDO";
         ClassDefaultObject->UUID = UEngineStatics::GenUUID();
         GUObjectArray.AddObject(ClassDefaultObject);
+        AddToClassMap(ClassDefaultObject);
     }
     return ClassDefaultObject;
 }
@@ -1,6 +1,9 @@
 #pragma once
+#include <cassert>
 #include <concepts>
 #include "Object.h"
+#include "Container/FlatMap.h"
+#include "ObjectPool.h"
 #include "Property.h"
 
 
@@ -27,17 +30,30 @@ public:
     UClass(UClass&&) = delete;
     UClass& operator=(UClass&&) = delete;
 
-    static TMap<FName, UClass*>& GetClassMap()
+    static TFlatMap<FName, UClass*>& GetClassMap()
     {
-        static TMap<FName, UClass*> ClassMap;
+        static TFlatMap<FName, UClass*> ClassMap;
         return ClassMap;
     }
 
     uint32 GetClassSize() const { return ClassSize; }
     uint32 GetClassAlignment() const { return ClassAlignment; }
 
-    /** SomeBase의 자식 클래스인지 확인합니다. */
-    bool IsChildOf(const UClass* SomeBase) const;
+    /**
+     * SomeBase의 자식 클래스인지 확인합니다.
+     * 부모를 따라 올라가지 않고, SomeBase의 깊이에 있는 조상이 SomeBase인지만 비교합니다.
+     */
+    bool IsChildOf(const UClass* SomeBase) const
+    {
+        assert(this);
+        if (!SomeBase) return false;
+
+        const int32 BaseDepth = SomeBase->ClassDepth;
+        return BaseDepth <= ClassDepth && ClassBaseChain[BaseDepth] == SomeBase;
+    }
+
+    /** 상속 깊이, UObject가 0 */
+    int32 GetClassDepth() const { return ClassDepth; }
 
     template <typename T>
         requires std::derived_from<T, UObject>
@@ -52,6 +68,14 @@ public:
 
     UObject* GetDefaultObject() const;
 
+    /** 이 클래스의 Object 하나를 담을 메모리를 클래스 전용 풀에서 할당합니다. ClassCTOR에서 사용합니다. */
+    void* AllocateObjectMemory() { return ObjectPool.Allocate(); }
+
+    /** AllocateObjectMemory로 할당한 메모리를 반환합니다. 소멸자는 먼저 호출되어 있어야 합니다. */
+    void FreeObjectMemory(void* Memory) { ObjectPool.Free(Memory); }
+
+    const FObjectPool& GetObjectPool() const { return ObjectPool; }
+
     template <typename T>
         requires std::derived_from<T, UObject>
     T* GetDefaultObject() const;
@@ -81,6 +105,12 @@ private:
     UClass* SuperClass = nullptr;
     UObject* ClassDefaultObject = nullptr;
 
+    // ClassBaseChain[i]는 깊이 i에 있는 조상, 마지막 원소는 자기 자신
+    TArray<const UClass*> ClassBaseChain;
+    int32 ClassDepth = 0;
+
+    FObjectPool ObjectPool;
+
     TArray<FProperty> Properties;
 };
 
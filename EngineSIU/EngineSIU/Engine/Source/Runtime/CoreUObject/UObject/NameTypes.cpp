@@ -1,11 +1,16 @@
 #include "NameTypes.h"
 
-#include <assert.h>
+#include <algorithm>
 #include <atomic>
+#include <cstring>
 #include <cwchar>
+#include <memory>
 #include <mutex>
-#include "Core/Container/Map.h"
+#include <type_traits>
+#include "Core/Container/Array.h"
 #include "Core/Container/String.h"
+#include "Core/HAL/PlatformMemory.h"
+#include "UserInterface/Console.h"
 
 
 enum ENameCase : uint8
@@ -33,13 +38,17 @@ struct FNameStringView
 	bool bIsWide;
 
 	bool IsAnsi() const { return !bIsWide; }
+	uint32 GetCharSize() const { return bIsWide ? sizeof(WIDECHAR) : sizeof(ANSICHAR); }
 };
 
 
-/** FName의 Hash값을 담는 클래스, FNameEntry에서 사용 */
+/**
+ * FNameEntry의 위치를 나타내는 Id
+ * 상위 비트는 블록 번호, 하위 BlockOffsetBits 비트는 블록 안에서의 위치(EntryAlignment 단위)
+ */
 struct FNameEntryId
 {
-	uint32 Value = 0;  // 비교 문자열이 있는 해시
+	uint32 Value = 0;
 
 	bool IsNone() const { return !Value; }
 
@@ -67,299 +76,499 @@ struct FNameEntryHeader
 };
 
 
+/** 블록 안에 문자열과 함께 저장되는 Name, 헤더 바로 뒤에 Len개의 문자와 null 문자가 이어짐 */
 struct FNameEntry
 {
-	static constexpr uint32 NAME_SIZE = 256; // FName에 저장될 수 있는 최대 길이
+	static constexpr uint32 NAME_SIZE = 1024; // FName에 저장될 수 있는 최대 길이
 
-	FNameEntryId ComparisonId; // 비교 문자열이 있는 해시
+	FNameEntryId ComparisonId; // 대소문자를 무시했을 때 같은 Name 중 처음 저장된 Entry
 	FNameEntryHeader Header;   // Name의 정보
 
-	union
-	{
-		ANSICHAR AnsiName[NAME_SIZE];
-		WIDECHAR WideName[NAME_SIZE];
-	};
-
-	void StoreName(const ANSICHAR* InName, uint32 Len)
-	{
-		memcpy(AnsiName, InName, sizeof(ANSICHAR) * Len);
-		AnsiName[Len] = '\0';
-	}
+	const ANSICHAR* GetAnsiName() const { return reinterpret_cast<const ANSICHAR*>(this + 1); }
+	const WIDECHAR* GetWideName() const { return reinterpret_cast<const WIDECHAR*>(this + 1); }
 
-	void StoreName(const WIDECHAR* InName, uint32 Len)
+	static uint32 GetSize(const FNameStringView& Name)
 	{
-		memcpy(WideName, InName, sizeof(WIDECHAR) * Len);
-		WideName[Len] = '\0';
+		return static_cast<uint32>(sizeof(FNameEntry) + (Name.Len + 1) * Name.GetCharSize());
 	}
 };
 
 namespace
 {
-template <typename CharType>
-uint32 HashString(const CharType* Str)
+/** 8개의 ANSI 문자 중 'A'~'Z'만 소문자로 바꿉니다. ASCII가 아닌 바이트는 그대로 둡니다. */
+uint64 ToLowerAnsi8(uint64 Word)
 {
-	// djb2 문자열 해싱 알고리즘
-	uint32 Hash = 5381;
-	while (*Str)
-	{
-		Hash = ((Hash << 5) + Hash) + *Str;
-		++Str;
-	}
-	return Hash;
+	constexpr uint64 Ones = 0x0101010101010101ull;
+	const uint64 Heptets = Word & (0x7F * Ones);
+	const uint64 AboveZ = Heptets + (0x7F - 'Z') * Ones; // 'Z'보다 크면 최상위 비트가 켜짐
+	const uint64 AtLeastA = Heptets + (0x80 - 'A') * Ones; // 'A' 이상이면 최상위 비트가 켜짐
+	const uint64 IsUpper = (AtLeastA ^ AboveZ) & ~Word & (0x80 * Ones);
+	return Word | (IsUpper >> 2);
 }
 
-template <typename CharType>
-uint32 HashStringLower(const CharType* Str, uint32 InLen)
+ANSICHAR ToLowerChar(ANSICHAR Char)
+{
+	return (Char >= 'A' && Char <= 'Z') ? static_cast<ANSICHAR>(Char + ('a' - 'A')) : Char;
+}
+
+WIDECHAR ToLowerChar(WIDECHAR Char)
+{
+	return static_cast<WIDECHAR>(towlower(Char));
+}
+
+uint64 MixWord(uint64 Hash, uint64 Word)
+{
+	Hash = (Hash ^ Word) * 0x9E3779B97F4A7C15ull;
+	return Hash ^ (Hash >> 32);
+}
+
+uint32 FinalizeHash(uint64 Hash)
+{
+	Hash ^= Hash >> 33;
+	Hash *= 0xFF51AFD7ED558CCDull;
+	Hash ^= Hash >> 33;
+	return static_cast<uint32>(Hash);
+}
+
+/** 원본 문자열의 Hash와 소문자로 바꾼 문자열의 Hash */
+struct FNameHash
+{
+	uint32 Display;
+	uint32 Comparison;
+};
+
+/**
+ * 문자열을 8바이트씩 읽어서 원본과 소문자 Hash를 한 번에 계산합니다.
+ * ANSI는 8글자를 한 번에 소문자로 바꾸므로 복사본을 만들지 않습니다.
+ */
+FNameHash HashName(const FNameStringView& Name)
 {
-	CharType LowerStr[FNameEntry::NAME_SIZE];
-	if constexpr (std::is_same_v<CharType, wchar_t>)
+	uint64 Display = Name.Len;
+	uint64 Comparison = Name.Len;
+
+	if (Name.IsAnsi())
 	{
-		for (uint32 i = 0; i < InLen; i++)
+		uint32 Index = 0;
+		for (; Index + sizeof(uint64) <= Name.Len; Index += sizeof(uint64))
 		{
-			LowerStr[i] = towlower(Str[i]);
+			uint64 Word;
+			std::memcpy(&Word, Name.Ansi + Index, sizeof(uint64));
+			Display = MixWord(Display, Word);
+			Comparison = MixWord(Comparison, ToLowerAnsi8(Word));
+		}
+		if (Index < Name.Len)
+		{
+			uint64 Word = 0;
+			std::memcpy(&Word, Name.Ansi + Index, Name.Len - Index);
+			Display = MixWord(Display, Word);
+			Comparison = MixWord(Comparison, ToLowerAnsi8(Word));
 		}
-		LowerStr[InLen] = '\0';
 	}
 	else
 	{
-		for (uint32 i = 0; i < InLen; ++i)
+		using UnsignedChar = std::make_unsigned_t<WIDECHAR>;
+		constexpr uint32 CharsPerWord = sizeof(uint64) / sizeof(WIDECHAR);
+		for (uint32 Index = 0; Index < Name.Len; Index += CharsPerWord)
 		{
-			LowerStr[i] = static_cast<CharType>(tolower(Str[i]));
+			uint64 Word = 0;
+			uint64 LowerWord = 0;
+			for (uint32 Offset = 0; Offset < CharsPerWord && Index + Offset < Name.Len; ++Offset)
+			{
+				const WIDECHAR Char = Name.Wide[Index + Offset];
+				const uint32 Shift = Offset * sizeof(WIDECHAR) * 8;
+				Word |= static_cast<uint64>(static_cast<UnsignedChar>(Char)) << Shift;
+				LowerWord |= static_cast<uint64>(static_cast<UnsignedChar>(ToLowerChar(Char))) << Shift;
+			}
+			Display = MixWord(Display, Word);
+			Comparison = MixWord(Comparison, LowerWord);
 		}
-		LowerStr[InLen] = '\0';
 	}
-	return HashString(LowerStr);
-}
 
-template <ENameCase Sensitivity>
-uint32 HashName(FNameStringView InName);
+	return {FinalizeHash(Display), FinalizeHash(Comparison)};
+}
 
-template <>
-uint32 HashName<IgnoreCase>(FNameStringView InName)
+template <typename CharType>
+bool EqualsIgnoreCase(const CharType* A, const CharType* B, uint32 Len)
 {
-	return InName.IsAnsi() ? HashStringLower(InName.Ansi, InName.Len) : HashStringLower(InName.Wide, InName.Len);
+	for (uint32 i = 0; i < Len; ++i)
+	{
+		if (A[i] != B[i] && ToLowerChar(A[i]) != ToLowerChar(B[i]))
+		{
+			return false;
+		}
+	}
+	return true;
 }
 
-template <>
-uint32 HashName<CaseSensitive>(FNameStringView InName)
+template <ENameCase Sensitivity>
+bool EqualsName(const FNameEntry& Entry, const FNameStringView& Name)
 {
-	return InName.IsAnsi() ? HashString(InName.Ansi) : HashString(InName.Wide);
+	if (Entry.Header.Len != Name.Len || (Entry.Header.IsWide != 0) != Name.bIsWide)
+	{
+		return false;
+	}
+
+	if constexpr (Sensitivity == CaseSensitive)
+	{
+		return std::memcmp(Entry.GetAnsiName(), Name.Data, Name.Len * Name.GetCharSize()) == 0;
+	}
+	else
+	{
+		return Name.IsAnsi()
+			? EqualsIgnoreCase(Entry.GetAnsiName(), Name.Ansi, Name.Len)
+			: EqualsIgnoreCase(Entry.GetWideName(), Name.Wide, Name.Len);
+	}
 }
 }
 
 template <ENameCase Sensitivity>
 struct FNameValue
 {
-	explicit FNameValue(FNameStringView InName)
-		: Name(InName)
-		, Hash(HashName<Sensitivity>(InName))
-	{}
-
 	FNameStringView Name;
 	uint32 Hash;
-	FNameEntryId ComparisonId = {};
 };
 
 using FNameComparisonValue = FNameValue<IgnoreCase>;
 using FNameDisplayValue = FNameValue<CaseSensitive>;
 
-/** Open Addressing을 이용한 커스텀 Hash Set 이었는데, Hash 충돌 문제로 사용 못함 */
-#pragma region Deprecated Pool Shard
-#if 0  // NOLINT(readability-avoid-unconditional-preprocessor-if)
-template <ENameCase Sensitivity>
-class FNamePoolShard
+
+/**
+ * FNameEntry를 64KB 블록에 이어서 저장하는 할당기
+ *
+ * 블록은 한 번 할당하면 해제하지 않고, Entry도 저장한 뒤에는 바뀌지 않으므로 Resolve는 잠금 없이 읽습니다.
+ */
+class FNameEntryAllocator
 {
-	template <typename T>
-	using Vec = std::vector<T, FDefaultAllocator<T>>;
+public:
+	static constexpr uint32 EntryAlignment = alignof(FNameEntry);
+	static constexpr uint32 BlockOffsetBits = 14;
+	static constexpr uint32 BlockSize = EntryAlignment << BlockOffsetBits; // 64KB
+	static constexpr uint32 MaxBlocks = 4096;
 
-	// 요소 상태를 나타내는 enum
-	enum class ESlotState : uint8
-	{
-		Empty,    // 비어있는 슬롯
-		Occupied, // 사용 중인 슬롯
-		Deleted   // 삭제된 슬롯
-	};
+	static_assert(sizeof(FNameEntry) + (FNameEntry::NAME_SIZE + 1) * sizeof(WIDECHAR) <= BlockSize);
 
-	// 슬롯 구조체
-	struct FSlot
-	{
-		FNameEntry Value;   // 저장된 값
-		ESlotState State;    // 슬롯의 상태
+private:
+	std::atomic<uint8*> Blocks[MaxBlocks] = {};
 
-		FSlot()
-			: Value()
-			, State(ESlotState::Empty)
-		{
-		}
+	std::mutex Mutex;
+	uint32 CurrentBlock = 0;
+	uint32 CurrentOffset = BlockSize; // 처음 할당할 때 블록을 만들도록 가득 찬 것으로 시작
 
-		bool Used() const
+	std::atomic<uint32> NumEntries = 0;
+	std::atomic<uint64> EntryBytes = 0;
+	std::atomic<uint32> NumBlocks = 0;
+
+public:
+	~FNameEntryAllocator()
+	{
+		for (uint32 Index = 0; Index < NumBlocks.load(std::memory_order_relaxed); ++Index)
 		{
-			return State == ESlotState::Occupied;
+			FPlatformMemory::Free<EAT_Container>(Blocks[Index].load(std::memory_order_relaxed), BlockSize);
 		}
+	}
 
-		void SetValue(const FNameEntry& InValue)
+	/** Name을 복사한 Entry를 만듭니다. ComparisonId는 호출한 쪽에서 채워야 합니다. */
+	FNameEntry& Allocate(const FNameStringView& Name, FNameEntryId& OutId)
+	{
+		const uint32 Size = (FNameEntry::GetSize(Name) + EntryAlignment - 1) & ~(EntryAlignment - 1);
+
+		uint32 BlockIndex;
+		uint32 Offset;
 		{
-			Value = InValue;
-			State = ESlotState::Occupied;
+			std::scoped_lock Lock(Mutex);
+			if (CurrentOffset + Size > BlockSize)
+			{
+				const uint32 NewBlock = NumBlocks.load(std::memory_order_relaxed);
+				if (NewBlock >= MaxBlocks)
+				{
+					UE_LOG(LogLevel::Error, "FName pool is out of blocks (%u)", MaxBlocks);
+					std::abort();
+				}
+				Blocks[NewBlock].store(static_cast<uint8*>(FPlatformMemory::Malloc<EAT_Container>(BlockSize)), std::memory_order_release);
+				NumBlocks.store(NewBlock + 1, std::memory_order_relaxed);
+				CurrentBlock = NewBlock;
+				CurrentOffset = 0;
+			}
+			BlockIndex = CurrentBlock;
+			Offset = CurrentOffset;
+			CurrentOffset += Size;
 		}
-	};
 
-private:
-	mutable Vec<FSlot> Slots;
-	std::atomic<uint32> ElementCount; // 총 요소 개수
-	float MaxLoadFactorValue;        // 최대 부하 계수
+		NumEntries.fetch_add(1, std::memory_order_relaxed);
+		EntryBytes.fetch_add(Size, std::memory_order_relaxed);
+
+		FNameEntry* Entry = reinterpret_cast<FNameEntry*>(Blocks[BlockIndex].load(std::memory_order_relaxed) + Offset);
+		Entry->Header = {
+			.IsWide = Name.bIsWide,
+			.Len = static_cast<uint16>(Name.Len)
+		};
+		uint8* Chars = reinterpret_cast<uint8*>(Entry + 1);
+		std::memcpy(Chars, Name.Data, Name.Len * Name.GetCharSize());
+		std::memset(Chars + Name.Len * Name.GetCharSize(), 0, Name.GetCharSize());
+
+		OutId = {(BlockIndex << BlockOffsetBits) | (Offset / EntryAlignment)};
+		return *Entry;
+	}
+
+	const FNameEntry& Resolve(FNameEntryId Id) const
+	{
+		// Id를 얻었다면 해당 블록은 이미 저장되어 있음
+		const uint8* Block = Blocks[Id.Value >> BlockOffsetBits].load(std::memory_order_acquire);
+		return *reinterpret_cast<const FNameEntry*>(Block + (Id.Value & ((1u << BlockOffsetBits) - 1)) * EntryAlignment);
+	}
+
+	uint32 GetNumEntries() const { return NumEntries.load(std::memory_order_relaxed); }
+	uint64 GetEntryBytes() const { return EntryBytes.load(std::memory_order_relaxed); }
+	uint64 GetReservedBytes() const { return static_cast<uint64>(NumBlocks.load(std::memory_order_relaxed)) * BlockSize; }
+};
+
 
-	mutable std::mutex Mutex;
+/**
+ * Hash의 일부 범위를 맡는 Open Addressing 해시 테이블
+ *
+ * 슬롯은 (Hash << 32) | (Id + 1)을 담는 64비트 값이라서, 찾을 때는 잠금 없이 슬롯을 읽고 Hash가 같은 Entry만 문자열을 비교합니다.
+ * 추가는 Mutex를 잡고 다시 찾은 뒤 슬롯에 씁니다.
+ * 테이블을 키울 때는 새 배열을 다 채운 뒤 바꾸고, 이전 배열은 다른 스레드가 읽고 있을 수 있으므로 풀이 사라질 때 해제합니다.
+ */
+template <ENameCase Sensitivity>
+class FNamePoolShard
+{
+	static constexpr uint32 InitialCapacity = 256;
 
-	// 해시 테이블 리사이징 및 리해싱
-	void Rehash(uint32 NewCapacity)
+	struct FSlotArray
 	{
-		Vec<FSlot> OldSlots = std::move(Slots);
-		Slots.clear();
-		Slots.resize(NewCapacity);
+		uint32 Capacity;
+		std::unique_ptr<std::atomic<uint64>[]> Slots;
 
-		ElementCount = 0;
-		for (const auto& Slot : OldSlots)
+		explicit FSlotArray(uint32 InCapacity)
+			: Capacity(InCapacity)
+			, Slots(new std::atomic<uint64>[InCapacity])
 		{
-			if (Slot.State == ESlotState::Occupied)
+			for (uint32 Index = 0; Index < Capacity; ++Index)
 			{
-				Slots[Slot.Value.ComparisonId.Value & Slots.size()] = Slot;
+				Slots[Index].store(0, std::memory_order_relaxed);
 			}
 		}
-	}
+	};
+
+	std::atomic<FSlotArray*> CurrentSlots;
+
+	std::mutex Mutex;
+	uint32 NumUsed = 0;
+	uint64 SlotBytes = 0;
+	TArray<FSlotArray*> RetiredSlots;
 
 public:
-	FNamePoolShard(int32 InitCapacity = 1024, float InMaxLoadFactor = 0.75f)
-		: Slots(InitCapacity)
-		, ElementCount(0)
-		, MaxLoadFactorValue(InMaxLoadFactor)
+	FNamePoolShard()
+		: CurrentSlots(new FSlotArray(InitialCapacity))
+		, SlotBytes(InitialCapacity * sizeof(uint64))
 	{
 	}
 
-	FSlot& Probe(uint32 InHash) const
+	~FNamePoolShard()
 	{
-		return Slots[InHash & Slots.size()-1];
+		delete CurrentSlots.load(std::memory_order_relaxed);
+		for (FSlotArray* Retired : RetiredSlots)
+		{
+			delete Retired;
+		}
 	}
 
-	FNameEntryId Find(const FNameValue<Sensitivity>& Value) const
+	FNamePoolShard(const FNamePoolShard&) = delete;
+	FNamePoolShard& operator=(const FNamePoolShard&) = delete;
+
+	/** 잠금 없이 찾습니다. 다른 스레드가 추가하고 있는 Name은 못 찾을 수 있습니다. */
+	bool Find(const FNameValue<Sensitivity>& Value, const FNameEntryAllocator& Entries, FNameEntryId& OutId) const
 	{
-		FNameEntryId Result;
+		uint32 EmptyIndex;
+		return Probe(*CurrentSlots.load(std::memory_order_acquire), Value, Entries, OutId, EmptyIndex);
+	}
+
+	/**
+	 * Name을 찾고, 없으면 CreateEntry()가 반환한 Id를 추가합니다.
+	 * CreateEntry는 이 Shard의 Mutex를 잡은 채로 호출됩니다.
+	 */
+	template <typename CreateFuncType>
+	FNameEntryId FindOrAdd(const FNameValue<Sensitivity>& Value, const FNameEntryAllocator& Entries, const CreateFuncType& CreateEntry)
+	{
+		FNameEntryId Id;
+		if (Find(Value, Entries, Id))
 		{
-			std::lock_guard _(Mutex);
+			return Id;
+		}
 
-			const FSlot& Slot = Probe(Value.Hash);
-			Result = Slot.Value.ComparisonId;
+		std::scoped_lock Lock(Mutex);
+
+		// 잠금을 잡기 전에 다른 스레드가 추가했을 수 있음
+		FSlotArray* Slots = CurrentSlots.load(std::memory_order_relaxed);
+		uint32 EmptyIndex;
+		if (Probe(*Slots, Value, Entries, Id, EmptyIndex))
+		{
+			return Id;
 		}
-		return Result;
-	}
 
-	FNameEntryId Insert(const FNameValue<Sensitivity>& Value)
-	{
-		// 부하 계수 확인 및 필요시 리해싱
-		if (ElementCount >= Slots.size() * MaxLoadFactorValue)
+		Id = CreateEntry();
+
+		// 탐사가 짧도록 절반까지만 채움
+		if ((NumUsed + 1) * 2 > Slots->Capacity)
 		{
-			Rehash(Slots.size() * 2);
+			Slots = Grow(*Slots);
+			EmptyIndex = FindEmptySlot(*Slots, Value.Hash);
 		}
+		Slots->Slots[EmptyIndex].store(MakeSlot(Value.Hash, Id), std::memory_order_release);
+		++NumUsed;
+		return Id;
+	}
+
+	uint64 GetSlotBytes()
+	{
+		std::scoped_lock Lock(Mutex);
+		return SlotBytes;
+	}
 
-		std::lock_guard _(Mutex);
-		FSlot& Slot = Probe(Value.Hash);
+private:
+	static uint64 MakeSlot(uint32 Hash, FNameEntryId Id)
+	{
+		// 0은 빈 슬롯이므로 Id에 1을 더해서 저장
+		return (static_cast<uint64>(Hash) << 32) | (static_cast<uint64>(Id.Value) + 1);
+	}
 
-		if (Slot.Used())
+	static bool Probe(const FSlotArray& Slots, const FNameValue<Sensitivity>& Value, const FNameEntryAllocator& Entries, FNameEntryId& OutId, uint32& OutEmptyIndex)
+	{
+		const uint32 Mask = Slots.Capacity - 1;
+		for (uint32 Index = Value.Hash & Mask;; Index = (Index + 1) & Mask)
 		{
-			return Slot.Value.ComparisonId;
+			const uint64 Slot = Slots.Slots[Index].load(std::memory_order_acquire);
+			if (Slot == 0)
+			{
+				OutEmptyIndex = Index;
+				return false;
+			}
+			if (static_cast<uint32>(Slot >> 32) == Value.Hash)
+			{
+				const FNameEntryId Id = {static_cast<uint32>(Slot) - 1};
+				if (EqualsName<Sensitivity>(Entries.Resolve(Id), Value.Name))
+				{
+					OutId = Id;
+					return true;
+				}
+			}
 		}
+	}
 
-		// 요소 삽입
-		FNameEntry Entry;
-		Entry.ComparisonId = Value.ComparisonId;
-		Entry.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
+	static uint32 FindEmptySlot(const FSlotArray& Slots, uint32 Hash)
+	{
+		const uint32 Mask = Slots.Capacity - 1;
+		uint32 Index = Hash & Mask;
+		while (Slots.Slots[Index].load(std::memory_order_relaxed) != 0)
 		{
-			Entry.StoreName(Value.Name.Wide, Value.Name.Len);
+			Index = (Index + 1) & Mask;
 		}
-		else
+		return Index;
+	}
+
+	FSlotArray* Grow(FSlotArray& OldSlots)
+	{
+		FSlotArray* NewSlots = new FSlotArray(OldSlots.Capacity * 2);
+		for (uint32 Index = 0; Index < OldSlots.Capacity; ++Index)
 		{
-			Entry.StoreName(Value.Name.Ansi, Value.Name.Len);
+			const uint64 Slot = OldSlots.Slots[Index].load(std::memory_order_relaxed);
+			if (Slot != 0)
+			{
+				const uint32 NewIndex = FindEmptySlot(*NewSlots, static_cast<uint32>(Slot >> 32));
+				NewSlots->Slots[NewIndex].store(Slot, std::memory_order_relaxed);
+			}
 		}
-		Slot.SetValue(Entry);
-		ElementCount.fetch_add(1, std::memory_order_relaxed);
-		return {Value.Hash};
+
+		CurrentSlots.store(NewSlots, std::memory_order_release);
+		RetiredSlots.Add(&OldSlots);
+		SlotBytes += static_cast<uint64>(NewSlots->Capacity) * sizeof(uint64);
+		return NewSlots;
 	}
 };
-#endif
-#pragma endregion Deprecated Pool Shard
 
-struct FNamePool
+
+/**
+ * 모든 FName의 문자열을 저장하는 풀
+ *
+ * 문자열은 FNameEntryAllocator의 블록에 길이만큼만 저장하고, FName은 Entry의 Id를 가집니다.
+ * 원본 문자열로 찾는 Display 테이블과 대소문자를 무시하고 찾는 Comparison 테이블이 있으며,
+ * 각 테이블은 Hash의 상위 비트로 나눈 Shard로 이루어져 있어서 서로 다른 Shard에 추가할 때는 경쟁하지 않습니다.
+ */
+class FNamePool
 {
 public:
-    static FNamePool& Get()
-    {
-        static FNamePool Instance;
-        return Instance;
-    }
+	static constexpr uint32 ShardBits = 4;
+	static constexpr uint32 NumShards = 1 << ShardBits;
 
-private:
-	// FNamePoolShard<CaseSensitive> DisplayPool;
-	// FNamePoolShard<IgnoreCase> ComparisonPool;
-
-	TMap<uint32, FNameEntry> DisplayPool;
-	TMap<uint32, FNameEntry> ComparisonPool;
+	static FNamePool& Get()
+	{
+		static FNamePool Instance;
+		return Instance;
+	}
 
 private:
-	template <ENameCase Sensitivity>
-	FNameEntry MakeEntry(const FNameValue<Sensitivity>& Value) const
-	{
-		FNameEntry Result;
-		Result.ComparisonId = Value.ComparisonId;
-		Result.Header = {
-			.IsWide = Value.Name.bIsWide,
-			.Len = static_cast<uint16>(Value.Name.Len)
-		};
-		if (Value.Name.bIsWide)
-		{
-			Result.StoreName(Value.Name.Wide, Value.Name.Len);
-		}
-		else
-		{
-			Result.StoreName(Value.Name.Ansi, Value.Name.Len);
-		}
-		return Result;
+	FNameEntryAllocator Entries;
+	FNamePoolShard<CaseSensitive> DisplayShards[NumShards];
+	FNamePoolShard<IgnoreCase> ComparisonShards[NumShards];
+
+	FNamePool()
+	{
+		// 첫 Entry는 Id가 0이므로 "None"을 저장해서 NAME_None과 같게 만듦
+		[[maybe_unused]] const FNameEntryId NoneId = Store({TEXT("None"), 4});
 	}
 
 public:
-	/** Hash로 원본 문자열을 가져옵니다. */
-	FNameEntry Resolve(uint32 Hash) const
+	/** Id로 원본 문자열을 가져옵니다. */
+	const FNameEntry& Resolve(FNameEntryId Id) const
 	{
-		return *DisplayPool.Find(Hash);
+		return Entries.Resolve(Id);
 	}
 
 	/**
-	 * 문자열을 찾거나, 없으면 Hash화 해서 저장합니다.
+	 * 문자열을 찾거나, 없으면 저장합니다.
 	 *
-	 * @return DisplayName의 Hash
+	 * @return 원본 문자열의 Id
 	 */
-	FNameEntryId FindOrStoreString(const FNameStringView& Name)
+	FNameEntryId Store(const FNameStringView& Name)
 	{
-		// DisplayPool에 같은 문자열이 있다면, 문자열의 Hash 반환
-		FNameDisplayValue DisplayValue{Name};
-		if (DisplayPool.Find(DisplayValue.Hash))
+		const FNameHash Hash = HashName(Name);
+		const FNameDisplayValue DisplayValue{Name, Hash.Display};
+		return DisplayShards[GetShardIndex(Hash.Display)].FindOrAdd(DisplayValue, Entries, [&]()
 		{
-			return {DisplayValue.Hash};
-		}
+			FNameEntryId DisplayId;
+			FNameEntry& Entry = Entries.Allocate(Name, DisplayId);
+
+			// 대소문자만 다른 Name이 없으면 이 Entry가 비교 기준이 됨
+			Entry.ComparisonId = DisplayId;
+			const FNameComparisonValue ComparisonValue{Name, Hash.Comparison};
+			Entry.ComparisonId = ComparisonShards[GetShardIndex(Hash.Comparison)].FindOrAdd(ComparisonValue, Entries, [DisplayId]()
+			{
+				return DisplayId;
+			});
+			return DisplayId;
+		});
+	}
 
-		const FNameComparisonValue ComparisonValue{Name};
-		if (!ComparisonPool.Find(ComparisonValue.Hash))
+	FName::FPoolStats GetStats()
+	{
+		FName::FPoolStats Stats = {
+			.NumEntries = Entries.GetNumEntries(),
+			.EntryBytes = Entries.GetEntryBytes(),
+			.ReservedBytes = Entries.GetReservedBytes(),
+			.SlotBytes = 0
+		};
+		for (uint32 Index = 0; Index < NumShards; ++Index)
 		{
-			const FNameEntry Entry = MakeEntry(ComparisonValue);
-			ComparisonPool.Add(ComparisonValue.Hash, Entry);
+			Stats.SlotBytes += DisplayShards[Index].GetSlotBytes() + ComparisonShards[Index].GetSlotBytes();
 		}
+		return Stats;
+	}
 
-		DisplayValue.ComparisonId = {ComparisonValue.Hash};
-		DisplayPool.Add(DisplayValue.Hash, MakeEntry(DisplayValue));
-		return {DisplayValue.Hash};
+private:
+	static uint32 GetShardIndex(uint32 Hash)
+	{
+		return Hash >> (32 - ShardBits);
 	}
 };
 
@@ -389,26 +598,28 @@ struct FNameHelper
 		// 문자열의 길이가 NAME_SIZE를 초과하면 None 반환
 		if (Len >= FNameEntry::NAME_SIZE)
 		{
-		    assert(Len >= FNameEntry::NAME_SIZE);
 			return {};
 		}
 
-		const FNameEntryId DisplayId = FNamePool::Get().FindOrStoreString({Char, Len});
+		if constexpr (std::is_same_v<CharType, wchar_t>)
+		{
+			// ASCII만 있으면 ANSI로 저장해서 같은 문자열의 ANSI, WIDECHAR 버전이 같은 Name이 되도록 함
+			if (std::all_of(Char, Char + Len, [](WIDECHAR C) { return C >= 0 && C < 0x80; }))
+			{
+				ANSICHAR AnsiName[FNameEntry::NAME_SIZE];
+				std::transform(Char, Char + Len, AnsiName, [](WIDECHAR C) { return static_cast<ANSICHAR>(C); });
+				return MakeFName(static_cast<const ANSICHAR*>(AnsiName), Len);
+			}
+		}
+
+		FNamePool& Pool = FNamePool::Get();
+		const FNameEntryId DisplayId = Pool.Store({Char, Len});
 
 		FName Result;
 		Result.DisplayIndex = DisplayId.Value;
-		Result.ComparisonIndex = ResolveComparisonId(DisplayId).Value;
+		Result.ComparisonIndex = Pool.Resolve(DisplayId).ComparisonId.Value;
 		return Result;
 	}
-
-	static FNameEntryId ResolveComparisonId(FNameEntryId DisplayId)
-	{
-		if (DisplayId.IsNone())
-		{
-			return {};
-		}
-		return FNamePool::Get().Resolve(DisplayId.Value).ComparisonId;
-	}
 };
 
 #if defined(_DEBUG)
@@ -433,17 +644,27 @@ FName::FName(const FString& Name)
 
 FString FName::ToString() const
 {
-	if (DisplayIndex == 0 && ComparisonIndex == 0)
+	const FNameEntry& Entry = FNamePool::Get().Resolve({DisplayIndex});
+	if (!Entry.Header.IsWide)
 	{
-		return {TEXT("None")};
+		return {Entry.GetAnsiName()};
 	}
 
-	// TODO: WIDECHAR에 대응 해야함
-	FNameEntry Entry = FNamePool::Get().Resolve(DisplayIndex);
-	return {
-		// Entry.Header.IsWide ? Entry.WideName : Entry.AnsiName
-		Entry.AnsiName
-	};
+#if USE_WIDECHAR
+	return {Entry.GetWideName()};
+#else
+	// ANSI로 바꿀 수 없는 문자는 '?'로 표시
+	std::string Result(Entry.Header.Len, '?');
+	for (uint32 i = 0; i < Entry.Header.Len; ++i)
+	{
+		const WIDECHAR Char = Entry.GetWideName()[i];
+		if (Char >= 0 && Char < 0x80)
+		{
+			Result[i] = static_cast<ANSICHAR>(Char);
+		}
+	}
+	return {Result};
+#endif
 }
 
 bool FName::operator==(const FName& Other) const
@@ -453,15 +674,20 @@ bool FName::operator==(const FName& Other) const
 
 bool FName::operator==(ENameNone) const
 {
-    return ComparisonIndex == NAME_None;
+	return ComparisonIndex == NAME_None;
 }
 
 bool FName::operator!=(ENameNone) const
 {
-    return ComparisonIndex != NAME_None;
+	return ComparisonIndex != NAME_None;
 }
 
 bool FName::operator!=(const FName& Other) const
 {
-    return ComparisonIndex != Other.ComparisonIndex;
+	return ComparisonIndex != Other.ComparisonIndex;
+}
+
+FName::FPoolStats FName::GetPoolStats()
+{
+	return FNamePool::Get().GetStats();
 }
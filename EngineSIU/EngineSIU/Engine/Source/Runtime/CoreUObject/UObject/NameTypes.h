@@ -9,8 +9,8 @@ class FName
 {
     friend struct FNameHelper;
 
-    uint32 DisplayIndex;    // 원본 문자열의 Hash
-    uint32 ComparisonIndex; // 비교시 사용되는 Hash
+    uint32 DisplayIndex;    // 원본 문자열 Entry의 Id
+    uint32 ComparisonIndex; // 비교시 사용되는 Entry의 Id, 대소문자만 다른 Name끼리 같음
 
 public:
     FName() : DisplayIndex(NAME_None), ComparisonIndex(NAME_None) {}
@@ -27,6 +27,17 @@ public:
     bool operator==(ENameNone) const;
     bool operator!=(const FName& Other) const;
     bool operator!=(ENameNone) const;
+
+    /** Name 풀 전체의 사용량 */
+    struct FPoolStats
+    {
+        uint32 NumEntries;
+        uint64 EntryBytes;    // Entry가 사용하는 크기
+        uint64 ReservedBytes; // 블록 크기의 합
+        uint64 SlotBytes;     // 해시 테이블 크기의 합
+    };
+
+    static FPoolStats GetPoolStats();
 };
 
 template<>
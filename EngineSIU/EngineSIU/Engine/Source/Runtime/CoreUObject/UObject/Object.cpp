@@ -14,7 +14,7 @@ UClass* UObject::StaticClass()
         nullptr,
         []() -> UObject*
         {
-            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            void* RawMemory = UObject::StaticClass()->AllocateObjectMemory();
             ::new (RawMemory) UObject;
             return static_cast<UObject*>(RawMemory);
         }
@@ -26,10 +26,19 @@ UObject::UObject()
     : UUID(0)
     // TODO: Object를 생성할 때 직접 설정하기
     , InternalIndex(-1)
-    , NamePrivate("None")
 {
 }
 
+FName UObject::GetFName() const
+{
+    // ConstructObject에서는 이름을 만들지 않고, 처음 요청될 때 Class 이름과 UUID로 만듦
+    if (NamePrivate == NAME_None && ClassPrivate)
+    {
+        NamePrivate = ClassPrivate->GetName() + "_" + std::to_string(UUID);
+    }
+    return NamePrivate;
+}
+
 UObject* UObject::Duplicate(UObject* InOuter)
 {
     return FObjectFactory::ConstructObject(GetClass(), InOuter);
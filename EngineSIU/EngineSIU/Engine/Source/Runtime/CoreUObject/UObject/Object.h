@@ -25,12 +25,14 @@ public:
 private:
     friend class FObjectFactory;
     friend class FSceneMgr;
+    friend class FUObjectArray;
     friend class UClass;
 
     uint32 UUID;
     uint32 InternalIndex; // Index of GUObjectArray
 
-    FName NamePrivate;
+    /** ConstructObject로 생성된 Object는 처음 GetFName이 호출될 때 정해짐 */
+    mutable FName NamePrivate;
     UClass* ClassPrivate = nullptr;
     UObject* OuterPrivate = nullptr;
 
@@ -44,8 +46,8 @@ public:
     virtual UWorld* GetWorld() const;
     virtual void Serialize(FArchive& Ar);
 
-    FName GetFName() const { return NamePrivate; }
-    FString GetName() const { return NamePrivate.ToString(); }
+    FName GetFName() const;
+    FString GetName() const { return GetFName().ToString(); }
 
     uint32 GetUUID() const { return UUID; }
     uint32 GetInternalIndex() const { return InternalIndex; }
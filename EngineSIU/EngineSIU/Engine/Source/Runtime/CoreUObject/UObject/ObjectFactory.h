@@ -3,24 +3,29 @@
 #include "Object.h"
 #include "Class.h"
 #include "UObjectArray.h"
+#include "UObjectHash.h"
 
 class FObjectFactory
 {
 public:
+    /** true면 ConstructObject마다 생성된 Object의 이름을 로그로 남깁니다. */
+    inline static bool bLogConstructObject = false;
+
     static UObject* ConstructObject(UClass* InClass, UObject* InOuter)
     {
-        const uint32 Id = UEngineStatics::GenUUID();
-        const FString Name = InClass->GetName() + "_" + std::to_string(Id);
-
+        // 이름은 처음 GetFName이 호출될 때 Class 이름과 UUID로 만들어짐
         UObject* Obj = InClass->ClassCTOR();
         Obj->ClassPrivate = InClass;
-        Obj->NamePrivate = Name;
-        Obj->UUID = Id;
+        Obj->UUID = UEngineStatics::GenUUID();
         Obj->OuterPrivate = InOuter;
 
         GUObjectArray.AddObject(Obj);
+        AddToClassMap(Obj);
 
-        UE_LOG(LogLevel::Display, "Created New Object : %s", *Name);
+        if (bLogConstructObject)
+        {
+            UE_LOG(LogLevel::Display, "Created New Object : %s", *Obj->GetName());
+        }
         return Obj;
     }
 
@@ -0,0 +1,70 @@
+#include "ObjectPool.h"
+
+#include <algorithm>
+#include <cassert>
+
+uint32 FObjectPool::TotalNumAllocated = 0;
+
+FObjectPool::FObjectPool(uint32 InElementSize, uint32 InAlignment)
+{
+    // 빈 자리에 다음 주소를 저장하므로 포인터보다 작을 수 없음
+    Alignment = std::max<uint32>(InAlignment, alignof(FFreeElement));
+    ElementStride = std::max<uint32>(InElementSize, sizeof(FFreeElement));
+    ElementStride = (ElementStride + Alignment - 1) / Alignment * Alignment;
+
+    ElementsPerSlab = std::max(MinElementsPerSlab, TargetSlabSize / ElementStride);
+    SlabSize = ElementsPerSlab * ElementStride;
+}
+
+FObjectPool::~FObjectPool()
+{
+    for (void* Slab : Slabs)
+    {
+        FPlatformMemory::AlignedFree<EAT_Object>(Slab, SlabSize);
+    }
+}
+
+void* FObjectPool::Allocate()
+{
+    if (FreeList == nullptr)
+    {
+        AllocateSlab();
+    }
+
+    FFreeElement* Element = FreeList;
+    FreeList = Element->Next;
+
+    ++TotalNumAllocated;
+    PeakNumAllocated = std::max(PeakNumAllocated, ++NumAllocated);
+    return Element;
+}
+
+void FObjectPool::Free(void* Memory)
+{
+    if (Memory == nullptr)
+    {
+        return;
+    }
+
+    assert(NumAllocated > 0);
+    --NumAllocated;
+    --TotalNumAllocated;
+
+    FFreeElement* Element = static_cast<FFreeElement*>(Memory);
+    Element->Next = FreeList;
+    FreeList = Element;
+}
+
+void FObjectPool::AllocateSlab()
+{
+    uint8* Slab = static_cast<uint8*>(FPlatformMemory::AlignedMalloc<EAT_Object>(SlabSize, Alignment));
+    Slabs.Add(Slab);
+
+    // 앞쪽 자리부터 할당되도록 뒤에서부터 연결
+    for (uint32 Index = ElementsPerSlab; Index-- > 0;)
+    {
+        FFreeElement* Element = reinterpret_cast<FFreeElement*>(Slab + Index * ElementStride);
+        Element->Next = FreeList;
+        FreeList = Element;
+    }
+}
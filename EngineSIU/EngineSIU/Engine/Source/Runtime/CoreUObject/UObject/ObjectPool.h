@@ -0,0 +1,64 @@
+#pragma once
+#include "Container/Array.h"
+
+/**
+ * 같은 크기의 Object 메모리를 슬랩 단위로 미리 할당해두고 나눠주는 풀
+ *
+ * UClass마다 하나씩 가지고 있으며, 반환된 자리는 다음 할당에서 재사용합니다.
+ * 슬랩은 풀이 사라질 때까지 해제하지 않습니다.
+ *
+ * @note 스레드 안전하지 않으므로 GUObjectArray와 같이 게임 스레드에서만 사용해야 합니다.
+ */
+class FObjectPool
+{
+public:
+    // 슬랩 하나의 목표 크기와 최소 원소 수
+    static constexpr uint32 TargetSlabSize = 64 * 1024;
+    static constexpr uint32 MinElementsPerSlab = 16;
+
+    FObjectPool(uint32 InElementSize, uint32 InAlignment);
+    ~FObjectPool();
+
+    FObjectPool(const FObjectPool&) = delete;
+    FObjectPool& operator=(const FObjectPool&) = delete;
+    FObjectPool(FObjectPool&&) = delete;
+    FObjectPool& operator=(FObjectPool&&) = delete;
+
+    void* Allocate();
+    void Free(void* Memory);
+
+    /** 사용 중인 원소 수 */
+    uint32 GetNumAllocated() const { return NumAllocated; }
+
+    /** 지금까지 가장 많이 사용된 원소 수 */
+    uint32 GetPeakNumAllocated() const { return PeakNumAllocated; }
+
+    /** 슬랩으로 할당받은 전체 메모리 크기 */
+    uint64 GetReservedBytes() const { return static_cast<uint64>(Slabs.Num()) * SlabSize; }
+
+    /** 모든 풀에서 사용 중인 원소 수 */
+    static uint32 GetTotalNumAllocated() { return TotalNumAllocated; }
+
+private:
+    void AllocateSlab();
+
+private:
+    /** 반환된 자리에 다음 빈 자리의 주소를 저장하는 연결 리스트 */
+    struct FFreeElement
+    {
+        FFreeElement* Next;
+    };
+
+    uint32 ElementStride;
+    uint32 Alignment;
+    uint32 ElementsPerSlab;
+    uint32 SlabSize;
+
+    TArray<void*> Slabs;
+    FFreeElement* FreeList = nullptr;
+
+    uint32 NumAllocated = 0;
+    uint32 PeakNumAllocated = 0;
+
+    static uint32 TotalNumAllocated;
+};
@@ -9,6 +9,7 @@ enum OBJECTS : uint8
     OBJ_SpotLight,
     OBJ_PointLight,
     OBJ_PARTICLE,
+    OBJ_ParticleSystem,
     OBJ_Text,
     OBJ_Fireball,
     OBJ_TRIANGLE,
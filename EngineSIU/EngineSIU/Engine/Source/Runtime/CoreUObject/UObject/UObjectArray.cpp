@@ -1,26 +1,82 @@
 ﻿#include "UObjectArray.h"
+#include "Class.h"
 #include "Object.h"
-#include "UObjectHash.h"
 
 
 void FUObjectArray::AddObject(UObject* Object)
 {
-    ObjObjects.Add(Object);
-    AddToClassMap(Object);
+    int32 Index;
+    if (!ObjAvailableList.IsEmpty())
+    {
+        Index = ObjAvailableList[ObjAvailableList.Num() - 1];
+        ObjAvailableList.RemoveAt(ObjAvailableList.Num() - 1);
+    }
+    else
+    {
+        Index = NumElements++;
+        if (Index / NumElementsPerChunk >= ObjObjects.Num())
+        {
+            ObjObjects.Emplace();
+            ObjObjects[ObjObjects.Num() - 1].SetNum(NumElementsPerChunk);
+        }
+    }
+
+    TArray<UObject*>& ClassArray = ClassObjects.FindOrAdd(Object->GetClass());
+
+    FUObjectItem& Item = GetItem(Index);
+    Item.Object = Object;
+    Item.ClassIndex = ClassArray.Add(Object);
+    Object->InternalIndex = Index;
 }
 
 void FUObjectArray::MarkRemoveObject(UObject* Object)
 {
-    ObjObjects.Remove(Object);
-    RemoveFromClassMap(Object);  // UObjectHashTable에서 Object를 제외
-    PendingDestroyObjects.AddUnique(Object);
+    // 이미 제거되었으면 자리가 다른 Object에게 재사용되었을 수 있으므로 Object를 비교
+    const int32 Index = static_cast<int32>(Object->InternalIndex);
+    if (IndexToObject(Index) != Object)
+    {
+        return;
+    }
+
+    // 순회 중인 Class별 배열의 순서가 바뀌지 않도록 자리와 ClassIndex는 ProcessPendingDestroyObjects까지 그대로 둠
+    GetItem(Index).Object = nullptr;
+    PendingDestroyObjects.Add(Object);
+}
+
+bool FUObjectArray::IsPendingDestroy(const UObject* Object) const
+{
+    const int32 Index = static_cast<int32>(Object->InternalIndex);
+    return Index >= 0 && Index < NumElements && GetItem(Index).Object == nullptr;
+}
+
+void FUObjectArray::RemovePendingObjects()
+{
+    for (UObject* Object : PendingDestroyObjects)
+    {
+        const int32 Index = static_cast<int32>(Object->InternalIndex);
+        FUObjectItem& Item = GetItem(Index);
+
+        // 마지막 Object를 제거할 자리로 옮김, 마지막 Object도 제거 대기 중일 수 있지만 아직 자리와 ClassIndex가 남아있음
+        TArray<UObject*>& ClassArray = *ClassObjects.Find(Object->GetClass());
+        UObject* LastObject = ClassArray[ClassArray.Num() - 1];
+        GetItem(static_cast<int32>(LastObject->InternalIndex)).ClassIndex = Item.ClassIndex;
+        ClassArray.RemoveAtSwap(Item.ClassIndex);
+
+        Item = FUObjectItem();
+        ObjAvailableList.Add(Index);
+        Object->InternalIndex = static_cast<uint32>(-1);
+    }
 }
 
 void FUObjectArray::ProcessPendingDestroyObjects()
 {
+    RemovePendingObjects();
     for (UObject* Object : PendingDestroyObjects)
     {
-        delete Object;
+        // 메모리는 Class의 풀로 반환
+        UClass* Class = Object->GetClass();
+        Object->~UObject();
+        Class->FreeObjectMemory(Object);
     }
     PendingDestroyObjects.Empty();
 }
@@ -1,31 +1,89 @@
 ﻿#pragma once
 #include "Container/Array.h"
-#include "Container/Set.h"
+#include "Container/Map.h"
 
 class UClass;
 class UObject;
 
 
+/** FUObjectArray의 한 자리 */
+struct FUObjectItem
+{
+    UObject* Object = nullptr;
+
+    /** 같은 Class의 Object들을 모은 배열에서 Object의 위치 */
+    int32 ClassIndex = -1;
+};
+
+
+/**
+ * 모든 UObject를 담는 배열
+ *
+ * Object는 생성될 때 받은 InternalIndex 자리에 제거될 때까지 머물며, 제거된 자리는 다음에 생성되는 Object가 재사용합니다.
+ * 일정 크기의 청크 단위로 할당하므로 Object가 늘어나도 기존 자리를 옮기지 않습니다.
+ * Class마다 그 Class의 Object들을 연속된 배열로 따로 모아두며, 제거할 때는 마지막 원소와 자리를 바꿔서 지웁니다.
+ * MarkRemoveObject는 IndexToObject에서만 Object를 숨기고, 자리와 Class별 배열에서 빼는 것은 ProcessPendingDestroyObjects까지 미룹니다.
+ * 그래서 순회하는 도중에 Object가 제거되어도 Class별 배열의 순서가 바뀌지 않습니다.
+ */
 class FUObjectArray
 {
 public:
+    // 청크 하나에 들어가는 Object 수
+    static constexpr int32 NumElementsPerChunk = 64 * 1024;
+
+    /**
+     * Object에 자리를 주고 Class별 배열에 추가합니다.
+     * Class의 상속 관계는 등록하지 않으므로, GUObjectArray에 넣을 때는 AddToClassMap도 함께 호출해야 합니다.
+     */
     void AddObject(UObject* Object);
     void MarkRemoveObject(UObject* Object);
 
+    /** 제거 대기 중인 Object들을 자리와 Class별 배열에서 빼고 메모리를 해제합니다. */
     void ProcessPendingDestroyObjects();
 
-    TSet<UObject*>& GetObjectItemArrayUnsafe()
+    bool HasPendingDestroyObjects() const { return !PendingDestroyObjects.IsEmpty(); }
+
+    /** MarkRemoveObject로 제거되어 ProcessPendingDestroyObjects를 기다리는 중인지 */
+    bool IsPendingDestroy(const UObject* Object) const;
+
+    /** Index 자리의 Object, 비어있는 자리면 nullptr */
+    UObject* IndexToObject(int32 Index) const
     {
-        return ObjObjects;
+        return Index >= 0 && Index < NumElements ? GetItem(Index).Object : nullptr;
     }
 
-    const TSet<UObject*>& GetObjectItemArrayUnsafe() const
+    /** 한 번이라도 사용된 자리의 수, 비어있는 자리도 포함 */
+    int32 GetObjectArrayNum() const { return NumElements; }
+
+    /** 살아있는 Object의 수 */
+    int32 GetObjectArrayNumMinusAvailable() const { return NumElements - ObjAvailableList.Num(); }
+
+    /**
+     * 정확히 Class 타입인 Object들, 파생 클래스의 Object는 포함하지 않음
+     * 제거 대기 중인 Object도 들어있으므로 IsPendingDestroy로 걸러야 합니다.
+     */
+    const TArray<UObject*>* FindObjectsOfClass(const UClass* Class) const
     {
-        return ObjObjects;
+        return ClassObjects.Find(Class);
     }
 
 private:
-    TSet<UObject*> ObjObjects;
+    /** 제거 대기 중인 Object들을 자리와 Class별 배열에서 뺍니다. Object의 메모리는 해제하지 않습니다. */
+    void RemovePendingObjects();
+
+    FUObjectItem& GetItem(int32 Index) { return ObjObjects[Index / NumElementsPerChunk][Index % NumElementsPerChunk]; }
+    const FUObjectItem& GetItem(int32 Index) const { return ObjObjects[Index / NumElementsPerChunk][Index % NumElementsPerChunk]; }
+
+private:
+    // 청크마다 NumElementsPerChunk 크기로 할당된 배열
+    TArray<TArray<FUObjectItem>> ObjObjects;
+    int32 NumElements = 0;
+
+    /** 비어있는 자리의 Index들, 뒤에서부터 재사용 */
+    TArray<int32> ObjAvailableList;
+
+    TMap<const UClass*, TArray<UObject*>> ClassObjects;
+
     TArray<UObject*> PendingDestroyObjects;
 };
 
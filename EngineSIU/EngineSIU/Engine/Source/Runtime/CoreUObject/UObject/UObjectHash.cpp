@@ -4,9 +4,11 @@
 #include "Class.h"
 #include "Container/Map.h"
 #include "Container/Set.h"
+#include "UObjectArray.h"
 
 /**
- * 모든 UObject의 정보를 담고 있는 HashTable
+ * UClass의 상속 관계를 담고 있는 HashTable
+ * Class별 Object 목록은 GUObjectArray가 가지고 있습니다.
  */
 struct FUObjectHashTables
 {
@@ -17,7 +19,9 @@ struct FUObjectHashTables
     }
 
     TMap<UClass*, TSet<UClass*>> ClassToChildListMap;
-    TMap<UClass*, TSet<UObject*>> ClassToObjectListMap;
+
+    /** GetClassAndDerivedClasses의 결과, 새 파생 클래스가 등록되면 뒤에 추가됨 */
+    TMap<const UClass*, TArray<const UClass*>> ClassAndDerivedClassesCache;
 };
 
 /** Helper function that returns all the children of the specified class recursively */
@@ -59,31 +63,30 @@ void AddToClassMap(UObject* Object)
     FUObjectHashTables& HashTable = FUObjectHashTables::Get();
 
     UClass* Class = Object->GetClass();
-    HashTable.ClassToObjectListMap.FindOrAdd(Class).Add(Object);
-
     for (UClass* SuperClass = Class->GetSuperClass(); SuperClass;)
     {
-        HashTable.ClassToChildListMap.FindOrAdd(SuperClass).Add(Class);
+        // 이미 등록된 Class면 그 위의 부모들도 등록되어 있음
+        TSet<UClass*>& ChildSet = HashTable.ClassToChildListMap.FindOrAdd(SuperClass);
+        if (ChildSet.Contains(Class))
+        {
+            break;
+        }
+        ChildSet.Add(Class);
+
+        // 반환한 목록을 들고 있는 호출자가 있을 수 있으므로 캐시를 지우지 않고 뒤에 추가
+        for (const UClass* Ancestor = SuperClass; Ancestor; Ancestor = Ancestor->GetSuperClass())
+        {
+            if (TArray<const UClass*>* CachedClasses = HashTable.ClassAndDerivedClassesCache.Find(Ancestor))
+            {
+                CachedClasses->Add(Class);
+            }
+        }
     
         Class = SuperClass;
         SuperClass = SuperClass->GetSuperClass();
     }
 }
 
-void RemoveFromClassMap(UObject* Object)
-{
-    assert(Object->GetClass());
-    FUObjectHashTables& HashTable = FUObjectHashTables::Get();
-
-    TSet<UObject*>& ObjectSet = HashTable.ClassToObjectListMap.FindOrAdd(Object->GetClass());
-    int32 NumRemoved = ObjectSet.Remove(Object);
-
-    if (NumRemoved == 0)
-    {
-        HashTable.ClassToObjectListMap.Remove(Object->GetClass());
-    }
-}
-
 void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
 {
     Results.Add(ClassToLookFor);
@@ -92,28 +95,45 @@ void GetChildOfClass(UClass* ClassToLookFor, TArray<UClass*>& Results)
     RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Results);
 }
 
-void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
+const TArray<const UClass*>& GetClassAndDerivedClasses(const UClass* ClassToLookFor)
 {
-    // Most classes searched for have around 10 subclasses, some have hundreds
-    TArray<const UClass*> ClassesToSearch;
-    ClassesToSearch.Add(ClassToLookFor);
-
     FUObjectHashTables& ThreadHash = FUObjectHashTables::Get();
-
-    if (bIncludeDerivedClasses)
+    if (const TArray<const UClass*>* CachedClasses = ThreadHash.ClassAndDerivedClassesCache.Find(ClassToLookFor))
     {
-        RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, ClassesToSearch);
+        return *CachedClasses;
     }
 
+    TArray<const UClass*>& Classes = ThreadHash.ClassAndDerivedClassesCache.FindOrAdd(ClassToLookFor);
+    Classes.Add(ClassToLookFor);
+    RecursivelyPopulateDerivedClasses(ThreadHash, ClassToLookFor, Classes);
+    return Classes;
+}
 
-    for (const UClass* SearchClass : ClassesToSearch)
+static void AddObjectsOfExactClass(const UClass* Class, TArray<UObject*>& Results)
+{
+    if (const TArray<UObject*>* List = GUObjectArray.FindObjectsOfClass(Class))
     {
-        if (TSet<UObject*>* List = ThreadHash.ClassToObjectListMap.Find(const_cast<UClass*>(SearchClass)))
+        Results.Reserve(Results.Num() + List->Num());
+        for (UObject* Object : *List)
         {
-            for (const auto& Object : *List)
+            if (!GUObjectArray.IsPendingDestroy(Object))
             {
                 Results.Add(Object);
             }
         }
     }
 }
+
+void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses)
+{
+    if (!bIncludeDerivedClasses)
+    {
+        AddObjectsOfExactClass(ClassToLookFor, Results);
+        return;
+    }
+
+    for (const UClass* SearchClass : GetClassAndDerivedClasses(ClassToLookFor))
+    {
+        AddObjectsOfExactClass(SearchClass, Results);
+    }
+}
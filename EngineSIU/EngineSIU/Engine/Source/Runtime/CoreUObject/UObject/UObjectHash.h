@@ -12,11 +12,14 @@ class UClass;
  */
 void GetObjectsOfClass(const UClass* ClassToLookFor, TArray<UObject*>& Results, bool bIncludeDerivedClasses);
 
-/** FUObjectHashTables에 Object의 정보를 저장합니다. */
-void AddToClassMap(UObject* Object);
+/**
+ * ClassToLookFor와 그 모든 파생 클래스의 목록을 반환합니다.
+ * 목록은 처음 요청될 때 만들어져 유지되며, 새 파생 클래스의 Object가 생성되면 뒤에 추가됩니다.
+ */
+const TArray<const UClass*>& GetClassAndDerivedClasses(const UClass* ClassToLookFor);
 
-/** FUObjectHashTables에 저장된 Object정보를 제거합니다. */
-void RemoveFromClassMap(UObject* Object);
+/** FUObjectHashTables에 Object의 Class와 부모 Class들의 상속 관계를 저장합니다. */
+void AddToClassMap(UObject* Object);
 
 /**
  * ClassToLookFor와 일치하는 자식 UClass를 반환합니다.
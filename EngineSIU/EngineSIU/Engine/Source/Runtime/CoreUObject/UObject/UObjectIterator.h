@@ -1,13 +1,22 @@
 ﻿#pragma once
 #include "Object.h"
+#include "Class.h"
+#include "UObjectArray.h"
 #include "UObjectHash.h"
 #include "Container/Array.h"
 
+class UWorld;
+
 #undef GetObject // Windows.h 이름 겹침
 
 
 /**
  * 특정 타입의 UObject 인스턴스를 순회하기 위한 반복자 클래스입니다.
+ *
+ * T와 파생 클래스마다 GUObjectArray가 모아둔 Class별 배열을 그 자리에서 순서대로 순회하므로, 다른 Class의 Object는 보지 않고 힙 할당도 없습니다.
+ * Class별 배열에서 빼는 것은 ProcessPendingDestroyObjects까지 미뤄지므로, 순회 중에 Object가 제거되어도 다른 Object를 건너뛰거나 두 번 만나지 않습니다.
+ * 제거 대기 중인 Object는 순회하지 않습니다.
+ * 순회 중에 생성된 Object는 Class별 배열의 뒤에 추가되므로, 그 Class를 아직 다 순회하지 않았으면 순회합니다.
  * 
  * @tparam T 순회할 UObject 타입 또는 그 파생 클래스
  */
@@ -21,17 +30,22 @@ public:
         EndTag
     };
 
-    /** Begin 생성자 */
-    explicit TObjectIterator(bool bIncludeDerivedClasses = true)
-        : Index(-1)
+    /**
+     * Begin 생성자
+     * @param InWorld nullptr가 아니면 이 World에 속한 Object만 순회
+     */
+    explicit TObjectIterator(bool bInIncludeDerivedClasses = true, const UWorld* InWorld = nullptr)
+        : Classes(bInIncludeDerivedClasses ? &GetClassAndDerivedClasses(T::StaticClass()) : nullptr)
+        , World(InWorld)
     {
-        GetObjectsOfClass(T::StaticClass(), ObjectArray, bIncludeDerivedClasses);
         Advance();
     }
 
     /** End 생성자 */
     TObjectIterator(EEndTagType, const TObjectIterator& Begin)
-        : Index(Begin.ObjectArray.Num())
+        : Classes(Begin.Classes)
+        , World(Begin.World)
+        , Object(nullptr)
     {
     }
 
@@ -50,31 +64,60 @@ public:
         return (T*)GetObject();
     }
 
-    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Index == Rhs.Index; }
-    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Index != Rhs.Index; }
+    FORCEINLINE bool operator==(const TObjectIterator& Rhs) const { return Object == Rhs.Object; }
+    FORCEINLINE bool operator!=(const TObjectIterator& Rhs) const { return Object != Rhs.Object; }
 
 protected:
     UObject* GetObject() const 
     { 
-        return ObjectArray[Index];
+        return Object;
     }
 
     bool Advance()
     {
-        while(++Index < ObjectArray.Num())
+        // 순회 중에 추가된 Object와 파생 클래스도 보도록 매번 크기를 다시 읽음
+        while (true)
         {
-            if (GetObject())
+            if (ClassObjects && ++ObjectIndex < ClassObjects->Num())
             {
-                return true;
+                UObject* Candidate = (*ClassObjects)[ObjectIndex];
+                if (GUObjectArray.HasPendingDestroyObjects() && GUObjectArray.IsPendingDestroy(Candidate))
+                {
+                    continue;
+                }
+                if (World == nullptr || Candidate->GetWorld() == World)
+                {
+                    Object = Candidate;
+                    return true;
+                }
+                continue;
             }
+
+            const int32 NumClasses = Classes ? Classes->Num() : 1;
+            if (++ClassIndex >= NumClasses)
+            {
+                break;
+            }
+            ClassObjects = GUObjectArray.FindObjectsOfClass(Classes ? (*Classes)[ClassIndex] : T::StaticClass());
+            ObjectIndex = -1;
         }
+
+        Object = nullptr;
         return false;
     }
 
 protected:
-    /** Results from the GetObjectsOfClass query */
-    TArray<UObject*> ObjectArray;
-    int32 Index;
+    /** T와 파생 클래스의 목록, 파생 클래스를 포함하지 않으면 nullptr이고 T만 순회 */
+    const TArray<const UClass*>* Classes;
+    const UWorld* World;
+
+    /** 지금 순회하는 Class의 Classes 안 위치와 그 Class의 Object 배열, 아직 Object가 없는 Class면 nullptr */
+    int32 ClassIndex = -1;
+    const TArray<UObject*>* ClassObjects = nullptr;
+
+    /** 현재 Object의 ClassObjects 안 위치 */
+    int32 ObjectIndex = -1;
+    UObject* Object = nullptr;
 };
 
 
@@ -93,6 +136,12 @@ struct TObjectRange
     {
     }
 
+    /** InWorld에 속한 Object만 순회합니다. */
+    explicit TObjectRange(const UWorld* InWorld, bool bIncludeDerivedClasses = true)
+        : Begin(bIncludeDerivedClasses, InWorld)
+    {
+    }
+
     friend TObjectIterator<T> begin(const TObjectRange& Range) { return Range.Begin; }
     friend TObjectIterator<T> end  (const TObjectRange& Range) { return TObjectIterator<T>(TObjectIterator<T>::EndTag, Range.Begin); }
 
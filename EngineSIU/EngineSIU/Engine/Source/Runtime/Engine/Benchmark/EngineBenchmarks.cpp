@@ -0,0 +1,3179 @@
+#include "EngineBenchmarks.h"
+
+#include "Async/ParallelFor.h"
+#include "Async/QueuedThreadPool.h"
+#include "Components/Mesh/StaticMesh.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/Mesh/StaticMeshBVH.h"
+#include "Container/FlatMap.h"
+#include "Container/FlatSet.h"
+#include "Container/Map.h"
+#include "Container/Set.h"
+#include "D3D11RHI/ConstantBufferUploader.h"
+#include "D3D11RHI/DXDBufferManager.h"
+#include "Engine/CookDatabase.h"
+#include "Engine/FLoaderOBJ.h"
+#include "HAL/FrameArena.h"
+#include "HAL/MallocBinned.h"
+#include "Math/Matrix.h"
+#include "Math/RayTriangleSIMD.h"
+#include "Math/Vector4.h"
+#include "Particles/ParticleEmitter.h"
+#include "Renderer/DrawCommandList.h"
+#include "Renderer/FrustumCuller.h"
+#include "Renderer/StaticMeshInstanceBatcher.h"
+#include "UObject/Class.h"
+#include "UObject/NameTypes.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/UObjectArray.h"
+#include "UserInterface/Console.h"
+#include "WindowsPlatformTime.h"
+#include "World/ProjectileSystem.h"
+#include "World/SceneTransformHierarchy.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+
+namespace
+{
+    // 콘솔과 디버거 출력에 함께 남김, -bench로 실행하면 콘솔 창이 없으므로 디버거 출력으로 확인
+    void Report(LogLevel Level, const char* Format, ...)
+    {
+        char Message[1024];
+        va_list Args;
+        va_start(Args, Format);
+        vsnprintf(Message, sizeof(Message), Format, Args);
+        va_end(Args);
+
+        UE_LOG(Level, "%s", Message);
+        OutputDebugStringA(Message);
+        OutputDebugStringA("\n");
+    }
+
+    /**
+     * 검사 하나의 결과를 모읍니다.
+     * 실패한 Check마다 에러 로그를 남기고, Finish에서 PASS/FAIL을 한 줄로 요약합니다.
+     */
+    class FBenchmarkChecker
+    {
+    public:
+        // 같은 원인으로 수천 줄이 찍히지 않도록 처음 몇 개의 실패만 출력
+        static constexpr int32 MaxLoggedFailures = 8;
+
+        explicit FBenchmarkChecker(const char* InName) : Name(InName) {}
+
+        bool Check(bool bCondition, const char* Format, ...)
+        {
+            ++NumChecks;
+            if (bCondition)
+            {
+                return true;
+            }
+
+            ++NumFailures;
+            if (NumFailures <= MaxLoggedFailures)
+            {
+                char Message[512];
+                va_list Args;
+                va_start(Args, Format);
+                vsnprintf(Message, sizeof(Message), Format, Args);
+                va_end(Args);
+                Report(LogLevel::Error, "%s Benchmark: FAILED: %s", Name, Message);
+            }
+            return false;
+        }
+
+        /** 두 배열의 길이와 모든 원소가 같은지 검사하고, 다르면 처음 다른 위치를 출력 */
+        template <typename T>
+        bool CheckEqualArrays(const TArray<T>& Actual, const TArray<T>& Expected, const char* What)
+        {
+            return CheckEqualArrays(Actual, Expected, What, [](const T& A, const T& B) { return A == B; });
+        }
+
+        /** operator==가 없는 타입은 IsEqual로 비교 */
+        template <typename T, typename EqualType>
+        bool CheckEqualArrays(const TArray<T>& Actual, const TArray<T>& Expected, const char* What, EqualType&& IsEqual)
+        {
+            if (!Check(Actual.Num() == Expected.Num(), "%s has %d elements, expected %d", What, Actual.Num(), Expected.Num()))
+            {
+                return false;
+            }
+
+            int32 FirstMismatch = INDEX_NONE;
+            for (int32 i = 0; i < Expected.Num() && FirstMismatch == INDEX_NONE; ++i)
+            {
+                if (!IsEqual(Actual[i], Expected[i]))
+                {
+                    FirstMismatch = i;
+                }
+            }
+            return Check(FirstMismatch == INDEX_NONE, "%s differs from the reference at element %d", What, FirstMismatch);
+        }
+
+        /** 요약을 출력하고 모든 검사를 통과했는지 반환 */
+        bool Finish() const
+        {
+            Report(
+                NumFailures == 0 ? LogLevel::Display : LogLevel::Error, "%s Benchmark: %s, %d checks, %d failed",
+                Name, NumFailures == 0 ? "PASS" : "FAIL", NumChecks, NumFailures
+            );
+            return NumFailures == 0;
+        }
+
+    private:
+        const char* Name;
+        int32 NumChecks = 0;
+        int32 NumFailures = 0;
+    };
+
+    /** Func를 NumIterations번 실행하고 한 번에 걸린 평균 시간(ms)을 반환 */
+    template <typename FuncType>
+    double MeasureMs(int32 NumIterations, FuncType&& Func)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+        {
+            Func();
+        }
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles) / NumIterations;
+    }
+
+    double Speedup(double ReferenceMs, double Ms)
+    {
+        return ReferenceMs / std::max(Ms, 1e-6);
+    }
+
+    // 실행할 때마다 같은 장면이 만들어지도록 고정 시드를 사용하는 무작위 값 생성기
+    class FBenchmarkRandom
+    {
+    public:
+        explicit FBenchmarkRandom(uint32 Seed = 12345) : Engine(Seed) {}
+
+        float Range(float Min, float Max)
+        {
+            return std::uniform_real_distribution<float>(Min, Max)(Engine);
+        }
+
+        // [Min, Max] 범위의 정수
+        int32 RangeInt(int32 Min, int32 Max)
+        {
+            return std::uniform_int_distribution<int32>(Min, Max)(Engine);
+        }
+
+        FVector Vector(float Min, float Max)
+        {
+            const float X = Range(Min, Max);
+            const float Y = Range(Min, Max);
+            const float Z = Range(Min, Max);
+            return FVector(X, Y, Z);
+        }
+
+        // 중심이 [-HalfSize, HalfSize] 안에 있고 임의로 회전한 월드 행렬
+        FMatrix Transform(float HalfSize)
+        {
+            const float Pitch = Range(-180.f, 180.f);
+            const float Yaw = Range(-180.f, 180.f);
+            const float Roll = Range(-180.f, 180.f);
+            return FMatrix::CreateRotationMatrix(Pitch, Yaw, Roll) * FMatrix::CreateTranslationMatrix(Vector(-HalfSize, HalfSize));
+        }
+
+    private:
+        std::mt19937 Engine;
+    };
+
+    /**
+     * 병렬 파서 검증용 OBJ 텍스트를 만듭니다.
+     * 줄 앞의 공백과 탭, CRLF, 빈 줄, 주석을 섞고 면은 음수(상대) 인덱스만 사용하므로,
+     * 청크마다 앞에 오는 요소의 개수를 잘못 세면 결과가 달라집니다.
+     */
+    std::string BuildIrregularObjText(uint64 MinSize)
+    {
+        static const char* const Indents[] = { "", "  ", "\t", " \t " };
+        static const char* const LineEnds[] = { "\n", "\r\n" };
+
+        std::string Text = "mtllib Irregular.mtl\n";
+        Text.reserve(MinSize + 1024);
+
+        char Line[128];
+        for (int32 Block = 0; Text.size() < MinSize; ++Block)
+        {
+            const char* Indent = Indents[Block % std::size(Indents)];
+            const char* LineEnd = LineEnds[Block % std::size(LineEnds)];
+
+            std::snprintf(Line, sizeof(Line), "%so Block%d%s", Indent, Block, LineEnd);
+            Text += Line;
+            for (int32 Corner = 0; Corner < 4; ++Corner)
+            {
+                std::snprintf(
+                    Line, sizeof(Line), "%sv %d.5 %d.25 %d%s", Indents[(Block + Corner) % std::size(Indents)],
+                    Block + (Corner & 1), Corner >> 1, Block % 7, LineEnd
+                );
+                Text += Line;
+                std::snprintf(Line, sizeof(Line), "%svt %d %d%s", Indent, Corner & 1, Corner >> 1, LineEnd);
+                Text += Line;
+            }
+            std::snprintf(Line, sizeof(Line), "\t vn 0 0 %d%s%s# Block%d%s", Block % 2 ? 1 : -1, LineEnd, Indent, Block, LineEnd);
+            Text += Line;
+            if (Block % 5 == 0)
+            {
+                std::snprintf(Line, sizeof(Line), "%s%susemtl Material%d%s", LineEnd, Indent, Block % 3, LineEnd);
+                Text += Line;
+            }
+            std::snprintf(Line, sizeof(Line), "%sf -4/-4/-1 -3/-3/-1 -1/-1/-1 -2/-2/-1%s", Indent, LineEnd);
+            Text += Line;
+            std::snprintf(Line, sizeof(Line), "  f\t-8/-8/-2 -4/-4/-1 -3%s", LineEnd);
+            Text += Line;
+        }
+        return Text;
+    }
+
+    /**
+     * 파일 파서 비교용 OBJ 텍스트를 만듭니다.
+     * 기존 Stream 파서도 읽을 수 있도록 줄 앞 공백 없이 절대 인덱스만 사용하고, 정점을 공유하는 사각형 격자로 용접도 검사합니다.
+     */
+    std::string BuildPlainObjText(uint64 MinSize)
+    {
+        constexpr int32 GridSize = 64;
+
+        std::string Text = "mtllib Plain.mtl\n";
+        Text.reserve(MinSize + 1024);
+
+        char Line[128];
+        int32 NumVertices = 0;
+        for (int32 Block = 0; Text.size() < MinSize; ++Block)
+        {
+            std::snprintf(Line, sizeof(Line), "o Grid%d\nvn 0 0 1\nusemtl Material%d\n", Block, Block % 3);
+            Text += Line;
+            for (int32 Y = 0; Y <= GridSize; ++Y)
+            {
+                for (int32 X = 0; X <= GridSize; ++X)
+                {
+                    std::snprintf(Line, sizeof(Line), "v %d.5 %d.25 %d\nvt %.4f %.4f\n", X, Y, Block, X / float(GridSize), Y / float(GridSize));
+                    Text += Line;
+                }
+            }
+            for (int32 Y = 0; Y < GridSize; ++Y)
+            {
+                for (int32 X = 0; X < GridSize; ++X)
+                {
+                    const int32 Corner = NumVertices + Y * (GridSize + 1) + X + 1;
+                    const int32 Up = Corner + GridSize + 1;
+                    std::snprintf(
+                        Line, sizeof(Line), "f %d/%d/%d %d/%d/%d %d/%d/%d %d/%d/%d\n",
+                        Corner, Corner, Block + 1, Corner + 1, Corner + 1, Block + 1, Up + 1, Up + 1, Block + 1, Up, Up, Block + 1
+                    );
+                    Text += Line;
+                }
+            }
+            NumVertices += (GridSize + 1) * (GridSize + 1);
+        }
+        return Text;
+    }
+
+    // Tolerance는 X에 대한 상대 오차, 인덱스와 서브셋은 정확히 같아야 함
+    bool IsSameObjInfo(const FObjInfo& A, const FObjInfo& B, float Tolerance)
+    {
+        if (A.Vertices.Num() != B.Vertices.Num() || A.Normals.Num() != B.Normals.Num() || A.UVs.Num() != B.UVs.Num()
+            || A.VertexIndices.Num() != B.VertexIndices.Num() || A.MaterialSubsets.Num() != B.MaterialSubsets.Num()
+            || A.NumOfGroup != B.NumOfGroup || A.MatName != B.MatName)
+        {
+            return false;
+        }
+
+        auto IsNearlySame = [Tolerance](float X, float Y)
+        {
+            return std::abs(X - Y) <= Tolerance * std::max(1.f, std::abs(X));
+        };
+
+        for (int32 i = 0; i < A.Vertices.Num(); ++i)
+        {
+            if (!IsNearlySame(A.Vertices[i].X, B.Vertices[i].X) || !IsNearlySame(A.Vertices[i].Y, B.Vertices[i].Y)
+                || !IsNearlySame(A.Vertices[i].Z, B.Vertices[i].Z))
+            {
+                return false;
+            }
+        }
+        for (int32 i = 0; i < A.Normals.Num(); ++i)
+        {
+            if (!IsNearlySame(A.Normals[i].X, B.Normals[i].X) || !IsNearlySame(A.Normals[i].Y, B.Normals[i].Y)
+                || !IsNearlySame(A.Normals[i].Z, B.Normals[i].Z))
+            {
+                return false;
+            }
+        }
+        for (int32 i = 0; i < A.UVs.Num(); ++i)
+        {
+            if (!IsNearlySame(A.UVs[i].X, B.UVs[i].X) || !IsNearlySame(A.UVs[i].Y, B.UVs[i].Y))
+            {
+                return false;
+            }
+        }
+
+        const size_t IndexBytes = sizeof(uint32) * A.VertexIndices.Num();
+        if (std::memcmp(A.VertexIndices.GetData(), B.VertexIndices.GetData(), IndexBytes) != 0
+            || std::memcmp(A.UVIndices.GetData(), B.UVIndices.GetData(), IndexBytes) != 0
+            || std::memcmp(A.NormalIndices.GetData(), B.NormalIndices.GetData(), IndexBytes) != 0)
+        {
+            return false;
+        }
+
+        for (int32 i = 0; i < A.MaterialSubsets.Num(); ++i)
+        {
+            const FMaterialSubset& SubsetA = A.MaterialSubsets[i];
+            const FMaterialSubset& SubsetB = B.MaterialSubsets[i];
+            if (SubsetA.IndexStart != SubsetB.IndexStart || SubsetA.IndexCount != SubsetB.IndexCount
+                || SubsetA.MaterialName != SubsetB.MaterialName)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 정점과 인덱스는 비트 단위로, 서브셋은 범위와 머티리얼 인덱스를 비교
+    bool IsSameRenderData(const OBJ::FStaticMeshRenderData& A, const OBJ::FStaticMeshRenderData& B)
+    {
+        if (A.Vertices.Num() != B.Vertices.Num() || A.Indices.Num() != B.Indices.Num()
+            || A.Materials.Num() != B.Materials.Num() || A.MaterialSubsets.Num() != B.MaterialSubsets.Num())
+        {
+            return false;
+        }
+
+        if (std::memcmp(A.Vertices.GetData(), B.Vertices.GetData(), A.Vertices.Num() * sizeof(FStaticMeshVertex)) != 0
+            || std::memcmp(A.Indices.GetData(), B.Indices.GetData(), A.Indices.Num() * sizeof(uint32)) != 0)
+        {
+            return false;
+        }
+
+        for (int32 i = 0; i < A.MaterialSubsets.Num(); ++i)
+        {
+            const FMaterialSubset& SubsetA = A.MaterialSubsets[i];
+            const FMaterialSubset& SubsetB = B.MaterialSubsets[i];
+            if (SubsetA.IndexStart != SubsetB.IndexStart || SubsetA.IndexCount != SubsetB.IndexCount
+                || SubsetA.MaterialIndex != SubsetB.MaterialIndex)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // 중심이 [-HalfSize, HalfSize] 안에 있는 크기가 제각각인 삼각형들로 이뤄진 메시, 인덱스는 순서대로
+    void BuildRandomTriangleMesh(FBenchmarkRandom& Random, int32 NumTriangles, float HalfSize, OBJ::FStaticMeshRenderData& OutRenderData)
+    {
+        OutRenderData.DisplayName = "RandomTriangles";
+        OutRenderData.Vertices.SetNum(NumTriangles * 3);
+        OutRenderData.Indices.SetNum(NumTriangles * 3);
+        for (int32 i = 0; i < NumTriangles; ++i)
+        {
+            const FVector Center = Random.Vector(-HalfSize, HalfSize);
+            const float Size = Random.Range(0.01f, 0.2f) * HalfSize;
+            for (int32 Corner = 0; Corner < 3; ++Corner)
+            {
+                const FVector Position = Center + Random.Vector(-Size, Size);
+                FStaticMeshVertex& Vertex = OutRenderData.Vertices[i * 3 + Corner];
+                Vertex = {};
+                Vertex.X = Position.X;
+                Vertex.Y = Position.Y;
+                Vertex.Z = Position.Z;
+                OutRenderData.Indices[i * 3 + Corner] = i * 3 + Corner;
+            }
+        }
+        FLoaderOBJ::ComputeBoundingBox(OutRenderData.Vertices, OutRenderData.BoundingBoxMin, OutRenderData.BoundingBoxMax);
+    }
+
+    /** 패딩이 없는 값 타입을 바이트 단위로 비교 */
+    template <typename T>
+    bool IsBitwiseEqual(const T& A, const T& B)
+    {
+        return std::memcmp(&A, &B, sizeof(T)) == 0;
+    }
+}
+
+bool EngineBenchmarks::ObjParsing(const FString& ObjFilePath, int32 NumIterations)
+{
+    FBenchmarkChecker Checker("ObjParse");
+    NumIterations = std::max(NumIterations, 1);
+
+    // 워커 수보다 많은 청크로 나뉘도록 크게 만들어서 청크마다 앞 요소의 수를 제대로 세는지 검사
+    const std::string Text = BuildIrregularObjText(
+        FLoaderOBJ::MinParallelChunkBytes * std::max(FQueuedThreadPool::Get().GetNumThreads() + 1, 2u)
+    );
+    FObjInfo SerialText;
+    FObjInfo ParallelText;
+    Checker.Check(FLoaderOBJ::ParseOBJBuffer(Text.data(), Text.size(), SerialText), "ParseOBJBuffer failed on the generated text");
+    Checker.Check(FLoaderOBJ::ParseOBJBufferParallel(Text.data(), Text.size(), ParallelText), "ParseOBJBufferParallel failed on the generated text");
+    Checker.Check(IsSameObjInfo(ParallelText, SerialText, 0.f), "parallel parse of the generated text differs from ParseOBJBuffer");
+
+    // 경로가 없으면 기존 파서도 읽을 수 있는 텍스트를 임시 파일로 저장해서 파일 파서들을 비교
+    FString Path = ObjFilePath;
+    std::filesystem::path TempPath;
+    std::error_code ErrorCode;
+    if (Path.IsEmpty())
+    {
+        const std::string PlainText = BuildPlainObjText(FLoaderOBJ::MinParallelChunkBytes * 2);
+        TempPath = std::filesystem::temp_directory_path(ErrorCode) / "EngineBenchmarks.obj";
+        std::ofstream File(TempPath, std::ios::binary);
+        File.write(PlainText.data(), static_cast<std::streamsize>(PlainText.size()));
+        File.close();
+        if (!Checker.Check(!ErrorCode && File.good(), "cannot write the generated OBJ to a temporary file"))
+        {
+            return Checker.Finish();
+        }
+        Path = TempPath.string();
+    }
+
+    const uint64 FileSize = std::filesystem::file_size(Path.ToWideString(), ErrorCode);
+    if (!Checker.Check(!ErrorCode, "cannot open the OBJ file"))
+    {
+        return Checker.Finish();
+    }
+
+    struct FParserEntry
+    {
+        const char* Name;
+        bool (*Parse)(const FString&, FObjInfo&);
+    };
+    const FParserEntry Parsers[] = {
+        { "Stream", &FLoaderOBJ::ParseOBJStream },
+        { "MemoryMapped", &FLoaderOBJ::ParseOBJMapped },
+        { "Parallel", &FLoaderOBJ::ParseOBJParallel },
+    };
+
+    FObjInfo Results[std::size(Parsers)];
+    double ParserMs[std::size(Parsers)] = {};
+    bool bAllParsed = true;
+    for (int32 ParserIndex = 0; ParserIndex < static_cast<int32>(std::size(Parsers)); ++ParserIndex)
+    {
+        const FParserEntry& Parser = Parsers[ParserIndex];
+        bool bParsed = true;
+        ParserMs[ParserIndex] = MeasureMs(NumIterations, [&]()
+        {
+            Results[ParserIndex] = FObjInfo();
+            bParsed &= Parser.Parse(Path, Results[ParserIndex]);
+        });
+        bAllParsed &= Checker.Check(bParsed, "%s parser failed to parse the OBJ file", Parser.Name);
+    }
+
+    if (bAllParsed)
+    {
+        // Stream 파서는 istream의 실수 변환을 사용하므로 오차를 허용하고, 병렬 파서는 비트 단위로 같아야 함
+        Checker.Check(IsSameObjInfo(Results[0], Results[1], 1.e-6f), "MemoryMapped parser differs from the Stream parser");
+        Checker.Check(IsSameObjInfo(Results[2], Results[1], 0.f), "Parallel parser differs from the MemoryMapped parser");
+
+        // 정점 용접: 모든 코너가 원래의 위치, UV, 노멀을 가리키고, 같은 (v, vt, vn, 머티리얼) 조합은 정점 하나로 합쳐져야 함
+        const FObjInfo& ObjInfo = Results[1];
+        OBJ::FStaticMeshRenderData RenderData;
+        RenderData.MaterialSubsets = ObjInfo.MaterialSubsets;
+        const double WeldMs = MeasureMs(1, [&]() { FLoaderOBJ::ConvertToStaticMesh(ObjInfo, RenderData); });
+
+        const int32 NumCorners = ObjInfo.VertexIndices.Num();
+        if (Checker.Check(RenderData.Indices.Num() == NumCorners, "welded mesh has %d indices, expected %d", RenderData.Indices.Num(), NumCorners))
+        {
+            std::set<std::tuple<uint32, uint32, uint32, uint32>> UniqueCorners;
+            int32 NumWrongCorners = 0;
+            for (int32 i = 0; i < NumCorners; ++i)
+            {
+                const FStaticMeshVertex& Vertex = RenderData.Vertices[RenderData.Indices[i]];
+                const FVector& Position = ObjInfo.Vertices[ObjInfo.VertexIndices[i]];
+                NumWrongCorners += Vertex.X != Position.X || Vertex.Y != Position.Y || Vertex.Z != Position.Z;
+                UniqueCorners.emplace(ObjInfo.VertexIndices[i], ObjInfo.UVIndices[i], ObjInfo.NormalIndices[i], Vertex.MaterialIndex);
+            }
+            Checker.Check(NumWrongCorners == 0, "%d welded corners moved away from their OBJ position", NumWrongCorners);
+            Checker.Check(
+                static_cast<int32>(UniqueCorners.size()) == RenderData.Vertices.Num(),
+                "welding made %d vertices, expected %d unique corners", RenderData.Vertices.Num(), static_cast<int32>(UniqueCorners.size())
+            );
+        }
+
+        const double NumTriangles = NumCorners / 3.0;
+        for (int32 ParserIndex = 0; ParserIndex < static_cast<int32>(std::size(Parsers)); ++ParserIndex)
+        {
+            const double Seconds = std::max(ParserMs[ParserIndex], 1e-6) / 1000.0;
+            Report(
+                LogLevel::Display, "ObjParse Benchmark: %-12s %8.3f ms, %8.2f MB/s, %8.3f Mtris/s",
+                Parsers[ParserIndex].Name, ParserMs[ParserIndex], FileSize / (1024.0 * 1024.0) / Seconds, NumTriangles / 1.e6 / Seconds
+            );
+        }
+        Report(
+            LogLevel::Display, "ObjParse Benchmark: %d vertices, %d triangles, %u worker threads, vertex weld %d -> %d vertices (%.1f%% reduction), convert %.3f ms",
+            ObjInfo.Vertices.Num(), NumCorners / 3, FQueuedThreadPool::Get().GetNumThreads(), NumCorners, RenderData.Vertices.Num(),
+            NumCorners > 0 ? 100.0 * (NumCorners - RenderData.Vertices.Num()) / NumCorners : 0.0, WeldMs
+        );
+    }
+
+    if (!TempPath.empty())
+    {
+        std::filesystem::remove(TempPath, ErrorCode);
+    }
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::AsyncMeshLoading(const TArray<FString>& FilePaths, bool bPublish)
+{
+    FBenchmarkChecker Checker("AsyncMesh");
+
+    // 같은 파일을 동시에 빌드하면 캐시 파일 쓰기가 겹치므로 중복 제거
+    TArray<FString> Paths;
+    for (const FString& Path : FilePaths)
+    {
+        Paths.AddUnique(Path);
+    }
+
+    // 경로가 없으면 크기가 다른 OBJ와 공통 MTL을 임시 폴더에 만들어 사용
+    std::filesystem::path TempDirectory;
+    std::error_code ErrorCode;
+    if (Paths.IsEmpty())
+    {
+        constexpr int32 NumGeneratedMeshes = 4;
+        TempDirectory = std::filesystem::temp_directory_path(ErrorCode) / "EngineBenchmarks";
+        std::filesystem::create_directories(TempDirectory, ErrorCode);
+
+        bool bWritten = !ErrorCode;
+        {
+            std::ofstream File(TempDirectory / "Plain.mtl", std::ios::binary);
+            File << "newmtl Material0\nKd 1 0 0\nnewmtl Material1\nKd 0 1 0\nnewmtl Material2\nKd 0 0 1\n";
+            File.close();
+            bWritten &= File.good();
+        }
+        for (int32 i = 0; i < NumGeneratedMeshes; ++i)
+        {
+            const std::string Text = BuildPlainObjText(64 * 1024 * (i + 1));
+            const std::filesystem::path Path = TempDirectory / ("Mesh" + std::to_string(i) + ".obj");
+            std::ofstream File(Path, std::ios::binary);
+            File.write(Text.data(), static_cast<std::streamsize>(Text.size()));
+            File.close();
+            bWritten &= File.good();
+            Paths.Add(Path.string());
+        }
+        if (!Checker.Check(bWritten, "cannot write the generated meshes to a temporary directory"))
+        {
+            std::filesystem::remove_all(TempDirectory, ErrorCode);
+            return Checker.Finish();
+        }
+    }
+    const int32 NumMeshes = Paths.Num();
+
+    // 기준 경로: 호출한 스레드에서 순서대로 빌드 (캐시가 없으면 여기서 만들어짐)
+    TArray<OBJ::FStaticMeshRenderData> SerialResults;
+    SerialResults.SetNum(NumMeshes);
+    TArray<uint8> SerialSucceeded;
+    SerialSucceeded.SetNum(NumMeshes);
+    const double SerialMs = MeasureMs(1, [&]()
+    {
+        for (int32 i = 0; i < NumMeshes; ++i)
+        {
+            SerialSucceeded[i] = FManagerOBJ::BuildStaticMeshRenderData(Paths[i], SerialResults[i]);
+        }
+    });
+
+    // 같은 메시들을 워커 스레드에서 동시에 빌드, 이번에는 캐시에서 읽음
+    TArray<OBJ::FStaticMeshRenderData> ConcurrentResults;
+    ConcurrentResults.SetNum(NumMeshes);
+    TArray<uint8> ConcurrentSucceeded;
+    ConcurrentSucceeded.SetNum(NumMeshes);
+    const double ConcurrentMs = MeasureMs(1, [&]()
+    {
+        ParallelFor(NumMeshes, [&](int32 Index)
+        {
+            ConcurrentSucceeded[Index] = FManagerOBJ::BuildStaticMeshRenderData(Paths[Index], ConcurrentResults[Index]);
+        });
+    });
+
+    for (int32 i = 0; i < NumMeshes; ++i)
+    {
+        if (!Checker.Check(SerialSucceeded[i], "failed to load mesh %d", i))
+        {
+            continue;
+        }
+        Checker.Check(ConcurrentSucceeded[i] && IsSameRenderData(ConcurrentResults[i], SerialResults[i]), "concurrent load of mesh %d does not match", i);
+        Checker.Check(SerialResults[i].BVH && ConcurrentResults[i].BVH, "mesh %d was loaded without a picking BVH", i);
+    }
+
+    // LoadStaticMeshAsync로 요청하고 등록까지 끝나는지 확인, GPU 버퍼와 UObject를 만드므로 엔진이 초기화된 뒤에만 실행
+    double AsyncMs = 0.0;
+    if (bPublish)
+    {
+        int32 NumCallbacks = 0;
+        TArray<FStaticMeshLoadHandle> Handles;
+        Handles.Reserve(NumMeshes);
+        AsyncMs = MeasureMs(1, [&]()
+        {
+            for (const FString& Path : Paths)
+            {
+                Handles.Add(FManagerOBJ::LoadStaticMeshAsync(Path, [&NumCallbacks](UStaticMesh*) { ++NumCallbacks; }));
+            }
+            FManagerOBJ::FlushAsyncLoads();
+        });
+
+        for (int32 i = 0; i < NumMeshes; ++i)
+        {
+            const UStaticMesh* StaticMesh = Handles[i]->GetStaticMesh();
+            Checker.Check(
+                Handles[i]->Succeeded() && StaticMesh && IsSameRenderData(*StaticMesh->GetRenderData(), SerialResults[i]),
+                "async load of mesh %d does not match", i
+            );
+        }
+        Checker.Check(NumCallbacks == NumMeshes, "%d of %d load callbacks were called", NumCallbacks, NumMeshes);
+    }
+
+    Report(
+        LogLevel::Display, "AsyncMesh Benchmark: %d meshes, serial %.3f ms, concurrent %.3f ms (%.1fx), async publish %.3f ms, %u worker threads",
+        NumMeshes, SerialMs, ConcurrentMs, Speedup(SerialMs, ConcurrentMs), AsyncMs, FQueuedThreadPool::Get().GetNumThreads()
+    );
+
+    // 임시 메시의 기록이 쿠킹 데이터베이스 파일에 남지 않도록 지움
+    if (!TempDirectory.empty())
+    {
+        for (const FString& Path : Paths)
+        {
+            FCookDatabase::Get().Invalidate(Path);
+        }
+        std::filesystem::remove_all(TempDirectory, ErrorCode);
+    }
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::MeshPicking(const OBJ::FStaticMeshRenderData& RenderData, int32 NumRays)
+{
+    FBenchmarkChecker Checker("BVH");
+    NumRays = std::max(NumRays, 1);
+
+    FStaticMeshBVH BVH;
+    const double BuildMs = MeasureMs(1, [&]() { BVH.Build(RenderData.Vertices, RenderData.Indices); });
+
+    // 바운딩 박스를 감싸는 구 위에서 박스 안의 임의의 점을 향하는 레이
+    const FVector Center = (RenderData.BoundingBoxMin + RenderData.BoundingBoxMax) * 0.5f;
+    const FVector Extent = RenderData.BoundingBoxMax - RenderData.BoundingBoxMin;
+    const float Radius = std::max(Extent.Length(), 1e-3f);
+
+    FBenchmarkRandom Random;
+    TArray<FVector> Origins;
+    TArray<FVector> Directions;
+    Origins.SetNum(NumRays);
+    Directions.SetNum(NumRays);
+    for (int32 i = 0; i < NumRays; ++i)
+    {
+        FVector OnSphere;
+        do
+        {
+            OnSphere = Random.Vector(-1.f, 1.f);
+        } while (OnSphere.Length() < 1e-3f || OnSphere.Length() > 1.f);
+
+        const FVector Target = RenderData.BoundingBoxMin + FVector(Extent.X * Random.Range(0.f, 1.f), Extent.Y * Random.Range(0.f, 1.f), Extent.Z * Random.Range(0.f, 1.f));
+        Origins[i] = Center + OnSphere.GetSafeNormal() * Radius;
+        Directions[i] = (Target - Origins[i]).GetSafeNormal();
+    }
+
+    // 기준 경로: BVH 없이 모든 삼각형을 검사
+    TArray<FBVHRayHit> BruteForceHits;
+    BruteForceHits.SetNum(NumRays);
+    const double BruteForceMs = MeasureMs(1, [&]()
+    {
+        for (int32 i = 0; i < NumRays; ++i)
+        {
+            BruteForceHits[i] = FBVHRayHit();
+            FStaticMeshBVH::RaycastBruteForce(RenderData.Vertices, RenderData.Indices, Origins[i], Directions[i], BruteForceHits[i]);
+        }
+    });
+
+    TArray<FBVHRayHit> AllHits;
+    AllHits.SetNum(NumRays);
+    const double AllHitsMs = MeasureMs(1, [&]()
+    {
+        for (int32 i = 0; i < NumRays; ++i)
+        {
+            AllHits[i] = FBVHRayHit();
+            BVH.Raycast(Origins[i], Directions[i], AllHits[i], true);
+        }
+    });
+
+    TArray<FBVHRayHit> NearestHits;
+    NearestHits.SetNum(NumRays);
+    const double NearestMs = MeasureMs(1, [&]()
+    {
+        for (int32 i = 0; i < NumRays; ++i)
+        {
+            NearestHits[i] = FBVHRayHit();
+            BVH.Raycast(Origins[i], Directions[i], NearestHits[i], false);
+        }
+    });
+
+    // 같은 거리의 삼각형이 여럿이면 고르는 삼각형이 다를 수 있으므로 거리와 교차 수를 비교
+    Checker.Check(BVH.GetNumTriangles() == RenderData.Indices.Num() / 3, "BVH has %d triangles, expected %d", BVH.GetNumTriangles(), RenderData.Indices.Num() / 3);
+    Checker.CheckEqualArrays(AllHits, BruteForceHits, "BVH hits counting all triangles", [](const FBVHRayHit& A, const FBVHRayHit& B)
+    {
+        return A.NumHits == B.NumHits && A.Distance == B.Distance;
+    });
+    Checker.CheckEqualArrays(NearestHits, BruteForceHits, "BVH nearest hits", [](const FBVHRayHit& A, const FBVHRayHit& B)
+    {
+        return (A.NumHits > 0) == (B.NumHits > 0) && A.Distance == B.Distance;
+    });
+
+    int32 NumRaysHit = 0;
+    for (const FBVHRayHit& Hit : BruteForceHits)
+    {
+        NumRaysHit += Hit.NumHits > 0;
+    }
+
+    const double MicrosecondsPerRay = 1000.0 / NumRays;
+    Report(
+        LogLevel::Display, "BVH Benchmark: %d triangles, %d nodes, build %.3f ms, %d rays (%d hit)",
+        BVH.GetNumTriangles(), BVH.GetNumNodes(), BuildMs, NumRays, NumRaysHit
+    );
+    Report(
+        LogLevel::Display, "BVH Benchmark: brute force %.3f us/ray, BVH all hits %.3f us/ray (%.1fx), BVH nearest %.3f us/ray (%.1fx)",
+        BruteForceMs * MicrosecondsPerRay,
+        AllHitsMs * MicrosecondsPerRay, Speedup(BruteForceMs, AllHitsMs),
+        NearestMs * MicrosecondsPerRay, Speedup(BruteForceMs, NearestMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::RayTriangleKernel(int32 NumTriangles, int32 NumRays)
+{
+    FBenchmarkChecker Checker("Ray-Triangle");
+    NumTriangles = std::max(NumTriangles, 1);
+    NumRays = std::max(NumRays, 1);
+
+    // 단위 정육면체 안의 작은 삼각형들과, 정육면체를 가로지르는 레이
+    FBenchmarkRandom Random;
+    const int32 NumPackets = (NumTriangles + FTrianglePacket4::Width - 1) / FTrianglePacket4::Width;
+    TArray<FVector> Positions;
+    TArray<FTrianglePacket4> TrianglePackets;
+    Positions.SetNum(NumTriangles * 3);
+    TrianglePackets.SetNum(NumPackets);
+    for (int32 i = 0; i < NumTriangles; ++i)
+    {
+        const FVector V0 = Random.Vector(-1.f, 1.f);
+        Positions[i * 3 + 0] = V0;
+        Positions[i * 3 + 1] = V0 + Random.Vector(-0.25f, 0.25f);
+        Positions[i * 3 + 2] = V0 + Random.Vector(-0.25f, 0.25f);
+        TrianglePackets[i / FTrianglePacket4::Width].SetTriangle(i % FTrianglePacket4::Width, Positions[i * 3 + 0], Positions[i * 3 + 1], Positions[i * 3 + 2]);
+    }
+
+    TArray<FRay4> Rays;
+    Rays.Reserve(NumRays);
+    for (int32 i = 0; i < NumRays; ++i)
+    {
+        const FVector Origin = Random.Vector(-1.f, 1.f) * 2.f;
+        const FVector Target = Random.Vector(-1.f, 1.f) * 0.5f;
+        Rays.Add(FRay4(Origin, (Target - Origin).GetSafeNormal()));
+    }
+
+    // 교차한 삼각형 수와 거리의 합으로 각 구현의 결과를 비교
+    struct FKernelResult
+    {
+        int32 NumHits = 0;
+        double DistanceSum = 0.0;
+    };
+
+    // 기준 경로: 삼각형마다 UPrimitiveComponent::IntersectRayTriangle
+    FKernelResult Reference;
+    const double ReferenceMs = MeasureMs(1, [&]()
+    {
+        for (const FRay4& Ray : Rays)
+        {
+            for (int32 i = 0; i < NumTriangles; ++i)
+            {
+                float Distance;
+                if (UPrimitiveComponent::IntersectRayTriangle(Ray.Origin, Ray.Direction, Positions[i * 3 + 0], Positions[i * 3 + 1], Positions[i * 3 + 2], Distance))
+                {
+                    ++Reference.NumHits;
+                    Reference.DistanceSum += Distance;
+                }
+            }
+        }
+    });
+
+    auto RunPacket = [&](FKernelResult& OutResult, auto&& IntersectPacket)
+    {
+        return MeasureMs(1, [&]()
+        {
+            alignas(16) float Distances[FTrianglePacket4::Width];
+            for (const FRay4& Ray : Rays)
+            {
+                for (const FTrianglePacket4& Packet : TrianglePackets)
+                {
+                    for (uint32 HitMask = IntersectPacket(Ray, Packet, Distances); HitMask != 0; HitMask &= HitMask - 1)
+                    {
+                        ++OutResult.NumHits;
+                        OutResult.DistanceSum += Distances[std::countr_zero(HitMask)];
+                    }
+                }
+            }
+        });
+    };
+
+    // 함수 포인터로 넘기면 인라인되지 않으므로 람다로 감쌈
+    FKernelResult Scalar;
+    const double ScalarMs = RunPacket(
+        Scalar, [](const FRay4& Ray, const FTrianglePacket4& Packet, float* OutDistances) { return RayTriangle::IntersectPacketScalar(Ray, Packet, OutDistances); }
+    );
+    FKernelResult SIMD;
+    const double SIMDMs = RunPacket(
+        SIMD, [](const FRay4& Ray, const FTrianglePacket4& Packet, float* OutDistances) { return RayTriangle::IntersectPacket(Ray, Packet, OutDistances); }
+    );
+
+    // 측정한 결과도 비교에 써야 측정 루프가 최적화로 사라지지 않음
+    Checker.Check(
+        Scalar.NumHits == Reference.NumHits && Scalar.DistanceSum == Reference.DistanceSum,
+        "packet scalar kernel found %d hits, expected %d", Scalar.NumHits, Reference.NumHits
+    );
+    Checker.Check(
+        SIMD.NumHits == Reference.NumHits && SIMD.DistanceSum == Reference.DistanceSum,
+        "packet SIMD kernel found %d hits, expected %d", SIMD.NumHits, Reference.NumHits
+    );
+
+    // 레이마다 모든 결과를 비교, 교차 여부와 거리가 비트 단위로 같아야 함
+    int32 NumMismatches = 0;
+    for (const FRay4& Ray : Rays)
+    {
+        for (int32 PacketIndex = 0; PacketIndex < NumPackets; ++PacketIndex)
+        {
+            const FTrianglePacket4& Packet = TrianglePackets[PacketIndex];
+            alignas(16) float ScalarDistances[FTrianglePacket4::Width];
+            alignas(16) float SIMDDistances[FTrianglePacket4::Width];
+            const uint32 ScalarMask = RayTriangle::IntersectPacketScalar(Ray, Packet, ScalarDistances);
+            const uint32 SIMDMask = RayTriangle::IntersectPacket(Ray, Packet, SIMDDistances);
+
+            for (int32 Lane = 0; Lane < FTrianglePacket4::Width; ++Lane)
+            {
+                const int32 TriangleIndex = PacketIndex * FTrianglePacket4::Width + Lane;
+                if (TriangleIndex >= NumTriangles)
+                {
+                    break;
+                }
+
+                float Distance = 0.f;
+                const bool bExpected = UPrimitiveComponent::IntersectRayTriangle(
+                    Ray.Origin, Ray.Direction, Positions[TriangleIndex * 3 + 0], Positions[TriangleIndex * 3 + 1], Positions[TriangleIndex * 3 + 2], Distance
+                );
+                const bool bScalarHit = (ScalarMask >> Lane) & 1;
+                const bool bSIMDHit = (SIMDMask >> Lane) & 1;
+                if (bScalarHit != bExpected || bSIMDHit != bExpected
+                    || (bExpected && (ScalarDistances[Lane] != Distance || SIMDDistances[Lane] != Distance)))
+                {
+                    ++NumMismatches;
+                }
+            }
+        }
+    }
+    Checker.Check(NumMismatches == 0, "%d ray-triangle results differ from IntersectRayTriangle", NumMismatches);
+
+    const double NumTests = static_cast<double>(NumTriangles) * NumRays;
+    auto GetMillionTrianglesPerSecond = [NumTests](double Milliseconds)
+    {
+        return NumTests / std::max(Milliseconds, 1e-6) / 1000.0;
+    };
+
+    Report(
+        LogLevel::Display, "Ray-Triangle Benchmark: %d triangles x %d rays, %d hits, SSE %s",
+        NumTriangles, NumRays, Reference.NumHits, RAY_TRIANGLE_USE_SSE ? "enabled" : "disabled"
+    );
+    Report(
+        LogLevel::Display, "Ray-Triangle Benchmark: reference %.1f Mtri/s, packet scalar %.1f Mtri/s (%.1fx), packet SIMD %.1f Mtri/s (%.1fx)",
+        GetMillionTrianglesPerSecond(ReferenceMs),
+        GetMillionTrianglesPerSecond(ScalarMs), Speedup(ReferenceMs, ScalarMs),
+        GetMillionTrianglesPerSecond(SIMDMs), Speedup(ReferenceMs, SIMDMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::TransformHierarchy(int32 NumComponents)
+{
+    FBenchmarkChecker Checker("Transform Hierarchy");
+    NumComponents = std::max(NumComponents, 1);
+
+    // 루트 하나에 평균 20개 정도의 컴포넌트가 붙은 무작위 계층 구조, World가 없으므로 MarkStructureDirty는 직접 호출
+    FBenchmarkRandom Random;
+    TArray<USceneComponent*> Components;
+    TArray<USceneComponent*> Roots;
+    Components.SetNum(NumComponents);
+    int32 RootIndex = 0;
+    for (int32 Index = 0; Index < NumComponents; ++Index)
+    {
+        USceneComponent* Component = FObjectFactory::ConstructObject<USceneComponent>(nullptr);
+        Component->InitializeComponent();
+        Component->SetRelativeLocation(Random.Vector(-100.f, 100.f));
+        Component->SetRelativeRotation(FRotator(Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f)));
+        Component->SetRelativeScale3D(Random.Vector(0.5f, 2.f));
+        Components[Index] = Component;
+
+        // 현재 루트의 서브트리 안에서 부모를 고름
+        if (Index > 0 && Random.RangeInt(0, 19) != 0)
+        {
+            Component->SetupAttachment(Components[Random.RangeInt(RootIndex, Index - 1)]);
+        }
+        else
+        {
+            RootIndex = Index;
+            Roots.Add(Component);
+        }
+    }
+
+    FSceneTransformHierarchy Hierarchy;
+    Hierarchy.Update(nullptr);
+    for (USceneComponent* Root : Roots)
+    {
+        Hierarchy.MarkStructureDirty(Root);
+    }
+
+    // 기준 경로: 컴포넌트마다 부모를 따라 올라가며 누적 행렬을 다시 계산
+    struct FAccumulated
+    {
+        FMatrix Scale, Rotation, Translation;
+    };
+    auto Accumulate = [](auto& Self, const USceneComponent* Component) -> FAccumulated
+    {
+        const FMatrix ScaleMat = FMatrix::GetScaleMatrix(Component->GetRelativeScale3D());
+        const FMatrix RotationMat = FMatrix::GetRotationMatrix(Component->GetRelativeRotation());
+        const FMatrix TranslationMat = FMatrix::GetTranslationMatrix(Component->GetRelativeLocation());
+        const USceneComponent* Parent = Component->GetAttachParent();
+        if (Parent == nullptr)
+        {
+            return { ScaleMat, RotationMat, TranslationMat };
+        }
+        const FAccumulated ParentMatrices = Self(Self, Parent);
+        return { ScaleMat * ParentMatrices.Scale, RotationMat * ParentMatrices.Rotation, TranslationMat * ParentMatrices.Translation };
+    };
+    TArray<FMatrix> ParentWalkMatrices;
+    ParentWalkMatrices.SetNum(NumComponents);
+    auto ComputeParentWalk = [&]()
+    {
+        for (int32 Index = 0; Index < NumComponents; ++Index)
+        {
+            const USceneComponent* Component = Components[Index];
+            const FMatrix RTMat = FMatrix::GetRotationMatrix(Component->GetRelativeRotation()) * FMatrix::GetTranslationMatrix(Component->GetRelativeLocation());
+            const USceneComponent* Parent = Component->GetAttachParent();
+            if (Parent == nullptr)
+            {
+                ParentWalkMatrices[Index] = FMatrix::GetScaleMatrix(Component->GetRelativeScale3D()) * RTMat;
+                continue;
+            }
+            const FAccumulated Self = Accumulate(Accumulate, Component);
+            const FAccumulated ParentMatrices = Accumulate(Accumulate, Parent);
+            ParentWalkMatrices[Index] = Self.Scale * (RTMat * (ParentMatrices.Rotation * ParentMatrices.Translation));
+        }
+    };
+
+    // 모든 컴포넌트가 배열에 있고, 배열의 행렬이 기준 경로와 비트 단위로 같아야 함
+    auto CheckMatrices = [&](const char* What)
+    {
+        Checker.Check(
+            Hierarchy.Num() - Hierarchy.GetNumDeadEntries() == NumComponents,
+            "%s: hierarchy holds %d components, expected %d", What, Hierarchy.Num() - Hierarchy.GetNumDeadEntries(), NumComponents
+        );
+        TArray<FMatrix> HierarchyMatrices;
+        HierarchyMatrices.SetNum(NumComponents);
+        for (int32 Index = 0; Index < NumComponents; ++Index)
+        {
+            HierarchyMatrices[Index] = FSceneTransformHierarchy::GetWorldMatrix(Components[Index]);
+        }
+        Checker.CheckEqualArrays(HierarchyMatrices, ParentWalkMatrices, What, IsBitwiseEqual<FMatrix>);
+    };
+
+    const double ParentWalkMs = MeasureMs(1, ComputeParentWalk);
+
+    // 모든 트리를 배열에 추가하고 전체를 계산, 서브트리마다 나눠서 병렬
+    const double FullMs = MeasureMs(1, [&]() { Hierarchy.Update(nullptr); });
+    const int32 NumFullUpdated = Hierarchy.GetNumUpdatedLastFrame();
+    Checker.Check(NumFullUpdated == NumComponents, "full update computed %d components, expected %d", NumFullUpdated, NumComponents);
+    CheckMatrices("full update");
+
+    // 1%만 회전이 바뀐 경우, 자손까지 다시 계산
+    const int32 NumChanged = std::max(NumComponents / 100, 1);
+    for (int32 i = 0; i < NumChanged; ++i)
+    {
+        Components[Random.RangeInt(0, NumComponents - 1)]->SetRelativeRotation(
+            FRotator(Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f), Random.Range(-180.f, 180.f))
+        );
+    }
+    const double PartialMs = MeasureMs(1, [&]() { Hierarchy.Update(nullptr); });
+    const int32 NumPartialUpdated = Hierarchy.GetNumUpdatedLastFrame();
+    ComputeParentWalk();
+    CheckMatrices("1% dirty update");
+
+    // 1%를 다른 루트로 옮긴 경우, 바뀐 트리만 다시 추가하고 계산
+    for (int32 i = 0; i < NumChanged; ++i)
+    {
+        USceneComponent* Component = Components[Random.RangeInt(0, NumComponents - 1)];
+        USceneComponent* NewRoot = Roots[Random.RangeInt(0, Roots.Num() - 1)];
+        if (Component->GetAttachParent() == nullptr || Component == NewRoot)
+        {
+            continue;
+        }
+        Hierarchy.MarkStructureDirty(Component);
+        Component->AttachToComponent(NewRoot);
+        Hierarchy.MarkStructureDirty(Component);
+    }
+    const double ReattachMs = MeasureMs(1, [&]() { Hierarchy.Update(nullptr); });
+    const int32 NumReattachUpdated = Hierarchy.GetNumUpdatedLastFrame();
+    ComputeParentWalk();
+    CheckMatrices("reattach update");
+
+    Report(
+        LogLevel::Display, "Transform Hierarchy Benchmark: %d components, %d roots, updated %d (1%% dirty: %d, 1%% reattached: %d)",
+        NumComponents, Roots.Num(), NumFullUpdated, NumPartialUpdated, NumReattachUpdated
+    );
+    Report(
+        LogLevel::Display,
+        "Transform Hierarchy Benchmark: parent walk %.3f ms, flat build + parallel %.3f ms (%.1fx), 1%% dirty %.3f ms (%.1fx), 1%% reattached %.3f ms (%.1fx)",
+        ParentWalkMs, FullMs, Speedup(ParentWalkMs, FullMs), PartialMs, Speedup(ParentWalkMs, PartialMs), ReattachMs, Speedup(ParentWalkMs, ReattachMs)
+    );
+
+    for (USceneComponent* Component : Components)
+    {
+        Component->DestroyComponent();
+    }
+    GUObjectArray.ProcessPendingDestroyObjects();
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::UObjectArray(int32 NumObjects)
+{
+    FBenchmarkChecker Checker("UObject Array");
+    NumObjects = std::max(NumObjects, 2);
+    UClass* Class = UObject::StaticClass();
+
+    // 벤치마크 전에 있던 같은 Class의 Object는 비교에서 빼고, 끝난 뒤 살아있는 Object 수가 그대로인지 확인
+    TSet<UObject*> PreexistingObjects;
+    if (const TArray<UObject*>* ClassArray = GUObjectArray.FindObjectsOfClass(Class))
+    {
+        for (UObject* Object : *ClassArray)
+        {
+            PreexistingObjects.Add(Object);
+        }
+    }
+    const int32 NumGlobalAlive = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+    // 기준 경로: 전체 TSet과 Class별 TSet
+    TSet<UObject*> LegacyObjects;
+    TMap<UClass*, TSet<UObject*>> LegacyClassObjects;
+
+    // GUObjectArray의 Class별 배열에서 이번에 만든 살아있는 Object들, 순서는 다르므로 정렬해서 비교
+    auto GatherSpawned = [&]()
+    {
+        TArray<UObject*> Spawned;
+        if (const TArray<UObject*>* ClassArray = GUObjectArray.FindObjectsOfClass(Class))
+        {
+            for (UObject* Object : *ClassArray)
+            {
+                if (!GUObjectArray.IsPendingDestroy(Object) && !PreexistingObjects.Contains(Object))
+                {
+                    Spawned.Add(Object);
+                }
+            }
+        }
+        std::sort(Spawned.begin(), Spawned.end());
+        return Spawned;
+    };
+    auto GatherLegacy = [&]()
+    {
+        TArray<UObject*> Legacy;
+        if (const TSet<UObject*>* ClassSet = LegacyClassObjects.Find(Class))
+        {
+            for (UObject* Object : *ClassSet)
+            {
+                Legacy.Add(Object);
+            }
+        }
+        std::sort(Legacy.begin(), Legacy.end());
+        return Legacy;
+    };
+    auto CheckIndices = [&](const TArray<UObject*>& Objects, const char* What)
+    {
+        int32 NumMismatched = 0;
+        for (UObject* Object : Objects)
+        {
+            NumMismatched += GUObjectArray.IndexToObject(static_cast<int32>(Object->GetInternalIndex())) != Object;
+        }
+        Checker.Check(NumMismatched == 0, "%s: %d objects are not at their InternalIndex", What, NumMismatched);
+    };
+
+    // 생성: ConstructObject는 Object 생성까지 포함하므로 기준 경로는 같은 Object를 TSet에 넣는 시간만 잼
+    TArray<UObject*> Objects;
+    Objects.SetNum(NumObjects);
+    const double SpawnMs = MeasureMs(1, [&]()
+    {
+        for (UObject*& Object : Objects)
+        {
+            Object = FObjectFactory::ConstructObject(Class, nullptr);
+        }
+    });
+    const double LegacySpawnMs = MeasureMs(1, [&]()
+    {
+        for (UObject* Object : Objects)
+        {
+            LegacyObjects.Add(Object);
+            LegacyClassObjects.FindOrAdd(Object->GetClass()).Add(Object);
+        }
+    });
+    Checker.CheckEqualArrays(GatherSpawned(), GatherLegacy(), "objects of class after spawn");
+    CheckIndices(Objects, "spawn");
+
+    // Class의 Object 순회
+    TArray<UObject*> Results;
+    Results.Reserve(NumObjects + PreexistingObjects.Num());
+    const double LegacyIterateMs = MeasureMs(1, [&]()
+    {
+        for (UObject* Object : *LegacyClassObjects.Find(Class))
+        {
+            Results.Add(Object);
+        }
+    });
+    Results.Empty();
+    const double IterateMs = MeasureMs(1, [&]()
+    {
+        if (const TArray<UObject*>* ClassArray = GUObjectArray.FindObjectsOfClass(Class))
+        {
+            for (UObject* Object : *ClassArray)
+            {
+                Results.Add(Object);
+            }
+        }
+    });
+    Checker.Check(
+        Results.Num() == NumObjects + PreexistingObjects.Num(), "iterated %d objects, expected %d", Results.Num(), NumObjects + PreexistingObjects.Num()
+    );
+
+    // 무작위 순서로 절반을 제거, 제거 대기 중인 Object는 순회에서 걸러지고 Process 뒤에는 자리와 Class별 배열에서 빠져야 함
+    TArray<UObject*> RemoveOrder = Objects;
+    std::shuffle(RemoveOrder.begin(), RemoveOrder.end(), std::mt19937(12345));
+    TArray<UObject*> Survivors;
+    for (int32 Index = NumObjects / 2; Index < NumObjects; ++Index)
+    {
+        Survivors.Add(RemoveOrder[Index]);
+    }
+    RemoveOrder.SetNum(NumObjects / 2);
+
+    const double LegacyDestroyMs = MeasureMs(1, [&]()
+    {
+        for (UObject* Object : RemoveOrder)
+        {
+            LegacyObjects.Remove(Object);
+            LegacyClassObjects.FindOrAdd(Object->GetClass()).Remove(Object);
+        }
+    });
+    const double MarkMs = MeasureMs(1, [&]()
+    {
+        for (UObject* Object : RemoveOrder)
+        {
+            GUObjectArray.MarkRemoveObject(Object);
+        }
+    });
+    Checker.CheckEqualArrays(GatherSpawned(), GatherLegacy(), "objects of class while pending destroy");
+
+    // 소멸자와 풀로 반환하는 시간도 포함
+    const double ProcessMs = MeasureMs(1, [&]() { GUObjectArray.ProcessPendingDestroyObjects(); });
+    Checker.CheckEqualArrays(GatherSpawned(), GatherLegacy(), "objects of class after destroy");
+    CheckIndices(Survivors, "destroy");
+    Checker.Check(
+        GUObjectArray.GetObjectArrayNumMinusAvailable() == NumGlobalAlive + Survivors.Num(),
+        "%d objects alive after destroy, expected %d", GUObjectArray.GetObjectArrayNumMinusAvailable(), NumGlobalAlive + Survivors.Num()
+    );
+
+    // 비어있는 자리를 재사용하므로 자리가 더 늘어나지 않아야 함
+    const int32 NumSlotsBeforeRespawn = GUObjectArray.GetObjectArrayNum();
+    TArray<UObject*> Respawned;
+    Respawned.SetNum(RemoveOrder.Num());
+    const double RespawnMs = MeasureMs(1, [&]()
+    {
+        for (UObject*& Object : Respawned)
+        {
+            Object = FObjectFactory::ConstructObject(Class, nullptr);
+        }
+    });
+    for (UObject* Object : Respawned)
+    {
+        LegacyObjects.Add(Object);
+        LegacyClassObjects.FindOrAdd(Object->GetClass()).Add(Object);
+    }
+    Checker.Check(
+        GUObjectArray.GetObjectArrayNum() == NumSlotsBeforeRespawn, "respawn grew the array from %d to %d slots",
+        NumSlotsBeforeRespawn, GUObjectArray.GetObjectArrayNum()
+    );
+    Checker.CheckEqualArrays(GatherSpawned(), GatherLegacy(), "objects of class after respawn");
+    CheckIndices(Respawned, "respawn");
+
+    // 만든 Object를 모두 제거해서 GUObjectArray를 원래대로 되돌림
+    for (UObject* Object : Survivors)
+    {
+        GUObjectArray.MarkRemoveObject(Object);
+    }
+    for (UObject* Object : Respawned)
+    {
+        GUObjectArray.MarkRemoveObject(Object);
+    }
+    GUObjectArray.ProcessPendingDestroyObjects();
+    Checker.Check(
+        GUObjectArray.GetObjectArrayNumMinusAvailable() == NumGlobalAlive, "%d objects alive after cleanup, expected %d",
+        GUObjectArray.GetObjectArrayNumMinusAvailable(), NumGlobalAlive
+    );
+
+    Report(
+        LogLevel::Display, "UObject Array Benchmark: %d objects, TSet add %.3f ms, iterate %.3f ms, remove half %.3f ms",
+        NumObjects, LegacySpawnMs, LegacyIterateMs, LegacyDestroyMs
+    );
+    Report(
+        LogLevel::Display,
+        "UObject Array Benchmark: ConstructObject %.3f ms, iterate %.3f ms (%.1fx), mark half %.3f ms (%.1fx) + destroy %.3f ms, respawn %.3f ms",
+        SpawnMs, IterateMs, Speedup(LegacyIterateMs, IterateMs), MarkMs, Speedup(LegacyDestroyMs, MarkMs), ProcessMs, RespawnMs
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::ClassIsChildOf(int32 NumIterations)
+{
+    FBenchmarkChecker Checker("IsChildOf");
+    NumIterations = std::max(NumIterations, 1);
+
+    TArray<const UClass*> Classes;
+    Classes.Add(UObject::StaticClass());
+    for (const auto& [Name, Class] : UClass::GetClassMap())
+    {
+        Classes.AddUnique(Class);
+    }
+
+    // 기준 경로: 부모를 따라 올라가며 비교
+    auto IsChildOfByWalk = [](const UClass* Class, const UClass* SomeBase)
+    {
+        for (const UClass* TempClass = Class; TempClass; TempClass = TempClass->GetSuperClass())
+        {
+            if (TempClass == SomeBase)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // 모든 클래스 쌍의 결과, 마지막 반복의 결과를 남겨서 비교
+    TArray<uint8> WalkResults;
+    TArray<uint8> ChainResults;
+    WalkResults.SetNum(Classes.Num() * Classes.Num());
+    ChainResults.SetNum(Classes.Num() * Classes.Num());
+
+    const double WalkMs = MeasureMs(NumIterations, [&]()
+    {
+        int32 PairIndex = 0;
+        for (const UClass* Class : Classes)
+        {
+            for (const UClass* SomeBase : Classes)
+            {
+                WalkResults[PairIndex++] = IsChildOfByWalk(Class, SomeBase);
+            }
+        }
+    });
+    const double ChainMs = MeasureMs(NumIterations, [&]()
+    {
+        int32 PairIndex = 0;
+        for (const UClass* Class : Classes)
+        {
+            for (const UClass* SomeBase : Classes)
+            {
+                ChainResults[PairIndex++] = Class->IsChildOf(SomeBase);
+            }
+        }
+    });
+    Checker.CheckEqualArrays(ChainResults, WalkResults, "IsChildOf results of every class pair");
+
+    // 깊이는 부모를 따라 올라간 횟수와 같아야 함
+    int32 NumWrongDepths = 0;
+    for (const UClass* Class : Classes)
+    {
+        int32 Depth = 0;
+        for (const UClass* SuperClass = Class->GetSuperClass(); SuperClass; SuperClass = SuperClass->GetSuperClass())
+        {
+            ++Depth;
+        }
+        NumWrongDepths += Class->GetClassDepth() != Depth;
+    }
+    Checker.Check(NumWrongDepths == 0, "%d classes have a depth different from their super chain", NumWrongDepths);
+    Checker.Check(!Classes[0]->IsChildOf(nullptr), "IsChildOf(nullptr) returned true");
+
+    Report(
+        LogLevel::Display, "IsChildOf Benchmark: %d classes, %d checks per pass, super walk %.3f us, base chain %.3f us (%.1fx)",
+        Classes.Num(), Classes.Num() * Classes.Num(), WalkMs * 1000.0, ChainMs * 1000.0, Speedup(WalkMs, ChainMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::ObjectSpawning(int32 NumObjects)
+{
+    FBenchmarkChecker Checker("Spawn");
+    NumObjects = std::max(NumObjects, 1);
+    UClass* Class = UObject::StaticClass();
+
+    // 기존 방식의 이름 규칙: Class 이름과 UUID
+    auto MakeEagerName = [Class](uint32 UUID) { return FName(Class->GetName() + "_" + std::to_string(UUID)); };
+
+    // 기준 경로: Object마다 힙에서 할당하고, 생성할 때 이름을 만들어 FName에 등록
+    TArray<UObject*> LegacyObjects;
+    TArray<FName> LegacyNames;
+    LegacyObjects.SetNum(NumObjects);
+    LegacyNames.SetNum(NumObjects);
+    const uint64 LegacyStartBytes = FPlatformMemory::GetAllocationBytes<EAT_Object>();
+    const double LegacySpawnMs = MeasureMs(1, [&]()
+    {
+        for (int32 Index = 0; Index < NumObjects; ++Index)
+        {
+            void* RawMemory = FPlatformMemory::Malloc<EAT_Object>(sizeof(UObject));
+            LegacyObjects[Index] = ::new (RawMemory) UObject;
+            LegacyNames[Index] = MakeEagerName(UEngineStatics::GenUUID());
+        }
+    });
+    const uint64 LegacyPeakBytes = FPlatformMemory::GetAllocationBytes<EAT_Object>() - LegacyStartBytes;
+    const double LegacyDestroyMs = MeasureMs(1, [&]()
+    {
+        for (UObject* Object : LegacyObjects)
+        {
+            Object->~UObject();
+            FPlatformMemory::Free<EAT_Object>(Object, sizeof(UObject));
+        }
+    });
+    const double LegacyMs = LegacySpawnMs + LegacyDestroyMs;
+
+    // ConstructObject: Class의 풀에서 할당, 이름은 처음 요청될 때
+    const bool bPrevLogConstructObject = FObjectFactory::bLogConstructObject;
+    FObjectFactory::bLogConstructObject = false;
+
+    const FObjectPool& Pool = Class->GetObjectPool();
+    const uint64 StartReservedBytes = Pool.GetReservedBytes();
+    const uint32 StartNumAllocated = Pool.GetNumAllocated();
+    const int32 StartNumAlive = GUObjectArray.GetObjectArrayNumMinusAvailable();
+
+    TArray<UObject*> Objects;
+    Objects.SetNum(NumObjects);
+    auto SpawnAndDestroy = [&](const char* What)
+    {
+        const double SpawnMs = MeasureMs(1, [&]()
+        {
+            for (UObject*& Object : Objects)
+            {
+                Object = FObjectFactory::ConstructObject(Class, nullptr);
+            }
+        });
+
+        Checker.Check(
+            Pool.GetNumAllocated() - StartNumAllocated == static_cast<uint32>(NumObjects), "%s: pool holds %u objects, expected %d",
+            What, Pool.GetNumAllocated() - StartNumAllocated, NumObjects
+        );
+        int32 NumInvalid = 0;
+        for (UObject* Object : Objects)
+        {
+            NumInvalid += Object->GetClass() != Class || Object->GetOuter() != nullptr
+                || GUObjectArray.IndexToObject(static_cast<int32>(Object->GetInternalIndex())) != Object;
+        }
+        Checker.Check(NumInvalid == 0, "%s: %d objects have a wrong class, outer or index", What, NumInvalid);
+
+        // 나중에 만든 이름이 기존 방식으로 생성할 때 만들던 이름과 같아야 함
+        TArray<FName> LazyNames;
+        TArray<FName> EagerNames;
+        LazyNames.Reserve(NumObjects);
+        EagerNames.Reserve(NumObjects);
+        for (UObject* Object : Objects)
+        {
+            LazyNames.Add(Object->GetFName());
+            EagerNames.Add(MakeEagerName(Object->GetUUID()));
+        }
+        Checker.CheckEqualArrays(LazyNames, EagerNames, What);
+
+        const double DestroyMs = MeasureMs(1, [&]()
+        {
+            for (UObject* Object : Objects)
+            {
+                GUObjectArray.MarkRemoveObject(Object);
+            }
+            GUObjectArray.ProcessPendingDestroyObjects();
+        });
+        Checker.Check(
+            Pool.GetNumAllocated() == StartNumAllocated && GUObjectArray.GetObjectArrayNumMinusAvailable() == StartNumAlive,
+            "%s: %u pooled and %d alive objects left behind", What, Pool.GetNumAllocated() - StartNumAllocated,
+            GUObjectArray.GetObjectArrayNumMinusAvailable() - StartNumAlive
+        );
+        return SpawnMs + DestroyMs;
+    };
+
+    const double PooledMs = SpawnAndDestroy("pooled names");
+    const uint64 PooledReservedBytes = Pool.GetReservedBytes() - StartReservedBytes;
+
+    // 반환된 자리를 재사용하므로 슬랩이 늘어나지 않아야 함
+    const double ReusedMs = SpawnAndDestroy("reused names");
+    const uint64 ReusedReservedBytes = Pool.GetReservedBytes() - StartReservedBytes;
+    Checker.Check(
+        ReusedReservedBytes == PooledReservedBytes, "reuse grew the pool from %llu to %llu bytes", PooledReservedBytes, ReusedReservedBytes
+    );
+
+    FObjectFactory::bLogConstructObject = bPrevLogConstructObject;
+
+    auto ObjectsPerSecond = [NumObjects](double Ms) { return NumObjects / std::max(Ms, 1e-6) * 1000.0; };
+    Report(
+        LogLevel::Display, "Spawn Benchmark: %d objects, heap + eager name %.3f ms (%.0f objects/s), peak %llu B",
+        NumObjects, LegacyMs, ObjectsPerSecond(LegacyMs), LegacyPeakBytes
+    );
+    Report(
+        LogLevel::Display, "Spawn Benchmark: pooled + lazy name %.3f ms (%.0f objects/s, %.1fx), reused %.3f ms (%.0f objects/s), slabs %llu B",
+        PooledMs, ObjectsPerSecond(PooledMs), Speedup(LegacyMs, PooledMs), ReusedMs, ObjectsPerSecond(ReusedMs), PooledReservedBytes
+    );
+    return Checker.Finish();
+}
+
+namespace
+{
+    // FrameArenaAllocation이 실행되는 동안 TBenchmarkArenaAllocator가 할당하는 지역 FFrameArena
+    FFrameArena* BenchmarkArena = nullptr;
+
+    /** 엔진의 FFrameArena 대신 BenchmarkArena에서 할당하는 TFrameAllocator */
+    template <typename T>
+    struct TBenchmarkArenaAllocator
+    {
+        using SizeType = int32;
+        using value_type = T;
+        using size_type = uint32;
+        using difference_type = int32;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = TBenchmarkArenaAllocator<U>;
+        };
+
+        constexpr TBenchmarkArenaAllocator() noexcept = default;
+
+        template <class U>
+        constexpr TBenchmarkArenaAllocator(const TBenchmarkArenaAllocator<U>&) noexcept {}
+
+        T* allocate(size_type n) noexcept
+        {
+            return static_cast<T*>(BenchmarkArena->Allocate(sizeof(T) * n, alignof(T)));
+        }
+
+        void deallocate(T*, size_type) noexcept {}
+
+        template <class U>
+        constexpr bool operator==(const TBenchmarkArenaAllocator<U>&) const noexcept { return true; }
+    };
+
+    /** 렌더 패스가 매 프레임 만드는 임시 배열과 비슷하게, 크기를 미리 정하지 않고 채운 뒤 버림, Out 배열을 넘기면 내용을 복사 */
+    template <template <typename> typename AllocatorType>
+    void FillTransientArrays(int32 NumElements, TArray<FString>* OutKeys, TArray<FVector4>* OutColors, TArray<FMatrix>* OutMatrices)
+    {
+        TArray<FString, AllocatorType<FString>> Keys = {
+            TEXT("FCameraConstantBuffer"),
+            TEXT("FLightBuffer"),
+            TEXT("FMaterialConstants"),
+        };
+
+        TArray<const void*, AllocatorType<const void*>> Objects;
+        TArray<FVector4, AllocatorType<FVector4>> Colors;
+        TArray<FMatrix, AllocatorType<FMatrix>> Matrices;
+        for (int32 i = 0; i < NumElements; ++i)
+        {
+            Objects.Add(&Keys);
+            Colors.Add(FVector4(static_cast<float>(i), 0.f, 0.f, 1.f));
+            Matrices.Add(FMatrix::CreateTranslationMatrix(FVector(static_cast<float>(i), static_cast<float>(Objects.Num()), 0.f)));
+        }
+
+        if (OutKeys)
+        {
+            OutKeys->Empty();
+            for (const FString& Key : Keys)
+            {
+                OutKeys->Add(Key);
+            }
+            OutColors->Empty();
+            for (const FVector4& Color : Colors)
+            {
+                OutColors->Add(Color);
+            }
+            OutMatrices->Empty();
+            for (const FMatrix& Matrix : Matrices)
+            {
+                OutMatrices->Add(Matrix);
+            }
+        }
+    }
+}
+
+bool EngineBenchmarks::FrameArenaAllocation(int32 NumFrames, int32 NumElements)
+{
+    FBenchmarkChecker Checker("Frame Arena");
+    NumFrames = std::max(NumFrames, 1);
+    NumElements = std::max(NumElements, 1);
+
+    // 엔진의 FFrameArena::Get()을 건드리지 않도록 지역 할당기를 사용, 엔진 프레임 중에 실행해도 다른 프레임 컨테이너에 영향이 없음
+    FFrameArena Arena;
+    BenchmarkArena = &Arena;
+
+    // 기준 경로: 힙 컨테이너
+    const uint64 StartHeapCalls = FPlatformMemory::GetTotalHeapAllocationCalls();
+    const double HeapMs = MeasureMs(NumFrames, [&]() { FillTransientArrays<FDefaultAllocator>(NumElements, nullptr, nullptr, nullptr); });
+    const uint64 HeapCalls = FPlatformMemory::GetTotalHeapAllocationCalls() - StartHeapCalls;
+
+    // 버퍼가 없는 상태에서 시작하므로, 두 버퍼가 모두 한 프레임 사용량만큼 커질 때까지 세 프레임은 측정에서 제외
+    for (int32 Frame = 0; Frame < 3; ++Frame)
+    {
+        FillTransientArrays<TBenchmarkArenaAllocator>(NumElements, nullptr, nullptr, nullptr);
+        Arena.EndFrame();
+    }
+
+    const uint64 StartArenaHeapCalls = FPlatformMemory::GetTotalHeapAllocationCalls();
+    uint64 NumOverflows = 0;
+    const double ArenaMs = MeasureMs(NumFrames, [&]()
+    {
+        FillTransientArrays<TBenchmarkArenaAllocator>(NumElements, nullptr, nullptr, nullptr);
+        Arena.EndFrame();
+        NumOverflows += Arena.GetLastFrameOverflowCount();
+    });
+    const uint64 ArenaHeapCalls = FPlatformMemory::GetTotalHeapAllocationCalls() - StartArenaHeapCalls;
+
+    // 컨테이너가 힙 대신 지역 할당기에서 할당하므로, 프레임당 할당 수는 힙 경로와 같고 남은 힙 할당은 FString 내부 할당뿐
+    const uint64 ArenaAllocationsPerFrame = Arena.GetLastFrameAllocationCount();
+    Checker.Check(NumOverflows == 0, "%llu allocations overflowed the arena after warm-up", NumOverflows);
+    Checker.Check(
+        HeapCalls == (ArenaAllocationsPerFrame * NumFrames) + ArenaHeapCalls,
+        "heap path made %llu heap allocations, arena path made %llu arena and %llu heap allocations",
+        HeapCalls, ArenaAllocationsPerFrame * NumFrames, ArenaHeapCalls
+    );
+
+    // 지역 할당기에서 채운 배열의 내용이 힙 컨테이너와 같아야 함
+    TArray<FString> HeapKeys, ArenaKeys;
+    TArray<FVector4> HeapColors, ArenaColors;
+    TArray<FMatrix> HeapMatrices, ArenaMatrices;
+    FillTransientArrays<FDefaultAllocator>(NumElements, &HeapKeys, &HeapColors, &HeapMatrices);
+    FillTransientArrays<TBenchmarkArenaAllocator>(NumElements, &ArenaKeys, &ArenaColors, &ArenaMatrices);
+    Checker.CheckEqualArrays(ArenaKeys, HeapKeys, "keys");
+    Checker.CheckEqualArrays(ArenaColors, HeapColors, "colors", IsBitwiseEqual<FVector4>);
+    Checker.CheckEqualArrays(ArenaMatrices, HeapMatrices, "matrices", IsBitwiseEqual<FMatrix>);
+
+    BenchmarkArena = nullptr;
+
+    Report(
+        LogLevel::Display,
+        "Frame Arena Benchmark: %d frames x %d elements, heap %.3f ms/frame (%.1f heap allocs/frame), frame arena %.3f ms/frame (%.1f heap allocs/frame, %.1fx)",
+        NumFrames, NumElements, HeapMs, static_cast<double>(HeapCalls) / NumFrames,
+        ArenaMs, static_cast<double>(ArenaHeapCalls) / NumFrames, Speedup(HeapMs, ArenaMs)
+    );
+    return Checker.Finish();
+}
+
+namespace
+{
+    /** 벤치마크에서 시스템 할당기와 FMallocBinned를 FPlatformMemory 설정과 상관없이 비교하기 위한 Allocator */
+    template <typename T, bool bBinned>
+    struct TMallocBenchmarkAllocator
+    {
+        using SizeType = int32;
+
+        using value_type = T;
+        using size_type = std::make_unsigned_t<SizeType>;
+        using difference_type = std::make_signed_t<SizeType>;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = TMallocBenchmarkAllocator<U, bBinned>;
+        };
+
+        constexpr TMallocBenchmarkAllocator() noexcept = default;
+
+        template <class U>
+        constexpr TMallocBenchmarkAllocator(const TMallocBenchmarkAllocator<U, bBinned>&) noexcept {}
+
+        T* allocate(size_type n) noexcept
+        {
+            const size_t Size = sizeof(T) * n;
+            if (bBinned && Size <= FMallocBinned::MaxSmallSize)
+            {
+                return static_cast<T*>(FMallocBinned::Malloc(Size));
+            }
+            return static_cast<T*>(std::malloc(Size));
+        }
+
+        void deallocate(T* p, size_type n) noexcept
+        {
+            const size_t Size = sizeof(T) * n;
+            if (bBinned && Size <= FMallocBinned::MaxSmallSize)
+            {
+                FMallocBinned::Free(p, Size);
+                return;
+            }
+            std::free(p);
+        }
+
+        template <class U>
+        constexpr bool operator==(const TMallocBenchmarkAllocator<U, bBinned>&) const noexcept { return true; }
+    };
+
+    template <typename T> using FSystemMallocBenchmarkAllocator = TMallocBenchmarkAllocator<T, false>;
+    template <typename T> using FBinnedMallocBenchmarkAllocator = TMallocBenchmarkAllocator<T, true>;
+
+    uint32 NextRandom(uint32& State)
+    {
+        State = State * 1664525u + 1013904223u;
+        return State >> 8;
+    }
+
+    /** 액터마다 이름, 컴포넌트 목록, 프로퍼티 맵, 태그 셋을 크기를 미리 정하지 않고 채운 뒤 모두 제거 */
+    template <template <typename> typename AllocatorType>
+    uint64 RunSceneLoad(int32 NumActors)
+    {
+        using FIndexArray = TArray<int32, AllocatorType<int32>>;
+        struct FActorData
+        {
+            TArray<char, AllocatorType<char>> Name;
+            TArray<FIndexArray, AllocatorType<FIndexArray>> Components;
+            TMap<int32, FIndexArray, AllocatorType<std::pair<const int32, FIndexArray>>> Properties;
+            TSet<int32, std::hash<int32>, AllocatorType<int32>> Tags;
+        };
+
+        uint64 Checksum = 0;
+        uint32 Random = 1;
+        TArray<FActorData, AllocatorType<FActorData>> Actors;
+        Actors.SetNum(NumActors);
+        for (FActorData& Actor : Actors)
+        {
+            const uint32 NameLength = 12 + NextRandom(Random) % 28;
+            for (uint32 i = 0; i < NameLength; ++i)
+            {
+                Actor.Name.Add(static_cast<char>('a' + i % 26));
+            }
+
+            const uint32 NumComponents = 1 + NextRandom(Random) % 6;
+            for (uint32 i = 0; i < NumComponents; ++i)
+            {
+                FIndexArray& Indices = Actor.Components[Actor.Components.Emplace()];
+                const uint32 NumIndices = 2 + NextRandom(Random) % 12;
+                for (uint32 j = 0; j < NumIndices; ++j)
+                {
+                    Indices.Add(static_cast<int32>(j));
+                }
+                Checksum += Indices.Num();
+            }
+
+            for (int32 Key = 0; Key < 4; ++Key)
+            {
+                FIndexArray& Values = Actor.Properties.FindOrAdd(Key);
+                Values.Add(Key);
+                Values.Add(Key + 1);
+                Values.Add(Key + 2);
+            }
+            for (int32 Tag = 0; Tag < 3; ++Tag)
+            {
+                Actor.Tags.Add(Tag);
+            }
+            Checksum += Actor.Name.Num() + Actor.Properties.Num() + Actor.Tags.Num();
+        }
+        return Checksum;
+    }
+
+    /** 매 프레임 패스마다 그릴 오브젝트 목록, 상수 버퍼 키, 슬롯 맵을 임시로 만들었다가 버림 */
+    template <template <typename> typename AllocatorType>
+    uint64 RunPassPrepare(int32 NumFrames, uint32 Seed)
+    {
+        constexpr int32 NumPasses = 8;
+
+        uint64 Checksum = 0;
+        uint32 Random = Seed;
+        for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+        {
+            for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+            {
+                TArray<const void*, AllocatorType<const void*>> Objects;
+                const uint32 NumObjects = 4 + NextRandom(Random) % 60;
+                for (uint32 i = 0; i < NumObjects; ++i)
+                {
+                    Objects.Add(&Checksum);
+                }
+
+                TArray<uint32, AllocatorType<uint32>> Keys;
+                TMap<uint32, int32, AllocatorType<std::pair<const uint32, int32>>> Slots;
+                for (uint32 i = 0; i < 6; ++i)
+                {
+                    Keys.Add(i * 31u + Pass);
+                    Slots.Add(Keys[i], static_cast<int32>(i));
+                }
+                Checksum += Objects.Num() + Keys.Num() + Slots.Num();
+            }
+        }
+        return Checksum;
+    }
+}
+
+bool EngineBenchmarks::BinnedMalloc(int32 NumActors, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Binned Malloc");
+    NumActors = std::max(NumActors, 1);
+    NumFrames = std::max(NumFrames, 1);
+    const int32 NumThreads = static_cast<int32>(FQueuedThreadPool::Get().GetNumThreads()) + 1;
+
+    // -binnedmalloc이면 다른 스레드의 FPlatformMemory 할당도 Bin 통계에 섞이므로 그때는 통계를 검사하지 않음
+    const bool bCheckStats = !FMallocBinned::IsEnabled();
+
+    // 모든 Bin에서 블록을 여러 페이지만큼 할당해서 정렬과 겹침, 통계를 검사
+    FMallocBinned::FSizeClassStats StartStats[FMallocBinned::NumSizeClasses];
+    FMallocBinned::FSizeClassStats LiveStats[FMallocBinned::NumSizeClasses];
+    FMallocBinned::GetStats(StartStats);
+    {
+        struct FBlock
+        {
+            uint8* Data;
+            size_t Size;
+        };
+        TArray<FBlock> Blocks;
+        for (int32 SizeClass = 0; SizeClass < FMallocBinned::NumSizeClasses; ++SizeClass)
+        {
+            const uint32 BlockSize = FMallocBinned::GetBlockSize(SizeClass);
+            const uint32 MinSize = SizeClass == 0 ? 1 : FMallocBinned::GetBlockSize(SizeClass - 1) + 1;
+            const uint32 NumBlocks = static_cast<uint32>(FMallocBinned::PageSize / BlockSize) * 2 + 1;
+            for (uint32 i = 0; i < NumBlocks; ++i)
+            {
+                // Bin에 들어가는 가장 큰 크기와 가장 작은 크기를 번갈아 요청
+                const size_t Size = (i % 2 == 0) ? BlockSize : MinSize;
+                Blocks.Add({ static_cast<uint8*>(FMallocBinned::Malloc(Size)), Size });
+            }
+        }
+
+        int32 NumMisaligned = 0;
+        for (int32 Index = 0; Index < Blocks.Num(); ++Index)
+        {
+            NumMisaligned += reinterpret_cast<uintptr_t>(Blocks[Index].Data) % 16 != 0;
+            std::memset(Blocks[Index].Data, Index & 0xFF, Blocks[Index].Size);
+        }
+        Checker.Check(NumMisaligned == 0, "%d blocks are not 16-byte aligned", NumMisaligned);
+
+        // 블록이 겹치면 나중에 채운 값이 앞 블록을 덮어씀
+        int32 NumOverwritten = 0;
+        for (int32 Index = 0; Index < Blocks.Num(); ++Index)
+        {
+            const uint8 Expected = static_cast<uint8>(Index & 0xFF);
+            NumOverwritten += std::any_of(Blocks[Index].Data, Blocks[Index].Data + Blocks[Index].Size, [Expected](uint8 Byte) { return Byte != Expected; });
+        }
+        Checker.Check(NumOverwritten == 0, "%d blocks were overwritten by another block", NumOverwritten);
+
+        FMallocBinned::GetStats(LiveStats);
+        for (const FBlock& Block : Blocks)
+        {
+            FMallocBinned::Free(Block.Data, Block.Size);
+        }
+    }
+
+    if (bCheckStats)
+    {
+        FMallocBinned::FSizeClassStats EndStats[FMallocBinned::NumSizeClasses];
+        FMallocBinned::GetStats(EndStats);
+        int32 NumWrongStats = 0;
+        for (int32 SizeClass = 0; SizeClass < FMallocBinned::NumSizeClasses; ++SizeClass)
+        {
+            const uint64 NumBlocks = FMallocBinned::PageSize / FMallocBinned::GetBlockSize(SizeClass) * 2 + 1;
+            NumWrongStats += LiveStats[SizeClass].NumLiveBlocks != StartStats[SizeClass].NumLiveBlocks + NumBlocks;
+            NumWrongStats += LiveStats[SizeClass].ReservedBytes < LiveStats[SizeClass].NumLiveBlocks * FMallocBinned::GetBlockSize(SizeClass);
+            NumWrongStats += EndStats[SizeClass].NumLiveBlocks != StartStats[SizeClass].NumLiveBlocks;
+        }
+        Checker.Check(NumWrongStats == 0, "%d bin statistics do not match the allocated blocks", NumWrongStats);
+    }
+
+    struct FResult
+    {
+        double SceneLoadMs = 0.0;
+        double PassPrepareMs = 0.0;
+        double ParallelPassPrepareMs = 0.0;
+        uint64 SceneLoadChecksum = 0;
+        uint64 PassPrepareChecksum = 0;
+        uint64 ParallelPassPrepareChecksum = 0;
+    };
+
+    auto Run = [NumActors, NumFrames, NumThreads]<template <typename> typename AllocatorType>() -> FResult
+    {
+        FResult Result;
+        Result.SceneLoadMs = MeasureMs(1, [&]() { Result.SceneLoadChecksum = RunSceneLoad<AllocatorType>(NumActors); });
+        Result.PassPrepareMs = MeasureMs(1, [&]() { Result.PassPrepareChecksum = RunPassPrepare<AllocatorType>(NumFrames, 1); });
+
+        std::atomic<uint64> ParallelChecksum = 0;
+        Result.ParallelPassPrepareMs = MeasureMs(1, [&]()
+        {
+            ParallelFor(NumThreads, [&ParallelChecksum, NumFrames](int32 Index)
+            {
+                ParallelChecksum += RunPassPrepare<AllocatorType>(NumFrames, static_cast<uint32>(Index) + 1);
+            });
+        });
+        Result.ParallelPassPrepareChecksum = ParallelChecksum;
+        return Result;
+    };
+
+    // 페이지를 미리 만들어 두어 첫 측정에만 페이지 할당이 포함되지 않도록 함
+    Run.operator()<FBinnedMallocBenchmarkAllocator>();
+
+    // 기준 경로: 시스템 할당기, 같은 작업이므로 컨테이너의 내용을 모은 값이 같아야 함
+    const FResult System = Run.operator()<FSystemMallocBenchmarkAllocator>();
+    const FResult Binned = Run.operator()<FBinnedMallocBenchmarkAllocator>();
+    Checker.Check(System.SceneLoadChecksum == Binned.SceneLoadChecksum, "scene load checksum %llu, expected %llu", Binned.SceneLoadChecksum, System.SceneLoadChecksum);
+    Checker.Check(
+        System.PassPrepareChecksum == Binned.PassPrepareChecksum, "pass prepare checksum %llu, expected %llu",
+        Binned.PassPrepareChecksum, System.PassPrepareChecksum
+    );
+    Checker.Check(
+        System.ParallelPassPrepareChecksum == Binned.ParallelPassPrepareChecksum, "parallel pass prepare checksum %llu, expected %llu",
+        Binned.ParallelPassPrepareChecksum, System.ParallelPassPrepareChecksum
+    );
+
+    Report(
+        LogLevel::Display, "Binned Malloc Benchmark: scene load %d actors, system %.3f ms, binned %.3f ms (%.2fx)",
+        NumActors, System.SceneLoadMs, Binned.SceneLoadMs, Speedup(System.SceneLoadMs, Binned.SceneLoadMs)
+    );
+    Report(
+        LogLevel::Display,
+        "Binned Malloc Benchmark: pass prepare %d frames, system %.3f ms, binned %.3f ms (%.2fx), on %d threads system %.3f ms, binned %.3f ms (%.2fx)",
+        NumFrames, System.PassPrepareMs, Binned.PassPrepareMs, Speedup(System.PassPrepareMs, Binned.PassPrepareMs),
+        NumThreads, System.ParallelPassPrepareMs, Binned.ParallelPassPrepareMs, Speedup(System.ParallelPassPrepareMs, Binned.ParallelPassPrepareMs)
+    );
+    return Checker.Finish();
+}
+
+namespace
+{
+    struct FContainerTimings
+    {
+        double InsertMs = 0.0;
+        double FindHitMs = 0.0;
+        double FindMissMs = 0.0;
+        double IterateMs = 0.0;
+        double RemoveMs = 0.0;
+    };
+
+    /** 기준 경로와 비교할 결과: 조회마다 찾은 값(없으면 INDEX_NONE), 순회한 값을 정렬한 배열, 측정 중에 더한 값 */
+    struct FContainerContents
+    {
+        TArray<int32> Found;
+        TArray<int32> Iterated;
+        uint64 Checksum = 0;
+    };
+
+    /** 같은 키로 추가, 있는 키 조회, 없는 키 조회, 순회, 세 개 중 하나 제거를 차례로 측정하고 제거한 뒤의 내용을 남김 */
+    template <typename MapType, typename KeyType>
+    FContainerTimings RunMapBenchmark(const TArray<KeyType>& Keys, const TArray<KeyType>& MissingKeys, FContainerContents& OutContents)
+    {
+        FContainerTimings Timings;
+        MapType Map;
+        uint64& Checksum = OutContents.Checksum;
+
+        Timings.InsertMs = MeasureMs(1, [&]()
+        {
+            for (int32 i = 0; i < Keys.Num(); ++i)
+            {
+                Map.Add(Keys[i], i);
+            }
+        });
+        Timings.FindHitMs = MeasureMs(1, [&]()
+        {
+            for (const KeyType& Key : Keys)
+            {
+                if (const int32* Value = Map.Find(Key))
+                {
+                    Checksum += *Value;
+                }
+            }
+        });
+        Timings.FindMissMs = MeasureMs(1, [&]()
+        {
+            for (const KeyType& Key : MissingKeys)
+            {
+                Checksum += Map.Contains(Key) ? 1 : 0;
+            }
+        });
+        Timings.IterateMs = MeasureMs(1, [&]()
+        {
+            for (const auto& [Key, Value] : Map)
+            {
+                Checksum += Value;
+            }
+        });
+        Timings.RemoveMs = MeasureMs(1, [&]()
+        {
+            for (int32 i = 0; i < Keys.Num(); i += 3)
+            {
+                Map.Remove(Keys[i]);
+            }
+        });
+
+        for (const TArray<KeyType>* LookupKeys : { &Keys, &MissingKeys })
+        {
+            for (const KeyType& Key : *LookupKeys)
+            {
+                const int32* Value = Map.Find(Key);
+                OutContents.Found.Add(Value ? *Value : INDEX_NONE);
+            }
+        }
+        for (const auto& [Key, Value] : Map)
+        {
+            OutContents.Iterated.Add(Value);
+        }
+        std::sort(OutContents.Iterated.begin(), OutContents.Iterated.end());
+        return Timings;
+    }
+
+    template <typename SetType>
+    FContainerTimings RunSetBenchmark(const TArray<int32>& Keys, const TArray<int32>& MissingKeys, FContainerContents& OutContents)
+    {
+        FContainerTimings Timings;
+        SetType Set;
+        uint64& Checksum = OutContents.Checksum;
+
+        Timings.InsertMs = MeasureMs(1, [&]()
+        {
+            for (int32 Key : Keys)
+            {
+                Set.Add(Key);
+            }
+        });
+        Timings.FindHitMs = MeasureMs(1, [&]()
+        {
+            for (int32 Key : Keys)
+            {
+                Checksum += Set.Contains(Key) ? 1 : 0;
+            }
+        });
+        Timings.FindMissMs = MeasureMs(1, [&]()
+        {
+            for (int32 Key : MissingKeys)
+            {
+                Checksum += Set.Contains(Key) ? 1 : 0;
+            }
+        });
+        Timings.IterateMs = MeasureMs(1, [&]()
+        {
+            for (int32 Key : Set)
+            {
+                Checksum += static_cast<uint32>(Key) & 0xFF;
+            }
+        });
+        Timings.RemoveMs = MeasureMs(1, [&]()
+        {
+            for (int32 i = 0; i < Keys.Num(); i += 3)
+            {
+                Set.Remove(Keys[i]);
+            }
+        });
+
+        for (const TArray<int32>* LookupKeys : { &Keys, &MissingKeys })
+        {
+            for (int32 Key : *LookupKeys)
+            {
+                OutContents.Found.Add(Set.Contains(Key) ? Key : INDEX_NONE);
+            }
+        }
+        for (int32 Key : Set)
+        {
+            OutContents.Iterated.Add(Key);
+        }
+        std::sort(OutContents.Iterated.begin(), OutContents.Iterated.end());
+        return Timings;
+    }
+}
+
+bool EngineBenchmarks::FlatContainers(int32 NumElements)
+{
+    FBenchmarkChecker Checker("Flat Container");
+    NumElements = std::max(NumElements, 1);
+
+    // 정수 키는 순서대로 넣지 않도록 섞은 값을 사용
+    TArray<int32> IntKeys;
+    TArray<int32> MissingIntKeys;
+    TArray<FString> StringKeys;
+    TArray<FString> MissingStringKeys;
+    IntKeys.Reserve(NumElements);
+    MissingIntKeys.Reserve(NumElements);
+    StringKeys.Reserve(NumElements);
+    MissingStringKeys.Reserve(NumElements);
+    for (int32 i = 0; i < NumElements; ++i)
+    {
+        IntKeys.Add(static_cast<int32>(static_cast<uint32>(i) * 2654435761u) & ~1);
+        MissingIntKeys.Add(IntKeys[i] | 1);
+        StringKeys.Add(FString::Printf(TEXT("ConstantBuffer_%d"), i));
+        MissingStringKeys.Add(FString::Printf(TEXT("MissingBuffer_%d"), i));
+    }
+
+    // 기준 경로: 노드 기반의 TMap, TSet
+    auto Compare = [&](const char* Name, const FContainerTimings& Node, const FContainerContents& NodeContents,
+        const FContainerTimings& Flat, const FContainerContents& FlatContents)
+    {
+        char What[128];
+        snprintf(What, sizeof(What), "%s lookups after remove", Name);
+        Checker.CheckEqualArrays(FlatContents.Found, NodeContents.Found, What);
+        snprintf(What, sizeof(What), "%s iterated values after remove", Name);
+        Checker.CheckEqualArrays(FlatContents.Iterated, NodeContents.Iterated, What);
+        Checker.Check(
+            FlatContents.Checksum == NodeContents.Checksum, "%s find and iterate checksum %llu, expected %llu",
+            Name, FlatContents.Checksum, NodeContents.Checksum
+        );
+
+        Report(
+            LogLevel::Display,
+            "Flat Container Benchmark (%s, %d): insert %.3f / %.3f ms (%.1fx), find hit %.3f / %.3f ms (%.1fx), find miss %.3f / %.3f ms (%.1fx), iterate %.3f / %.3f ms (%.1fx), remove %.3f / %.3f ms (%.1fx)",
+            Name, NumElements,
+            Node.InsertMs, Flat.InsertMs, Speedup(Node.InsertMs, Flat.InsertMs),
+            Node.FindHitMs, Flat.FindHitMs, Speedup(Node.FindHitMs, Flat.FindHitMs),
+            Node.FindMissMs, Flat.FindMissMs, Speedup(Node.FindMissMs, Flat.FindMissMs),
+            Node.IterateMs, Flat.IterateMs, Speedup(Node.IterateMs, Flat.IterateMs),
+            Node.RemoveMs, Flat.RemoveMs, Speedup(Node.RemoveMs, Flat.RemoveMs)
+        );
+    };
+
+    {
+        FContainerContents NodeContents, FlatContents;
+        const FContainerTimings Node = RunMapBenchmark<TMap<int32, int32>>(IntKeys, MissingIntKeys, NodeContents);
+        const FContainerTimings Flat = RunMapBenchmark<TFlatMap<int32, int32>>(IntKeys, MissingIntKeys, FlatContents);
+        Compare("TMap/TFlatMap int32", Node, NodeContents, Flat, FlatContents);
+    }
+    {
+        FContainerContents NodeContents, FlatContents;
+        const FContainerTimings Node = RunMapBenchmark<TMap<FString, int32>>(StringKeys, MissingStringKeys, NodeContents);
+        const FContainerTimings Flat = RunMapBenchmark<TFlatMap<FString, int32>>(StringKeys, MissingStringKeys, FlatContents);
+        Compare("TMap/TFlatMap FString", Node, NodeContents, Flat, FlatContents);
+    }
+    {
+        FContainerContents NodeContents, FlatContents;
+        const FContainerTimings Node = RunSetBenchmark<TSet<int32>>(IntKeys, MissingIntKeys, NodeContents);
+        const FContainerTimings Flat = RunSetBenchmark<TFlatSet<int32>>(IntKeys, MissingIntKeys, FlatContents);
+        Compare("TSet/TFlatSet int32", Node, NodeContents, Flat, FlatContents);
+    }
+    return Checker.Finish();
+}
+
+namespace
+{
+    /** 이전 구현과 같은 방식(고정 크기 Entry, djb2, 소문자 복사본 해싱)으로 동작하는 비교용 풀 */
+    class FLegacyNamePool
+    {
+        static constexpr uint32 NAME_SIZE = 256;
+
+        struct FEntry
+        {
+            uint32 ComparisonHash;
+            uint16 IsWide : 1;
+            uint16 Len : 15;
+            union
+            {
+                ANSICHAR AnsiName[NAME_SIZE];
+                WIDECHAR WideName[NAME_SIZE];
+            };
+        };
+
+        TMap<uint32, FEntry> DisplayPool;
+        TMap<uint32, FEntry> ComparisonPool;
+        std::mutex Mutex;
+
+        static uint32 HashString(const ANSICHAR* Str)
+        {
+            uint32 Hash = 5381;
+            while (*Str)
+            {
+                Hash = ((Hash << 5) + Hash) + *Str;
+                ++Str;
+            }
+            return Hash;
+        }
+
+    public:
+        /** @return 대소문자를 무시한 문자열의 Hash */
+        uint32 FindOrStore(const ANSICHAR* Str, uint32 Len)
+        {
+            ANSICHAR LowerStr[NAME_SIZE];
+            for (uint32 i = 0; i < Len; ++i)
+            {
+                LowerStr[i] = static_cast<ANSICHAR>(tolower(Str[i]));
+            }
+            LowerStr[Len] = '\0';
+            const uint32 DisplayHash = HashString(Str);
+            const uint32 ComparisonHash = HashString(LowerStr);
+
+            std::scoped_lock Lock(Mutex);
+            if (const FEntry* Found = DisplayPool.Find(DisplayHash))
+            {
+                return Found->ComparisonHash;
+            }
+
+            FEntry Entry;
+            Entry.ComparisonHash = ComparisonHash;
+            Entry.IsWide = false;
+            Entry.Len = static_cast<uint16>(Len);
+            std::memcpy(Entry.AnsiName, Str, Len);
+            Entry.AnsiName[Len] = '\0';
+            if (!ComparisonPool.Contains(ComparisonHash))
+            {
+                ComparisonPool.Add(ComparisonHash, Entry);
+            }
+            DisplayPool.Add(DisplayHash, Entry);
+            return ComparisonHash;
+        }
+    };
+}
+
+bool EngineBenchmarks::NamePool(int32 NumNames)
+{
+    FBenchmarkChecker Checker("FName Pool");
+    NumNames = std::max(NumNames, 1);
+
+    // 풀에서 Name을 지울 수 없으므로 실행할 때마다 다른 이름을 사용
+    static int32 RunCount = 0;
+    const int32 Run = RunCount++;
+
+    TArray<FString> Names;
+    Names.Reserve(NumNames);
+    uint64 TotalLen = 0;
+    for (int32 i = 0; i < NumNames; ++i)
+    {
+        Names.Add(FString::Printf(TEXT("BenchName_%d_StaticMeshComponent_%d"), Run, i));
+        TotalLen += Names[i].Len();
+    }
+
+    // 워커 스레드와 나눠서 실행하도록 작은 묶음으로 나눔
+    constexpr int32 NamesPerTask = 256;
+    const int32 NumTasks = (NumNames + NamesPerTask - 1) / NamesPerTask;
+    auto RunParallel = [&](const auto& Body)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        ParallelFor(NumTasks, [&](int32 Task)
+        {
+            const int32 End = std::min(NumNames, (Task + 1) * NamesPerTask);
+            for (int32 i = Task * NamesPerTask; i < End; ++i)
+            {
+                Body(i);
+            }
+        });
+        return FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    };
+
+    // 기존 방식
+    double LegacyCreateMs, LegacyFindMs;
+    uint64 LegacyBytes;
+    {
+        const uint64 StartBytes = FPlatformMemory::GetAllocationBytes<EAT_Container>();
+        FLegacyNamePool LegacyPool;
+        auto Body = [&](int32 i) { LegacyPool.FindOrStore(*Names[i], Names[i].Len()); };
+        LegacyCreateMs = RunParallel(Body);
+        LegacyFindMs = RunParallel(Body);
+        LegacyBytes = FPlatformMemory::GetAllocationBytes<EAT_Container>() - StartBytes;
+    }
+
+    // 현재 풀, 스레드마다 만든 Name의 Index를 남겨서 한 스레드에서 다시 찾은 결과와 비교
+    TArray<uint32> CreatedIndices;
+    TArray<uint32> FoundIndices;
+    CreatedIndices.SetNum(NumNames);
+    FoundIndices.SetNum(NumNames);
+    const FName::FPoolStats StartStats = FName::GetPoolStats();
+    const double CreateMs = RunParallel([&](int32 i) { CreatedIndices[i] = FName(Names[i]).GetDisplayIndex(); });
+    const FName::FPoolStats EndStats = FName::GetPoolStats();
+    const double FindMs = RunParallel([&](int32 i) { FoundIndices[i] = FName(Names[i]).GetDisplayIndex(); });
+    const FName::FPoolStats FindStats = FName::GetPoolStats();
+
+    Checker.Check(
+        EndStats.NumEntries - StartStats.NumEntries >= static_cast<uint32>(NumNames),
+        "pool grew by %u entries for %d new names", EndStats.NumEntries - StartStats.NumEntries, NumNames
+    );
+    Checker.Check(
+        FindStats.NumEntries == EndStats.NumEntries, "finding existing names added %u entries",
+        FindStats.NumEntries - EndStats.NumEntries
+    );
+    Checker.CheckEqualArrays(FoundIndices, CreatedIndices, "display indices found in parallel");
+
+    // 기준 경로: 한 스레드에서 찾은 Index, 원본 문자열, 대소문자를 무시한 문자열 비교
+    TArray<uint32> SerialIndices;
+    TArray<FString> Strings;
+    TArray<uint8> Equalities;
+    TArray<uint8> ExpectedEqualities;
+    SerialIndices.Reserve(NumNames);
+    Strings.Reserve(NumNames);
+    Equalities.Reserve(NumNames * 2);
+    ExpectedEqualities.Reserve(NumNames * 2);
+    for (int32 i = 0; i < NumNames; ++i)
+    {
+        const FName Name(Names[i]);
+        const FString& Next = Names[(i + 1) % NumNames];
+        const FString Upper = Names[i].ToUpper();
+        SerialIndices.Add(Name.GetDisplayIndex());
+        Strings.Add(Name.ToString());
+        Equalities.Add(Name == FName(Upper));
+        ExpectedEqualities.Add(Names[i].Equals(Upper, ESearchCase::IgnoreCase));
+        Equalities.Add(Name == FName(Next));
+        ExpectedEqualities.Add(Names[i].Equals(Next, ESearchCase::IgnoreCase));
+    }
+    Checker.CheckEqualArrays(CreatedIndices, SerialIndices, "display indices created in parallel");
+    Checker.CheckEqualArrays(
+        Strings, Names, "name strings",
+        [](const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+    );
+    Checker.CheckEqualArrays(Equalities, ExpectedEqualities, "case-insensitive name equality");
+
+    const uint64 EntryBytes = EndStats.EntryBytes - StartStats.EntryBytes;
+    const uint64 SlotBytes = EndStats.SlotBytes - StartStats.SlotBytes;
+    Report(
+        LogLevel::Display,
+        "FName Pool Benchmark (%d names, avg %.1f chars, %u threads): memory legacy %.1f B/name, pool %.1f B/name (entry %.1f + slots %.1f)",
+        NumNames, static_cast<double>(TotalLen) / NumNames, FQueuedThreadPool::Get().GetNumThreads() + 1,
+        static_cast<double>(LegacyBytes) / NumNames,
+        static_cast<double>(EntryBytes + SlotBytes) / NumNames,
+        static_cast<double>(EntryBytes) / NumNames, static_cast<double>(SlotBytes) / NumNames
+    );
+    Report(
+        LogLevel::Display,
+        "FName Pool Benchmark: create legacy %.3f ms, pool %.3f ms (%.1fx); find existing legacy %.3f ms, pool %.3f ms (%.1fx)",
+        LegacyCreateMs, CreateMs, Speedup(LegacyCreateMs, CreateMs), LegacyFindMs, FindMs, Speedup(LegacyFindMs, FindMs)
+    );
+    Report(
+        LogLevel::Display,
+        "FName Pool Benchmark: pool total %u entries, %llu B used, %llu B reserved, %llu B slots",
+        FindStats.NumEntries, FindStats.EntryBytes, FindStats.ReservedBytes, FindStats.SlotBytes
+    );
+    return Checker.Finish();
+}
+
+namespace
+{
+    /** 기존 UProjectileMovementComponent::TickComponent와 같은 계산을 가상 함수 호출로 하나씩 실행 */
+    class FLegacyProjectile
+    {
+    public:
+        FLegacyProjectile(USceneComponent* InTarget, const FVector& InVelocity, float InGravity, float InMaxSpeed, float InLifetime)
+            : Target(InTarget), Velocity(InVelocity), Gravity(InGravity), MaxSpeed(InMaxSpeed), Lifetime(InLifetime)
+        {
+        }
+        virtual ~FLegacyProjectile() = default;
+
+        /** @return 수명이 끝났으면 true */
+        virtual bool Tick(float DeltaTime)
+        {
+            Velocity.Z += Gravity * DeltaTime;
+            if (Velocity.Length() > MaxSpeed)
+            {
+                Velocity = Velocity.GetSafeNormal() * MaxSpeed;
+            }
+            Target->SetRelativeLocation(Target->GetRelativeLocation() + Velocity * DeltaTime);
+
+            AccumulatedTime += DeltaTime;
+            return AccumulatedTime >= Lifetime;
+        }
+
+    private:
+        USceneComponent* Target;
+        FVector Velocity;
+        float Gravity;
+        float MaxSpeed;
+        float Lifetime;
+        float AccumulatedTime = 0.f;
+    };
+}
+
+bool EngineBenchmarks::Projectiles(int32 NumProjectiles, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Projectile");
+    NumProjectiles = std::max(NumProjectiles, 1);
+    NumFrames = std::max(NumFrames, 1);
+    constexpr float DeltaTime = 1.f / 60.f;
+
+    struct FSetup
+    {
+        FVector Location;
+        FVector Velocity;
+        float MaxSpeed;
+        float Lifetime;
+    };
+    constexpr float Gravity = -9.8f;
+
+    // 절반 정도는 측정 중에 수명이 끝나도록 설정
+    FBenchmarkRandom Random(777);
+    TArray<FSetup> Setups;
+    Setups.Reserve(NumProjectiles);
+    TArray<USceneComponent*> LegacyTargets;
+    TArray<USceneComponent*> SystemTargets;
+    LegacyTargets.Reserve(NumProjectiles);
+    SystemTargets.Reserve(NumProjectiles);
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        FSetup& Setup = Setups[Setups.Emplace()];
+        Setup.Location = Random.Vector(-1000.f, 1000.f);
+        Setup.Velocity = Random.Vector(-200.f, 200.f);
+        Setup.MaxSpeed = Random.Range(50.f, 300.f);
+        Setup.Lifetime = Random.Range(0.5f * NumFrames * DeltaTime, 1.5f * NumFrames * DeltaTime);
+
+        for (TArray<USceneComponent*>* TargetArray : { &LegacyTargets, &SystemTargets })
+        {
+            USceneComponent* Target = FObjectFactory::ConstructObject<USceneComponent>(nullptr);
+            Target->SetRelativeLocation(Setup.Location);
+            TargetArray->Add(Target);
+        }
+    }
+
+    // 중간 프레임에 일부 투사체를 밖에서 옮겨서, 다음 Update가 옮긴 위치에서 이어서 움직이는지 검사
+    const int32 MoveFrame = NumFrames / 2;
+    const FVector MoveOffset(150.f, -75.f, 40.f);
+    auto MoveExternally = [NumProjectiles, &MoveOffset](const TArray<USceneComponent*>& Targets)
+    {
+        for (int32 Index = 0; Index < NumProjectiles; Index += 7)
+        {
+            Targets[Index]->SetRelativeLocation(Targets[Index]->GetRelativeLocation() + MoveOffset);
+        }
+    };
+
+    // 기준 경로: 투사체마다 따로 할당한 객체를 가상 함수로 Tick
+    TArray<std::unique_ptr<FLegacyProjectile>> LegacyProjectiles;
+    LegacyProjectiles.Reserve(NumProjectiles);
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        const FSetup& Setup = Setups[Index];
+        LegacyProjectiles.Add(std::make_unique<FLegacyProjectile>(LegacyTargets[Index], Setup.Velocity, Gravity, Setup.MaxSpeed, Setup.Lifetime));
+    }
+
+    uint64 StartCycles = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        if (Frame == MoveFrame)
+        {
+            MoveExternally(LegacyTargets);
+        }
+        for (int32 Index = 0; Index < LegacyProjectiles.Num();)
+        {
+            if (LegacyProjectiles[Index]->Tick(DeltaTime))
+            {
+                LegacyProjectiles.RemoveAtSwap(Index);
+            }
+            else
+            {
+                ++Index;
+            }
+        }
+    }
+    const double LegacyMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    const int32 NumLegacyAlive = LegacyProjectiles.Num();
+    LegacyProjectiles.Empty();
+
+    // FProjectileSystem
+    FProjectileSystem System;
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        const FSetup& Setup = Setups[Index];
+        System.Register(nullptr, SystemTargets[Index], Setup.Velocity, Gravity, Setup.MaxSpeed, 0.f, Setup.Lifetime);
+    }
+
+    int32 NumRetired = 0;
+    StartCycles = FPlatformTime::Cycles64();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        if (Frame == MoveFrame)
+        {
+            MoveExternally(SystemTargets);
+        }
+        System.Update(DeltaTime);
+        NumRetired += System.GetNumRetiredLastFrame();
+    }
+    const double SystemMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+    const int32 NumSystemAlive = System.Num();
+
+    Checker.Check(NumSystemAlive == NumLegacyAlive, "%d projectiles alive, expected %d", NumSystemAlive, NumLegacyAlive);
+    Checker.Check(
+        NumRetired == NumProjectiles - NumSystemAlive, "%d projectiles retired, expected %d", NumRetired, NumProjectiles - NumSystemAlive
+    );
+
+    // 나눗셈 순서가 달라서 생기는 오차는 허용
+    TArray<FVector> LegacyLocations;
+    TArray<FVector> SystemLocations;
+    LegacyLocations.Reserve(NumProjectiles);
+    SystemLocations.Reserve(NumProjectiles);
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        LegacyLocations.Add(LegacyTargets[Index]->GetRelativeLocation());
+        SystemLocations.Add(SystemTargets[Index]->GetRelativeLocation());
+    }
+    Checker.CheckEqualArrays(
+        SystemLocations, LegacyLocations, "final target locations",
+        [](const FVector& A, const FVector& B) { return (A - B).Length() <= 1e-2f * std::max(1.f, B.Length()); }
+    );
+
+    for (USceneComponent* Target : LegacyTargets)
+    {
+        GUObjectArray.MarkRemoveObject(Target);
+    }
+    for (USceneComponent* Target : SystemTargets)
+    {
+        GUObjectArray.MarkRemoveObject(Target);
+    }
+    GUObjectArray.ProcessPendingDestroyObjects();
+
+    Report(
+        LogLevel::Display,
+        "Projectile Benchmark: %d projectiles x %d frames (%d alive), per-object tick %.3f ms, SoA system %.3f ms (%.1fx)",
+        NumProjectiles, NumFrames, NumSystemAlive, LegacyMs, SystemMs, Speedup(LegacyMs, SystemMs)
+    );
+    return Checker.Finish();
+}
+
+namespace
+{
+    /** 파티클 하나의 모든 값을 한 구조체에 담는 기존 방식 */
+    struct FLegacyParticle
+    {
+        FVector Position;
+        FVector Velocity;
+        float Age;
+        float InvLifetime;
+        float Size;
+        FLinearColor Color;
+        int32 SubUVFrame;
+    };
+
+    void TickLegacyParticles(TArray<FLegacyParticle>& Particles, const FParticleEmitterSettings& Settings, float DeltaTime)
+    {
+        const float NumFrames = static_cast<float>(Settings.SubUVRows * Settings.SubUVColumns);
+        const FLinearColor& Start = Settings.StartColor;
+        const FLinearColor& End = Settings.EndColor;
+
+        for (FLegacyParticle& Particle : Particles)
+        {
+            Particle.Velocity = Particle.Velocity + Settings.Acceleration * DeltaTime;
+            Particle.Position = Particle.Position + Particle.Velocity * DeltaTime;
+            Particle.Age += DeltaTime;
+
+            const float T = std::min(Particle.Age * Particle.InvLifetime, 1.f);
+            Particle.Size = Settings.StartSize + (Settings.EndSize - Settings.StartSize) * T;
+            Particle.Color = FLinearColor(
+                Start.R + (End.R - Start.R) * T, Start.G + (End.G - Start.G) * T,
+                Start.B + (End.B - Start.B) * T, Start.A + (End.A - Start.A) * T
+            );
+            Particle.SubUVFrame = static_cast<int32>(std::min(T * NumFrames, NumFrames - 1.f));
+        }
+
+        for (int32 Index = 0; Index < Particles.Num();)
+        {
+            if (Particles[Index].Age * Particles[Index].InvLifetime >= 1.f)
+            {
+                Particles.RemoveAtSwap(Index);
+            }
+            else
+            {
+                ++Index;
+            }
+        }
+    }
+
+    void BuildLegacyInstances(const TArray<FLegacyParticle>& Particles, const FParticleEmitterSettings& Settings, TArray<FParticleInstance>& OutInstances)
+    {
+        const FVector2D UVScale(1.f / static_cast<float>(Settings.SubUVColumns), 1.f / static_cast<float>(Settings.SubUVRows));
+        OutInstances.SetNum(Particles.Num());
+        for (int32 Index = 0; Index < Particles.Num(); ++Index)
+        {
+            const FLegacyParticle& Particle = Particles[Index];
+            FParticleInstance& Instance = OutInstances[Index];
+            Instance.Position = Particle.Position;
+            Instance.Size = Particle.Size;
+            Instance.Color = Particle.Color;
+            Instance.UVOffset = FVector2D(
+                static_cast<float>(Particle.SubUVFrame % Settings.SubUVColumns) * UVScale.X,
+                static_cast<float>(Particle.SubUVFrame / Settings.SubUVColumns) * UVScale.Y
+            );
+        }
+    }
+
+    bool IsNearlyEqualRelative(float A, float B)
+    {
+        return std::abs(A - B) <= 1e-3f * std::max(1.f, std::abs(A));
+    }
+}
+
+bool EngineBenchmarks::ParticleSimulation(int32 NumParticles, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Particle");
+    NumParticles = std::max(NumParticles, 1);
+    NumFrames = std::max(NumFrames, 1);
+    constexpr float DeltaTime = 1.f / 60.f;
+
+    FParticleEmitterSettings Settings;
+    Settings.SpawnRate = 0.f;
+    Settings.MaxParticles = NumParticles;
+    Settings.SubUVRows = 6;
+    Settings.SubUVColumns = 6;
+    Settings.EndColor = FLinearColor(1.f, 0.3f, 0.f, 0.f);
+
+    // 절반 정도는 측정 중에 수명이 끝나도록 설정
+    FBenchmarkRandom Random(777);
+    FParticleEmitter Emitter;
+    Emitter.SetSettings(Settings);
+    TArray<FLegacyParticle> LegacyParticles;
+    LegacyParticles.Reserve(NumParticles);
+    for (int32 i = 0; i < NumParticles; ++i)
+    {
+        const FVector Velocity = Random.Vector(-50.f, 50.f);
+        const float Lifetime = Random.Range(0.5f * NumFrames * DeltaTime, 1.5f * NumFrames * DeltaTime);
+        Emitter.SpawnParticle(FVector::ZeroVector, Velocity, Lifetime);
+
+        FLegacyParticle& Particle = LegacyParticles[LegacyParticles.Emplace()];
+        Particle.Position = FVector::ZeroVector;
+        Particle.Velocity = Velocity;
+        Particle.Age = 0.f;
+        Particle.InvLifetime = 1.f / Lifetime;
+        Particle.Size = Settings.StartSize;
+        Particle.Color = Settings.StartColor;
+        Particle.SubUVFrame = 0;
+    }
+
+    // 기준 경로: 구조체 배열을 하나씩 계산
+    TArray<FParticleInstance> LegacyInstances;
+    LegacyInstances.Reserve(NumParticles);
+    double LegacySimulateMs = 0.0;
+    double LegacyBuildMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        LegacySimulateMs += MeasureMs(1, [&] { TickLegacyParticles(LegacyParticles, Settings, DeltaTime); });
+        LegacyBuildMs += MeasureMs(1, [&] { BuildLegacyInstances(LegacyParticles, Settings, LegacyInstances); });
+    }
+
+    // FParticleEmitter
+    TArray<FParticleInstance> Instances;
+    Instances.SetNum(NumParticles);
+    double SimulateMs = 0.0;
+    double BuildMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        SimulateMs += MeasureMs(1, [&] { Emitter.Tick(DeltaTime, FVector::ZeroVector); });
+        BuildMs += MeasureMs(1, [&] { Emitter.BuildInstances(Instances.GetData()); });
+    }
+    Instances.SetNum(Emitter.Num());
+
+    // 제거 순서가 같으므로 인스턴스도 같은 순서여야 함
+    Checker.CheckEqualArrays(
+        Instances, LegacyInstances, "particle instances",
+        [](const FParticleInstance& A, const FParticleInstance& B)
+        {
+            return IsNearlyEqualRelative(A.Position.X, B.Position.X) && IsNearlyEqualRelative(A.Position.Y, B.Position.Y)
+                && IsNearlyEqualRelative(A.Position.Z, B.Position.Z) && IsNearlyEqualRelative(A.Size, B.Size)
+                && IsNearlyEqualRelative(A.Color.R, B.Color.R) && IsNearlyEqualRelative(A.Color.G, B.Color.G)
+                && IsNearlyEqualRelative(A.Color.B, B.Color.B) && IsNearlyEqualRelative(A.Color.A, B.Color.A)
+                && IsNearlyEqualRelative(A.UVOffset.X, B.UVOffset.X) && IsNearlyEqualRelative(A.UVOffset.Y, B.UVOffset.Y);
+        }
+    );
+
+    // 바운딩 박스는 기준 경로의 모든 파티클을 감싸야 함
+    FBoundingBox EmitterBounds;
+    const bool bHasBounds = Emitter.GetBounds(EmitterBounds);
+    Checker.Check(bHasBounds == (Emitter.Num() > 0), "GetBounds returned %d for %d particles", bHasBounds, Emitter.Num());
+    if (bHasBounds)
+    {
+        int32 NumOutside = 0;
+        for (const FParticleInstance& Instance : LegacyInstances)
+        {
+            const FVector& P = Instance.Position;
+            if (P.X < EmitterBounds.min.X || P.Y < EmitterBounds.min.Y || P.Z < EmitterBounds.min.Z
+                || P.X > EmitterBounds.max.X || P.Y > EmitterBounds.max.Y || P.Z > EmitterBounds.max.Z)
+            {
+                ++NumOutside;
+            }
+        }
+        Checker.Check(NumOutside == 0, "%d particles outside the emitter bounds", NumOutside);
+    }
+
+    Report(
+        LogLevel::Display,
+        "Particle Benchmark: %d particles x %d frames (%d alive, %d bytes per instance), simulate %.3f / %.3f ms (%.1fx), build instances %.3f / %.3f ms (%.1fx)",
+        NumParticles, NumFrames, Emitter.Num(), static_cast<int32>(sizeof(FParticleInstance)),
+        LegacySimulateMs, SimulateMs, Speedup(LegacySimulateMs, SimulateMs),
+        LegacyBuildMs, BuildMs, Speedup(LegacyBuildMs, BuildMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::FrustumCulling(int32 NumBoxes, int32 NumIterations)
+{
+    FBenchmarkChecker Checker("Frustum Culling");
+    NumBoxes = std::max(NumBoxes, 1);
+    NumIterations = std::max(NumIterations, 1);
+
+    // 원점에서 +X를 바라보는 시야각 90도의 절두체
+    const float InvSqrt2 = 1.f / sqrtf(2.f);
+    const Plane Planes[6] = {
+        { InvSqrt2, InvSqrt2, 0.f, 0.f },
+        { InvSqrt2, -InvSqrt2, 0.f, 0.f },
+        { InvSqrt2, 0.f, InvSqrt2, 0.f },
+        { InvSqrt2, 0.f, -InvSqrt2, 0.f },
+        { 1.f, 0.f, 0.f, -1.f },
+        { -1.f, 0.f, 0.f, 1000.f },
+    };
+
+    // 로컬 바운딩 박스와 월드 행렬을 가진 무작위 오브젝트들
+    FBenchmarkRandom Random;
+    TArray<FBoundingBox> LocalBounds;
+    TArray<FMatrix> WorldMatrices;
+    LocalBounds.SetNum(NumBoxes);
+    WorldMatrices.SetNum(NumBoxes);
+    for (int32 i = 0; i < NumBoxes; ++i)
+    {
+        const FVector Extent = Random.Vector(0.5f, 20.f);
+        LocalBounds[i] = FBoundingBox(Extent * -1.f, Extent);
+        WorldMatrices[i] = Random.Transform(1000.f);
+    }
+
+    // 기존 방식: 매 프레임 박스마다 월드로 변환한 뒤 경계 구로 검사
+    TArray<int32> LegacyVisible;
+    const double LegacyMs = MeasureMs(NumIterations, [&]()
+    {
+        LegacyVisible.Empty();
+        for (int32 i = 0; i < NumBoxes; ++i)
+        {
+            if (LocalBounds[i].TransformWorld(WorldMatrices[i]).IsIntersectingFrustum(Planes))
+            {
+                LegacyVisible.Add(i);
+            }
+        }
+    });
+
+    // 모든 박스가 Dirty일 때의 갱신 비용
+    FFrustumCuller Culler;
+    const double RefreshMs = MeasureMs(1, [&]()
+    {
+        Culler.SetNum(NumBoxes);
+        for (int32 i = 0; i < NumBoxes; ++i)
+        {
+            Culler.SetBounds(i, LocalBounds[i].TransformWorld(WorldMatrices[i]));
+        }
+    });
+
+    // 기준 경로
+    TArray<int32> ScalarVisible;
+    const double ScalarMs = MeasureMs(NumIterations, [&]() { Culler.CullScalar(Planes, ScalarVisible); });
+
+    TArray<int32> SIMDVisible;
+    const double SIMDMs = MeasureMs(NumIterations, [&]()
+    {
+        SIMDVisible.Empty();
+        Culler.CullRange(Planes, 0, NumBoxes, SIMDVisible);
+    });
+
+    TArray<int32> ParallelVisible;
+    const double ParallelMs = MeasureMs(NumIterations, [&]() { Culler.Cull(Planes, ParallelVisible); });
+
+    Checker.CheckEqualArrays(SIMDVisible, ScalarVisible, "SIMD visible indices");
+    Checker.CheckEqualArrays(ParallelVisible, ScalarVisible, "SIMD parallel visible indices");
+
+    // 경계 구는 박스를 감싸므로, 박스 검사를 통과한 오브젝트는 기존 방식에서도 보여야 함
+    Checker.Check(
+        std::includes(LegacyVisible.begin(), LegacyVisible.end(), ScalarVisible.begin(), ScalarVisible.end()),
+        "a box visible to the culler was rejected by the bounding sphere test"
+    );
+
+    Report(
+        LogLevel::Display, "Frustum Culling Benchmark: %d boxes, %d iterations, %d visible (bounding sphere: %d), refresh all %.3f ms",
+        NumBoxes, NumIterations, ScalarVisible.Num(), LegacyVisible.Num(), RefreshMs
+    );
+    Report(
+        LogLevel::Display,
+        "Frustum Culling Benchmark: transform + sphere %.3f ms, scalar %.3f ms (%.1fx), SIMD %.3f ms (%.1fx), SIMD parallel %.3f ms (%.1fx)",
+        LegacyMs, ScalarMs, Speedup(LegacyMs, ScalarMs), SIMDMs, Speedup(LegacyMs, SIMDMs), ParallelMs, Speedup(LegacyMs, ParallelMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::MeshBatching(int32 NumComponents, int32 NumMeshes, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Mesh Batch");
+    NumComponents = std::max(NumComponents, 1);
+    NumMeshes = std::max(NumMeshes, 1);
+    NumFrames = std::max(NumFrames, 1);
+    // 메시 하나가 가진 머티리얼 서브셋 수
+    constexpr int32 NumSubsets = 3;
+
+    // 키는 주소만 비교하므로 메시와 머티리얼 대신 이 배열의 원소 주소를 사용
+    TArray<uint64> FakeObjects;
+    FakeObjects.SetNum(NumMeshes + 1);
+    auto FakeMesh = [&FakeObjects](int32 Index) { return reinterpret_cast<UStaticMesh*>(&FakeObjects[Index]); };
+    UMaterial* FakeOverride = reinterpret_cast<UMaterial*>(&FakeObjects[NumMeshes]);
+
+    // 컴포넌트마다 자기 오버라이드 배열을 가지며, 10개 중 하나는 첫 머티리얼을 바꿈
+    FBenchmarkRandom Random;
+    TArray<TArray<UMaterial*>> OverrideMaterials;
+    TArray<FStaticMeshBatchKey> Keys;
+    TArray<FMatrix> Worlds;
+    OverrideMaterials.SetNum(NumComponents);
+    Keys.SetNum(NumComponents);
+    Worlds.SetNum(NumComponents);
+    for (int32 i = 0; i < NumComponents; ++i)
+    {
+        OverrideMaterials[i].SetNum(NumSubsets);
+        for (UMaterial*& Material : OverrideMaterials[i])
+        {
+            Material = nullptr;
+        }
+        if (i % 10 == 0)
+        {
+            OverrideMaterials[i][0] = FakeOverride;
+        }
+
+        Keys[i].Mesh = FakeMesh(Random.RangeInt(0, NumMeshes - 1));
+        Keys[i].OverrideMaterials = &OverrideMaterials[i];
+        Keys[i].SelectedSubMeshIndex = i == 0 ? 1 : INDEX_NONE;
+        Worlds[i] = Random.Transform(1000.f);
+    }
+
+    // 기준 경로: 컴포넌트마다 상수 버퍼 두 개를 채우고 서브셋마다 드로우
+    FMatrix Projection = FMatrix::Identity;
+    Projection.M[2][3] = 1.f;
+    Projection.M[3][2] = -0.1f;
+    Projection.M[3][3] = 0.f;
+
+    TArray<FPerObjectConstantBuffer> MappedPerObjects;
+    MappedPerObjects.SetNum(NumComponents);
+    FCameraConstantBuffer MappedCamera;
+    int32 LegacyDraws = 0;
+    int32 LegacyBufferUpdates = 0;
+    const double LegacyMs = MeasureMs(NumFrames, [&]()
+    {
+        LegacyDraws = 0;
+        LegacyBufferUpdates = 0;
+        for (int32 i = 0; i < NumComponents; ++i)
+        {
+            const FPerObjectConstantBuffer PerObject(Worlds[i], FMatrix::Transpose(FMatrix::Inverse(Worlds[i])), FVector4(), false);
+            std::memcpy(&MappedPerObjects[i], &PerObject, sizeof(PerObject));
+
+            FCameraConstantBuffer Camera;
+            Camera.View = FMatrix::Identity;
+            Camera.Projection = Projection;
+            Camera.InvProjection = FMatrix::Inverse(Projection);
+            std::memcpy(&MappedCamera, &Camera, sizeof(Camera));
+
+            // 서브셋마다 FSubMeshConstants와 FMaterialConstants도 갱신
+            LegacyDraws += NumSubsets;
+            LegacyBufferUpdates += 2 + NumSubsets * 2;
+        }
+    });
+
+    // 배치 단계: 묶은 뒤 인스턴스 버퍼 하나를 채우고 배치와 서브셋마다 드로우
+    FStaticMeshInstanceBatcher Batcher;
+    TArray<FStaticMeshInstanceData> MappedInstances;
+    MappedInstances.SetNum(NumComponents);
+    int32 Draws = 0;
+    int32 BufferUpdates = 0;
+    const double BatchMs = MeasureMs(NumFrames, [&]()
+    {
+        Batcher.Reset();
+        for (int32 i = 0; i < NumComponents; ++i)
+        {
+            Batcher.AddInstance(Keys[i], Worlds[i]);
+        }
+        Batcher.Build();
+        std::memcpy(MappedInstances.GetData(), Batcher.GetInstances().GetData(), sizeof(FStaticMeshInstanceData) * Batcher.NumInstances());
+        Draws = Batcher.GetBatches().Num() * NumSubsets;
+        // 카메라와 인스턴스 버퍼 한 번씩, 배치마다 FInstanceConstants
+        BufferUpdates = 2 + Batcher.GetBatches().Num() * (1 + NumSubsets * 2);
+    });
+
+    // 기준 경로의 행렬을 처음 나온 키 순서로, 같은 키 안에서는 컴포넌트 순서로 모은 것과 같아야 함
+    TArray<FStaticMeshBatch> ExpectedBatches;
+    TArray<TArray<int32>> ComponentsPerBatch;
+    for (int32 i = 0; i < NumComponents; ++i)
+    {
+        int32 BatchIndex = 0;
+        while (BatchIndex < ExpectedBatches.Num() && !(ExpectedBatches[BatchIndex].Key == Keys[i]))
+        {
+            ++BatchIndex;
+        }
+        if (BatchIndex == ExpectedBatches.Num())
+        {
+            ExpectedBatches[ExpectedBatches.Emplace()].Key = Keys[i];
+            ComponentsPerBatch.Emplace();
+        }
+        ++ExpectedBatches[BatchIndex].NumInstances;
+        ComponentsPerBatch[BatchIndex].Add(i);
+    }
+
+    TArray<FStaticMeshInstanceData> ExpectedInstances;
+    ExpectedInstances.Reserve(NumComponents);
+    for (int32 BatchIndex = 0; BatchIndex < ExpectedBatches.Num(); ++BatchIndex)
+    {
+        ExpectedBatches[BatchIndex].FirstInstance = ExpectedInstances.Num();
+        for (const int32 Component : ComponentsPerBatch[BatchIndex])
+        {
+            FStaticMeshInstanceData& Instance = ExpectedInstances[ExpectedInstances.Emplace()];
+            Instance.World = MappedPerObjects[Component].Model;
+            Instance.WorldInverseTranspose = MappedPerObjects[Component].ModelMatrixInverseTranspose;
+        }
+    }
+
+    Checker.CheckEqualArrays(
+        Batcher.GetBatches(), ExpectedBatches, "batches", [](const FStaticMeshBatch& A, const FStaticMeshBatch& B)
+        {
+            return A.Key == B.Key && A.FirstInstance == B.FirstInstance && A.NumInstances == B.NumInstances;
+        }
+    );
+    Checker.CheckEqualArrays(MappedInstances, ExpectedInstances, "instance data", IsBitwiseEqual<FStaticMeshInstanceData>);
+
+    Report(
+        LogLevel::Display,
+        "Mesh Batch Benchmark: %d components, %d meshes x %d frames, %d batches, draws %d / %d, buffer updates %d / %d, CPU prepare %.3f / %.3f ms (%.1fx)",
+        NumComponents, NumMeshes, NumFrames, Batcher.GetBatches().Num(),
+        LegacyDraws, Draws, LegacyBufferUpdates, BufferUpdates,
+        LegacyMs, BatchMs, Speedup(LegacyMs, BatchMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::DrawCommandSorting(int32 NumCommands, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Draw List");
+    NumCommands = std::max(NumCommands, 1);
+    NumFrames = std::max(NumFrames, 1);
+    constexpr int32 NumMaterials = 64;
+    constexpr int32 NumMeshes = 256;
+    constexpr int32 MaxDepth = (1 << FDrawCommandList::DepthBits) - 1;
+
+    struct FDrawDesc
+    {
+        uint32 ShaderVariant;
+        uint32 Material;
+        uint32 Mesh;
+        uint32 Depth;
+    };
+
+    // 명령이 많으면 깊이까지 같은 키가 생기므로 같은 키의 순서가 유지되는지도 검사됨
+    FBenchmarkRandom Random;
+    TArray<FDrawDesc> Draws;
+    Draws.SetNum(NumCommands);
+    for (FDrawDesc& Draw : Draws)
+    {
+        const uint32 ShaderVariant = Random.RangeInt(0, 1);
+        const uint32 Material = Random.RangeInt(0, NumMaterials - 1);
+        const uint32 Mesh = Random.RangeInt(0, NumMeshes - 1);
+        const uint32 Depth = Random.RangeInt(0, MaxDepth);
+        Draw = { ShaderVariant, Material, Mesh, Depth };
+    }
+
+    // 값은 비교에만 쓰므로 0이 아닌 정수를 주소처럼 사용
+    auto AsHandle = [](uint32 Value) { return reinterpret_cast<const void*>(static_cast<uintptr_t>(Value) + 1); };
+    auto CountStates = [&Draws, &AsHandle](const TArray<FDrawCommand>& Commands)
+    {
+        FDrawStateTracker Tracker;
+        for (const FDrawCommand& Command : Commands)
+        {
+            const FDrawDesc& Draw = Draws[Command.BatchIndex];
+            Tracker.SetPixelShader(AsHandle(Draw.ShaderVariant));
+            Tracker.SetMesh(AsHandle(Draw.Mesh));
+            Tracker.SetMaterial(AsHandle(Draw.Material));
+            Tracker.AddDraw();
+        }
+        return Tracker.GetStats();
+    };
+
+    FDrawCommandList List;
+    auto FillList = [&List, &Draws, NumCommands]()
+    {
+        List.Reset();
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            const FDrawDesc& Draw = Draws[Index];
+            List.Add(FDrawCommandList::MakeSortKey(Draw.ShaderVariant, Draw.Material, Draw.Mesh, Draw.Depth), Index, 0);
+        }
+    };
+
+    FillList();
+    const TArray<FDrawCommand> Unsorted = List.GetCommands();
+    const FDrawListStats UnsortedStats = CountStates(Unsorted);
+
+    // 기준 경로: std::stable_sort
+    TArray<FDrawCommand> Reference;
+    double ReferenceMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Reference = Unsorted;
+        ReferenceMs += MeasureMs(1, [&Reference]()
+        {
+            std::stable_sort(Reference.begin(), Reference.end(), [](const FDrawCommand& A, const FDrawCommand& B) { return A.SortKey < B.SortKey; });
+        });
+    }
+
+    // 명령이 MinRadixSortCommands보다 적으면 Sort 안에서도 std::stable_sort를 사용
+    double SortMs = 0.0;
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        FillList();
+        SortMs += MeasureMs(1, [&List]() { List.Sort(); });
+    }
+    const FDrawListStats SortedStats = CountStates(List.GetCommands());
+
+    Checker.CheckEqualArrays(
+        List.GetCommands(), Reference, "sorted draw commands", [](const FDrawCommand& A, const FDrawCommand& B)
+        {
+            return A.SortKey == B.SortKey && A.BatchIndex == B.BatchIndex && A.SubsetIndex == B.SubsetIndex;
+        }
+    );
+    Checker.Check(
+        SortedStats.NumDraws == UnsortedStats.NumDraws && SortedStats.NumStateChanges <= UnsortedStats.NumStateChanges,
+        "sorting changed the draw count or added state changes (%u -> %u)", UnsortedStats.NumStateChanges, SortedStats.NumStateChanges
+    );
+
+    Report(
+        LogLevel::Display,
+        "Draw List Benchmark: %d draws x %d frames, state changes %u / %u, constant buffer uploads %u / %u, sort std::stable_sort %.3f / %s %.3f ms (%.1fx)",
+        NumCommands, NumFrames,
+        UnsortedStats.NumStateChanges, SortedStats.NumStateChanges,
+        UnsortedStats.NumConstantBufferUploads, SortedStats.NumConstantBufferUploads,
+        ReferenceMs, NumCommands < FDrawCommandList::MinRadixSortCommands ? "Sort" : "radix", SortMs, Speedup(ReferenceMs, SortMs)
+    );
+    return Checker.Finish();
+}
+
+bool EngineBenchmarks::ConstantBuffers(int32 NumObjects, int32 NumFrames)
+{
+    FBenchmarkChecker Checker("Constant Buffer");
+    NumObjects = std::max(NumObjects, 1);
+    NumFrames = std::max(NumFrames, 1);
+
+    // 빌보드처럼 오브젝트마다 행렬과 SubUV를 올리고, 이전 스태틱 메시 패스처럼 카메라도 오브젝트마다 올리는 장면
+    constexpr int32 SubUVRunLength = 64;
+    constexpr uint32 PerObjectSlot = 0;
+    constexpr uint32 SubUVSlot = 1;
+    constexpr uint32 CameraSlot = 2;
+
+    // 값 검사는 링 버퍼가 여러 번 돌고 SubUV 중복 제거가 프레임을 넘어가는지 볼 수 있을 만큼만 따로 실행
+    const int32 NumVerifyFrames = std::min(NumFrames, 2);
+
+    FCameraConstantBuffer CameraData = {};
+    CameraData.View = FMatrix::Identity;
+    CameraData.Projection = FMatrix::Identity;
+    CameraData.InvProjection = FMatrix::Identity;
+    CameraData.CameraNear = 0.1f;
+    CameraData.CameraFar = 1000.f;
+
+    auto MakePerObject = [](int32 Frame, int32 Object)
+    {
+        FPerObjectConstantBuffer Data = {};
+        Data.Model = FMatrix::Identity;
+        Data.Model.M[3][0] = static_cast<float>(Object);
+        Data.Model.M[3][1] = static_cast<float>(Frame);
+        Data.ModelMatrixInverseTranspose = FMatrix::Identity;
+        Data.UUIDColor = FVector4(static_cast<float>(Object & 0xFF), static_cast<float>((Object >> 8) & 0xFF), 0.f, 1.f);
+        Data.IsSelected = Object == 0;
+        return Data;
+    };
+    auto MakeSubUV = [](int32 Object)
+    {
+        FSubUVConstant Data = {};
+        Data.uvOffset = FVector2D(static_cast<float>((Object / SubUVRunLength) % 4) * 0.25f, 0.f);
+        Data.uvScale = FVector2D(0.25f, 1.f);
+        Data.TintColor = FLinearColor::White;
+        return Data;
+    };
+
+    // 드로우마다 셰이더가 세 슬롯에서 읽게 될 바이트를 이어 붙임, 바인딩이 없거나 작으면 그 슬롯은 빠져서 길이가 달라짐
+    auto CaptureBound = [](const FMockConstantBufferDevice& Device, TArray<uint8>& OutBound)
+    {
+        struct FSlotDesc
+        {
+            uint32 Slot;
+            uint32 Size;
+        };
+        const FSlotDesc Slots[] = {
+            { PerObjectSlot, sizeof(FPerObjectConstantBuffer) },
+            { SubUVSlot, sizeof(FSubUVConstant) },
+            { CameraSlot, sizeof(FCameraConstantBuffer) },
+        };
+        for (const FSlotDesc& Desc : Slots)
+        {
+            uint32 BoundSize = 0;
+            const uint8* Bound = Device.GetBoundData(EShaderStage::Vertex, Desc.Slot, BoundSize);
+            if (Bound && BoundSize >= Desc.Size)
+            {
+                const int32 Offset = OutBound.AddUninitialized(Desc.Size);
+                std::memcpy(OutBound.GetData() + Offset, Bound, Desc.Size);
+            }
+        }
+    };
+
+    // 기준 경로: 매번 이름으로 버퍼를 찾아 Discard로 Map하고 바인딩
+    auto RunLegacy = [&](int32 NumRunFrames, TArray<uint8>* OutBound, FMockConstantBufferDevice::FCounters& OutCounters)
+    {
+        FMockConstantBufferDevice MockDevice(false);
+        TFlatMap<FString, ID3D11Buffer*> Pool;
+        Pool.Add(TEXT("FPerObjectConstantBuffer"), MockDevice.CreateConstantBuffer(sizeof(FPerObjectConstantBuffer)));
+        Pool.Add(TEXT("FSubUVConstant"), MockDevice.CreateConstantBuffer(sizeof(FSubUVConstant)));
+        Pool.Add(TEXT("FCameraConstantBuffer"), MockDevice.CreateConstantBuffer(sizeof(FCameraConstantBuffer)));
+        MockDevice.ResetCounters();
+
+        auto UpdateAndBind = [&Pool, &MockDevice](const FString& Key, const void* Data, uint32 Size, uint32 Slot)
+        {
+            ID3D11Buffer* const* Buffer = Pool.Find(Key);
+            void* Mapped = MockDevice.Map(*Buffer, EConstantBufferMapMode::Discard);
+            std::memcpy(Mapped, Data, Size);
+            MockDevice.Unmap(*Buffer);
+            MockDevice.Bind(EShaderStage::Vertex, Slot, *Pool.Find(Key), 0, 0);
+        };
+
+        double ElapsedMs = 0.0;
+        for (int32 Frame = 0; Frame < NumRunFrames; ++Frame)
+        {
+            ElapsedMs += MeasureMs(1, [&]()
+            {
+                for (int32 Object = 0; Object < NumObjects; ++Object)
+                {
+                    const FPerObjectConstantBuffer PerObject = MakePerObject(Frame, Object);
+                    const FSubUVConstant SubUV = MakeSubUV(Object);
+                    UpdateAndBind(TEXT("FPerObjectConstantBuffer"), &PerObject, sizeof(PerObject), PerObjectSlot);
+                    UpdateAndBind(TEXT("FSubUVConstant"), &SubUV, sizeof(SubUV), SubUVSlot);
+                    UpdateAndBind(TEXT("FCameraConstantBuffer"), &CameraData, sizeof(CameraData), CameraSlot);
+                    if (OutBound)
+                    {
+                        CaptureBound(MockDevice, *OutBound);
+                    }
+                }
+            });
+        }
+        OutCounters = MockDevice.GetCounters();
+        return ElapsedMs;
+    };
+
+    // 핸들과 중복 제거, 장치가 지원하면 링 버퍼, 카메라는 프레임마다 한 번
+    auto RunUploader = [&](bool bSupportsOffsets, int32 NumRunFrames, TArray<uint8>* OutBound, FConstantBufferStats& OutStats, FMockConstantBufferDevice::FCounters& OutCounters)
+    {
+        FMockConstantBufferDevice MockDevice(bSupportsOffsets);
+        FConstantBufferUploader Uploader;
+        Uploader.Initialize(&MockDevice);
+        const FConstantBufferHandle PerObjectHandle = Uploader.Create(TEXT("FPerObjectConstantBuffer"), sizeof(FPerObjectConstantBuffer));
+        const FConstantBufferHandle SubUVHandle = Uploader.Create(TEXT("FSubUVConstant"), sizeof(FSubUVConstant));
+        const FConstantBufferHandle CameraHandle = Uploader.Create(TEXT("FCameraConstantBuffer"), sizeof(FCameraConstantBuffer));
+        MockDevice.ResetCounters();
+
+        double ElapsedMs = 0.0;
+        for (int32 Frame = 0; Frame < NumRunFrames; ++Frame)
+        {
+            ElapsedMs += MeasureMs(1, [&]()
+            {
+                Uploader.Update(CameraHandle, &CameraData, sizeof(CameraData));
+                Uploader.Bind(CameraHandle, CameraSlot, EShaderStage::Vertex);
+                Uploader.Bind(SubUVHandle, SubUVSlot, EShaderStage::Vertex);
+                for (int32 Object = 0; Object < NumObjects; ++Object)
+                {
+                    const FPerObjectConstantBuffer PerObject = MakePerObject(Frame, Object);
+                    const FSubUVConstant SubUV = MakeSubUV(Object);
+                    const FTransientConstantBuffer Transient = Uploader.UploadTransient(PerObjectHandle, &PerObject, sizeof(PerObject));
+                    Uploader.BindTransient(Transient, PerObjectSlot, EShaderStage::Vertex);
+                    Uploader.Update(SubUVHandle, &SubUV, sizeof(SubUV));
+                    if (OutBound)
+                    {
+                        CaptureBound(MockDevice, *OutBound);
+                    }
+                }
+            });
+        }
+        OutStats = Uploader.GetStats();
+        OutCounters = MockDevice.GetCounters();
+        return ElapsedMs;
+    };
+
+    FMockConstantBufferDevice::FCounters LegacyCounters;
+    const double LegacyMs = RunLegacy(NumFrames, nullptr, LegacyCounters);
+
+    FConstantBufferStats FallbackStats;
+    FMockConstantBufferDevice::FCounters FallbackCounters;
+    const double FallbackMs = RunUploader(false, NumFrames, nullptr, FallbackStats, FallbackCounters);
+
+    FConstantBufferStats RingStats;
+    FMockConstantBufferDevice::FCounters RingCounters;
+    const double RingMs = RunUploader(true, NumFrames, nullptr, RingStats, RingCounters);
+
+    // 시간을 잰 뒤 따로 한 번 더 돌려 드로우마다 셰이더가 읽는 값을 기준 경로와 비교
+    FMockConstantBufferDevice::FCounters VerifyCounters;
+    FConstantBufferStats VerifyStats;
+    TArray<uint8> ReferenceBound;
+    RunLegacy(NumVerifyFrames, &ReferenceBound, VerifyCounters);
+
+    TArray<uint8> RingBound;
+    RunUploader(true, NumVerifyFrames, &RingBound, VerifyStats, VerifyCounters);
+    Checker.CheckEqualArrays(RingBound, ReferenceBound, "constants bound from the ring buffer");
+
+    TArray<uint8> FallbackBound;
+    RunUploader(false, NumVerifyFrames, &FallbackBound, VerifyStats, VerifyCounters);
+    Checker.CheckEqualArrays(FallbackBound, ReferenceBound, "constants bound from the fallback buffers");
+
+    Checker.Check(
+        RingCounters.NumMaps <= LegacyCounters.NumMaps && FallbackCounters.NumMaps <= LegacyCounters.NumMaps,
+        "uploader mapped more than the reference (%u, %u > %u)", RingCounters.NumMaps, FallbackCounters.NumMaps, LegacyCounters.NumMaps
+    );
+    Checker.Check(
+        NumObjects <= SubUVRunLength || FallbackStats.NumSkippedUploads > 0,
+        "repeated SubUV constants were not skipped"
+    );
+
+    Report(
+        LogLevel::Display,
+        "Constant Buffer Benchmark: %d objects x %d frames, maps by name %u (%.3f ms) / handles %u, %u skipped (%.3f ms) / handles + ring %u, %u discard, %u wraps (%.3f ms, %.1fx)",
+        NumObjects, NumFrames,
+        LegacyCounters.NumMaps, LegacyMs,
+        FallbackCounters.NumMaps, FallbackStats.NumSkippedUploads, FallbackMs,
+        RingCounters.NumMaps, RingCounters.NumDiscardMaps, RingStats.NumRingWraps, RingMs, Speedup(LegacyMs, RingMs)
+    );
+    return Checker.Finish();
+}
+
+int32 EngineBenchmarks::RunAll()
+{
+    // -bench로 실행하면 엔진 초기화 없이 불리므로 여기서 워커 스레드를 띄움
+    if (FQueuedThreadPool::Get().GetNumThreads() == 0)
+    {
+        FQueuedThreadPool::Get().Startup();
+    }
+
+    int32 NumFailed = 0;
+
+    // 경로 없이 실행해서 병렬 파서가 청크로 나누는 크기의 텍스트를 임시 파일로 만들어 비교
+    NumFailed += !ObjParsing(FString(), 1);
+    // 엔진 초기화 전이므로 등록 단계는 빼고 임시 메시로 동기, 병렬 빌드만 비교
+    NumFailed += !AsyncMeshLoading(TArray<FString>(), false);
+    // 리프가 여러 단계로 나뉘도록 삼각형이 많은 무작위 메시
+    {
+        FBenchmarkRandom Random;
+        OBJ::FStaticMeshRenderData RandomMesh;
+        BuildRandomTriangleMesh(Random, 4096, 100.f, RandomMesh);
+        NumFailed += !MeshPicking(RandomMesh, 500);
+    }
+    // 패킷의 빈 자리도 검사하도록 Width의 배수가 아니게
+    NumFailed += !RayTriangleKernel(FTrianglePacket4::Width * 256 + 3, 64);
+    // 여러 작업으로 나뉘도록 작업 크기보다 많게
+    NumFailed += !TransformHierarchy(FSceneTransformHierarchy::MinEntriesPerTask * 4);
+    // 청크 하나에 들어가는 작은 수, 콘솔의 bench uobject로 큰 수를 비교
+    NumFailed += !UObjectArray(10000);
+    NumFailed += !ClassIsChildOf(100);
+    NumFailed += !ObjectSpawning(10000);
+    NumFailed += !FrameArenaAllocation(20, 256);
+    NumFailed += !BinnedMalloc(1000, 20);
+    NumFailed += !FlatContainers(5000);
+    NumFailed += !NamePool(2000);
+    NumFailed += !Projectiles(1000, 30);
+    NumFailed += !ParticleSimulation(1000, 30);
+    // 박스 수가 Width의 배수가 아니고 여러 작업으로 나뉘도록 해서 남는 자리와 병렬 경로도 검사
+    NumFailed += !FrustumCulling(FFrustumCuller::BoxesPerTask * 3 + 3, 2);
+    // 노멀 행렬을 여러 작업으로 나눠 계산하도록 작업 크기보다 많게
+    NumFailed += !MeshBatching(FStaticMeshInstanceBatcher::MinInstancesPerTask * 2 + 5, 8, 2);
+    // 기수 정렬과 적을 때 쓰는 std::stable_sort 경로를 모두 검사
+    NumFailed += !DrawCommandSorting(FDrawCommandList::MinRadixSortCommands * 64, 2);
+    NumFailed += !DrawCommandSorting(FDrawCommandList::MinRadixSortCommands / 2, 2);
+    // 링 버퍼가 한 프레임 안에서 끝에 닿아 처음으로 돌아가도록 링 버퍼에 들어가는 수보다 많게
+    NumFailed += !ConstantBuffers(FConstantBufferUploader::DefaultRingBufferSize / FConstantBufferUploader::TransientAlignment + 100, 2);
+
+    Report(NumFailed == 0 ? LogLevel::Display : LogLevel::Error, "Benchmarks: %d failed", NumFailed);
+    return NumFailed;
+}
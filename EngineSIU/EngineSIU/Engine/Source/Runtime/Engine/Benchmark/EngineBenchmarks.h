@@ -0,0 +1,128 @@
+#pragma once
+#include "Container/Array.h"
+#include "HAL/PlatformType.h"
+
+class FString;
+
+namespace OBJ
+{
+    struct FStaticMeshRenderData;
+}
+
+/**
+ * 최적화한 경로를 기준(reference) 경로와 비교하는 벤치마크 겸 검사
+ *
+ * 각 함수는 두 경로의 처리 시간을 출력하고, 결과가 기준 경로와 하나라도 다르면 실패한 검사를 로그로 남긴 뒤 false를 반환합니다.
+ * 콘솔의 bench 명령이나 -bench 실행 인자(RunAll)로 실행합니다.
+ */
+namespace EngineBenchmarks
+{
+    /**
+     * 줄 앞 공백과 음수 인덱스가 섞인 OBJ 텍스트로 병렬 파서가 ParseOBJBuffer와 같은 결과를 내는지 검사한 뒤,
+     * ObjFilePath를 Stream, MemoryMapped, Parallel 파서로 NumIterations번 읽어 처리량과 결과, 정점 용접 결과를 비교
+     * @param ObjFilePath 비어 있으면 만든 텍스트를 임시 파일로 저장해서 사용
+     */
+    bool ObjParsing(const FString& ObjFilePath, int32 NumIterations);
+
+    /**
+     * 메시들을 호출한 스레드에서 순서대로, 워커 스레드에서 동시에 빌드해서 시간과 렌더 데이터를 비교
+     * @param FilePaths 비어 있으면 크기가 다른 OBJ를 임시 폴더에 만들어 사용
+     * @param bPublish LoadStaticMeshAsync로 등록까지 검사할지 여부, GPU 버퍼를 만들므로 엔진이 초기화된 뒤에만 true
+     */
+    bool AsyncMeshLoading(const TArray<FString>& FilePaths, bool bPublish);
+
+    /** RenderData로 FStaticMeshBVH를 만들고 바깥에서 메시를 향하는 NumRays개의 레이로 Raycast와 RaycastBruteForce의 시간과 결과를 비교 */
+    bool MeshPicking(const OBJ::FStaticMeshRenderData& RenderData, int32 NumRays);
+
+    /**
+     * 무작위 삼각형들에 대해 UPrimitiveComponent::IntersectRayTriangle과 패킷 검사(스칼라, SSE)의
+     * 초당 처리 삼각형 수를 비교하고, 레이와 삼각형마다 교차 여부와 거리가 비트 단위로 같은지 검사
+     */
+    bool RayTriangleKernel(int32 NumTriangles, int32 NumRays);
+
+    /**
+     * 무작위 계층 구조의 USceneComponent들로 부모를 따라 올라가며 계산하는 기존 방식과 FSceneTransformHierarchy의
+     * 전체 갱신, 일부만 Dirty일 때, 일부를 다른 부모로 옮겼을 때의 갱신 시간을 비교하고 행렬이 같은지 검사
+     */
+    bool TransformHierarchy(int32 NumComponents);
+
+    /**
+     * GUObjectArray에 NumObjects개의 Object를 만들고 절반을 제거한 뒤 다시 만들면서, 기존 방식(TSet과 Class별 TSet)과
+     * 추가, 순회, 제거 시간을 비교하고 Class별 Object 목록과 InternalIndex 자리가 기준 경로와 같은지 검사
+     * 끝나면 만든 Object를 모두 제거하므로 살아있는 Object 수는 그대로
+     */
+    bool UObjectArray(int32 NumObjects);
+
+    /** 등록된 모든 클래스 쌍에 대해 부모를 따라 올라가는 방식과 UClass::IsChildOf를 NumIterations번 실행해서 시간과 결과를 비교 */
+    bool ClassIsChildOf(int32 NumIterations);
+
+    /**
+     * 기존 방식(Object마다 힙 할당, 생성할 때 이름 생성)과 ConstructObject로 NumObjects개의 Object를 생성하고 제거하는
+     * 처리량과 메모리를 비교하고, 나중에 만든 이름이 기존 이름 규칙과 같은지와 풀의 자리를 재사용하는지 검사
+     */
+    bool ObjectSpawning(int32 NumObjects);
+
+    /**
+     * 렌더 패스와 비슷한 임시 배열을 NumFrames번 힙 컨테이너와 지역 FFrameArena의 컨테이너로 채워서 시간과 힙 할당 수를 비교하고,
+     * 배열의 내용과 프레임당 할당 수가 힙 경로와 같은지, 버퍼가 자란 뒤에는 힙으로 넘치지 않는지 검사
+     */
+    bool FrameArenaAllocation(int32 NumFrames, int32 NumElements);
+
+    /**
+     * 모든 Bin에서 여러 페이지만큼 블록을 할당해서 정렬과 겹침, 통계를 검사한 뒤, 씬 로드(액터마다 작은 배열, 맵, 셋을 만들고 제거)와
+     * 렌더 패스 준비(매 프레임 작은 임시 배열)를 흉내낸 작업을 시스템 할당기와 FMallocBinned로 실행해서 시간과 결과를 비교
+     * 패스 준비는 워커 스레드에서도 동시에 실행
+     */
+    bool BinnedMalloc(int32 NumActors, int32 NumFrames);
+
+    /**
+     * TMap과 TFlatMap의 추가, 조회(있는 키, 없는 키), 순회, 제거 시간을 정수 키와 문자열 키로 비교하고 TSet과 TFlatSet도 비교,
+     * 일부를 제거한 뒤의 조회 결과와 남은 원소가 기준 경로(TMap, TSet)와 같은지 검사
+     */
+    bool FlatContainers(int32 NumElements);
+
+    /**
+     * 기존 방식(고정 크기 Entry, 잠금)과 현재 Name 풀에 NumNames개의 Name을 여러 스레드에서 만들고 다시 찾아서 Name당 메모리와 시간을 비교하고,
+     * 여러 스레드에서 얻은 Index와 문자열, 대소문자를 무시한 비교 결과가 한 스레드에서 얻은 기준 결과와 같은지 검사
+     */
+    bool NamePool(int32 NumNames);
+
+    /**
+     * 컴포넌트마다 Tick에서 계산하던 기존 방식과 FProjectileSystem으로 NumProjectiles개의 투사체를 NumFrames번 움직여서 시간을 비교하고,
+     * 살아 있는 투사체 수와 대상 컴포넌트의 최종 위치가 기존 방식과 같은지 검사, 중간 프레임에 밖에서 옮긴 위치가 유지되는지도 함께 검사
+     */
+    bool Projectiles(int32 NumProjectiles, int32 NumFrames);
+
+    /**
+     * 파티클을 구조체 배열에 담아 하나씩 계산하는 방식과 FParticleEmitter로 NumParticles개의 파티클을 NumFrames번 움직이고
+     * 인스턴스 데이터를 만드는 시간을 비교하고, 인스턴스 데이터와 바운딩 박스가 기준 경로와 맞는지 검사
+     */
+    bool ParticleSimulation(int32 NumParticles, int32 NumFrames);
+
+    /** 무작위 박스들을 박스마다 변환 후 경계 구로 검사하는 기존 방식, FFrustumCuller::CullScalar, Cull로 컬링해서 비교 */
+    bool FrustumCulling(int32 NumBoxes, int32 NumIterations);
+
+    /**
+     * 컴포넌트마다 상수 버퍼를 채우던 방식과 FStaticMeshInstanceBatcher로 NumComponents개의 컴포넌트를 NumFrames번 준비해서
+     * CPU 시간과 드로우, 버퍼 갱신 수를 비교하고, 배치와 인스턴스 데이터가 기준 경로의 행렬을 묶은 것과 같은지 검사
+     */
+    bool MeshBatching(int32 NumComponents, int32 NumMeshes, int32 NumFrames);
+
+    /**
+     * 무작위 장면의 드로우를 추가한 순서대로 그릴 때와 정렬한 뒤 그릴 때의 상태 변경 수를 비교하고,
+     * FDrawCommandList::Sort의 결과가 std::stable_sort와 같은지 검사
+     */
+    bool DrawCommandSorting(int32 NumCommands, int32 NumFrames);
+
+    /**
+     * NumObjects개의 오브젝트를 그리는 프레임을 NumFrames번 흉내 내어, 매번 이름으로 찾아 Map하던 방식과 FConstantBufferUploader의
+     * Map 수와 CPU 시간을 비교하고, 드로우마다 셰이더가 읽는 값이 기준 경로와 같은지 링 버퍼와 Fallback 버퍼 모두 검사
+     */
+    bool ConstantBuffers(int32 NumObjects, int32 NumFrames);
+
+    /**
+     * 모든 검사를 작은 기본 크기로 실행합니다.
+     * @return 실패한 검사의 수
+     */
+    int32 RunAll();
+}
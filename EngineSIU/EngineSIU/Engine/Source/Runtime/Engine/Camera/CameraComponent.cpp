@@ -7,7 +7,7 @@
 void UCameraComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
-	RelativeLocation = FVector(0.0f, 0.0f, 0.5f);
+	SetRelativeLocation(FVector(0.0f, 0.0f, 0.5f));
 	FOV = 60.f;
 }
 
@@ -81,29 +81,35 @@ void UCameraComponent::Input()
 
 void UCameraComponent::MoveForward(float _Value)
 {
-	RelativeLocation = RelativeLocation + GetForwardVector() * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar() * _Value;
+	SetRelativeLocation(RelativeLocation + GetForwardVector() * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar() * _Value);
 }
 
 void UCameraComponent::MoveRight(float _Value)
 {
 	//FVector newRight = FVector(GetRightVector().X, GetRightVector().Y, 0.0f);
-	RelativeLocation = RelativeLocation + GetRightVector() * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar() * _Value;
+	SetRelativeLocation(RelativeLocation + GetRightVector() * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar() * _Value);
 }
 
 void UCameraComponent::MoveUp(float _Value)
 {
-	RelativeLocation.Z += _Value * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar();
+	FVector NewLocation = RelativeLocation;
+	NewLocation.Z += _Value * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar();
+	SetRelativeLocation(NewLocation);
 }
 
 void UCameraComponent::RotateYaw(float _Value)
 {
-    RelativeRotation.Yaw += _Value * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar();
+    FRotator NewRotation = RelativeRotation;
+    NewRotation.Yaw += _Value * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar();
+    SetRelativeRotation(NewRotation);
 	// RelativeRotation.Z += _Value * GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetCameraSpeedScalar();
 }
 
 void UCameraComponent::RotatePitch(float _Value)
 {
-    RelativeRotation.Pitch += FMath::Clamp((RelativeRotation.Pitch + _Value), -90.f, 90.f);
+    FRotator NewRotation = RelativeRotation;
+    NewRotation.Pitch += FMath::Clamp((RelativeRotation.Pitch + _Value), -90.f, 90.f);
+    SetRelativeRotation(NewRotation);
     
 	// RelativeRotation.Y = FMath::Clamp(RelativeRotation.Y + _Value, -90.f, 90.f);
 }
@@ -7,7 +7,7 @@
 
 ACube::ACube()
 {
-    StaticMeshComponent->SetStaticMesh(FManagerOBJ::GetStaticMesh(L"Contents/helloBlender.obj"));
+    StaticMeshComponent->SetStaticMeshAsync("Contents/helloBlender.obj");
 }
 
 void ACube::Tick(float DeltaTime)
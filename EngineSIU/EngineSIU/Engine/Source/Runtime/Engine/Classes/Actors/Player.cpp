@@ -14,6 +14,7 @@
 #include "UnrealEd/EditorViewportClient.h"
 #include "UObject/UObjectIterator.h"
 #include "Engine/EditorEngine.h"
+#include "World/PrimitiveSpatialIndex.h"
 
 
 void AEditorPlayer::Tick(float DeltaTime)
@@ -187,41 +188,55 @@ void AEditorPlayer::PickActor(const FVector& pickPosition)
 {
     if (!(ShowFlags::GetInstance().currentFlags & EEngineShowFlags::SF_Primitives)) return;
 
+    FVector RayOrigin, RayDirection;
+    GetWorldPickRay(pickPosition, RayOrigin, RayDirection);
+
     const UActorComponent* Possible = nullptr;
     int maxIntersect = 0;
     float minDistance = FLT_MAX;
-    for (const auto iter : TObjectRange<UPrimitiveComponent>())
+    auto UpdatePossible = [&](UPrimitiveComponent* pObj, float Distance, int currentIntersectCount)
     {
-        UPrimitiveComponent* pObj;
-        if (iter->IsA<UPrimitiveComponent>() || iter->IsA<ULightComponentBase>())
+        if (Distance < minDistance)
         {
-            pObj = static_cast<UPrimitiveComponent*>(iter);
+            minDistance = Distance;
+            maxIntersect = currentIntersectCount;
+            Possible = pObj;
         }
-        else
+        else if (abs(Distance - minDistance) < FLT_EPSILON && currentIntersectCount > maxIntersect)
+        {
+            maxIntersect = currentIntersectCount;
+            Possible = pObj;
+        }
+    };
+
+    FPrimitiveSpatialIndex& SpatialIndex = FPrimitiveSpatialIndex::Get();
+
+    // 빌보드는 화면 공간에서 검사하므로 바운딩 박스로 걸러낼 수 없음
+    for (UPrimitiveComponent* pObj : SpatialIndex.GetUnboundedPrimitives())
+    {
+        float Distance = 0.0f;
+        int currentIntersectCount = 0;
+        if (RayIntersectsObject(pickPosition, pObj, Distance, currentIntersectCount))
         {
-            continue;
+            UpdatePossible(pObj, Distance, currentIntersectCount);
         }
+    }
 
-        if (pObj && !pObj->IsA<UGizmoBaseComponent>())
+    // 레이가 바운딩 박스에 들어가는 거리가 가까운 순서로 검사하고, 찾은 교차점보다 먼 박스가 나오면 멈춤
+    SpatialIndex.RaycastSorted(
+        RayOrigin, RayDirection,
+        [&](UPrimitiveComponent* pObj, float EnterDistance)
         {
             float Distance = 0.0f;
-            int currentIntersectCount = 0;
-            if (RayIntersectsObject(pickPosition, pObj, Distance, currentIntersectCount))
+            if (int currentIntersectCount = RayIntersectsPrimitive(RayOrigin, RayDirection, pObj, Distance))
             {
-                if (Distance < minDistance)
-                {
-                    minDistance = Distance;
-                    maxIntersect = currentIntersectCount;
-                    Possible = pObj;
-                }
-                else if (abs(Distance - minDistance) < FLT_EPSILON && currentIntersectCount > maxIntersect)
-                {
-                    maxIntersect = currentIntersectCount;
-                    Possible = pObj;
-                }
+                UpdatePossible(pObj, Distance, currentIntersectCount);
             }
+            // 거리가 같으면 교차 수로 고르므로 같은 거리에서 시작하는 박스까지는 검사
+            return minDistance + FLT_EPSILON;
         }
-    }
+    );
+
     if (Possible)
     {
         Cast<UEditorEngine>(GEngine)->SelectActor(Possible->GetOwner());
@@ -259,7 +274,7 @@ void AEditorPlayer::ScreenToViewSpace(int screenX, int screenY, const FMatrix& v
 
 int AEditorPlayer::RayIntersectsObject(const FVector& pickPosition, USceneComponent* obj, float& hitDistance, int& intersectCount)
 {
-    FMatrix WorldMatrix = obj->GetWorldMatrix();
+    FMatrix WorldMatrix = FSceneTransformHierarchy::GetWorldMatrix(obj);
 	FMatrix ViewMatrix = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->GetViewMatrix();
     
     bool bIsOrtho = GEngineLoop.GetLevelEditor()->GetActiveViewportClient()->IsOrtho();
@@ -298,6 +313,43 @@ int AEditorPlayer::RayIntersectsObject(const FVector& pickPosition, USceneCompon
     }
 }
 
+void AEditorPlayer::GetWorldPickRay(const FVector& pickPosition, FVector& OutRayOrigin, FVector& OutRayDirection) const
+{
+    std::shared_ptr<FEditorViewportClient> ActiveViewport = GEngineLoop.GetLevelEditor()->GetActiveViewportClient();
+    FMatrix inverseView = FMatrix::Inverse(ActiveViewport->GetViewMatrix());
+
+    if (ActiveViewport->IsOrtho())
+    {
+        // 오쏘 모드: 픽셀 위치에서 카메라 정면 방향으로 평행한 레이
+        OutRayOrigin = inverseView.TransformPosition(pickPosition);
+        OutRayDirection = ActiveViewport->ViewTransformOrthographic.GetForwardVector().GetSafeNormal();
+    }
+    else
+    {
+        OutRayOrigin = inverseView.TransformPosition(FVector(0, 0, 0));
+        OutRayDirection = (inverseView.TransformPosition(pickPosition) - OutRayOrigin).GetSafeNormal();
+    }
+}
+
+int AEditorPlayer::RayIntersectsPrimitive(const FVector& RayOrigin, const FVector& RayDirection, UPrimitiveComponent* Primitive, float& OutHitDistance)
+{
+    const FMatrix WorldMatrix = FSceneTransformHierarchy::GetWorldMatrix(Primitive);
+    const FMatrix LocalMatrix = FMatrix::Inverse(WorldMatrix);
+
+    FVector LocalRayOrigin = LocalMatrix.TransformPosition(RayOrigin);
+    FVector LocalRayDirection = (LocalMatrix.TransformPosition(RayOrigin + RayDirection) - LocalRayOrigin).GetSafeNormal();
+
+    float LocalHitDistance = 0.0f;
+    const int IntersectCount = Primitive->CheckRayIntersection(LocalRayOrigin, LocalRayDirection, LocalHitDistance);
+    if (IntersectCount > 0)
+    {
+        // 스케일이 다른 오브젝트끼리 비교할 수 있도록 월드 공간 거리로 바꿈
+        const FVector WorldHitPosition = WorldMatrix.TransformPosition(LocalRayOrigin + LocalRayDirection * LocalHitDistance);
+        OutHitDistance = (WorldHitPosition - RayOrigin).Length();
+    }
+    return IntersectCount;
+}
+
 void AEditorPlayer::PickedObjControl()
 {
     UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
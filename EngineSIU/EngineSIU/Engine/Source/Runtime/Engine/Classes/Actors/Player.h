@@ -28,6 +28,12 @@ class AEditorPlayer : public AActor
 
 private:
     int RayIntersectsObject(const FVector& pickPosition, USceneComponent* obj, float& hitDistance, int& intersectCount);
+
+    /** pickPosition을 지나는 월드 공간의 피킹 레이를 구합니다. */
+    void GetWorldPickRay(const FVector& pickPosition, FVector& OutRayOrigin, FVector& OutRayDirection) const;
+
+    /** 월드 공간의 레이로 Primitive를 검사하고, 가장 가까운 교차점까지의 월드 공간 거리를 구합니다. */
+    int RayIntersectsPrimitive(const FVector& RayOrigin, const FVector& RayDirection, UPrimitiveComponent* Primitive, float& OutHitDistance);
     void ScreenToViewSpace(int screenX, int screenY, const FMatrix& viewMatrix, const FMatrix& projectionMatrix, FVector& rayOrigin);
     void PickedObjControl();
     void ControlRotation(USceneComponent* pObj, UGizmoBaseComponent* Gizmo, int32 deltaX, int32 deltaY);
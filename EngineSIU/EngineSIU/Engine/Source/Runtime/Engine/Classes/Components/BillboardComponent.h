@@ -21,6 +21,9 @@ public:
         float& pfNearHitDistance
     ) override;
 
+    // 카메라를 향해 회전하므로 고정된 월드 바운딩 박스가 없음
+    virtual bool GetWorldBoundingBox(FBoundingBox& OutBounds) const override { return false; }
+
     virtual void SetTexture(const FWString& _fileName);
     void SetUUIDParent(USceneComponent* _parent);
     void SetTintColor(FLinearColor color);
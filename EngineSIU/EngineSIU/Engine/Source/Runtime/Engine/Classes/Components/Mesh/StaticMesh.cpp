@@ -1,4 +1,5 @@
 #include "StaticMesh.h"
+#include "StaticMeshBVH.h"
 #include "Engine/FLoaderOBJ.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
@@ -44,6 +45,11 @@ void UStaticMesh::GetUsedMaterials(TArray<UMaterial*>& Out) const
     }
 }
 
+const FStaticMeshBVH* UStaticMesh::GetBVH() const
+{
+    return staticMeshRenderData ? staticMeshRenderData->BVH.get() : nullptr;
+}
+
 void UStaticMesh::SetData(OBJ::FStaticMeshRenderData* renderData)
 {
     staticMeshRenderData = renderData;
@@ -4,6 +4,8 @@
 #include "Components/Material/Material.h"
 #include "Define.h"
 
+struct FStaticMeshBVH;
+
 class UStaticMesh : public UObject
 {
     DECLARE_CLASS(UStaticMesh, UObject)
@@ -19,6 +21,9 @@ public:
     void GetUsedMaterials(TArray<UMaterial*>& Out) const;
     OBJ::FStaticMeshRenderData* GetRenderData() const { return staticMeshRenderData; }
 
+    // 렌더 데이터의 삼각형 BVH, 로드할 때 만들어지며 없으면 nullptr
+    const FStaticMeshBVH* GetBVH() const;
+
     void SetData(OBJ::FStaticMeshRenderData* renderData);
 
 private:
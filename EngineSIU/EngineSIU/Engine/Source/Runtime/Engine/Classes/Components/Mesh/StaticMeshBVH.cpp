@@ -0,0 +1,396 @@
+#include "StaticMeshBVH.h"
+
+#include "Components/PrimitiveComponent.h"
+
+#include <bit>
+#include <numeric>
+
+namespace
+{
+    // 깊이가 이보다 깊어지면 더 나누지 않고 리프로 만듦, Raycast의 스택 크기
+    constexpr int32 MaxTreeDepth = 64;
+
+    // UStaticMeshComponent::CheckRayIntersection과 같이 인덱스 1, 2번을 바꿔서 읽음
+    FORCEINLINE void GetTrianglePositions(
+        const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices, int32 TriangleIndex,
+        FVector& OutV0, FVector& OutV1, FVector& OutV2
+    )
+    {
+        int32 Index0 = TriangleIndex * 3;
+        int32 Index1 = TriangleIndex * 3 + 1;
+        int32 Index2 = TriangleIndex * 3 + 2;
+        if (!Indices.IsEmpty())
+        {
+            Index0 = static_cast<int32>(Indices[TriangleIndex * 3]);
+            Index2 = static_cast<int32>(Indices[TriangleIndex * 3 + 1]);
+            Index1 = static_cast<int32>(Indices[TriangleIndex * 3 + 2]);
+        }
+
+        const FStaticMeshVertex& A = Vertices[Index0];
+        const FStaticMeshVertex& B = Vertices[Index1];
+        const FStaticMeshVertex& C = Vertices[Index2];
+        OutV0 = FVector(A.X, A.Y, A.Z);
+        OutV1 = FVector(B.X, B.Y, B.Z);
+        OutV2 = FVector(C.X, C.Y, C.Z);
+    }
+
+    FORCEINLINE int32 CountTriangles(const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices)
+    {
+        return Indices.IsEmpty() ? Vertices.Num() / 3 : Indices.Num() / 3;
+    }
+
+    FORCEINLINE float HalfSurfaceArea(const FVector& Min, const FVector& Max)
+    {
+        const FVector Extent = Max - Min;
+        return Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X;
+    }
+
+    // 레이가 [0, MaxDistance] 구간에서 박스와 만나면 들어가는 거리를 반환
+    FORCEINLINE bool IntersectBounds(
+        const FVector& Min, const FVector& Max, const FVector& RayOrigin, const FVector& InvDirection,
+        float MaxDistance, float& OutEnterDistance
+    )
+    {
+        const float X1 = (Min.X - RayOrigin.X) * InvDirection.X;
+        const float X2 = (Max.X - RayOrigin.X) * InvDirection.X;
+        const float Y1 = (Min.Y - RayOrigin.Y) * InvDirection.Y;
+        const float Y2 = (Max.Y - RayOrigin.Y) * InvDirection.Y;
+        const float Z1 = (Min.Z - RayOrigin.Z) * InvDirection.Z;
+        const float Z2 = (Max.Z - RayOrigin.Z) * InvDirection.Z;
+
+        const float Enter = std::max(std::max(std::min(X1, X2), std::min(Y1, Y2)), std::max(std::min(Z1, Z2), 0.f));
+        // 삼각형 교차 거리의 반올림 오차로 경계의 교차를 놓치지 않도록 살짝 늘림
+        const float Exit = std::min(std::min(std::max(X1, X2), std::max(Y1, Y2)), std::min(std::max(Z1, Z2), MaxDistance)) * 1.0000004f;
+
+        OutEnterDistance = Enter;
+        return Enter <= Exit;
+    }
+
+    FORCEINLINE float SafeInverse(float Value)
+    {
+        constexpr float Huge = 1e30f;
+        return fabs(Value) > 1e-30f ? 1.f / Value : (Value < 0.f ? -Huge : Huge);
+    }
+}
+
+void FStaticMeshBVH::Build(const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices)
+{
+    Nodes.Empty();
+    Packets.Empty();
+    TriangleIndices.Empty();
+    TriangleCount = 0;
+
+    const int32 NumTriangles = CountTriangles(Vertices, Indices);
+    if (NumTriangles == 0)
+    {
+        return;
+    }
+
+    struct FBuildTriangle
+    {
+        FVector Min;
+        FVector Max;
+        FVector Centroid;
+    };
+    TArray<FBuildTriangle> BuildTriangles;
+    BuildTriangles.SetNum(NumTriangles);
+    for (int32 i = 0; i < NumTriangles; ++i)
+    {
+        FVector V0, V1, V2;
+        GetTrianglePositions(Vertices, Indices, i, V0, V1, V2);
+        FBuildTriangle& Triangle = BuildTriangles[i];
+        Triangle.Min = V0.ComponentMin(V1).ComponentMin(V2);
+        Triangle.Max = V0.ComponentMax(V1).ComponentMax(V2);
+        Triangle.Centroid = (Triangle.Min + Triangle.Max) * 0.5f;
+    }
+
+    TArray<int32> Order;
+    Order.SetNum(NumTriangles);
+    std::iota(Order.begin(), Order.end(), 0);
+
+    struct FBuildTask
+    {
+        int32 Begin;
+        int32 End;
+        int32 Parent;   // 오른쪽 자식이면 부모의 인덱스, 왼쪽 자식이나 루트면 -1
+        int32 Depth;
+    };
+    TArray<FBuildTask> Tasks;
+    Tasks.Add({ 0, NumTriangles, -1, 0 });
+    Nodes.Reserve(NumTriangles * 2 - 1);
+
+    struct FBin
+    {
+        FVector Min = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector Max = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        int32 Count = 0;
+    };
+
+    while (!Tasks.IsEmpty())
+    {
+        const FBuildTask Task = Tasks[Tasks.Num() - 1];
+        Tasks.RemoveAt(Tasks.Num() - 1);
+
+        // 깊이 우선으로 처리하므로 왼쪽 자식은 항상 부모 바로 다음에 추가됨
+        const int32 NodeIndex = Nodes.Num();
+        if (Task.Parent >= 0)
+        {
+            Nodes[Task.Parent].RightChildOrFirstPacket = static_cast<uint32>(NodeIndex);
+        }
+
+        FNode Node;
+        Node.BoundsMin = FVector(FLT_MAX, FLT_MAX, FLT_MAX);
+        Node.BoundsMax = FVector(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        FVector CentroidMin = Node.BoundsMin;
+        FVector CentroidMax = Node.BoundsMax;
+        for (int32 i = Task.Begin; i < Task.End; ++i)
+        {
+            const FBuildTriangle& Triangle = BuildTriangles[Order[i]];
+            Node.BoundsMin = Node.BoundsMin.ComponentMin(Triangle.Min);
+            Node.BoundsMax = Node.BoundsMax.ComponentMax(Triangle.Max);
+            CentroidMin = CentroidMin.ComponentMin(Triangle.Centroid);
+            CentroidMax = CentroidMax.ComponentMax(Triangle.Centroid);
+        }
+
+        const int32 Count = Task.End - Task.Begin;
+        int32 Mid = -1;
+        if (Count > MaxLeafTriangles && Task.Depth < MaxTreeDepth - 1)
+        {
+            // 각 축을 BinCount개로 나눠 SAH 비용이 가장 작은 분할 위치를 찾음
+            int32 BestAxis = -1;
+            int32 BestSplit = 0;
+            float BestCost = FLT_MAX;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                const float Extent = CentroidMax[Axis] - CentroidMin[Axis];
+                if (Extent <= 0.f)
+                {
+                    continue;
+                }
+
+                FBin Bins[BinCount];
+                const float Scale = BinCount / Extent;
+                for (int32 i = Task.Begin; i < Task.End; ++i)
+                {
+                    const FBuildTriangle& Triangle = BuildTriangles[Order[i]];
+                    const int32 BinIndex = std::min(BinCount - 1, static_cast<int32>((Triangle.Centroid[Axis] - CentroidMin[Axis]) * Scale));
+                    FBin& Bin = Bins[BinIndex];
+                    Bin.Min = Bin.Min.ComponentMin(Triangle.Min);
+                    Bin.Max = Bin.Max.ComponentMax(Triangle.Max);
+                    ++Bin.Count;
+                }
+
+                // 분할 위치 Split은 [0, Split) 구간이 왼쪽
+                float LeftCost[BinCount] = {};
+                FBin Left;
+                for (int32 Split = 1; Split < BinCount; ++Split)
+                {
+                    const FBin& Bin = Bins[Split - 1];
+                    if (Bin.Count > 0)
+                    {
+                        Left.Min = Left.Min.ComponentMin(Bin.Min);
+                        Left.Max = Left.Max.ComponentMax(Bin.Max);
+                        Left.Count += Bin.Count;
+                    }
+                    LeftCost[Split] = Left.Count > 0 ? HalfSurfaceArea(Left.Min, Left.Max) * Left.Count : 0.f;
+                }
+
+                FBin Right;
+                for (int32 Split = BinCount - 1; Split >= 1; --Split)
+                {
+                    const FBin& Bin = Bins[Split];
+                    if (Bin.Count > 0)
+                    {
+                        Right.Min = Right.Min.ComponentMin(Bin.Min);
+                        Right.Max = Right.Max.ComponentMax(Bin.Max);
+                        Right.Count += Bin.Count;
+                    }
+                    if (Right.Count == 0 || Right.Count == Count)
+                    {
+                        continue;
+                    }
+
+                    const float Cost = LeftCost[Split] + HalfSurfaceArea(Right.Min, Right.Max) * Right.Count;
+                    if (Cost < BestCost)
+                    {
+                        BestCost = Cost;
+                        BestAxis = Axis;
+                        BestSplit = Split;
+                    }
+                }
+            }
+
+            if (BestAxis >= 0)
+            {
+                const float Scale = BinCount / (CentroidMax[BestAxis] - CentroidMin[BestAxis]);
+                const int32* Partition = std::partition(
+                    Order.GetData() + Task.Begin, Order.GetData() + Task.End,
+                    [&](int32 TriangleIndex)
+                    {
+                        const float Centroid = BuildTriangles[TriangleIndex].Centroid[BestAxis];
+                        return std::min(BinCount - 1, static_cast<int32>((Centroid - CentroidMin[BestAxis]) * Scale)) < BestSplit;
+                    }
+                );
+                Mid = static_cast<int32>(Partition - Order.GetData());
+            }
+
+            // 모든 중심이 한 점에 모여 있거나 한쪽으로 쏠렸으면 절반으로 나눔
+            if (Mid <= Task.Begin || Mid >= Task.End)
+            {
+                Mid = Task.Begin + Count / 2;
+            }
+        }
+
+        if (Mid < 0)
+        {
+            // 리프의 범위는 더 이상 재배치되지 않으므로 바로 패킷으로 묶음
+            Node.RightChildOrFirstPacket = static_cast<uint32>(Packets.Num());
+            Node.NumTriangles = static_cast<uint32>(Count);
+            Nodes.Add(Node);
+
+            for (int32 i = Task.Begin; i < Task.End; i += FTrianglePacket4::Width)
+            {
+                FTrianglePacket4 Packet;
+                for (int32 Lane = 0; Lane < FTrianglePacket4::Width; ++Lane)
+                {
+                    if (i + Lane >= Task.End)
+                    {
+                        TriangleIndices.Add(-1);
+                        continue;
+                    }
+
+                    FVector V0, V1, V2;
+                    GetTrianglePositions(Vertices, Indices, Order[i + Lane], V0, V1, V2);
+                    Packet.SetTriangle(Lane, V0, V1, V2);
+                    TriangleIndices.Add(Order[i + Lane]);
+                }
+                Packets.Add(Packet);
+            }
+            continue;
+        }
+
+        Node.RightChildOrFirstPacket = 0;
+        Node.NumTriangles = 0;
+        Nodes.Add(Node);
+
+        // 왼쪽 자식이 먼저 처리되도록 오른쪽을 먼저 넣음
+        Tasks.Add({ Mid, Task.End, NodeIndex, Task.Depth + 1 });
+        Tasks.Add({ Task.Begin, Mid, -1, Task.Depth + 1 });
+    }
+
+    TriangleCount = NumTriangles;
+}
+
+bool FStaticMeshBVH::Raycast(const FVector& RayOrigin, const FVector& RayDirection, FBVHRayHit& OutHit, bool bCountAllHits) const
+{
+    OutHit = FBVHRayHit();
+    if (Nodes.IsEmpty())
+    {
+        return false;
+    }
+
+    const FVector InvDirection(SafeInverse(RayDirection.X), SafeInverse(RayDirection.Y), SafeInverse(RayDirection.Z));
+
+    float EnterDistance;
+    if (!IntersectBounds(Nodes[0].BoundsMin, Nodes[0].BoundsMax, RayOrigin, InvDirection, FLT_MAX, EnterDistance))
+    {
+        return false;
+    }
+
+    const FRay4 Ray(RayOrigin, RayDirection);
+    uint32 Stack[MaxTreeDepth];
+    int32 StackSize = 0;
+    uint32 NodeIndex = 0;
+    while (true)
+    {
+        const FNode& Node = Nodes[NodeIndex];
+        if (Node.IsLeaf())
+        {
+            const uint32 End = Node.RightChildOrFirstPacket + Node.GetNumPackets();
+            for (uint32 PacketIndex = Node.RightChildOrFirstPacket; PacketIndex < End; ++PacketIndex)
+            {
+                alignas(16) float Distances[FTrianglePacket4::Width];
+                uint32 HitMask = RayTriangle::IntersectPacket(Ray, Packets[PacketIndex], Distances);
+                while (HitMask != 0)
+                {
+                    const int32 Lane = std::countr_zero(HitMask);
+                    HitMask &= HitMask - 1;
+
+                    ++OutHit.NumHits;
+                    if (Distances[Lane] < OutHit.Distance)
+                    {
+                        OutHit.Distance = Distances[Lane];
+                        OutHit.TriangleIndex = TriangleIndices[PacketIndex * FTrianglePacket4::Width + Lane];
+                    }
+                }
+            }
+
+            if (StackSize == 0)
+            {
+                break;
+            }
+            NodeIndex = Stack[--StackSize];
+            continue;
+        }
+
+        // 가장 가까운 교차점만 찾을 때는 이미 찾은 교차점보다 먼 노드를 건너뜀
+        const float MaxDistance = bCountAllHits ? FLT_MAX : OutHit.Distance;
+        const uint32 Left = NodeIndex + 1;
+        const uint32 Right = Node.RightChildOrFirstPacket;
+        float LeftDistance, RightDistance;
+        const bool bHitLeft = IntersectBounds(Nodes[Left].BoundsMin, Nodes[Left].BoundsMax, RayOrigin, InvDirection, MaxDistance, LeftDistance);
+        const bool bHitRight = IntersectBounds(Nodes[Right].BoundsMin, Nodes[Right].BoundsMax, RayOrigin, InvDirection, MaxDistance, RightDistance);
+
+        if (bHitLeft && bHitRight)
+        {
+            // 가까운 자식을 먼저 방문해야 먼 자식을 건너뛸 가능성이 커짐
+            const bool bLeftFirst = LeftDistance <= RightDistance;
+            Stack[StackSize++] = bLeftFirst ? Right : Left;
+            NodeIndex = bLeftFirst ? Left : Right;
+        }
+        else if (bHitLeft || bHitRight)
+        {
+            NodeIndex = bHitLeft ? Left : Right;
+        }
+        else
+        {
+            if (StackSize == 0)
+            {
+                break;
+            }
+            NodeIndex = Stack[--StackSize];
+        }
+    }
+
+    if (!bCountAllHits && OutHit.NumHits > 0)
+    {
+        OutHit.NumHits = 1;
+    }
+    return OutHit.NumHits > 0;
+}
+
+bool FStaticMeshBVH::RaycastBruteForce(
+    const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices,
+    const FVector& RayOrigin, const FVector& RayDirection, FBVHRayHit& OutHit
+)
+{
+    OutHit = FBVHRayHit();
+    const int32 NumTriangles = CountTriangles(Vertices, Indices);
+    for (int32 i = 0; i < NumTriangles; ++i)
+    {
+        FVector V0, V1, V2;
+        GetTrianglePositions(Vertices, Indices, i, V0, V1, V2);
+
+        float Distance;
+        if (UPrimitiveComponent::IntersectRayTriangle(RayOrigin, RayDirection, V0, V1, V2, Distance))
+        {
+            ++OutHit.NumHits;
+            if (Distance < OutHit.Distance)
+            {
+                OutHit.Distance = Distance;
+                OutHit.TriangleIndex = i;
+            }
+        }
+    }
+    return OutHit.NumHits > 0;
+}
@@ -0,0 +1,61 @@
+#pragma once
+#include "Define.h"
+#include "Math/RayTriangleSIMD.h"
+
+struct FBVHRayHit
+{
+    float Distance = FLT_MAX;   // 가장 가까운 교차점까지의 거리
+    int32 TriangleIndex = -1;   // 가장 가까운 삼각형의 원래 인덱스 (Indices 기준 i / 3)
+    int32 NumHits = 0;          // 교차한 삼각형 수, bCountAllHits가 false면 1 이하
+};
+
+/**
+ * 스태틱 메시의 삼각형에 대한 Bounding Volume Hierarchy
+ *
+ * SAH(Surface Area Heuristic)로 각 축을 BinCount개의 구간으로 나눠 분할 위치를 고르며,
+ * 노드는 배열에 깊이 우선 순서로 저장되고 왼쪽 자식은 항상 부모 바로 다음, 오른쪽 자식은 RightChild에 있습니다.
+ * 리프의 삼각형은 FTrianglePacket4로 묶여 레이 하나와 4개씩 동시에 검사됩니다.
+ * 렌더 데이터와 같은 로컬 공간의 레이를 받습니다.
+ */
+struct FStaticMeshBVH
+{
+    static constexpr int32 BinCount = 16;
+
+    // 패킷 하나를 검사하는 비용이 삼각형 하나와 비슷하므로 한 패킷을 채울 때까지는 나누지 않음
+    static constexpr int32 MaxLeafTriangles = FTrianglePacket4::Width;
+
+    struct FNode
+    {
+        FVector BoundsMin;
+        uint32 RightChildOrFirstPacket;    // NumTriangles가 0이면 오른쪽 자식의 인덱스, 아니면 첫 패킷의 인덱스
+        FVector BoundsMax;
+        uint32 NumTriangles;               // 0이면 내부 노드
+
+        bool IsLeaf() const { return NumTriangles != 0; }
+        uint32 GetNumPackets() const { return (NumTriangles + FTrianglePacket4::Width - 1) / FTrianglePacket4::Width; }
+    };
+
+    void Build(const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices);
+
+    /**
+     * 레이와 교차하는 가장 가까운 삼각형을 찾습니다.
+     * @param bCountAllHits true면 레이와 교차하는 모든 삼각형을 세고, false면 가장 가까운 교차점만 찾아 더 많은 노드를 건너뜁니다.
+     * @return 교차한 삼각형이 있으면 true
+     */
+    bool Raycast(const FVector& RayOrigin, const FVector& RayDirection, FBVHRayHit& OutHit, bool bCountAllHits = true) const;
+
+    // BVH 없이 모든 삼각형을 검사, Raycast와 같은 결과를 반환
+    static bool RaycastBruteForce(
+        const TArray<FStaticMeshVertex>& Vertices, const TArray<UINT>& Indices,
+        const FVector& RayOrigin, const FVector& RayDirection, FBVHRayHit& OutHit
+    );
+
+    int32 GetNumNodes() const { return Nodes.Num(); }
+    int32 GetNumTriangles() const { return TriangleCount; }
+
+private:
+    TArray<FNode> Nodes;
+    TArray<FTrianglePacket4> Packets;   // 리프 순서로 정렬된 삼각형, 리프마다 새 패킷에서 시작
+    TArray<int32> TriangleIndices;      // Packets[i / 4]의 i % 4번째 삼각형의 원래 인덱스, 빈 자리는 -1
+    int32 TriangleCount = 0;
+};
@@ -0,0 +1,43 @@
+#include "ParticleSystemComponent.h"
+#include "EngineLoop.h"
+#include "UObject/Casts.h"
+
+UParticleSystemComponent::UParticleSystemComponent()
+{
+    SetType(StaticClass()->GetName());
+}
+
+UObject* UParticleSystemComponent::Duplicate(UObject* InOuter)
+{
+    // 살아있는 파티클은 복사하지 않고 설정과 텍스처만 복제
+    UParticleSystemComponent* NewComponent = Cast<UParticleSystemComponent>(Super::Duplicate(InOuter));
+    if (NewComponent)
+    {
+        NewComponent->Emitter.SetSettings(Emitter.GetSettings());
+        NewComponent->Texture = Texture;
+    }
+    return NewComponent;
+}
+
+void UParticleSystemComponent::TickComponent(float DeltaTime)
+{
+    Super::TickComponent(DeltaTime);
+    if (!IsActive())
+    {
+        return;
+    }
+
+    const bool bHadParticles = Emitter.Num() > 0;
+    Emitter.Tick(DeltaTime, GetWorldLocation());
+
+    // 파티클이 움직였으므로 공간 인덱스의 바운딩 박스를 다시 구하게 함
+    if (bHadParticles || Emitter.Num() > 0)
+    {
+        UpdateBounds();
+    }
+}
+
+void UParticleSystemComponent::SetTexture(const FWString& InFileName)
+{
+    Texture = FEngineLoop::ResourceManager.GetTexture(InFileName);
+}
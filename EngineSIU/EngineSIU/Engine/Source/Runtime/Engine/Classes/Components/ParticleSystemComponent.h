@@ -0,0 +1,34 @@
+#pragma once
+#include "PrimitiveComponent.h"
+#include "Engine/Texture.h"
+#include "Particles/ParticleEmitter.h"
+
+/**
+ * FParticleEmitter로 많은 파티클을 만들고 움직이는 컴포넌트
+ * 파티클은 컴포넌트의 월드 위치에서 생성되고, FParticleRenderPass가 이미터마다 한 번의 인스턴싱 드로우로 그립니다.
+ */
+class UParticleSystemComponent : public UPrimitiveComponent
+{
+    DECLARE_CLASS(UParticleSystemComponent, UPrimitiveComponent)
+
+public:
+    UParticleSystemComponent();
+
+    virtual UObject* Duplicate(UObject* InOuter) override;
+    virtual void TickComponent(float DeltaTime) override;
+
+    /** 살아있는 파티클을 감싸는 바운딩 박스, 파티클이 없으면 false */
+    virtual bool GetWorldBoundingBox(FBoundingBox& OutBounds) const override { return Emitter.GetBounds(OutBounds); }
+
+    void SetTexture(const FWString& InFileName);
+
+    void SetEmitterSettings(const FParticleEmitterSettings& InSettings) { Emitter.SetSettings(InSettings); }
+    const FParticleEmitterSettings& GetEmitterSettings() const { return Emitter.GetSettings(); }
+
+    const FParticleEmitter& GetEmitter() const { return Emitter; }
+
+    std::shared_ptr<FTexture> Texture;
+
+private:
+    FParticleEmitter Emitter;
+};
@@ -1,6 +1,8 @@
 #include "PrimitiveComponent.h"
 
 #include "UObject/Casts.h"
+#include "World/PrimitiveSpatialIndex.h"
+#include "World/SceneTransformHierarchy.h"
 
 
 UObject* UPrimitiveComponent::Duplicate(UObject* InOuter)
@@ -12,9 +14,26 @@ UObject* UPrimitiveComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
+UPrimitiveComponent::~UPrimitiveComponent()
+{
+    FPrimitiveSpatialIndex::Get().Unregister(this);
+}
+
 void UPrimitiveComponent::InitializeComponent()
 {
 	Super::InitializeComponent();
+
+    if (bSelectable)
+    {
+        FPrimitiveSpatialIndex::Get().Register(this);
+    }
+}
+
+void UPrimitiveComponent::UninitializeComponent()
+{
+    FPrimitiveSpatialIndex::Get().Unregister(this);
+
+    Super::UninitializeComponent();
 }
 
 void UPrimitiveComponent::TickComponent(float DeltaTime)
@@ -68,7 +87,32 @@ int UPrimitiveComponent::CheckRayIntersection(FVector& rayOrigin, FVector& rayDi
     return nIntersections;
 }
 
-bool UPrimitiveComponent::IntersectRayTriangle(const FVector& rayOrigin, const FVector& rayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& hitDistance) const
+void UPrimitiveComponent::UpdateBounds()
+{
+    BoundsRevision = AllocateBoundsRevision();
+    FPrimitiveSpatialIndex::Get().MarkDirty(this);
+}
+
+uint32 UPrimitiveComponent::AllocateBoundsRevision()
+{
+    static uint32 NextBoundsRevision = 0;
+    return ++NextBoundsRevision;
+}
+
+bool UPrimitiveComponent::GetWorldBoundingBox(FBoundingBox& OutBounds) const
+{
+    OutBounds = AABB.TransformWorld(FSceneTransformHierarchy::GetWorldMatrix(this));
+    return true;
+}
+
+void UPrimitiveComponent::OnUpdateTransform()
+{
+    Super::OnUpdateTransform();
+
+    UpdateBounds();
+}
+
+bool UPrimitiveComponent::IntersectRayTriangle(const FVector& rayOrigin, const FVector& rayDirection, const FVector& v0, const FVector& v1, const FVector& v2, float& hitDistance)
 {
     constexpr float epsilon = 1e-6f;
     FVector edge1 = v1 - v0;
@@ -7,20 +7,61 @@ class UPrimitiveComponent : public USceneComponent
 
 public:
     UPrimitiveComponent() = default;
+    virtual ~UPrimitiveComponent() override;
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
     virtual void InitializeComponent() override;
+    virtual void UninitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance) override;
-    bool IntersectRayTriangle(
+    static bool IntersectRayTriangle(
         const FVector& rayOrigin, const FVector& rayDirection,
         const FVector& v0, const FVector& v1, const FVector& v2, float& hitDistance
-    ) const;
+    );
 
 
     FBoundingBox AABB;
 
+    /** AABB를 바꾼 뒤 호출해서 피킹용 공간 인덱스와 컬링 캐시에 반영합니다. */
+    void UpdateBounds();
+
+    /**
+     * 월드 바운딩 박스가 바뀔 때마다 새로 발급되는 값
+     * 컴포넌트끼리도 겹치지 않으므로, 캐시는 컴포넌트와 이 값이 모두 같으면 저장해둔 바운딩 박스를 재사용할 수 있습니다.
+     */
+    uint32 GetBoundsRevision() const { return BoundsRevision; }
+
+    /**
+     * AABB를 월드 공간으로 변환한 바운딩 박스를 구합니다.
+     * @return 카메라를 향하는 빌보드처럼 고정된 월드 바운딩 박스가 없으면 false
+     */
+    virtual bool GetWorldBoundingBox(FBoundingBox& OutBounds) const;
+
+    /** 에디터에서 클릭해서 선택할 수 있는지 여부, false면 피킹용 공간 인덱스에 등록하지 않음 */
+    uint8 bSelectable : 1 = true;
+
+protected:
+    virtual void OnUpdateTransform() override;
+
+private:
+    friend class FPrimitiveSpatialIndex;
+
+    /** FPrimitiveSpatialIndex의 트리에서의 프록시 ID, 트리에 없으면 INDEX_NONE */
+    int32 SpatialProxyId = INDEX_NONE;
+
+    /** FPrimitiveSpatialIndex에 등록되어 있는지 여부 */
+    uint8 bSpatiallyIndexed : 1 = false;
+
+    /** 바운딩 박스가 바뀌어 다음 레이 검사 전에 갱신해야 하는지 여부 */
+    uint8 bSpatialIndexDirty : 1 = false;
+
+    /** 고정된 바운딩 박스가 없어 트리 대신 별도 목록에 있는지 여부 */
+    uint8 bSpatiallyUnbounded : 1 = false;
+
+    static uint32 AllocateBoundsRevision();
+    uint32 BoundsRevision = AllocateBoundsRevision();
+
 private:
     FString m_Type;
 
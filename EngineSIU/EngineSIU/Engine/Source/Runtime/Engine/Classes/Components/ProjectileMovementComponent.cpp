@@ -1,5 +1,7 @@
 #include "ProjectileMovementComponent.h"
 #include "GameFramework/Actor.h"
+#include "World/ProjectileSystem.h"
+#include "World/World.h"
 
 UProjectileMovementComponent::UProjectileMovementComponent()
 {
@@ -25,22 +27,95 @@ UObject* UProjectileMovementComponent::Duplicate(UObject* InOuter)
     NewComponent->InitialSpeed = InitialSpeed;
     NewComponent->MaxSpeed = MaxSpeed;
     NewComponent->Gravity = Gravity;
-    NewComponent->Velocity = Velocity;
+    NewComponent->Velocity = GetVelocity();
 
     return NewComponent;
     
 }
 
+void UProjectileMovementComponent::SetVelocity(FVector NewVelocity)
+{
+    Velocity = NewVelocity;
+    if (ProjectileSystem)
+    {
+        ProjectileSystem->SetVelocity(ProjectileIndex, NewVelocity);
+    }
+}
+
+FVector UProjectileMovementComponent::GetVelocity() const
+{
+    return ProjectileSystem ? ProjectileSystem->GetVelocity(ProjectileIndex) : Velocity;
+}
+
+void UProjectileMovementComponent::SetMaxSpeed(float NewMaxSpeed)
+{
+    MaxSpeed = NewMaxSpeed;
+    if (ProjectileSystem)
+    {
+        ProjectileSystem->SetMaxSpeed(ProjectileIndex, NewMaxSpeed);
+    }
+}
+
+void UProjectileMovementComponent::SetGravity(float NewGravity)
+{
+    Gravity = NewGravity;
+    if (ProjectileSystem)
+    {
+        ProjectileSystem->SetGravity(ProjectileIndex, NewGravity);
+    }
+}
+
+void UProjectileMovementComponent::SetLifetime(float NewLifetime)
+{
+    ProjectileLifetime = NewLifetime;
+    if (ProjectileSystem)
+    {
+        ProjectileSystem->SetLifetime(ProjectileIndex, NewLifetime);
+    }
+}
+
 void UProjectileMovementComponent::BeginPlay()
 {
-    FVector Forward = GetOwner()->GetActorForwardVector();
+    Super::BeginPlay();
+
+    AActor* Owner = GetOwner();
+    FVector Forward = Owner->GetActorForwardVector();
     Velocity = Forward * InitialSpeed;
+
+    // Editor World에서는 Tick이 도는 Actor만 움직였으므로 같은 조건으로 등록
+    UWorld* World = GetWorld();
+    USceneComponent* Root = Owner->GetRootComponent();
+    if (World && Root && (World->WorldType != EWorldType::Editor || Owner->IsActorTickInEditor()))
+    {
+        ProjectileSystem = &World->GetProjectileSystem();
+        ProjectileIndex = ProjectileSystem->Register(this, Root, Velocity, Gravity, MaxSpeed, AccumulatedTime, ProjectileLifetime);
+    }
+}
+
+void UProjectileMovementComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (ProjectileSystem)
+    {
+        Velocity = ProjectileSystem->GetVelocity(ProjectileIndex);
+        AccumulatedTime = ProjectileSystem->GetAge(ProjectileIndex);
+        ProjectileSystem->Unregister(ProjectileIndex);
+        ProjectileSystem = nullptr;
+        ProjectileIndex = INDEX_NONE;
+    }
+
+    Super::EndPlay(EndPlayReason);
 }
 
 void UProjectileMovementComponent::TickComponent(float DeltaTime)
 {
     Super::TickComponent(DeltaTime);
 
+    // 등록된 투사체는 UWorld::UpdateProjectiles에서 한 번에 계산
+    if (ProjectileSystem)
+    {
+        return;
+    }
+
     Velocity.Z += Gravity * DeltaTime;
 
     if (Velocity.Length() > MaxSpeed)
@@ -1,8 +1,12 @@
 #pragma once
 #include"Components/SceneComponent.h"
 
+class FProjectileSystem;
+
 class UProjectileMovementComponent : public USceneComponent
 {
+    friend class FProjectileSystem;
+
     DECLARE_CLASS(UProjectileMovementComponent, USceneComponent)
 public:
     UProjectileMovementComponent();
@@ -10,27 +14,28 @@ public:
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
-    void SetVelocity(FVector NewVelocity) { Velocity = NewVelocity; }
+    void SetVelocity(FVector NewVelocity);
 
-    FVector GetVelocity() const { return Velocity; }
+    FVector GetVelocity() const;
 
     void SetInitialSpeed(float NewInitialSpeed) { InitialSpeed = NewInitialSpeed; }
 
     float GetInitialSpeed() const { return InitialSpeed; }
 
-    void SetMaxSpeed(float NewMaxSpeed) { MaxSpeed = NewMaxSpeed; }
+    void SetMaxSpeed(float NewMaxSpeed);
 
     float GetMaxSpeed() const { return MaxSpeed; }
 
-    void SetGravity(float NewGravity) { Gravity = NewGravity; }
+    void SetGravity(float NewGravity);
 
     float GetGravity() const { return Gravity; }
 
-    void SetLifetime(float NewLifetime) { ProjectileLifetime = NewLifetime; }
+    void SetLifetime(float NewLifetime);
 
     float GetLifetime() const { return ProjectileLifetime; }
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 
     virtual void TickComponent(float DeltaTime) override;
@@ -44,5 +49,9 @@ private:
 
     float Gravity;
     FVector Velocity;
+
+    // 등록되어 있으면 위치, 속도, 수명은 World의 FProjectileSystem에서 계산
+    FProjectileSystem* ProjectileSystem = nullptr;
+    int32 ProjectileIndex = INDEX_NONE;
 };
 
@@ -3,6 +3,9 @@
 #include "Math/JungleMath.h"
 #include "UObject/Casts.h"
 #include "UObject/ObjectFactory.h"
+#include "World/World.h"
+
+std::atomic<uint32> USceneComponent::NumWorldTransformUpdates = 0;
 
 USceneComponent::USceneComponent()
     : RelativeLocation(FVector(0.f, 0.f, 0.f))
@@ -18,6 +21,7 @@ UObject* USceneComponent::Duplicate(UObject* InOuter)
     NewComponent->RelativeLocation = RelativeLocation;
     NewComponent->RelativeRotation = RelativeRotation;
     NewComponent->RelativeScale3D = RelativeScale3D;
+    NewComponent->PropagateTransformUpdate();
 
     return NewComponent;
 }
@@ -26,6 +30,27 @@ void USceneComponent::InitializeComponent()
 {
     Super::InitializeComponent();
 
+    // Actor의 생성자에서 추가되어 아직 World가 없으면 UWorld::SpawnActor에서 등록됨
+    if (FSceneTransformHierarchy* Hierarchy = GetWorldTransformHierarchy())
+    {
+        Hierarchy->MarkStructureDirty(this);
+    }
+}
+
+void USceneComponent::UninitializeComponent()
+{
+    if (FSceneTransformHierarchy* Hierarchy = GetWorldTransformHierarchy())
+    {
+        Hierarchy->RemoveComponent(this);
+    }
+
+    // 제거된 뒤에도 부모의 AttachChildren에 남아서 해제된 메모리를 가리키지 않도록 뺌
+    if (AttachParent)
+    {
+        AttachParent->AttachChildren.Remove(this);
+    }
+
+    Super::UninitializeComponent();
 }
 
 void USceneComponent::TickComponent(float DeltaTime)
@@ -65,23 +90,29 @@ FVector USceneComponent::GetUpVector()
 void USceneComponent::AddLocation(FVector InAddValue)
 {
 	RelativeLocation = RelativeLocation + InAddValue;
-
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddRotation(FVector InAddValue)
 {
 	RelativeRotation = RelativeRotation + InAddValue;
-
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AddScale(FVector InAddValue)
 {
 	RelativeScale3D = RelativeScale3D + InAddValue;
-
+    PropagateTransformUpdate();
 }
 
 void USceneComponent::AttachToComponent(USceneComponent* InParent)
 {
+    FSceneTransformHierarchy* Hierarchy = GetWorldTransformHierarchy();
+    if (Hierarchy)
+    {
+        Hierarchy->MarkStructureDirty(this);
+    }
+
     // 기존 부모와 연결을 끊기
     if (AttachParent)
     {
@@ -92,6 +123,11 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
     if (InParent == nullptr)
     {
         AttachParent = nullptr;
+        if (Hierarchy)
+        {
+            Hierarchy->MarkStructureDirty(this);
+        }
+        PropagateTransformUpdate();
         return;
     }
 
@@ -104,86 +140,98 @@ void USceneComponent::AttachToComponent(USceneComponent* InParent)
     {
         InParent->AttachChildren.Add(this);
     }
+    if (Hierarchy)
+    {
+        Hierarchy->MarkStructureDirty(this);
+    }
+    PropagateTransformUpdate();
 }
 
 FVector USceneComponent::GetWorldLocation() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldLocation() + RelativeLocation;
-    }
-    return RelativeLocation;
+    UpdateWorldTransformCache();
+    return CachedWorldLocation;
 }
 
 FRotator USceneComponent::GetWorldRotation() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldRotation().ToQuaternion() * RelativeRotation.ToQuaternion();
-    }
-    return RelativeRotation;
+    UpdateWorldTransformCache();
+    return CachedWorldRotation;
 }
 
 FVector USceneComponent::GetWorldScale3D() const
 {
-    if (AttachParent)
-    {
-        return AttachParent->GetWorldScale3D() * RelativeScale3D;
-    }
-    return RelativeScale3D;
+    UpdateWorldTransformCache();
+    return CachedWorldScale3D;
 }
 
 FMatrix USceneComponent::GetScaleMatrix() const
 {
-    FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
-    if (AttachParent)
-    {
-        FMatrix ParentScaleMat = AttachParent->GetScaleMatrix();
-        ScaleMat = ScaleMat * ParentScaleMat;
-    }
-    return ScaleMat;
+    UpdateWorldTransformCache();
+    return CachedScaleMatrix;
 }
 
 FMatrix USceneComponent::GetRotationMatrix() const
 {
-    FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
-    if (AttachParent)
-    {
-        FMatrix ParentRotationMat = AttachParent->GetRotationMatrix();
-        RotationMat = RotationMat * ParentRotationMat;
-    }
-    return RotationMat;
+    UpdateWorldTransformCache();
+    return CachedRotationMatrix;
 }
 
 FMatrix USceneComponent::GetTranslationMatrix() const
 {
-    FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
-    if (AttachParent)
-    {
-        FMatrix ParentTranslationMat = AttachParent->GetTranslationMatrix();
-        TranslationMat = TranslationMat * ParentTranslationMat;
-    }
-    return TranslationMat;
+    UpdateWorldTransformCache();
+    return CachedTranslationMatrix;
 }
 
 FMatrix USceneComponent::GetWorldMatrix() const
 {
-    FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
-    FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
-    FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+    UpdateWorldTransformCache();
+    return CachedWorldMatrix;
+}
+
+void USceneComponent::UpdateWorldTransformCache() const
+{
+    if (!bWorldTransformDirty)
+    {
+        return;
+    }
+
+    NumWorldTransformUpdates.fetch_add(1, std::memory_order_relaxed);
+
+    const FMatrix ScaleMat = FMatrix::GetScaleMatrix(RelativeScale3D);
+    const FMatrix RotationMat = FMatrix::GetRotationMatrix(RelativeRotation);
+    const FMatrix TranslationMat = FMatrix::GetTranslationMatrix(RelativeLocation);
+    const FMatrix RTMat = RotationMat * TranslationMat;
 
-    FMatrix RTMat = RotationMat * TranslationMat;
     if (AttachParent)
     {
-        FMatrix ParentScaleMat = AttachParent->GetScaleMatrix();
-        FMatrix ParentRotationMat = AttachParent->GetRotationMatrix();
-        FMatrix ParentTranslationMat = AttachParent->GetTranslationMatrix();
-        
-        ScaleMat = ScaleMat * ParentScaleMat;
-        FMatrix ParentRTMat = ParentRotationMat * ParentTranslationMat;
-        RTMat = RTMat * ParentRTMat;
+        // 부모의 캐시도 무효화되었으면 부모부터 다시 계산
+        AttachParent->UpdateWorldTransformCache();
+
+        CachedScaleMatrix = ScaleMat * AttachParent->CachedScaleMatrix;
+        CachedRotationMatrix = RotationMat * AttachParent->CachedRotationMatrix;
+        CachedTranslationMatrix = TranslationMat * AttachParent->CachedTranslationMatrix;
+
+        const FMatrix ParentRTMat = AttachParent->CachedRotationMatrix * AttachParent->CachedTranslationMatrix;
+        CachedWorldMatrix = CachedScaleMatrix * (RTMat * ParentRTMat);
+
+        CachedWorldLocation = AttachParent->CachedWorldLocation + RelativeLocation;
+        CachedWorldRotation = AttachParent->CachedWorldRotation.ToQuaternion() * RelativeRotation.ToQuaternion();
+        CachedWorldScale3D = AttachParent->CachedWorldScale3D * RelativeScale3D;
+    }
+    else
+    {
+        CachedScaleMatrix = ScaleMat;
+        CachedRotationMatrix = RotationMat;
+        CachedTranslationMatrix = TranslationMat;
+        CachedWorldMatrix = ScaleMat * RTMat;
+
+        CachedWorldLocation = RelativeLocation;
+        CachedWorldRotation = RelativeRotation;
+        CachedWorldScale3D = RelativeScale3D;
     }
-    return ScaleMat * RTMat;
+
+    bWorldTransformDirty = false;
 }
 
 void USceneComponent::SetupAttachment(USceneComponent* InParent)
@@ -197,9 +245,40 @@ void USceneComponent::SetupAttachment(USceneComponent* InParent)
             || !AttachParent->AttachChildren.Contains(this)  // 한번이라도 SetupAttachment가 호출된적이 없는 경우
         ) 
     ) {
+        FSceneTransformHierarchy* Hierarchy = GetWorldTransformHierarchy();
+        if (Hierarchy)
+        {
+            Hierarchy->MarkStructureDirty(this);
+        }
+
         AttachParent = InParent;
 
         // TODO: .AddUnique의 실행 위치를 RegisterComponent로 바꾸거나 해야할 듯
         InParent->AttachChildren.AddUnique(this);
+        if (Hierarchy)
+        {
+            Hierarchy->MarkStructureDirty(this);
+        }
+        PropagateTransformUpdate();
+    }
+}
+
+FSceneTransformHierarchy* USceneComponent::GetWorldTransformHierarchy() const
+{
+    UWorld* World = GetWorld();
+    return World ? &World->GetTransformHierarchy() : nullptr;
+}
+
+void USceneComponent::PropagateTransformUpdate()
+{
+    bWorldTransformDirty = true;
+    if (TransformHierarchy)
+    {
+        TransformHierarchy->MarkDirty(this);
+    }
+    OnUpdateTransform();
+    for (USceneComponent* Child : AttachChildren)
+    {
+        Child->PropagateTransformUpdate();
     }
 }
@@ -1,18 +1,26 @@
 #pragma once
 #include "ActorComponent.h"
+#include "Math/Matrix.h"
 #include "Math/Rotator.h"
 #include "UObject/ObjectMacros.h"
 
+#include <atomic>
+
+class FSceneTransformHierarchy;
+
 class USceneComponent : public UActorComponent
 {
     DECLARE_CLASS(USceneComponent, UActorComponent)
 
+    friend class FSceneTransformHierarchy;
+
 public:
     USceneComponent();
 
     virtual UObject* Duplicate(UObject* InOuter) override;
 
     virtual void InitializeComponent() override;
+    virtual void UninitializeComponent() override;
     virtual void TickComponent(float DeltaTime) override;
     virtual int CheckRayIntersection(FVector& InRayOrigin, FVector& InRayDirection, float& pfNearHitDistance);
     
@@ -30,9 +38,9 @@ public:
     void AttachToComponent(USceneComponent* InParent);
 
 public:
-    void SetRelativeLocation(FVector InNewLocation) { RelativeLocation = InNewLocation; }
-    void SetRelativeRotation(FRotator InNewRotation) { RelativeRotation = InNewRotation; }
-    void SetRelativeScale3D(FVector NewScale) { RelativeScale3D = NewScale; }
+    void SetRelativeLocation(FVector InNewLocation) { RelativeLocation = InNewLocation; PropagateTransformUpdate(); }
+    void SetRelativeRotation(FRotator InNewRotation) { RelativeRotation = InNewRotation; PropagateTransformUpdate(); }
+    void SetRelativeScale3D(FVector NewScale) { RelativeScale3D = NewScale; PropagateTransformUpdate(); }
     
     FVector GetRelativeLocation() const { return RelativeLocation; }
     FRotator GetRelativeRotation() const { return RelativeRotation; }
@@ -50,7 +58,19 @@ public:
     
     void SetupAttachment(USceneComponent* InParent);
 
+    /** 이번 프레임에 월드 Transform 캐시를 다시 계산한 횟수 */
+    static uint32 GetNumWorldTransformUpdates() { return NumWorldTransformUpdates.load(std::memory_order_relaxed); }
+
+    /** 프레임이 시작할 때 호출해서 GetNumWorldTransformUpdates를 0으로 되돌립니다. */
+    static void ResetNumWorldTransformUpdates() { NumWorldTransformUpdates.store(0, std::memory_order_relaxed); }
+
 protected:
+    /** 이 컴포넌트나 부모 컴포넌트의 Transform이 바뀌었을 때 호출됩니다. */
+    virtual void OnUpdateTransform() {}
+
+    /** 자신과 모든 자식 컴포넌트의 월드 Transform 캐시를 무효화하고 OnUpdateTransform을 호출합니다. */
+    void PropagateTransformUpdate();
+
     /** 부모 컴포넌트로부터 상대적인 위치 */
     UPROPERTY
     (FVector, RelativeLocation);
@@ -69,4 +89,30 @@ protected:
 
     UPROPERTY
     (TArray<USceneComponent*>, AttachChildren);
+
+private:
+    /** 월드 Transform 캐시가 무효화되었으면 부모의 캐시로부터 다시 계산합니다. */
+    void UpdateWorldTransformCache() const;
+
+    /** 이 컴포넌트가 속한 World의 Transform 배열, 아직 World에 속하지 않았으면 nullptr */
+    FSceneTransformHierarchy* GetWorldTransformHierarchy() const;
+
+    // 부모까지 누적한 Transform, GetXXXMatrix와 GetWorldXXX가 반환하는 값
+    mutable FMatrix CachedScaleMatrix;
+    mutable FMatrix CachedRotationMatrix;
+    mutable FMatrix CachedTranslationMatrix;
+    mutable FMatrix CachedWorldMatrix;
+    mutable FVector CachedWorldLocation;
+    mutable FRotator CachedWorldRotation;
+    mutable FVector CachedWorldScale3D;
+
+    /** Relative Transform이나 부모가 바뀌어 캐시를 다시 계산해야 하는지 여부 */
+    mutable bool bWorldTransformDirty = true;
+
+    // ParallelFor 작업에서도 캐시를 다시 계산하므로 atomic
+    static std::atomic<uint32> NumWorldTransformUpdates;
+
+    // 이 컴포넌트를 담고 있는 World의 Transform 배열과 그 안의 위치
+    FSceneTransformHierarchy* TransformHierarchy = nullptr;
+    int32 TransformHierarchyIndex = INDEX_NONE;
 };
@@ -1,4 +1,6 @@
 #include "Components/StaticMeshComponent.h"
+#include "Components/Mesh/StaticMeshBVH.h"
+#include "Engine/FLoaderOBJ.h"
 
 #include "Launch/EngineLoop.h"
 #include "UObject/Casts.h"
@@ -16,6 +18,31 @@ UObject* UStaticMeshComponent::Duplicate(UObject* InOuter)
     return NewComponent;
 }
 
+void UStaticMeshComponent::SetStaticMeshAsync(const FString& PathFileName)
+{
+    SetStaticMesh(FManagerOBJ::GetPlaceholderStaticMesh());
+
+    // 콜백이 불릴 때 이 컴포넌트가 아직 살아있는지 GUObjectArray의 자리와 UUID로 확인
+    const int32 ObjectIndex = static_cast<int32>(GetInternalIndex());
+    const uint32 ObjectUUID = GetUUID();
+    const uint32 RequestId = StaticMeshRequestId;
+
+    FManagerOBJ::LoadStaticMeshAsync(PathFileName, [ObjectIndex, ObjectUUID, RequestId](UStaticMesh* LoadedMesh)
+    {
+        UStaticMeshComponent* Component = Cast<UStaticMeshComponent>(GUObjectArray.IndexToObject(ObjectIndex));
+        if (Component == nullptr || Component->GetUUID() != ObjectUUID || Component->StaticMeshRequestId != RequestId)
+        {
+            return;
+        }
+
+        // 실패하면 Placeholder를 그대로 둠, 실패 로그는 FManagerOBJ가 남김
+        if (LoadedMesh)
+        {
+            Component->SetStaticMesh(LoadedMesh);
+        }
+    });
+}
+
 uint32 UStaticMeshComponent::GetNumMaterials() const
 {
     if (staticMesh == nullptr) return 0;
@@ -76,48 +103,16 @@ void UStaticMeshComponent::GetUsedMaterials(TArray<UMaterial*>& Out) const
 int UStaticMeshComponent::CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance)
 {
     if (!AABB.Intersect(rayOrigin, rayDirection, pfNearHitDistance)) return 0;
-    int nIntersections = 0;
     if (staticMesh == nullptr) return 0;
 
-    OBJ::FStaticMeshRenderData* renderData = staticMesh->GetRenderData();
-
-    FStaticMeshVertex* vertices = renderData->Vertices.GetData();
-    int vCount = renderData->Vertices.Num();
-    UINT* indices = renderData->Indices.GetData();
-    int iCount = renderData->Indices.Num();
-
-    if (!vertices) return 0;
-    BYTE* pbPositions = reinterpret_cast<BYTE*>(renderData->Vertices.GetData());
-
-    int nPrimitives = (!indices) ? (vCount / 3) : (iCount / 3);
-    float fNearHitDistance = FLT_MAX;
-    for (int i = 0; i < nPrimitives; i++) {
-        int idx0, idx1, idx2;
-        if (!indices) {
-            idx0 = i * 3;
-            idx1 = i * 3 + 1;
-            idx2 = i * 3 + 2;
-        }
-        else {
-            idx0 = indices[i * 3];
-            idx2 = indices[i * 3 + 1];
-            idx1 = indices[i * 3 + 2];
-        }
-
-        // 각 삼각형의 버텍스 위치를 FVector로 불러옵니다.
-        uint32 stride = sizeof(FStaticMeshVertex);
-        FVector v0 = *reinterpret_cast<FVector*>(pbPositions + idx0 * stride);
-        FVector v1 = *reinterpret_cast<FVector*>(pbPositions + idx1 * stride);
-        FVector v2 = *reinterpret_cast<FVector*>(pbPositions + idx2 * stride);
-
-        float fHitDistance;
-        if (IntersectRayTriangle(rayOrigin, rayDirection, v0, v1, v2, fHitDistance)) {
-            if (fHitDistance < fNearHitDistance) {
-                pfNearHitDistance = fNearHitDistance = fHitDistance;
-            }
-            nIntersections++;
-        }
+    const FStaticMeshBVH* BVH = staticMesh->GetBVH();
+    if (BVH == nullptr) return 0;
 
+    // 교차한 삼각형 수로 겹친 오브젝트 중 하나를 고르므로 가장 가까운 교차점만 찾지 않고 모두 셈
+    FBVHRayHit Hit;
+    if (BVH->Raycast(rayOrigin, rayDirection, Hit, true))
+    {
+        pfNearHitDistance = Hit.Distance;
     }
-    return nIntersections;
+    return Hit.NumHits;
 }
\ No newline at end of file
@@ -25,11 +25,23 @@ public:
     UStaticMesh* GetStaticMesh() const { return staticMesh; }
     void SetStaticMesh(UStaticMesh* value)
     { 
+        ++StaticMeshRequestId;
         staticMesh = value;
         OverrideMaterials.SetNum(value->GetMaterials().Num());
         AABB = FBoundingBox(staticMesh->GetRenderData()->BoundingBoxMin, staticMesh->GetRenderData()->BoundingBoxMax);
+        UpdateBounds();
     }
+
+    /**
+     * 메시를 워커 스레드에서 로드하고, 로드가 끝날 때까지는 Placeholder 메시를 그립니다.
+     * 이미 로드된 메시면 바로 설정하며, 로드가 끝나기 전에 컴포넌트가 제거되거나 메시가 다시 바뀌면 결과를 버립니다.
+     */
+    void SetStaticMeshAsync(const FString& PathFileName);
+
 protected:
     UStaticMesh* staticMesh = nullptr;
     int selectedSubMeshIndex = -1;
+
+    // SetStaticMesh마다 증가, 늦게 끝난 비동기 로드가 새로 설정한 메시를 덮어쓰지 않도록 함
+    uint32 StaticMeshRequestId = 0;
 };
@@ -59,9 +59,12 @@ void UAssetManager::LoadObjFiles()
             AssetRegistry->PathNameToAssetInfo.Add(NewAssetInfo.AssetName, NewAssetInfo);
             
             FString MeshName = NewAssetInfo.PackagePath.ToString() + "/" + NewAssetInfo.AssetName.ToString();
-            FManagerOBJ::CreateStaticMesh(MeshName);
+            FManagerOBJ::LoadStaticMeshAsync(MeshName);
             // ObjFileNames.push_back(UGTLStringLibrary::StringToWString(Entry.path().string()));
             // FObjManager::LoadObjStaticMeshAsset(UGTLStringLibrary::StringToWString(Entry.path().string()));
         }
     }
+
+    // 메시들은 워커 스레드에서 로드되고 매 프레임 FManagerOBJ::ProcessAsyncLoads()에서 등록됨
+    // 로드가 끝나기 전에 메시가 필요한 곳은 GetStaticMesh가 그 메시만 기다림
 }
@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <functional>
+#include <memory>
+
+#include "Container/Array.h"
+#include "Container/String.h"
+
+class UStaticMesh;
+struct FManagerOBJ;
+
+namespace OBJ
+{
+    struct FStaticMeshRenderData;
+}
+
+enum class EAsyncLoadState : uint8
+{
+    Loading,    // 워커 스레드에서 파싱/쿠킹 중
+    Built,      // 렌더 데이터가 준비되어 메인 스레드에서 등록되기를 기다리는 중
+    Succeeded,  // UStaticMesh가 만들어져 StaticMeshMap에 등록됨
+    Failed,
+};
+
+/**
+ * FManagerOBJ::LoadStaticMeshAsync가 반환하는 비동기 로드 요청
+ * 상태는 어느 스레드에서든 읽을 수 있지만, 결과 UStaticMesh는 메인 스레드의 FManagerOBJ::ProcessAsyncLoads()에서 채워집니다.
+ */
+class FStaticMeshAsyncLoad
+{
+public:
+    explicit FStaticMeshAsyncLoad(const FString& InFilePath) : FilePath(InFilePath) {}
+
+    const FString& GetFilePath() const { return FilePath; }
+
+    EAsyncLoadState GetState() const { return State.load(std::memory_order_acquire); }
+
+    // 메인 스레드에 결과가 등록되었으면 true (성공, 실패 모두)
+    bool IsDone() const
+    {
+        const EAsyncLoadState CurrentState = GetState();
+        return CurrentState == EAsyncLoadState::Succeeded || CurrentState == EAsyncLoadState::Failed;
+    }
+
+    bool Succeeded() const { return GetState() == EAsyncLoadState::Succeeded; }
+
+    // 로드가 끝나지 않았으면 Placeholder 메시, 실패했으면 nullptr
+    UStaticMesh* GetStaticMesh() const;
+
+private:
+    friend struct FManagerOBJ;
+
+    FString FilePath;
+    std::atomic<EAsyncLoadState> State = EAsyncLoadState::Loading;
+
+    // 워커 스레드가 채우고, State가 Built가 된 뒤에 메인 스레드가 가져감
+    OBJ::FStaticMeshRenderData* RenderData = nullptr;
+
+    // 아래는 메인 스레드에서만 접근
+    UStaticMesh* StaticMesh = nullptr;
+    TArray<std::function<void(UStaticMesh*)>> OnLoadedCallbacks;
+};
+
+using FStaticMeshLoadHandle = std::shared_ptr<FStaticMeshAsyncLoad>;
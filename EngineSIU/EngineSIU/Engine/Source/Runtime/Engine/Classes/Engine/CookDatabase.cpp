@@ -0,0 +1,307 @@
+#include "CookDatabase.h"
+
+#include "HAL/MemoryMappedFile.h"
+#include "Hash/XxHash.h"
+#include "Serialization/MemoryArchive.h"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+namespace
+{
+    // 손상된 파일에서 읽은 개수로 큰 메모리를 할당하지 않도록 제한
+    constexpr int32 MaxSerializedCount = 1 << 20;
+
+    bool GetFileStamp(const FWString& Path, uint64& OutFileSize, int64& OutWriteTime)
+    {
+        std::error_code ErrorCode;
+        OutFileSize = std::filesystem::file_size(Path, ErrorCode);
+        if (ErrorCode)
+        {
+            return false;
+        }
+
+        const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(Path, ErrorCode);
+        if (ErrorCode)
+        {
+            return false;
+        }
+
+        OutWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+        return true;
+    }
+
+    void SerializeCount(FArchive& Ar, int32& Count)
+    {
+        Ar << Count;
+        if (Ar.IsLoading() && (Count < 0 || Count > MaxSerializedCount))
+        {
+            throw std::runtime_error("Invalid element count.");
+        }
+    }
+
+    void SerializeWideString(FArchive& Ar, FWString& Value)
+    {
+        int32 Length = static_cast<int32>(Value.length());
+        SerializeCount(Ar, Length);
+        if (Ar.IsLoading())
+        {
+            Value.resize(Length);
+        }
+        Ar.Serialize(Value.data(), Length * sizeof(WIDECHAR));
+    }
+
+    void SerializeRecord(FArchive& Ar, FCookRecord& Record)
+    {
+        Ar << Record.ImporterVersion;
+
+        int32 NumDependencies = Record.Dependencies.Num();
+        SerializeCount(Ar, NumDependencies);
+        if (Ar.IsLoading())
+        {
+            Record.Dependencies.SetNum(NumDependencies);
+        }
+
+        for (FCookDependency& Dependency : Record.Dependencies)
+        {
+            SerializeWideString(Ar, Dependency.Path);
+            Ar << Dependency.FileSize << Dependency.WriteTime << Dependency.ContentHash;
+        }
+    }
+}
+
+FCookDatabase& FCookDatabase::Get()
+{
+    static FCookDatabase Instance;
+    return Instance;
+}
+
+FCookDatabase::FCookDatabase()
+{
+    Load(DefaultFilePath);
+}
+
+bool FCookDatabase::IsUpToDate(const FString& AssetPath, uint32 ImporterVersion)
+{
+    TArray<FCookDependency> Dependencies;
+    {
+        std::lock_guard Lock(Mutex);
+        const FCookRecord* Record = Records.Find(AssetPath);
+        if (Record == nullptr || Record->ImporterVersion != ImporterVersion)
+        {
+            return false;
+        }
+        Dependencies = Record->Dependencies;
+    }
+
+    bool bStampChanged = false;
+    for (FCookDependency& Dependency : Dependencies)
+    {
+        uint64 FileSize;
+        int64 WriteTime;
+        if (!GetFileStamp(Dependency.Path, FileSize, WriteTime))
+        {
+            if (Dependency.IsMissing())
+            {
+                continue;
+            }
+            return false;
+        }
+
+        if (Dependency.IsMissing() || FileSize != Dependency.FileSize)
+        {
+            return false;
+        }
+
+        if (WriteTime == Dependency.WriteTime)
+        {
+            continue;
+        }
+
+        // 수정 시간만 바뀌었으면 내용을 해시해서 비교
+        FCookDependency Current;
+        MakeDependency(Dependency.Path, Current);
+        if (Current.ContentHash != Dependency.ContentHash || Current.FileSize != Dependency.FileSize)
+        {
+            return false;
+        }
+        Dependency = std::move(Current);
+        bStampChanged = true;
+    }
+
+    // 다음 검사에서 다시 해시하지 않도록 새 수정 시간을 기록
+    if (bStampChanged)
+    {
+        std::lock_guard Lock(Mutex);
+        if (FCookRecord* Record = Records.Find(AssetPath))
+        {
+            Record->Dependencies = std::move(Dependencies);
+            bDirty = true;
+        }
+    }
+    return true;
+}
+
+void FCookDatabase::Record(const FString& AssetPath, uint32 ImporterVersion, const TArray<FCookDependency>& Dependencies)
+{
+    FCookRecord NewRecord;
+    NewRecord.ImporterVersion = ImporterVersion;
+    NewRecord.Dependencies = Dependencies;
+
+    std::lock_guard Lock(Mutex);
+    Records.Add(AssetPath, std::move(NewRecord));
+    bDirty = true;
+}
+
+void FCookDatabase::Invalidate(const FString& AssetPath)
+{
+    std::lock_guard Lock(Mutex);
+    if (Records.Contains(AssetPath))
+    {
+        Records.Remove(AssetPath);
+        bDirty = true;
+    }
+}
+
+bool FCookDatabase::Load(const FWString& FilePath)
+{
+    TArray<uint8> FileData;
+    {
+        FMemoryMappedFile File;
+        if (!File.Open(FilePath))
+        {
+            return false;
+        }
+        FileData.SetNum(static_cast<int32>(File.GetSize()));
+        if (File.GetSize() > 0)
+        {
+            FPlatformMemory::Memcpy(FileData.GetData(), File.GetData(), File.GetSize());
+        }
+    }
+
+    std::lock_guard Lock(Mutex);
+    try
+    {
+        FMemoryReader Reader(FileData);
+        Serialize(Reader);
+        bDirty = false;
+        return true;
+    }
+    catch (const std::exception&)
+    {
+        // 손상되었거나 버전이 다르면 모든 에셋을 다시 쿠킹
+        Records.Empty();
+        bDirty = true;
+        return false;
+    }
+}
+
+bool FCookDatabase::Save(const FWString& FilePath)
+{
+    std::lock_guard Lock(Mutex);
+
+    TArray<uint8> FileData;
+    FMemoryWriter Writer(FileData);
+    Serialize(Writer);
+
+    // 쓰는 도중 실패해도 기존 데이터베이스가 깨지지 않도록 임시 파일에 쓴 뒤 교체
+    const FWString TempFilePath = FilePath + L".tmp";
+    {
+        std::ofstream File(TempFilePath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        File.write(reinterpret_cast<const char*>(FileData.GetData()), FileData.Num());
+        // 닫을 때 남은 데이터를 쓰다가 실패할 수도 있으므로 닫은 뒤에 검사
+        File.close();
+        if (!File.good())
+        {
+            std::error_code RemoveErrorCode;
+            std::filesystem::remove(TempFilePath, RemoveErrorCode);
+            return false;
+        }
+    }
+
+    std::error_code ErrorCode;
+    std::filesystem::rename(TempFilePath, FilePath, ErrorCode);
+    if (ErrorCode)
+    {
+        std::error_code RemoveErrorCode;
+        std::filesystem::remove(TempFilePath, RemoveErrorCode);
+        return false;
+    }
+
+    bDirty = false;
+    return true;
+}
+
+bool FCookDatabase::SaveIfDirty()
+{
+    {
+        std::lock_guard Lock(Mutex);
+        if (!bDirty)
+        {
+            return true;
+        }
+    }
+    return Save(DefaultFilePath);
+}
+
+int32 FCookDatabase::GetNumRecords()
+{
+    std::lock_guard Lock(Mutex);
+    return Records.Num();
+}
+
+void FCookDatabase::MakeDependency(const FWString& Path, FCookDependency& OutDependency)
+{
+    OutDependency = FCookDependency();
+    OutDependency.Path = Path;
+
+    FMemoryMappedFile File;
+    if (!GetFileStamp(Path, OutDependency.FileSize, OutDependency.WriteTime) || !File.Open(Path))
+    {
+        OutDependency.FileSize = FCookDependency::MissingFileSize;
+        OutDependency.WriteTime = 0;
+        return;
+    }
+
+    OutDependency.ContentHash = FXxHash64::HashBuffer(File.GetData(), File.GetSize());
+}
+
+void FCookDatabase::Serialize(FArchive& Ar)
+{
+    uint32 FileMagic = Magic;
+    uint32 FileVersion = Version;
+    Ar << FileMagic << FileVersion;
+    if (Ar.IsLoading() && (FileMagic != Magic || FileVersion != Version))
+    {
+        throw std::runtime_error("Cook database version mismatch.");
+    }
+
+    int32 NumRecords = Records.Num();
+    SerializeCount(Ar, NumRecords);
+
+    if (Ar.IsLoading())
+    {
+        Records.Empty();
+        for (int32 i = 0; i < NumRecords; ++i)
+        {
+            FString AssetPath;
+            FCookRecord Record;
+            Ar << AssetPath;
+            SerializeRecord(Ar, Record);
+            Records.Add(AssetPath, std::move(Record));
+        }
+    }
+    else
+    {
+        for (auto& [AssetPath, Record] : Records)
+        {
+            Ar << const_cast<FString&>(AssetPath);
+            SerializeRecord(Ar, Record);
+        }
+    }
+}
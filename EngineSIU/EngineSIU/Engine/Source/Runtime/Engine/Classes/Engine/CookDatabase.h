@@ -0,0 +1,91 @@
+#pragma once
+#include <mutex>
+
+#include "Container/Array.h"
+#include "Container/Map.h"
+#include "Container/String.h"
+#include "HAL/PlatformType.h"
+
+class FArchive;
+
+// 쿠킹 결과에 영향을 주는 파일 하나 (원본 OBJ, mtllib, 텍스처)
+struct FCookDependency
+{
+    // 파일이 없을 때의 FileSize, 나중에 파일이 생기면 다시 쿠킹
+    static constexpr uint64 MissingFileSize = ~0ull;
+
+    FWString Path;
+    uint64 FileSize = MissingFileSize;
+    int64 WriteTime = 0;
+    uint64 ContentHash = 0;
+
+    bool IsMissing() const { return FileSize == MissingFileSize; }
+};
+
+struct FCookRecord
+{
+    uint32 ImporterVersion = 0;
+    TArray<FCookDependency> Dependencies;
+};
+
+/**
+ * 에셋별로 쿠킹에 사용한 파일들의 내용 해시(xxHash64)와 임포터 버전을 기록하는 데이터베이스
+ *
+ * 파일 크기와 수정 시간이 그대로면 해시를 다시 계산하지 않고, 바뀐 경우에만 내용을 해시해서 비교합니다.
+ * 따라서 저장만 다시 하거나 복사해서 수정 시간만 바뀐 파일은 다시 쿠킹하지 않습니다.
+ *
+ * @note 모든 함수는 여러 스레드에서 동시에 호출할 수 있습니다.
+ */
+class FCookDatabase
+{
+public:
+    static constexpr uint32 Magic = 0x42444B43; // "CKDB"
+    static constexpr uint32 Version = 1;
+
+    // 처음 Get()을 호출할 때 이 파일에서 읽음
+    static constexpr const WIDECHAR* DefaultFilePath = L"CookDatabase.bin";
+
+    static FCookDatabase& Get();
+
+    // 복사 & 이동 생성자 제거
+    FCookDatabase(const FCookDatabase&) = delete;
+    FCookDatabase& operator=(const FCookDatabase&) = delete;
+    FCookDatabase(FCookDatabase&&) = delete;
+    FCookDatabase& operator=(FCookDatabase&&) = delete;
+
+    /**
+     * 마지막 쿠킹 이후 임포터 버전과 모든 의존 파일의 내용이 그대로인지 검사합니다.
+     * 기록이 없으면 false를 반환합니다.
+     */
+    bool IsUpToDate(const FString& AssetPath, uint32 ImporterVersion);
+
+    /**
+     * 쿠킹이 끝난 에셋의 의존 파일 정보를 기록합니다.
+     * @param Dependencies 에셋의 원본 파일을 포함한, 쿠킹 결과에 영향을 준 모든 파일.
+     *                     쿠킹 도중 바뀐 파일을 최신으로 기록하지 않도록, 각 파일을 읽기 전에 MakeDependency로 만든 값이어야 합니다.
+     */
+    void Record(const FString& AssetPath, uint32 ImporterVersion, const TArray<FCookDependency>& Dependencies);
+
+    void Invalidate(const FString& AssetPath);
+
+    bool Load(const FWString& FilePath);
+    bool Save(const FWString& FilePath);
+
+    // Record나 해시 갱신으로 바뀐 내용이 있으면 DefaultFilePath에 저장
+    bool SaveIfDirty();
+
+    int32 GetNumRecords();
+
+    // 파일의 크기, 수정 시간, 내용 해시를 읽음, 파일이 없으면 IsMissing()인 값을 채움
+    static void MakeDependency(const FWString& Path, FCookDependency& OutDependency);
+
+private:
+    FCookDatabase();
+
+    void Serialize(FArchive& Ar);
+
+private:
+    std::mutex Mutex;
+    TMap<FString, FCookRecord> Records;
+    bool bDirty = false;
+};
@@ -0,0 +1,368 @@
+#include "CookedStaticMesh.h"
+
+#include "Hash/XxHash.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint64 AlignUp(uint64 Value, uint64 Alignment)
+    {
+        return (Value + Alignment - 1) & ~(Alignment - 1);
+    }
+
+    // 문자열을 String Table에 추가하고 위치를 반환
+    template <typename CharType>
+    FCookedStringRef AddString(TArray<uint8>& StringTable, const CharType* Chars, uint64 Length)
+    {
+        const int32 Offset = static_cast<int32>(AlignUp(StringTable.Num(), sizeof(CharType)));
+        StringTable.SetNum(Offset + static_cast<int32>(Length * sizeof(CharType)));
+        if (Length > 0)
+        {
+            std::memcpy(StringTable.GetData() + Offset, Chars, Length * sizeof(CharType));
+        }
+
+        FCookedStringRef Ref;
+        Ref.Offset = static_cast<uint32>(Offset);
+        Ref.Length = static_cast<uint32>(Length);
+        return Ref;
+    }
+
+    FCookedStringRef AddString(TArray<uint8>& StringTable, const FString& String)
+    {
+        return AddString(StringTable, GetData(String), String.Len());
+    }
+
+    FCookedStringRef AddString(TArray<uint8>& StringTable, const FWString& String)
+    {
+        return AddString(StringTable, String.c_str(), String.length());
+    }
+
+    bool IsValidBlock(const FCookedBlock& Block, uint64 Stride, uint64 HeaderSize, uint64 FileSize)
+    {
+        return Block.Offset % CookedMesh::BlockAlignment == 0
+            && Block.Offset >= HeaderSize
+            && Block.Offset <= FileSize
+            && Block.Count <= (FileSize - Block.Offset) / Stride;
+    }
+}
+
+ECookedMeshStatus FCookedStaticMeshView::Open(const FWString& CookedFilePath, const FWString& SourceFilePath)
+{
+    Header = nullptr;
+    if (!FileLock.owns_lock())
+    {
+        FileLock = std::shared_lock(FCookedStaticMesh::GetFileLock());
+    }
+
+    if (!MappedFile.Open(CookedFilePath))
+    {
+        return ECookedMeshStatus::Missing;
+    }
+
+    const uint64 FileSize = MappedFile.GetSize();
+    if (FileSize < sizeof(FCookedMeshHeader))
+    {
+        return ECookedMeshStatus::InvalidHeader;
+    }
+
+    const FCookedMeshHeader* FileHeader = reinterpret_cast<const FCookedMeshHeader*>(MappedFile.GetData());
+    if (FileHeader->Magic != CookedMesh::Magic)
+    {
+        return ECookedMeshStatus::InvalidHeader;
+    }
+
+    if (FileHeader->Version != CookedMesh::Version
+        || FileHeader->HeaderSize != sizeof(FCookedMeshHeader)
+        || FileHeader->VertexStride != sizeof(FStaticMeshVertex))
+    {
+        return ECookedMeshStatus::VersionMismatch;
+    }
+
+    // 원본이 없으면 캐시만으로 로드
+    uint64 SourceFileSize;
+    int64 SourceWriteTime;
+    if (!SourceFilePath.empty() && FCookedStaticMesh::GetSourceStamp(SourceFilePath, SourceFileSize, SourceWriteTime))
+    {
+        if (FileHeader->SourceFileSize != SourceFileSize || FileHeader->SourceWriteTime != SourceWriteTime)
+        {
+            return ECookedMeshStatus::Stale;
+        }
+    }
+
+    const uint64 HeaderSize = FileHeader->HeaderSize;
+    if (FileHeader->PayloadSize != FileSize - HeaderSize
+        || !IsValidBlock(FileHeader->Vertices, sizeof(FStaticMeshVertex), HeaderSize, FileSize)
+        || !IsValidBlock(FileHeader->Indices, sizeof(uint32), HeaderSize, FileSize)
+        || !IsValidBlock(FileHeader->Materials, sizeof(FCookedMaterial), HeaderSize, FileSize)
+        || !IsValidBlock(FileHeader->MaterialSubsets, sizeof(FCookedMaterialSubset), HeaderSize, FileSize)
+        || !IsValidBlock(FileHeader->StringTable, 1, HeaderSize, FileSize))
+    {
+        return ECookedMeshStatus::Corrupt;
+    }
+
+    if (FXxHash64::HashBuffer(MappedFile.GetData() + HeaderSize, FileHeader->PayloadSize) != FileHeader->PayloadChecksum)
+    {
+        return ECookedMeshStatus::Corrupt;
+    }
+
+    Header = FileHeader;
+    return ECookedMeshStatus::Valid;
+}
+
+FString FCookedStaticMeshView::GetString(const FCookedStringRef& Ref) const
+{
+    using CharType = FString::ElementType;
+    if (static_cast<uint64>(Ref.Offset) + static_cast<uint64>(Ref.Length) * sizeof(CharType) > Header->StringTable.Count)
+    {
+        return FString();
+    }
+
+    const CharType* Chars = reinterpret_cast<const CharType*>(MappedFile.GetData() + Header->StringTable.Offset + Ref.Offset);
+    return FString(std::basic_string<CharType>(Chars, Ref.Length));
+}
+
+FWString FCookedStaticMeshView::GetWideString(const FCookedStringRef& Ref) const
+{
+    if (static_cast<uint64>(Ref.Offset) + static_cast<uint64>(Ref.Length) * sizeof(WIDECHAR) > Header->StringTable.Count)
+    {
+        return FWString();
+    }
+
+    const WIDECHAR* Chars = reinterpret_cast<const WIDECHAR*>(MappedFile.GetData() + Header->StringTable.Offset + Ref.Offset);
+    return FWString(Chars, Ref.Length);
+}
+
+const char* FCookedStaticMesh::GetStatusName(ECookedMeshStatus Status)
+{
+    switch (Status)
+    {
+    case ECookedMeshStatus::Valid:           return "Valid";
+    case ECookedMeshStatus::Missing:         return "Missing";
+    case ECookedMeshStatus::InvalidHeader:   return "InvalidHeader";
+    case ECookedMeshStatus::VersionMismatch: return "VersionMismatch";
+    case ECookedMeshStatus::Stale:           return "Stale";
+    case ECookedMeshStatus::Corrupt:         return "Corrupt";
+    default:                                 return "Unknown";
+    }
+}
+
+std::shared_mutex& FCookedStaticMesh::GetFileLock()
+{
+    static std::shared_mutex FileLock;
+    return FileLock;
+}
+
+bool FCookedStaticMesh::GetSourceStamp(const FWString& SourceFilePath, uint64& OutFileSize, int64& OutWriteTime)
+{
+    std::error_code ErrorCode;
+    OutFileSize = std::filesystem::file_size(SourceFilePath, ErrorCode);
+    if (ErrorCode)
+    {
+        return false;
+    }
+
+    const std::filesystem::file_time_type WriteTime = std::filesystem::last_write_time(SourceFilePath, ErrorCode);
+    if (ErrorCode)
+    {
+        return false;
+    }
+
+    OutWriteTime = static_cast<int64>(WriteTime.time_since_epoch().count());
+    return true;
+}
+
+bool FCookedStaticMesh::Save(const FWString& CookedFilePath, uint64 SourceFileSize, int64 SourceWriteTime, const OBJ::FStaticMeshRenderData& StaticMesh)
+{
+    FCookedMeshHeader Header = {};
+    Header.Magic = CookedMesh::Magic;
+    Header.Version = CookedMesh::Version;
+    Header.HeaderSize = sizeof(FCookedMeshHeader);
+    Header.VertexStride = sizeof(FStaticMeshVertex);
+    Header.SourceFileSize = SourceFileSize;
+    Header.SourceWriteTime = SourceWriteTime;
+
+    TArray<uint8> StringTable;
+    Header.ObjectName = AddString(StringTable, StaticMesh.ObjectName);
+    Header.DisplayName = AddString(StringTable, StaticMesh.DisplayName);
+    Header.BoundingBoxMin = StaticMesh.BoundingBoxMin;
+    Header.BoundingBoxMax = StaticMesh.BoundingBoxMax;
+
+    TArray<FCookedMaterial> Materials;
+    Materials.SetNum(StaticMesh.Materials.Num());
+    for (int32 i = 0; i < StaticMesh.Materials.Num(); ++i)
+    {
+        const FObjMaterialInfo& Source = StaticMesh.Materials[i];
+        FCookedMaterial& Material = Materials[i];
+        Material.MaterialName = AddString(StringTable, Source.MaterialName);
+        Material.bHasTexture = Source.bHasTexture;
+        Material.bTransparent = Source.bTransparent;
+        Material.bHasNormalMap = Source.bHasNormalMap;
+        Material.Padding = 0;
+        Material.Diffuse = Source.Diffuse;
+        Material.Specular = Source.Specular;
+        Material.Ambient = Source.Ambient;
+        Material.Emissive = Source.Emissive;
+        Material.SpecularScalar = Source.SpecularScalar;
+        Material.DensityScalar = Source.DensityScalar;
+        Material.TransparencyScalar = Source.TransparencyScalar;
+        Material.IlluminanceModel = Source.IlluminanceModel;
+
+        Material.TextureNames[ECookedTexture::Diffuse] = AddString(StringTable, Source.DiffuseTextureName);
+        Material.TexturePaths[ECookedTexture::Diffuse] = AddString(StringTable, Source.DiffuseTexturePath);
+        Material.TextureNames[ECookedTexture::Ambient] = AddString(StringTable, Source.AmbientTextureName);
+        Material.TexturePaths[ECookedTexture::Ambient] = AddString(StringTable, Source.AmbientTexturePath);
+        Material.TextureNames[ECookedTexture::Specular] = AddString(StringTable, Source.SpecularTextureName);
+        Material.TexturePaths[ECookedTexture::Specular] = AddString(StringTable, Source.SpecularTexturePath);
+        Material.TextureNames[ECookedTexture::Bump] = AddString(StringTable, Source.BumpTextureName);
+        Material.TexturePaths[ECookedTexture::Bump] = AddString(StringTable, Source.BumpTexturePath);
+        Material.TextureNames[ECookedTexture::Alpha] = AddString(StringTable, Source.AlphaTextureName);
+        Material.TexturePaths[ECookedTexture::Alpha] = AddString(StringTable, Source.AlphaTexturePath);
+    }
+
+    TArray<FCookedMaterialSubset> Subsets;
+    Subsets.SetNum(StaticMesh.MaterialSubsets.Num());
+    for (int32 i = 0; i < StaticMesh.MaterialSubsets.Num(); ++i)
+    {
+        const FMaterialSubset& Source = StaticMesh.MaterialSubsets[i];
+        Subsets[i].IndexStart = Source.IndexStart;
+        Subsets[i].IndexCount = Source.IndexCount;
+        Subsets[i].MaterialIndex = Source.MaterialIndex;
+        Subsets[i].MaterialName = AddString(StringTable, Source.MaterialName);
+    }
+
+    // 블록 배치
+    uint64 Offset = AlignUp(sizeof(FCookedMeshHeader), CookedMesh::BlockAlignment);
+    auto PlaceBlock = [&Offset](FCookedBlock& Block, uint64 Count, uint64 Stride)
+    {
+        Block.Offset = Offset;
+        Block.Count = Count;
+        Offset = AlignUp(Offset + Count * Stride, CookedMesh::BlockAlignment);
+    };
+    PlaceBlock(Header.Vertices, StaticMesh.Vertices.Num(), sizeof(FStaticMeshVertex));
+    PlaceBlock(Header.Indices, StaticMesh.Indices.Num(), sizeof(uint32));
+    PlaceBlock(Header.Materials, Materials.Num(), sizeof(FCookedMaterial));
+    PlaceBlock(Header.MaterialSubsets, Subsets.Num(), sizeof(FCookedMaterialSubset));
+    PlaceBlock(Header.StringTable, StringTable.Num(), 1);
+
+    // 정렬용 패딩이 0으로 채워지도록 SetNum으로 초기화
+    TArray<uint8> FileData;
+    FileData.SetNum(static_cast<int32>(Offset));
+    auto CopyBlock = [&FileData](const FCookedBlock& Block, const void* Source, uint64 Bytes)
+    {
+        if (Bytes > 0)
+        {
+            std::memcpy(FileData.GetData() + Block.Offset, Source, Bytes);
+        }
+    };
+    CopyBlock(Header.Vertices, StaticMesh.Vertices.GetData(), Header.Vertices.Count * sizeof(FStaticMeshVertex));
+    CopyBlock(Header.Indices, StaticMesh.Indices.GetData(), Header.Indices.Count * sizeof(uint32));
+    CopyBlock(Header.Materials, Materials.GetData(), Header.Materials.Count * sizeof(FCookedMaterial));
+    CopyBlock(Header.MaterialSubsets, Subsets.GetData(), Header.MaterialSubsets.Count * sizeof(FCookedMaterialSubset));
+    CopyBlock(Header.StringTable, StringTable.GetData(), Header.StringTable.Count);
+
+    Header.PayloadSize = Offset - Header.HeaderSize;
+    Header.PayloadChecksum = FXxHash64::HashBuffer(FileData.GetData() + Header.HeaderSize, Header.PayloadSize);
+    std::memcpy(FileData.GetData(), &Header, sizeof(Header));
+
+    // 쓰는 도중 실패해도 기존 캐시가 깨지지 않도록 임시 파일에 쓴 뒤 교체
+    const FWString TempFilePath = CookedFilePath + L".tmp";
+    {
+        std::ofstream File(TempFilePath, std::ios::binary | std::ios::trunc);
+        if (!File.is_open())
+        {
+            return false;
+        }
+        File.write(reinterpret_cast<const char*>(FileData.GetData()), FileData.Num());
+        File.close();
+        if (!File.good())
+        {
+            std::error_code RemoveErrorCode;
+            std::filesystem::remove(TempFilePath, RemoveErrorCode);
+            return false;
+        }
+    }
+
+    // Windows는 매핑되어 있거나 열려 있는 파일을 교체할 수 없으므로, 이 프로세스의 뷰가 모두 닫힐 때까지 기다림
+    std::error_code ErrorCode;
+    {
+        std::unique_lock Lock(GetFileLock());
+        std::filesystem::rename(TempFilePath, CookedFilePath, ErrorCode);
+    }
+    if (ErrorCode)
+    {
+        std::error_code RemoveErrorCode;
+        std::filesystem::remove(TempFilePath, RemoveErrorCode);
+        return false;
+    }
+    return true;
+}
+
+ECookedMeshStatus FCookedStaticMesh::Load(const FWString& CookedFilePath, const FWString& SourceFilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+{
+    FCookedStaticMeshView View;
+    const ECookedMeshStatus Status = View.Open(CookedFilePath, SourceFilePath);
+    if (Status != ECookedMeshStatus::Valid)
+    {
+        return Status;
+    }
+
+    const FCookedMeshHeader& Header = View.GetHeader();
+    OutStaticMesh.ObjectName = View.GetWideString(Header.ObjectName);
+    OutStaticMesh.DisplayName = View.GetString(Header.DisplayName);
+
+    // 정점/인덱스는 매핑된 메모리에서 한 번에 복사
+    OutStaticMesh.Vertices.SetNum(static_cast<int32>(Header.Vertices.Count));
+    std::memcpy(OutStaticMesh.Vertices.GetData(), View.GetVertices(), Header.Vertices.Count * sizeof(FStaticMeshVertex));
+
+    OutStaticMesh.Indices.SetNum(static_cast<int32>(Header.Indices.Count));
+    std::memcpy(OutStaticMesh.Indices.GetData(), View.GetIndices(), Header.Indices.Count * sizeof(uint32));
+
+    const FCookedMaterial* Materials = View.GetMaterials();
+    OutStaticMesh.Materials.SetNum(static_cast<int32>(Header.Materials.Count));
+    for (int32 i = 0; i < OutStaticMesh.Materials.Num(); ++i)
+    {
+        const FCookedMaterial& Source = Materials[i];
+        FObjMaterialInfo& Material = OutStaticMesh.Materials[i];
+        Material.MaterialName = View.GetString(Source.MaterialName);
+        Material.bHasTexture = Source.bHasTexture != 0;
+        Material.bTransparent = Source.bTransparent != 0;
+        Material.bHasNormalMap = Source.bHasNormalMap != 0;
+        Material.Diffuse = Source.Diffuse;
+        Material.Specular = Source.Specular;
+        Material.Ambient = Source.Ambient;
+        Material.Emissive = Source.Emissive;
+        Material.SpecularScalar = Source.SpecularScalar;
+        Material.DensityScalar = Source.DensityScalar;
+        Material.TransparencyScalar = Source.TransparencyScalar;
+        Material.IlluminanceModel = Source.IlluminanceModel;
+
+        Material.DiffuseTextureName = View.GetString(Source.TextureNames[ECookedTexture::Diffuse]);
+        Material.DiffuseTexturePath = View.GetWideString(Source.TexturePaths[ECookedTexture::Diffuse]);
+        Material.AmbientTextureName = View.GetString(Source.TextureNames[ECookedTexture::Ambient]);
+        Material.AmbientTexturePath = View.GetWideString(Source.TexturePaths[ECookedTexture::Ambient]);
+        Material.SpecularTextureName = View.GetString(Source.TextureNames[ECookedTexture::Specular]);
+        Material.SpecularTexturePath = View.GetWideString(Source.TexturePaths[ECookedTexture::Specular]);
+        Material.BumpTextureName = View.GetString(Source.TextureNames[ECookedTexture::Bump]);
+        Material.BumpTexturePath = View.GetWideString(Source.TexturePaths[ECookedTexture::Bump]);
+        Material.AlphaTextureName = View.GetString(Source.TextureNames[ECookedTexture::Alpha]);
+        Material.AlphaTexturePath = View.GetWideString(Source.TexturePaths[ECookedTexture::Alpha]);
+    }
+
+    const FCookedMaterialSubset* Subsets = View.GetMaterialSubsets();
+    OutStaticMesh.MaterialSubsets.SetNum(static_cast<int32>(Header.MaterialSubsets.Count));
+    for (int32 i = 0; i < OutStaticMesh.MaterialSubsets.Num(); ++i)
+    {
+        FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[i];
+        Subset.IndexStart = Subsets[i].IndexStart;
+        Subset.IndexCount = Subsets[i].IndexCount;
+        Subset.MaterialIndex = Subsets[i].MaterialIndex;
+        Subset.MaterialName = View.GetString(Subsets[i].MaterialName);
+    }
+
+    OutStaticMesh.BoundingBoxMin = Header.BoundingBoxMin;
+    OutStaticMesh.BoundingBoxMax = Header.BoundingBoxMax;
+    return ECookedMeshStatus::Valid;
+}
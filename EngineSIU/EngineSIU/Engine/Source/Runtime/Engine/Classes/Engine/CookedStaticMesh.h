@@ -0,0 +1,187 @@
+#pragma once
+
+#include "Define.h"
+#include "HAL/MemoryMappedFile.h"
+#include "HAL/PlatformType.h"
+
+#include <shared_mutex>
+
+/**
+ * 쿠킹된 스태틱 메시(*.obj.bin) 파일 포맷
+ *
+ *  [FCookedMeshHeader]                     파일 맨 앞
+ *  [FStaticMeshVertex x VertexCount]       16바이트 정렬
+ *  [uint32 x IndexCount]                   16바이트 정렬
+ *  [FCookedMaterial x MaterialCount]       16바이트 정렬
+ *  [FCookedMaterialSubset x SubsetCount]   16바이트 정렬
+ *  [String Table]                          16바이트 정렬, 모든 이름/경로 문자열
+ *
+ * 모든 블록은 파일을 메모리에 매핑한 주소에서 그대로 읽을 수 있는 POD 배열이며,
+ * 헤더 뒤의 전체 내용은 PayloadChecksum(xxHash64)으로 검증합니다.
+ */
+namespace CookedMesh
+{
+    constexpr uint32 Magic = 0x4B434D53; // "SMCK"
+
+    // 포맷이나 임포터의 결과가 바뀌면 올려서 기존 캐시를 모두 다시 빌드하게 함
+    constexpr uint32 Version = 1;
+
+    constexpr uint64 BlockAlignment = 16;
+}
+
+enum class ECookedMeshStatus : uint8
+{
+    Valid,
+    Missing,            // 캐시 파일이 없음
+    InvalidHeader,      // Magic이 다르거나 헤더가 잘림
+    VersionMismatch,    // 포맷 버전 또는 정점 구조체 크기가 다름
+    Stale,              // 원본 파일이 캐시 이후에 바뀜
+    Corrupt,            // 블록 범위 또는 체크섬 오류
+};
+
+// String Table 안의 문자열 위치, Length는 문자 수
+struct FCookedStringRef
+{
+    uint32 Offset = 0;
+    uint32 Length = 0;
+};
+
+struct FCookedBlock
+{
+    uint64 Offset = 0;  // 파일 시작 기준 바이트 오프셋
+    uint64 Count = 0;   // 요소 개수 (String Table은 바이트 수)
+};
+
+struct alignas(16) FCookedMeshHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 HeaderSize;
+    uint32 VertexStride;
+
+    // 원본 OBJ 파일 정보, 바뀌면 캐시를 다시 빌드
+    uint64 SourceFileSize;
+    int64 SourceWriteTime;
+
+    uint64 PayloadSize;
+    uint64 PayloadChecksum;
+
+    FCookedBlock Vertices;
+    FCookedBlock Indices;
+    FCookedBlock Materials;
+    FCookedBlock MaterialSubsets;
+    FCookedBlock StringTable;
+
+    FCookedStringRef ObjectName;    // WIDECHAR
+    FCookedStringRef DisplayName;   // FString::ElementType
+
+    FVector BoundingBoxMin;
+    FVector BoundingBoxMax;
+};
+
+namespace ECookedTexture
+{
+    enum Type : uint8
+    {
+        Diffuse,
+        Ambient,
+        Specular,
+        Bump,
+        Alpha,
+        Count
+    };
+}
+
+struct FCookedMaterial
+{
+    FCookedStringRef MaterialName;
+
+    uint8 bHasTexture;
+    uint8 bTransparent;
+    uint8 bHasNormalMap;
+    uint8 Padding;
+
+    FVector Diffuse;
+    FVector Specular;
+    FVector Ambient;
+    FVector Emissive;
+
+    float SpecularScalar;
+    float DensityScalar;
+    float TransparencyScalar;
+    uint32 IlluminanceModel;
+
+    FCookedStringRef TextureNames[ECookedTexture::Count];   // FString::ElementType
+    FCookedStringRef TexturePaths[ECookedTexture::Count];   // WIDECHAR
+};
+
+struct FCookedMaterialSubset
+{
+    uint32 IndexStart;
+    uint32 IndexCount;
+    uint32 MaterialIndex;
+    FCookedStringRef MaterialName;
+};
+
+/**
+ * 메모리에 매핑된 쿠킹 메시 파일을 복사 없이 읽는 뷰
+ * 반환하는 포인터는 뷰가 살아있는 동안만 유효합니다.
+ * 뷰가 파일을 매핑하고 있는 동안 같은 프로세스의 FCookedStaticMesh::Save는 캐시 파일을 교체하지 않고 기다립니다.
+ */
+class FCookedStaticMeshView
+{
+public:
+    /**
+     * 파일을 매핑하고 헤더, 블록 범위, 체크섬을 검사합니다.
+     * @param SourceFilePath 비어있지 않으면 원본 파일의 크기와 수정 시간을 헤더와 비교합니다.
+     */
+    ECookedMeshStatus Open(const FWString& CookedFilePath, const FWString& SourceFilePath);
+
+    const FCookedMeshHeader& GetHeader() const { return *Header; }
+
+    const FStaticMeshVertex* GetVertices() const { return GetBlock<FStaticMeshVertex>(Header->Vertices); }
+    const uint32* GetIndices() const { return GetBlock<uint32>(Header->Indices); }
+    const FCookedMaterial* GetMaterials() const { return GetBlock<FCookedMaterial>(Header->Materials); }
+    const FCookedMaterialSubset* GetMaterialSubsets() const { return GetBlock<FCookedMaterialSubset>(Header->MaterialSubsets); }
+
+    FString GetString(const FCookedStringRef& Ref) const;
+    FWString GetWideString(const FCookedStringRef& Ref) const;
+
+private:
+    template <typename T>
+    const T* GetBlock(const FCookedBlock& Block) const
+    {
+        return reinterpret_cast<const T*>(MappedFile.GetData() + Block.Offset);
+    }
+
+private:
+    // MappedFile보다 먼저 선언해서, 매핑을 해제한 뒤에 잠금을 풂
+    std::shared_lock<std::shared_mutex> FileLock;
+
+    FMemoryMappedFile MappedFile;
+    const FCookedMeshHeader* Header = nullptr;
+};
+
+struct FCookedStaticMesh
+{
+    static const char* GetStatusName(ECookedMeshStatus Status);
+
+    // 원본 파일의 크기와 수정 시간, 원본이 없으면 false
+    static bool GetSourceStamp(const FWString& SourceFilePath, uint64& OutFileSize, int64& OutWriteTime);
+
+    /**
+     * 임시 파일에 쓴 뒤 캐시 파일과 교체합니다.
+     * SourceFileSize, SourceWriteTime은 원본을 읽기 전에 얻은 크기와 수정 시간(GetSourceStamp와 같은 단위)이어야 합니다.
+     * 교체는 매핑 중인 FCookedStaticMeshView가 모두 닫힐 때까지 기다리며, 다른 프로세스가 파일을 열고 있어 교체에 실패하면 false를 반환합니다.
+     */
+    static bool Save(const FWString& CookedFilePath, uint64 SourceFileSize, int64 SourceWriteTime, const OBJ::FStaticMeshRenderData& StaticMesh);
+
+    /**
+     * 캐시 파일을 매핑하고 검증한 뒤, 정점과 인덱스 블록을 문자열 파싱 없이 OutStaticMesh로 한 번에 복사합니다.
+     * FStaticMeshRenderData는 자신의 배열을 소유하므로 매핑을 그대로 가리키지 않으며, 반환하기 전에 매핑을 닫습니다.
+     */
+    static ECookedMeshStatus Load(const FWString& CookedFilePath, const FWString& SourceFilePath, OBJ::FStaticMeshRenderData& OutStaticMesh);
+
+    // 캐시 파일을 매핑한 뷰는 공유 잠금을, 파일을 교체하는 Save는 배타 잠금을 잡음
+    static std::shared_mutex& GetFileLock();
+};
@@ -61,6 +61,8 @@ void UEditorEngine::Tick(float DeltaTime)
                         }
                     }
                 }
+                World->UpdateProjectiles(DeltaTime);
+                World->UpdateTransformHierarchy();
             }
         }
         else if (WorldContext->WorldType == EWorldType::PIE)
@@ -80,6 +82,8 @@ void UEditorEngine::Tick(float DeltaTime)
                         }
                     }
                 }
+                World->UpdateProjectiles(DeltaTime);
+                World->UpdateTransformHierarchy();
             }
         }
     }
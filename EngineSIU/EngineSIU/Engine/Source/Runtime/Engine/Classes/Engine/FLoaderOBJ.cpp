@@ -3,18 +3,621 @@
 #include "UObject/ObjectFactory.h"
 #include "Components/Material/Material.h"
 #include "Components/Mesh/StaticMesh.h"
-
+#include "Components/Mesh/StaticMeshBVH.h"
+#include "Engine/CookDatabase.h"
+#include "Engine/CookedStaticMesh.h"
+#include "Async/ParallelFor.h"
+#include "HAL/MemoryMappedFile.h"
+#include "WindowsPlatformTime.h"
+
+#include <charconv>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
+#include <string_view>
+
+namespace
+{
+    // OBJ 텍스트 토큰화에 사용하는 스캐너, 모든 함수는 [Cursor, End) 범위만 읽습니다.
+
+    FORCEINLINE bool IsSpace(char Char)
+    {
+        return Char == ' ' || Char == '\t' || Char == '\r' || Char == '\v' || Char == '\f';
+    }
+
+    FORCEINLINE bool IsDigit(char Char)
+    {
+        return static_cast<uint8>(Char - '0') < 10;
+    }
+
+    FORCEINLINE const char* SkipSpaces(const char* Cursor, const char* End)
+    {
+        while (Cursor < End && IsSpace(*Cursor))
+        {
+            ++Cursor;
+        }
+        return Cursor;
+    }
+
+    FORCEINLINE const char* FindLineEnd(const char* Cursor, const char* End)
+    {
+        const void* Found = std::memchr(Cursor, '\n', End - Cursor);
+        return Found ? static_cast<const char*>(Found) : End;
+    }
+
+    // 공백으로 구분된 다음 단어를 읽습니다.
+    FORCEINLINE std::string_view ReadWord(const char*& Cursor, const char* End)
+    {
+        Cursor = SkipSpaces(Cursor, End);
+        const char* WordStart = Cursor;
+        while (Cursor < End && !IsSpace(*Cursor))
+        {
+            ++Cursor;
+        }
+        return { WordStart, static_cast<size_t>(Cursor - WordStart) };
+    }
+
+    constexpr double Pow10Table[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+
+    /**
+     * 10진 실수를 읽습니다.
+     * 유효 숫자가 2^53 이하이고 지수가 10^22 이내인 경우(OBJ 데이터의 대부분)는 double 연산 한 번으로 계산하고,
+     * 그 외의 경우는 std::from_chars로 넘깁니다.
+     */
+    const char* ParseFloat(const char* Cursor, const char* End, float& OutValue)
+    {
+        Cursor = SkipSpaces(Cursor, End);
+
+        bool bNegative = false;
+        if (Cursor < End && (*Cursor == '-' || *Cursor == '+'))
+        {
+            bNegative = *Cursor == '-';
+            ++Cursor;
+        }
+
+        const char* NumberStart = Cursor;
+        uint64 Mantissa = 0;
+        int32 NumDigits = 0;
+        int32 Exponent = 0;
+
+        while (Cursor < End && IsDigit(*Cursor))
+        {
+            if (NumDigits < 19)
+            {
+                Mantissa = Mantissa * 10 + (*Cursor - '0');
+                NumDigits += Mantissa != 0;
+            }
+            else
+            {
+                ++Exponent;
+            }
+            ++Cursor;
+        }
+
+        bool bHasDigits = Cursor != NumberStart;
+        if (Cursor < End && *Cursor == '.')
+        {
+            ++Cursor;
+            const char* FractionStart = Cursor;
+            while (Cursor < End && IsDigit(*Cursor))
+            {
+                if (NumDigits < 19)
+                {
+                    Mantissa = Mantissa * 10 + (*Cursor - '0');
+                    NumDigits += Mantissa != 0;
+                    --Exponent;
+                }
+                ++Cursor;
+            }
+            bHasDigits |= Cursor != FractionStart;
+        }
+
+        if (!bHasDigits)
+        {
+            OutValue = 0.f;
+            return Cursor;
+        }
+
+        if (Cursor < End && (*Cursor == 'e' || *Cursor == 'E'))
+        {
+            const char* ExponentCursor = Cursor + 1;
+            bool bNegativeExponent = false;
+            if (ExponentCursor < End && (*ExponentCursor == '-' || *ExponentCursor == '+'))
+            {
+                bNegativeExponent = *ExponentCursor == '-';
+                ++ExponentCursor;
+            }
+
+            if (ExponentCursor < End && IsDigit(*ExponentCursor))
+            {
+                int32 ExplicitExponent = 0;
+                while (ExponentCursor < End && IsDigit(*ExponentCursor))
+                {
+                    if (ExplicitExponent < 10000)
+                    {
+                        ExplicitExponent = ExplicitExponent * 10 + (*ExponentCursor - '0');
+                    }
+                    ++ExponentCursor;
+                }
+                Exponent += bNegativeExponent ? -ExplicitExponent : ExplicitExponent;
+                Cursor = ExponentCursor;
+            }
+        }
+
+        double Value;
+        if (Mantissa <= (1ull << 53) && Exponent >= -22 && Exponent <= 22)
+        {
+            Value = static_cast<double>(Mantissa);
+            Value = Exponent < 0 ? Value / Pow10Table[-Exponent] : Value * Pow10Table[Exponent];
+        }
+        else
+        {
+            // 정밀도가 부족한 경우
+            std::from_chars(NumberStart, Cursor, Value);
+        }
+
+        OutValue = static_cast<float>(bNegative ? -Value : Value);
+        return Cursor;
+    }
+
+    FORCEINLINE const char* ParseInt(const char* Cursor, const char* End, int64& OutValue)
+    {
+        bool bNegative = false;
+        if (Cursor < End && (*Cursor == '-' || *Cursor == '+'))
+        {
+            bNegative = *Cursor == '-';
+            ++Cursor;
+        }
+
+        int64 Value = 0;
+        while (Cursor < End && IsDigit(*Cursor))
+        {
+            Value = Value * 10 + (*Cursor - '0');
+            ++Cursor;
+        }
+
+        OutValue = bNegative ? -Value : Value;
+        return Cursor;
+    }
+
+    /**
+     * OBJ 인덱스(1부터 시작, 음수는 현재까지의 개수 기준 상대 인덱스)를 0부터 시작하는 인덱스로 변환합니다.
+     */
+    FORCEINLINE uint32 ResolveObjIndex(int64 RawIndex, uint32 ElementCount)
+    {
+        if (RawIndex < 0)
+        {
+            return static_cast<uint32>(static_cast<int64>(ElementCount) + RawIndex);
+        }
+        return static_cast<uint32>(RawIndex - 1);
+    }
+
+    // 파일(또는 청크)에 들어있는 요소별 줄 수
+    struct FObjLineCounts
+    {
+        uint32 NumVertices = 0;
+        uint32 NumNormals = 0;
+        uint32 NumUVs = 0;
+        uint32 NumFaces = 0;
+    };
+
+    // 면 하나를 구성하는 정점 토큰 "v", "v/vt", "v//vn", "v/vt/vn"
+    struct FObjFaceCorner
+    {
+        uint32 VertexIndex;
+        uint32 UVIndex;
+        uint32 NormalIndex;
+    };
+
+    /**
+     * @param NumParsed 이 면 이전까지 파싱된 요소의 개수, 음수 인덱스를 변환할 때 사용합니다.
+     */
+    const char* ParseFaceCorner(const char* Cursor, const char* End, const FObjLineCounts& NumParsed, FObjFaceCorner& OutCorner)
+    {
+        OutCorner.VertexIndex = 0;
+        OutCorner.UVIndex = UINT32_MAX;
+        OutCorner.NormalIndex = UINT32_MAX;
+
+        int64 RawIndex;
+        if (Cursor < End && *Cursor != '/')
+        {
+            Cursor = ParseInt(Cursor, End, RawIndex);
+            OutCorner.VertexIndex = ResolveObjIndex(RawIndex, NumParsed.NumVertices);
+        }
+
+        if (Cursor < End && *Cursor == '/')
+        {
+            ++Cursor;
+            if (Cursor < End && *Cursor != '/' && !IsSpace(*Cursor))
+            {
+                Cursor = ParseInt(Cursor, End, RawIndex);
+                OutCorner.UVIndex = ResolveObjIndex(RawIndex, NumParsed.NumUVs);
+            }
+
+            if (Cursor < End && *Cursor == '/')
+            {
+                ++Cursor;
+                if (Cursor < End && !IsSpace(*Cursor))
+                {
+                    Cursor = ParseInt(Cursor, End, RawIndex);
+                    OutCorner.NormalIndex = ResolveObjIndex(RawIndex, NumParsed.NumNormals);
+                }
+            }
+        }
+
+        // 인식하지 못한 나머지 문자는 무시
+        while (Cursor < End && !IsSpace(*Cursor))
+        {
+            ++Cursor;
+        }
+        return Cursor;
+    }
+
+    FORCEINLINE void AddFaceTriangle(FObjInfo& OutObjInfo, const FObjFaceCorner& A, const FObjFaceCorner& B, const FObjFaceCorner& C)
+    {
+        OutObjInfo.VertexIndices.Add(A.VertexIndex);
+        OutObjInfo.VertexIndices.Add(B.VertexIndex);
+        OutObjInfo.VertexIndices.Add(C.VertexIndex);
+
+        OutObjInfo.UVIndices.Add(A.UVIndex);
+        OutObjInfo.UVIndices.Add(B.UVIndex);
+        OutObjInfo.UVIndices.Add(C.UVIndex);
+
+        OutObjInfo.NormalIndices.Add(A.NormalIndex);
+        OutObjInfo.NormalIndices.Add(B.NormalIndex);
+        OutObjInfo.NormalIndices.Add(C.NormalIndex);
+    }
+
+    /**
+     * 미리 Reserve할 수 있도록 각 요소의 줄 수를 셉니다.
+     * 청크별 음수 인덱스의 기준으로도 쓰이므로, 줄 앞 공백과 토큰은 ParseObjLines와 똑같이 읽어야 합니다.
+     */
+    FObjLineCounts CountObjLines(const char* Cursor, const char* End)
+    {
+        FObjLineCounts Counts;
+        while (Cursor < End)
+        {
+            const char* LineEnd = FindLineEnd(Cursor, End);
+            Cursor = SkipSpaces(Cursor, LineEnd);
+
+            if (Cursor < LineEnd && *Cursor != '#')
+            {
+                const std::string_view Token = ReadWord(Cursor, LineEnd);
+                Counts.NumVertices += Token == "v";
+                Counts.NumNormals += Token == "vn";
+                Counts.NumUVs += Token == "vt";
+                Counts.NumFaces += Token == "f";
+            }
+            Cursor = LineEnd + 1;
+        }
+        return Counts;
+    }
+
+    // ConvertToStaticMesh에서 (v, vt, vn, 머티리얼) 조합이 같은 정점을 하나로 합칠 때 쓰는 키
+    struct FVertexWeldKey
+    {
+        uint32 VertexIndex;
+        uint32 UVIndex;
+        uint32 NormalIndex;
+        uint32 MaterialIndex;
+
+        bool operator==(const FVertexWeldKey& Other) const
+        {
+            return VertexIndex == Other.VertexIndex && UVIndex == Other.UVIndex
+                && NormalIndex == Other.NormalIndex && MaterialIndex == Other.MaterialIndex;
+        }
+    };
+
+    /**
+     * FVertexWeldKey -> 정점 인덱스의 선형 탐사(open addressing) 해시 맵
+     * 삽입만 하고 삭제는 하지 않으므로 톰스톤이 필요 없습니다.
+     */
+    class FVertexWeldMap
+    {
+    public:
+        explicit FVertexWeldMap(int32 ExpectedNum)
+        {
+            // 부하율 0.5 이하를 유지하도록 2의 거듭제곱으로 맞춤
+            uint32 Capacity = 16;
+            while (Capacity < static_cast<uint32>(ExpectedNum) * 2)
+            {
+                Capacity <<= 1;
+            }
+            Slots.SetNum(static_cast<int32>(Capacity));
+            for (FSlot& Slot : Slots)
+            {
+                Slot.Value = EmptyValue;
+            }
+        }
+
+        /** Key가 없으면 NewValue로 추가하고, 저장된 값의 참조를 반환합니다. */
+        uint32& FindOrAdd(const FVertexWeldKey& Key, uint32 NewValue)
+        {
+            if ((NumElements + 1) * 2 > static_cast<uint32>(Slots.Num()))
+            {
+                Grow();
+            }
+
+            const uint32 Mask = Slots.Num() - 1;
+            for (uint32 SlotIndex = Hash(Key) & Mask; ; SlotIndex = (SlotIndex + 1) & Mask)
+            {
+                FSlot& Slot = Slots[static_cast<int32>(SlotIndex)];
+                if (Slot.Value == EmptyValue)
+                {
+                    Slot.Key = Key;
+                    Slot.Value = NewValue;
+                    ++NumElements;
+                    return Slot.Value;
+                }
+                if (Slot.Key == Key)
+                {
+                    return Slot.Value;
+                }
+            }
+        }
+
+    private:
+        struct FSlot
+        {
+            FVertexWeldKey Key;
+            uint32 Value;
+        };
+
+        static constexpr uint32 EmptyValue = UINT32_MAX;
+
+        static uint32 Hash(const FVertexWeldKey& Key)
+        {
+            uint64 H = (static_cast<uint64>(Key.VertexIndex) << 32 | Key.UVIndex) * 0x9E3779B97F4A7C15ull;
+            H ^= (static_cast<uint64>(Key.NormalIndex) << 32 | Key.MaterialIndex) * 0xC2B2AE3D27D4EB4Full;
+            H ^= H >> 29;
+            H *= 0xBF58476D1CE4E5B9ull;
+            H ^= H >> 32;
+            return static_cast<uint32>(H);
+        }
+
+        void Grow()
+        {
+            TArray<FSlot> OldSlots = std::move(Slots);
+            Slots = TArray<FSlot>();
+            Slots.SetNum(OldSlots.Num() * 2);
+            for (FSlot& Slot : Slots)
+            {
+                Slot.Value = EmptyValue;
+            }
+
+            const uint32 Mask = Slots.Num() - 1;
+            for (const FSlot& OldSlot : OldSlots)
+            {
+                if (OldSlot.Value == EmptyValue)
+                {
+                    continue;
+                }
+                uint32 SlotIndex = Hash(OldSlot.Key) & Mask;
+                while (Slots[static_cast<int32>(SlotIndex)].Value != EmptyValue)
+                {
+                    SlotIndex = (SlotIndex + 1) & Mask;
+                }
+                Slots[static_cast<int32>(SlotIndex)] = OldSlot;
+            }
+        }
+
+    private:
+        TArray<FSlot> Slots;
+        uint32 NumElements = 0;
+    };
+
+    void ReserveObjInfo(FObjInfo& OutObjInfo, const FObjLineCounts& Counts)
+    {
+        // 쿼드가 섞여 있으면 인덱스 배열은 한 번 더 늘어날 수 있음
+        OutObjInfo.Vertices.Reserve(OutObjInfo.Vertices.Num() + Counts.NumVertices);
+        OutObjInfo.Normals.Reserve(OutObjInfo.Normals.Num() + Counts.NumNormals);
+        OutObjInfo.UVs.Reserve(OutObjInfo.UVs.Num() + Counts.NumUVs);
+        OutObjInfo.VertexIndices.Reserve(OutObjInfo.VertexIndices.Num() + Counts.NumFaces * 3);
+        OutObjInfo.UVIndices.Reserve(OutObjInfo.UVIndices.Num() + Counts.NumFaces * 3);
+        OutObjInfo.NormalIndices.Reserve(OutObjInfo.NormalIndices.Num() + Counts.NumFaces * 3);
+    }
+
+    template <typename T>
+    void AppendArray(TArray<T>& Dest, const TArray<T>& Source)
+    {
+        const int32 Offset = Dest.AddUninitialized(Source.Num());
+        std::copy(Source.begin(), Source.end(), Dest.begin() + Offset);
+    }
+
+    /**
+     * [Cursor, End) 범위의 OBJ 줄을 파싱해서 OutObjInfo 뒤에 추가합니다.
+     * 마지막 머티리얼 서브셋의 IndexCount는 호출한 쪽에서 채워야 합니다.
+     * @param BaseCounts 이 범위 앞에 있지만 OutObjInfo에는 들어있지 않은 요소의 개수, 청크 단위로 파싱할 때 사용합니다.
+     */
+    void ParseObjLines(const char* Cursor, const char* End, const FObjLineCounts& BaseCounts, FObjInfo& OutObjInfo)
+    {
+        while (Cursor < End)
+        {
+            const char* LineEnd = FindLineEnd(Cursor, End);
+            Cursor = SkipSpaces(Cursor, LineEnd);
+
+            if (Cursor == LineEnd || *Cursor == '#')
+            {
+                Cursor = LineEnd + 1;
+                continue;
+            }
+
+            const std::string_view Token = ReadWord(Cursor, LineEnd);
+
+            if (Token == "v") // Vertex
+            {
+                float X, Y, Z;
+                Cursor = ParseFloat(Cursor, LineEnd, X);
+                Cursor = ParseFloat(Cursor, LineEnd, Y);
+                Cursor = ParseFloat(Cursor, LineEnd, Z);
+                OutObjInfo.Vertices.Add(FVector(X, Y * -1.f, Z));
+            }
+            else if (Token == "vn") // Normal
+            {
+                float NormalX, NormalY, NormalZ;
+                Cursor = ParseFloat(Cursor, LineEnd, NormalX);
+                Cursor = ParseFloat(Cursor, LineEnd, NormalY);
+                Cursor = ParseFloat(Cursor, LineEnd, NormalZ);
+                OutObjInfo.Normals.Add(FVector(NormalX, NormalY * -1, NormalZ));
+            }
+            else if (Token == "vt") // Texture
+            {
+                float U, V;
+                Cursor = ParseFloat(Cursor, LineEnd, U);
+                Cursor = ParseFloat(Cursor, LineEnd, V);
+                OutObjInfo.UVs.Add(FVector2D(U, 1.f - V));
+            }
+            else if (Token == "f")
+            {
+                // 삼각형과 쿼드만 지원, 그 외의 다각형은 기존 파서와 동일하게 무시
+                FObjFaceCorner Corners[4];
+                int32 NumCorners = 0;
+
+                FObjLineCounts NumParsed;
+                NumParsed.NumVertices = BaseCounts.NumVertices + OutObjInfo.Vertices.Num();
+                NumParsed.NumNormals = BaseCounts.NumNormals + OutObjInfo.Normals.Num();
+                NumParsed.NumUVs = BaseCounts.NumUVs + OutObjInfo.UVs.Num();
+
+                while (true)
+                {
+                    Cursor = SkipSpaces(Cursor, LineEnd);
+                    if (Cursor == LineEnd)
+                    {
+                        break;
+                    }
+
+                    FObjFaceCorner Corner;
+                    Cursor = ParseFaceCorner(Cursor, LineEnd, NumParsed, Corner);
+                    if (NumCorners < 4)
+                    {
+                        Corners[NumCorners] = Corner;
+                    }
+                    ++NumCorners;
+                }
+
+                // 반시계 방향(오른손 좌표계)을 시계 방향(왼손 좌표계)으로 변환: 0-2-1
+                if (NumCorners == 3)
+                {
+                    AddFaceTriangle(OutObjInfo, Corners[0], Corners[2], Corners[1]);
+                }
+                else if (NumCorners == 4)
+                {
+                    AddFaceTriangle(OutObjInfo, Corners[0], Corners[2], Corners[1]);
+                    AddFaceTriangle(OutObjInfo, Corners[0], Corners[3], Corners[2]);
+                }
+            }
+            else if (Token == "usemtl")
+            {
+                const std::string_view Name = ReadWord(Cursor, LineEnd);
+
+                if (!OutObjInfo.MaterialSubsets.IsEmpty())
+                {
+                    FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+                    LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+                }
+
+                FMaterialSubset MaterialSubset;
+                MaterialSubset.MaterialName = std::string(Name.empty() ? Token : Name);
+                MaterialSubset.IndexStart = OutObjInfo.VertexIndices.Num();
+                MaterialSubset.IndexCount = 0;
+                OutObjInfo.MaterialSubsets.Add(MaterialSubset);
+            }
+            else if (Token == "mtllib")
+            {
+                const std::string_view Name = ReadWord(Cursor, LineEnd);
+                OutObjInfo.MatName = std::string(Name.empty() ? Token : Name);
+            }
+            else if (Token == "g" || Token == "o")
+            {
+                const std::string_view Name = ReadWord(Cursor, LineEnd);
+                OutObjInfo.GroupName.Add(std::string(Name.empty() ? Token : Name));
+                OutObjInfo.NumOfGroup++;
+            }
+
+            Cursor = LineEnd + 1;
+        }
+    }
+
+    // 비동기 로드가 끝나기 전까지 대신 그릴, 머티리얼이 없는 한 변이 2인 큐브
+    void BuildPlaceholderRenderData(OBJ::FStaticMeshRenderData& OutStaticMesh)
+    {
+        OutStaticMesh.ObjectName = L"Placeholder";
+        OutStaticMesh.DisplayName = "Placeholder";
+
+        const FVector Normals[6] = {
+            FVector(1.f, 0.f, 0.f), FVector(-1.f, 0.f, 0.f),
+            FVector(0.f, 1.f, 0.f), FVector(0.f, -1.f, 0.f),
+            FVector(0.f, 0.f, 1.f), FVector(0.f, 0.f, -1.f),
+        };
+        const FVector Tangents[6] = {
+            FVector(0.f, 1.f, 0.f), FVector(0.f, -1.f, 0.f),
+            FVector(-1.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f),
+            FVector(1.f, 0.f, 0.f), FVector(1.f, 0.f, 0.f),
+        };
+        constexpr float CornerSigns[4][2] = { { -1.f, -1.f }, { 1.f, -1.f }, { 1.f, 1.f }, { -1.f, 1.f } };
+
+        OutStaticMesh.Vertices.Reserve(24);
+        OutStaticMesh.Indices.Reserve(36);
+        for (int32 Face = 0; Face < 6; ++Face)
+        {
+            const FVector& Normal = Normals[Face];
+            const FVector& Tangent = Tangents[Face];
+            const FVector Bitangent = FVector::CrossProduct(Normal, Tangent);
+
+            // OBJ 로더와 같이 (B - A) x (C - A)가 바깥을 향하는 순서
+            const uint32 BaseIndex = static_cast<uint32>(OutStaticMesh.Vertices.Num());
+            for (const float* Signs : CornerSigns)
+            {
+                const FVector Position = Normal + Tangent * Signs[0] + Bitangent * Signs[1];
+
+                FStaticMeshVertex Vertex;
+                Vertex.X = Position.X;
+                Vertex.Y = Position.Y;
+                Vertex.Z = Position.Z;
+                Vertex.NormalX = Normal.X;
+                Vertex.NormalY = Normal.Y;
+                Vertex.NormalZ = Normal.Z;
+                Vertex.TangentX = Tangent.X;
+                Vertex.TangentY = Tangent.Y;
+                Vertex.TangentZ = Tangent.Z;
+                Vertex.U = (Signs[0] + 1.f) * 0.5f;
+                Vertex.V = (1.f - Signs[1]) * 0.5f;
+                Vertex.R = Vertex.G = Vertex.B = Vertex.A = 1.f;
+                Vertex.MaterialIndex = 0;
+                OutStaticMesh.Vertices.Add(Vertex);
+            }
+
+            const uint32 FaceIndices[6] = { 0, 1, 2, 0, 2, 3 };
+            for (const uint32 Index : FaceIndices)
+            {
+                OutStaticMesh.Indices.Add(BaseIndex + Index);
+            }
+        }
+
+        FLoaderOBJ::ComputeBoundingBox(OutStaticMesh.Vertices, OutStaticMesh.BoundingBoxMin, OutStaticMesh.BoundingBoxMax);
+    }
+}
 
 bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
 {
-    std::ifstream OBJ(ObjFilePath.ToWideString());
-    if (!OBJ)
+    switch (ParseMode)
     {
-        return false;
+    case EObjParseMode::Stream:
+        return ParseOBJStream(ObjFilePath, OutObjInfo);
+    case EObjParseMode::MemoryMapped:
+        return ParseOBJMapped(ObjFilePath, OutObjInfo);
+    case EObjParseMode::Parallel:
+    default:
+        return ParseOBJParallel(ObjFilePath, OutObjInfo);
     }
+}
 
+void FLoaderOBJ::SetupObjInfoPath(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
     OutObjInfo.FilePath = ObjFilePath.ToWideString().substr(0, ObjFilePath.ToWideString().find_last_of(L"\\/") + 1);
     OutObjInfo.ObjectName = ObjFilePath.ToWideString();
     // ObjectName은 wstring 타입이므로, 이를 string으로 변환 (간단한 ASCII 변환의 경우)
@@ -31,6 +634,17 @@ bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
     {
         OutObjInfo.DisplayName = fileName;
     }
+}
+
+bool FLoaderOBJ::ParseOBJStream(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
+    std::ifstream OBJ(ObjFilePath.ToWideString());
+    if (!OBJ)
+    {
+        return false;
+    }
+
+    SetupObjInfoPath(ObjFilePath, OutObjInfo);
 
     /**
      * 블렌더 Export 설정
@@ -182,30 +796,174 @@ bool FLoaderOBJ::ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo)
                 OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
                 OutObjInfo.UVIndices.Add(FaceUVIndices[1]);
 
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[1]);
+
+                // 두 번째 삼각형: 0-3-2
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
+                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+
+                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
+                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
+                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
+                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
+            }
+        }
+    }
+
+    if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    {
+        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+    }
+
+    return true;
+}
+
+bool FLoaderOBJ::ParseOBJMapped(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
+    FMemoryMappedFile MappedFile;
+    if (!MappedFile.Open(ObjFilePath.ToWideString()))
+    {
+        return false;
+    }
+
+    SetupObjInfoPath(ObjFilePath, OutObjInfo);
+
+    return ParseOBJBuffer(reinterpret_cast<const char*>(MappedFile.GetData()), MappedFile.GetSize(), OutObjInfo);
+}
+
+bool FLoaderOBJ::ParseOBJParallel(const FString& ObjFilePath, FObjInfo& OutObjInfo)
+{
+    FMemoryMappedFile MappedFile;
+    if (!MappedFile.Open(ObjFilePath.ToWideString()))
+    {
+        return false;
+    }
+
+    SetupObjInfoPath(ObjFilePath, OutObjInfo);
+
+    return ParseOBJBufferParallel(reinterpret_cast<const char*>(MappedFile.GetData()), MappedFile.GetSize(), OutObjInfo);
+}
+
+bool FLoaderOBJ::ParseOBJBuffer(const char* Data, uint64 Size, FObjInfo& OutObjInfo)
+{
+    const char* Cursor = Data;
+    const char* const End = Data + Size;
+
+    ReserveObjInfo(OutObjInfo, CountObjLines(Cursor, End));
+
+    ParseObjLines(Cursor, End, FObjLineCounts(), OutObjInfo);
+
+    if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    {
+        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
+        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+    }
+
+    return true;
+}
+
+bool FLoaderOBJ::ParseOBJBufferParallel(const char* Data, uint64 Size, FObjInfo& OutObjInfo)
+{
+    const uint64 MaxChunks = FQueuedThreadPool::Get().GetNumThreads() + 1;
+    const int32 NumChunks = static_cast<int32>(std::min(MaxChunks, Size / MinParallelChunkBytes));
+    if (NumChunks <= 1)
+    {
+        return ParseOBJBuffer(Data, Size, OutObjInfo);
+    }
+
+    const char* const End = Data + Size;
+
+    // 1. 줄 경계에서 청크 분할
+    TArray<const char*> ChunkBounds;
+    ChunkBounds.SetNum(NumChunks + 1);
+    ChunkBounds[0] = Data;
+    for (int32 ChunkIndex = 1; ChunkIndex < NumChunks; ++ChunkIndex)
+    {
+        const char* Split = std::max(Data + Size * ChunkIndex / NumChunks, ChunkBounds[ChunkIndex - 1]);
+        Split = FindLineEnd(Split, End);
+        ChunkBounds[ChunkIndex] = Split < End ? Split + 1 : End;
+    }
+    ChunkBounds[NumChunks] = End;
+
+    // 2. 청크별 요소 개수를 세고, 각 청크 앞에 오는 요소의 개수(음수 인덱스의 기준)를 계산
+    TArray<FObjLineCounts> ChunkCounts;
+    ChunkCounts.SetNum(NumChunks);
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        ChunkCounts[ChunkIndex] = CountObjLines(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1]);
+    });
+
+    TArray<FObjLineCounts> ChunkBases;
+    ChunkBases.SetNum(NumChunks);
+    FObjLineCounts TotalCounts;
+    TotalCounts.NumVertices = OutObjInfo.Vertices.Num();
+    TotalCounts.NumNormals = OutObjInfo.Normals.Num();
+    TotalCounts.NumUVs = OutObjInfo.UVs.Num();
+    for (int32 ChunkIndex = 0; ChunkIndex < NumChunks; ++ChunkIndex)
+    {
+        ChunkBases[ChunkIndex] = TotalCounts;
+        TotalCounts.NumVertices += ChunkCounts[ChunkIndex].NumVertices;
+        TotalCounts.NumNormals += ChunkCounts[ChunkIndex].NumNormals;
+        TotalCounts.NumUVs += ChunkCounts[ChunkIndex].NumUVs;
+        TotalCounts.NumFaces += ChunkCounts[ChunkIndex].NumFaces;
+    }
+
+    // 3. 청크 파싱, 면 인덱스는 이미 전역 인덱스로 변환됨
+    TArray<FObjInfo> ChunkInfos;
+    ChunkInfos.SetNum(NumChunks);
+    ParallelFor(NumChunks, [&](int32 ChunkIndex)
+    {
+        ReserveObjInfo(ChunkInfos[ChunkIndex], ChunkCounts[ChunkIndex]);
+        ParseObjLines(ChunkBounds[ChunkIndex], ChunkBounds[ChunkIndex + 1], ChunkBases[ChunkIndex], ChunkInfos[ChunkIndex]);
+    });
+
+    // 4. 파일 순서대로 병합
+    // 서브셋은 다음 usemtl이 나올 때까지 이어지므로, IndexCount는 병합이 끝난 뒤 다시 계산
+    const int32 FirstOpenSubset = std::max(OutObjInfo.MaterialSubsets.Num() - 1, 0);
+    ReserveObjInfo(OutObjInfo, TotalCounts);
+    for (FObjInfo& ChunkInfo : ChunkInfos)
+    {
+        const uint32 IndexOffset = OutObjInfo.VertexIndices.Num();
+
+        AppendArray(OutObjInfo.Vertices, ChunkInfo.Vertices);
+        AppendArray(OutObjInfo.Normals, ChunkInfo.Normals);
+        AppendArray(OutObjInfo.UVs, ChunkInfo.UVs);
+        AppendArray(OutObjInfo.VertexIndices, ChunkInfo.VertexIndices);
+        AppendArray(OutObjInfo.UVIndices, ChunkInfo.UVIndices);
+        AppendArray(OutObjInfo.NormalIndices, ChunkInfo.NormalIndices);
 
-                // 두 번째 삼각형: 0-3-2
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[0]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[3]);
-                OutObjInfo.VertexIndices.Add(FaceVertexIndices[2]);
+        for (FMaterialSubset& Subset : ChunkInfo.MaterialSubsets)
+        {
+            Subset.IndexStart += IndexOffset;
+            OutObjInfo.MaterialSubsets.Add(std::move(Subset));
+        }
 
-                OutObjInfo.UVIndices.Add(FaceUVIndices[0]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[3]);
-                OutObjInfo.UVIndices.Add(FaceUVIndices[2]);
+        for (FString& Name : ChunkInfo.GroupName)
+        {
+            OutObjInfo.GroupName.Add(std::move(Name));
+        }
+        OutObjInfo.NumOfGroup += ChunkInfo.NumOfGroup;
 
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[0]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[3]);
-                OutObjInfo.NormalIndices.Add(FaceNormalIndices[2]);
-            }
+        if (!ChunkInfo.MatName.IsEmpty())
+        {
+            OutObjInfo.MatName = std::move(ChunkInfo.MatName);
         }
     }
 
-    if (!OutObjInfo.MaterialSubsets.IsEmpty())
+    for (int32 SubsetIndex = FirstOpenSubset; SubsetIndex < OutObjInfo.MaterialSubsets.Num(); ++SubsetIndex)
     {
-        FMaterialSubset& LastSubset = OutObjInfo.MaterialSubsets[OutObjInfo.MaterialSubsets.Num() - 1];
-        LastSubset.IndexCount = OutObjInfo.VertexIndices.Num() - LastSubset.IndexStart;
+        FMaterialSubset& Subset = OutObjInfo.MaterialSubsets[SubsetIndex];
+        const uint32 IndexEnd = SubsetIndex + 1 < OutObjInfo.MaterialSubsets.Num()
+            ? OutObjInfo.MaterialSubsets[SubsetIndex + 1].IndexStart
+            : OutObjInfo.VertexIndices.Num();
+        Subset.IndexCount = IndexEnd - Subset.IndexStart;
     }
 
     return true;
@@ -310,8 +1068,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].DiffuseTextureName.ToWideString();
             OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath = TexturePath;
             OutFStaticMesh.Materials[MaterialIndex].bHasTexture = true;
-
-            CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].DiffuseTexturePath);
         }
 
         if (Token == "map_Bump" || Token == "map_bump")
@@ -345,8 +1101,6 @@ bool FLoaderOBJ::ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData&
             FWString TexturePath = OutObjInfo.FilePath + OutFStaticMesh.Materials[MaterialIndex].BumpTextureName.ToWideString();
             OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath = TexturePath;
             OutFStaticMesh.Materials[MaterialIndex].bHasNormalMap = true;
-
-            CreateTextureFromFile(OutFStaticMesh.Materials[MaterialIndex].BumpTexturePath);
         }
     }
 
@@ -359,41 +1113,43 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
     //OutStaticMesh.PathName = RawData.PathName;
     OutStaticMesh.DisplayName = RawData.DisplayName;
 
-    // 고유 정점을 기반으로 FVertexSimple 배열 생성
-    TMap<std::string, uint32> IndexMap; // 중복 체크용
-
     struct FTempTangent {
         FVector TangentSum = FVector();
         int32 Count = 0;
     };
     TArray<FTempTangent> TempTangents; // 정점 인덱스별 임시 데이터
 
-    // 인덱스 → MaterialIndex 매핑 생성
-    TMap<uint32, uint32> IndexToMaterialMap;
-    for (const FMaterialSubset& Subset : RawData.MaterialSubsets) {
-        for (uint32 i = Subset.IndexStart; i < Subset.IndexStart + Subset.IndexCount; ++i) {
-            IndexToMaterialMap.Add(i, Subset.MaterialIndex);
-        }
-    }
-
-    for (int32 i = 0; i < RawData.VertexIndices.Num(); i++)
-    {
-        const uint32 VertexIndex = RawData.VertexIndices[i];
-        const uint32 UVIndex = RawData.UVIndices[i];
-        const uint32 NormalIndex = RawData.NormalIndices[i];
-        const uint32* MaterialPtr = IndexToMaterialMap.Find(i);
-        const uint32 MaterialIndex = MaterialPtr ? *MaterialPtr : 0;
+    // 고유 정점을 기반으로 FStaticMeshVertex 배열 생성
+    const int32 NumCorners = RawData.VertexIndices.Num();
+    FVertexWeldMap WeldMap(NumCorners / 2); // 중복 체크용
+    OutStaticMesh.Indices.Reserve(NumCorners);
 
-        // 키 생성 (v/vt/vn/materialIndex 조합)
-        std::string Key = std::to_string(VertexIndex) + "/" + std::to_string(UVIndex) + "/" + std::to_string(NormalIndex) + "/" + std::to_string(MaterialIndex);
+    // 서브셋은 IndexStart 순서로 정렬되어 있으므로, 인덱스를 따라가며 현재 서브셋을 찾음
+    const TArray<FMaterialSubset>& Subsets = OutStaticMesh.MaterialSubsets;
+    int32 SubsetCursor = 0;
 
-        uint32 FinalIndex;
-        if (IndexMap.Contains(Key))
+    for (int32 i = 0; i < NumCorners; i++)
+    {
+        while (SubsetCursor < Subsets.Num() && i >= static_cast<int32>(Subsets[SubsetCursor].IndexStart + Subsets[SubsetCursor].IndexCount))
         {
-            FinalIndex = IndexMap[Key];
+            ++SubsetCursor;
         }
-        else
+        const bool bInSubset = SubsetCursor < Subsets.Num() && i >= static_cast<int32>(Subsets[SubsetCursor].IndexStart);
+
+        // 키 (v/vt/vn/materialIndex 조합)
+        FVertexWeldKey Key;
+        Key.VertexIndex = RawData.VertexIndices[i];
+        Key.UVIndex = RawData.UVIndices[i];
+        Key.NormalIndex = RawData.NormalIndices[i];
+        Key.MaterialIndex = bInSubset ? Subsets[SubsetCursor].MaterialIndex : 0;
+
+        uint32& FinalIndex = WeldMap.FindOrAdd(Key, OutStaticMesh.Vertices.Num());
+        if (FinalIndex == static_cast<uint32>(OutStaticMesh.Vertices.Num()))
         {
+            const uint32 VertexIndex = Key.VertexIndex;
+            const uint32 UVIndex = Key.UVIndex;
+            const uint32 NormalIndex = Key.NormalIndex;
+
             FStaticMeshVertex StaticMeshVertex = {};
             StaticMeshVertex.X = RawData.Vertices[VertexIndex].X;
             StaticMeshVertex.Y = RawData.Vertices[VertexIndex].Y;
@@ -414,19 +1170,9 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
                 StaticMeshVertex.NormalZ = RawData.Normals[NormalIndex].Z;
             }
 
-            for (int32 j = 0; j < OutStaticMesh.MaterialSubsets.Num(); j++)
-            {
-                const FMaterialSubset& Subset = OutStaticMesh.MaterialSubsets[j];
-                if ( i >= Subset.IndexStart && i < Subset.IndexStart + Subset.IndexCount)
-                {
-                    StaticMeshVertex.MaterialIndex = Subset.MaterialIndex;
-                    break;
-                }
-            }
+            StaticMeshVertex.MaterialIndex = Key.MaterialIndex;
 
-            FinalIndex = OutStaticMesh.Vertices.Num();
             OutStaticMesh.Vertices.Add(StaticMeshVertex);
-            IndexMap[Key] = FinalIndex;
         }
 
         OutStaticMesh.Indices.Add(FinalIndex);
@@ -434,16 +1180,29 @@ bool FLoaderOBJ::ConvertToStaticMesh(const FObjInfo& RawData, OBJ::FStaticMeshRe
 
     TempTangents.SetNum(OutStaticMesh.Vertices.Num());
     const int32 TriangleCount = OutStaticMesh.Indices.Num() / 3;
+
+    // 삼각형별 탄젠트는 병렬로 계산하고, 누적은 삼각형 순서대로 해서 결과가 스레드 수와 무관하게 같도록 함
+    TArray<FVector> TriangleTangents;
+    TriangleTangents.SetNum(TriangleCount);
+    constexpr int32 TrianglesPerTask = 4096;
+    ParallelFor((TriangleCount + TrianglesPerTask - 1) / TrianglesPerTask, [&](int32 TaskIndex)
+    {
+        const int32 TriEnd = std::min(TriangleCount, (TaskIndex + 1) * TrianglesPerTask);
+        for (int32 TriIdx = TaskIndex * TrianglesPerTask; TriIdx < TriEnd; ++TriIdx)
+        {
+            FStaticMeshVertex& V0 = OutStaticMesh.Vertices[OutStaticMesh.Indices[TriIdx * 3]];
+            const FStaticMeshVertex& V1 = OutStaticMesh.Vertices[OutStaticMesh.Indices[TriIdx * 3 + 1]];
+            const FStaticMeshVertex& V2 = OutStaticMesh.Vertices[OutStaticMesh.Indices[TriIdx * 3 + 2]];
+            TriangleTangents[TriIdx] = CalculateTangent(V0, V1, V2);
+        }
+    });
+
     for (int32 TriIdx = 0; TriIdx < TriangleCount; ++TriIdx) {
         const uint32 Idx0 = OutStaticMesh.Indices[TriIdx * 3];
         const uint32 Idx1 = OutStaticMesh.Indices[TriIdx * 3 + 1];
         const uint32 Idx2 = OutStaticMesh.Indices[TriIdx * 3 + 2];
 
-        FStaticMeshVertex& V0 = OutStaticMesh.Vertices[Idx0];
-        FStaticMeshVertex& V1 = OutStaticMesh.Vertices[Idx1];
-        FStaticMeshVertex& V2 = OutStaticMesh.Vertices[Idx2];
-
-        const FVector Tangent = CalculateTangent(V0, V1, V2);
+        const FVector& Tangent = TriangleTangents[TriIdx];
 
         // 탄젠트 누적
         TempTangents[Idx0].TangentSum += Tangent;
@@ -564,63 +1323,198 @@ FVector FLoaderOBJ::CalculateTangent(FStaticMeshVertex& PivotVertex, const FStat
 
 OBJ::FStaticMeshRenderData* FManagerOBJ::LoadObjStaticMeshAsset(const FString& PathFileName)
 {
-    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
-    FEngineLoop::ResourceManager.CreateDefaultSampler(FEngineLoop::GraphicDevice.Device, nullptr, L"NoneTexture");
-
-    if ( const auto It = ObjStaticMeshMap.Find(PathFileName))
+    if (const auto It = ObjStaticMeshMap.Find(PathFileName))
     {
         return *It;
     }
 
-    FWString BinaryPath = (PathFileName + ".bin").ToWideString();
-    if (std::ifstream(BinaryPath).good())
+    // 같은 파일을 워커 스레드에서 로드하고 있으면 다시 빌드하지 않고 그 결과를 기다림
+    if (const FStaticMeshLoadHandle* Pending = AsyncLoadMap.Find(PathFileName))
+    {
+        // 등록되면서 AsyncLoadMap에서 빠지므로 Handle을 복사해서 기다림
+        const FStaticMeshLoadHandle Handle = *Pending;
+        WaitForAsyncLoad(Handle);
+        const auto It = ObjStaticMeshMap.Find(PathFileName);
+        return It ? *It : nullptr;
+    }
+
+    OBJ::FStaticMeshRenderData* NewStaticMesh = new OBJ::FStaticMeshRenderData();
+    if (!BuildStaticMeshRenderData(PathFileName, *NewStaticMesh))
+    {
+        delete NewStaticMesh;
+        return nullptr;
+    }
+
+    RegisterStaticMeshRenderData(PathFileName, NewStaticMesh);
+    return NewStaticMesh;
+}
+
+bool FManagerOBJ::BuildStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData& OutStaticMesh)
+{
+    // 원본과 mtllib, 텍스처의 내용이 쿠킹 이후 그대로면 캐시 사용
+    // 수정 시간은 FCookDatabase가 확인하므로 캐시 헤더의 원본 정보는 비교하지 않음
+    const FWString BinaryPath = (PathFileName + ".bin").ToWideString();
+    if (!FCookDatabase::Get().IsUpToDate(PathFileName, ImporterVersion)
+        || !LoadStaticMeshFromBinary(BinaryPath, FWString(), OutStaticMesh))
     {
-        if (LoadStaticMeshFromBinary(BinaryPath, *NewStaticMesh))
+        // 캐시가 없거나 사용할 수 없으면 OBJ에서 다시 빌드
+        OutStaticMesh = OBJ::FStaticMeshRenderData();
+        if (!CookStaticMesh(PathFileName, OutStaticMesh))
         {
-            ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-            return NewStaticMesh;
+            return false;
         }
     }
 
+    // 피킹용 BVH도 렌더 데이터와 같이 여기서 만들어서, 비동기 로드면 워커 스레드에서 처리되게 함
+    OutStaticMesh.BVH = std::make_shared<FStaticMeshBVH>();
+    OutStaticMesh.BVH->Build(OutStaticMesh.Vertices, OutStaticMesh.Indices);
+    return true;
+}
+
+bool FManagerOBJ::CookStaticMesh(const FString& PathFileName, OBJ::FStaticMeshRenderData& OutStaticMesh, bool* bOutCacheSaved)
+{
+    if (bOutCacheSaved)
+    {
+        *bOutCacheSaved = false;
+    }
+
+    const FWString SourcePath = PathFileName.ToWideString();
+    const FWString BinaryPath = (PathFileName + ".bin").ToWideString();
+
+    // 쿠킹 결과에 영향을 준 파일들, 읽기 전에 해시해서 쿠킹 도중 파일이 바뀌면 다음 검사에서 다시 쿠킹되게 함
+    TArray<FCookDependency> Dependencies;
+    auto AddDependency = [&Dependencies](const FWString& DependencyPath)
+    {
+        for (const FCookDependency& Dependency : Dependencies)
+        {
+            if (Dependency.Path == DependencyPath)
+            {
+                return;
+            }
+        }
+        FCookDatabase::MakeDependency(DependencyPath, Dependencies[Dependencies.Emplace()]);
+    };
+    AddDependency(SourcePath);
+
     // Parse OBJ
     FObjInfo NewObjInfo;
-    bool Result = FLoaderOBJ::ParseOBJ(PathFileName, NewObjInfo);
+    if (!FLoaderOBJ::ParseOBJ(PathFileName, NewObjInfo))
+    {
+        FCookDatabase::Get().Invalidate(PathFileName);
+        return false;
+    }
 
-    if (!Result)
+    if (!NewObjInfo.MatName.IsEmpty())
     {
-        delete NewStaticMesh;
-        return nullptr;
+        AddDependency(NewObjInfo.FilePath + NewObjInfo.MatName.ToWideString());
     }
 
     // Material
     if (NewObjInfo.MaterialSubsets.Num() > 0)
     {
-        Result = FLoaderOBJ::ParseMaterial(NewObjInfo, *NewStaticMesh);
-
-        if (!Result)
+        if (!FLoaderOBJ::ParseMaterial(NewObjInfo, OutStaticMesh))
         {
-            delete NewStaticMesh;
-            return nullptr;
+            FCookDatabase::Get().Invalidate(PathFileName);
+            return false;
         }
 
-        CombineMaterialIndex(*NewStaticMesh);
+        CombineMaterialIndex(OutStaticMesh);
+    }
 
-        for (int materialIndex = 0; materialIndex < NewStaticMesh->Materials.Num(); materialIndex++) {
-            CreateMaterial(NewStaticMesh->Materials[materialIndex]);
+    // 텍스처는 쿠킹 중에 읽지 않고 경로만 저장
+    for (const FObjMaterialInfo& Material : OutStaticMesh.Materials)
+    {
+        for (const FWString* TexturePath : { &Material.DiffuseTexturePath, &Material.AmbientTexturePath, &Material.SpecularTexturePath,
+                                             &Material.BumpTexturePath, &Material.AlphaTexturePath })
+        {
+            if (!TexturePath->empty())
+            {
+                AddDependency(*TexturePath);
+            }
         }
     }
 
     // Convert FStaticMeshRenderData
-    Result = FLoaderOBJ::ConvertToStaticMesh(NewObjInfo, *NewStaticMesh);
-    if (!Result)
+    if (!FLoaderOBJ::ConvertToStaticMesh(NewObjInfo, OutStaticMesh))
     {
-        delete NewStaticMesh;
-        return nullptr;
+        FCookDatabase::Get().Invalidate(PathFileName);
+        return false;
     }
 
-    // SaveStaticMeshToBinary(BinaryPath, *NewStaticMesh); // TODO: refactoring 끝나면 활성화하기
-    ObjStaticMeshMap.Add(PathFileName, NewStaticMesh);
-    return NewStaticMesh;
+    // 캐시 헤더에도 파싱하기 전의 원본 정보를 기록해서, 쿠킹 도중 원본이 바뀌면 캐시가 오래된 것으로 판정되게 함
+    const FCookDependency& Source = Dependencies[0];
+    const uint64 SourceFileSize = Source.IsMissing() ? 0 : Source.FileSize;
+    const int64 SourceWriteTime = Source.IsMissing() ? 0 : Source.WriteTime;
+    if (!SaveStaticMeshToBinary(BinaryPath, SourceFileSize, SourceWriteTime, OutStaticMesh))
+    {
+        FCookDatabase::Get().Invalidate(PathFileName);
+        return true;
+    }
+    if (bOutCacheSaved)
+    {
+        *bOutCacheSaved = true;
+    }
+
+    FCookDatabase::Get().Record(PathFileName, ImporterVersion, Dependencies);
+    return true;
+}
+
+void FManagerOBJ::CookDirectory(const FString& Directory, bool bForce)
+{
+    // 같은 에셋을 비동기 로드와 동시에 쿠킹하면 캐시 파일 쓰기가 겹침
+    FlushAsyncLoads();
+
+    TArray<FString> Paths;
+    std::error_code ErrorCode;
+    for (const auto& Entry : std::filesystem::recursive_directory_iterator(Directory.ToWideString(), ErrorCode))
+    {
+        if (Entry.is_regular_file() && Entry.path().extension() == ".obj")
+        {
+            Paths.Add(Entry.path().string());
+        }
+    }
+    if (ErrorCode)
+    {
+        UE_LOG(LogLevel::Error, "Cook: Cannot open directory %s", *Directory);
+        return;
+    }
+
+    std::atomic<int32> NumCooked = 0;
+    std::atomic<int32> NumSkipped = 0;
+    std::atomic<int32> NumFailed = 0;
+
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    ParallelFor(Paths.Num(), [&](int32 Index)
+    {
+        const FString& Path = Paths[Index];
+        if (!bForce && FCookDatabase::Get().IsUpToDate(Path, ImporterVersion)
+            && FCookedStaticMeshView().Open((Path + ".bin").ToWideString(), FWString()) == ECookedMeshStatus::Valid)
+        {
+            ++NumSkipped;
+            return;
+        }
+
+        OBJ::FStaticMeshRenderData RenderData;
+        bool bCacheSaved = false;
+        if (CookStaticMesh(Path, RenderData, &bCacheSaved) && bCacheSaved)
+        {
+            ++NumCooked;
+        }
+        else
+        {
+            UE_LOG(LogLevel::Error, "Cook: Failed to cook %s", *Path);
+            ++NumFailed;
+        }
+    });
+    const double ElapsedMs = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - StartCycles);
+
+    FCookDatabase::Get().SaveIfDirty();
+
+    UE_LOG(
+        NumFailed == 0 ? LogLevel::Display : LogLevel::Error,
+        "Cook: %s, %d cooked, %d up to date, %d failed, %.3f ms, %u worker threads",
+        *Directory, NumCooked.load(), NumSkipped.load(), NumFailed.load(), ElapsedMs, FQueuedThreadPool::Get().GetNumThreads()
+    );
 }
 
 void FManagerOBJ::CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMesh)
@@ -639,141 +1533,103 @@ void FManagerOBJ::CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMes
     }
 }
 
-bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh)
+bool FManagerOBJ::SaveStaticMeshToBinary(const FWString& FilePath, uint64 SourceFileSize, int64 SourceWriteTime, const OBJ::FStaticMeshRenderData& StaticMesh)
 {
-    std::ofstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    if (!FCookedStaticMesh::Save(FilePath, SourceFileSize, SourceWriteTime, StaticMesh))
     {
-        assert("CAN'T SAVE STATIC MESH BINARY FILE");
+        UE_LOG(LogLevel::Warning, "Failed to save cooked static mesh: %ls", FilePath.c_str());
         return false;
     }
+    return true;
+}
 
-    // Object Name
-    Serializer::WriteFWString(File, StaticMesh.ObjectName);
+bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, const FWString& SourcePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+{
+    const ECookedMeshStatus Status = FCookedStaticMesh::Load(FilePath, SourcePath, OutStaticMesh);
+    if (Status != ECookedMeshStatus::Valid)
+    {
+        if (Status != ECookedMeshStatus::Missing)
+        {
+            UE_LOG(
+                LogLevel::Warning, "Cooked static mesh is %s, rebuilding: %ls",
+                FCookedStaticMesh::GetStatusName(Status), FilePath.c_str()
+            );
+        }
+        return false;
+    }
 
-    // Display Name
-    Serializer::WriteFString(File, StaticMesh.DisplayName);
+    return true;
+}
 
-    // Vertices
-    uint32 VertexCount = StaticMesh.Vertices.Num();
-    File.write(reinterpret_cast<const char*>(&VertexCount), sizeof(VertexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+UMaterial* FManagerOBJ::CreateMaterial(FObjMaterialInfo materialInfo)
+{
+    if (materialMap[materialInfo.MaterialName] != nullptr)
+        return materialMap[materialInfo.MaterialName];
 
-    // Indices
-    uint32 IndexCount = StaticMesh.Indices.Num();
-    File.write(reinterpret_cast<const char*>(&IndexCount), sizeof(IndexCount));
-    File.write(reinterpret_cast<const char*>(StaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+    UMaterial* newMaterial = FObjectFactory::ConstructObject<UMaterial>(nullptr); // Material은 Outer가 없이 따로 관리되는 객체이므로 Outer가 없음으로 설정. 추후 Garbage Collection이 추가되면 AssetManager를 생성해서 관리.
+    newMaterial->SetMaterialInfo(materialInfo);
+    materialMap.Add(materialInfo.MaterialName, newMaterial);
+    return newMaterial;
+}
 
-    // Materials
-    uint32 MaterialCount = StaticMesh.Materials.Num();
-    File.write(reinterpret_cast<const char*>(&MaterialCount), sizeof(MaterialCount));
-    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
-    {
-        Serializer::WriteFString(File, Material.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Material.bHasTexture), sizeof(Material.bHasTexture));
-        File.write(reinterpret_cast<const char*>(&Material.bHasNormalMap), sizeof(Material.bHasNormalMap));
-        File.write(reinterpret_cast<const char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.write(reinterpret_cast<const char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.write(reinterpret_cast<const char*>(&Material.Specular), sizeof(Material.Specular));
-        File.write(reinterpret_cast<const char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.write(reinterpret_cast<const char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.write(reinterpret_cast<const char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.write(reinterpret_cast<const char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.write(reinterpret_cast<const char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.write(reinterpret_cast<const char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-
-        Serializer::WriteFString(File, Material.DiffuseTextureName);
-        Serializer::WriteFWString(File, Material.DiffuseTexturePath);
-        Serializer::WriteFString(File, Material.AmbientTextureName);
-        Serializer::WriteFWString(File, Material.AmbientTexturePath);
-        Serializer::WriteFString(File, Material.SpecularTextureName);
-        Serializer::WriteFWString(File, Material.SpecularTexturePath);
-        Serializer::WriteFString(File, Material.BumpTextureName);
-        Serializer::WriteFWString(File, Material.BumpTexturePath);
-        Serializer::WriteFString(File, Material.AlphaTextureName);
-        Serializer::WriteFWString(File, Material.AlphaTexturePath);
-    }
-
-    // Material Subsets
-    uint32 SubsetCount = StaticMesh.MaterialSubsets.Num();
-    File.write(reinterpret_cast<const char*>(&SubsetCount), sizeof(SubsetCount));
-    for (const FMaterialSubset& Subset : StaticMesh.MaterialSubsets)
-    {
-        Serializer::WriteFString(File, Subset.MaterialName);
-        File.write(reinterpret_cast<const char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.write(reinterpret_cast<const char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.write(reinterpret_cast<const char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
-    }
-
-    // Bounding Box
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.write(reinterpret_cast<const char*>(&StaticMesh.BoundingBoxMax), sizeof(FVector));
-
-    File.close();
-    return true;
+UMaterial* FManagerOBJ::GetMaterial(FString name)
+{
+    return materialMap[name];
 }
 
-bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh)
+UStaticMesh* FManagerOBJ::CreateStaticMesh(const FString& filePath)
 {
-    std::ifstream File(FilePath, std::ios::binary);
-    if (!File.is_open())
+    OBJ::FStaticMeshRenderData* StaticMeshRenderData = FManagerOBJ::LoadObjStaticMeshAsset(filePath);
+
+    if (StaticMeshRenderData == nullptr) return nullptr;
+
+    UStaticMesh* StaticMesh = GetStaticMesh(StaticMeshRenderData->ObjectName);
+    if (StaticMesh != nullptr)
     {
-        assert("CAN'T OPEN STATIC MESH BINARY FILE");
-        return false;
+        return StaticMesh;
     }
 
-    TArray<FWString> Textures;
-
-    // Object Name
-    Serializer::ReadFWString(File, OutStaticMesh.ObjectName);
+    return CreateStaticMeshFromRenderData(StaticMeshRenderData);
+}
 
-    //// Path Name
-    //Serializer::ReadFWString(File, OutStaticMesh.PathName);
+UStaticMesh* FManagerOBJ::GetStaticMesh(FWString name)
+{
+    if (UStaticMesh** Found = StaticMeshMap.Find(name))
+    {
+        return *Found;
+    }
 
-    // Display Name
-    Serializer::ReadFString(File, OutStaticMesh.DisplayName);
+    // 아직 워커 스레드에서 로드 중이면 이 메시만 기다림
+    for (const auto& Pair : AsyncLoadMap)
+    {
+        if (Pair.Key.ToWideString() == name)
+        {
+            // 등록되면서 AsyncLoadMap에서 빠지므로 Handle을 복사해서 기다림
+            const FStaticMeshLoadHandle Handle = Pair.Value;
+            WaitForAsyncLoad(Handle);
+            return Handle->Succeeded() ? Handle->StaticMesh : nullptr;
+        }
+    }
+    return nullptr;
+}
 
-    // Vertices
-    uint32 VertexCount = 0;
-    File.read(reinterpret_cast<char*>(&VertexCount), sizeof(VertexCount));
-    OutStaticMesh.Vertices.SetNum(VertexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Vertices.GetData()), VertexCount * sizeof(FStaticMeshVertex));
+void FManagerOBJ::RegisterStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData)
+{
+    FEngineLoop::ResourceManager.CreateDefaultSampler(FEngineLoop::GraphicDevice.Device, nullptr, L"NoneTexture");
+    LoadMaterialTextures(*RenderData);
 
-    // Indices
-    uint32 IndexCount = 0;
-    File.read(reinterpret_cast<char*>(&IndexCount), sizeof(IndexCount));
-    OutStaticMesh.Indices.SetNum(IndexCount);
-    File.read(reinterpret_cast<char*>(OutStaticMesh.Indices.GetData()), IndexCount * sizeof(UINT));
+    for (int materialIndex = 0; materialIndex < RenderData->Materials.Num(); materialIndex++) {
+        CreateMaterial(RenderData->Materials[materialIndex]);
+    }
 
-    // Material
-    uint32 MaterialCount = 0;
-    File.read(reinterpret_cast<char*>(&MaterialCount), sizeof(MaterialCount));
-    OutStaticMesh.Materials.SetNum(MaterialCount);
-    for (FObjMaterialInfo& Material : OutStaticMesh.Materials)
-    {
-        Serializer::ReadFString(File, Material.MaterialName);
-        File.read(reinterpret_cast<char*>(&Material.bHasTexture), sizeof(Material.bHasTexture));
-        File.read(reinterpret_cast<char*>(&Material.bHasNormalMap), sizeof(Material.bHasNormalMap));
-        File.read(reinterpret_cast<char*>(&Material.bTransparent), sizeof(Material.bTransparent));
-        File.read(reinterpret_cast<char*>(&Material.Diffuse), sizeof(Material.Diffuse));
-        File.read(reinterpret_cast<char*>(&Material.Specular), sizeof(Material.Specular));
-        File.read(reinterpret_cast<char*>(&Material.Ambient), sizeof(Material.Ambient));
-        File.read(reinterpret_cast<char*>(&Material.Emissive), sizeof(Material.Emissive));
-        File.read(reinterpret_cast<char*>(&Material.SpecularScalar), sizeof(Material.SpecularScalar));
-        File.read(reinterpret_cast<char*>(&Material.DensityScalar), sizeof(Material.DensityScalar));
-        File.read(reinterpret_cast<char*>(&Material.TransparencyScalar), sizeof(Material.TransparencyScalar));
-        File.read(reinterpret_cast<char*>(&Material.IlluminanceModel), sizeof(Material.IlluminanceModel));
-        Serializer::ReadFString(File, Material.DiffuseTextureName);
-        Serializer::ReadFWString(File, Material.DiffuseTexturePath);
-        Serializer::ReadFString(File, Material.AmbientTextureName);
-        Serializer::ReadFWString(File, Material.AmbientTexturePath);
-        Serializer::ReadFString(File, Material.SpecularTextureName);
-        Serializer::ReadFWString(File, Material.SpecularTexturePath);
-        Serializer::ReadFString(File, Material.BumpTextureName);
-        Serializer::ReadFWString(File, Material.BumpTexturePath);
-        Serializer::ReadFString(File, Material.AlphaTextureName);
-        Serializer::ReadFWString(File, Material.AlphaTexturePath);
+    ObjStaticMeshMap.Add(PathFileName, RenderData);
+}
 
+void FManagerOBJ::LoadMaterialTextures(const OBJ::FStaticMeshRenderData& StaticMesh)
+{
+    TArray<FWString> Textures;
+    for (const FObjMaterialInfo& Material : StaticMesh.Materials)
+    {
         if (!Material.DiffuseTexturePath.empty())
         {
             Textures.AddUnique(Material.DiffuseTexturePath);
@@ -796,78 +1652,183 @@ bool FManagerOBJ::LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStati
         }
     }
 
-    // Material Subset
-    uint32 SubsetCount = 0;
-    File.read(reinterpret_cast<char*>(&SubsetCount), sizeof(SubsetCount));
-    OutStaticMesh.MaterialSubsets.SetNum(SubsetCount);
-    for (FMaterialSubset& Subset : OutStaticMesh.MaterialSubsets)
+    // Texture Load
+    for (const FWString& Texture : Textures)
     {
-        Serializer::ReadFString(File, Subset.MaterialName);
-        File.read(reinterpret_cast<char*>(&Subset.IndexStart), sizeof(Subset.IndexStart));
-        File.read(reinterpret_cast<char*>(&Subset.IndexCount), sizeof(Subset.IndexCount));
-        File.read(reinterpret_cast<char*>(&Subset.MaterialIndex), sizeof(Subset.MaterialIndex));
+        FLoaderOBJ::CreateTextureFromFile(Texture);
     }
+}
 
-    // Bounding Box
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMin), sizeof(FVector));
-    File.read(reinterpret_cast<char*>(&OutStaticMesh.BoundingBoxMax), sizeof(FVector));
+UStaticMesh* FManagerOBJ::CreateStaticMeshFromRenderData(OBJ::FStaticMeshRenderData* RenderData)
+{
+    UStaticMesh* StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr); // TODO: 추후 AssetManager를 생성해서 관리.
+    StaticMesh->SetData(RenderData);
 
-    File.close();
+    StaticMeshMap.Add(RenderData->ObjectName, StaticMesh); // TODO: 장기적으로 보면 파일 이름 대신 경로를 Key로 사용하는게 좋음.
+    return StaticMesh;
+}
 
-    // Texture Load
-    if (Textures.Num() > 0)
+UStaticMesh* FStaticMeshAsyncLoad::GetStaticMesh() const
+{
+    switch (GetState())
+    {
+    case EAsyncLoadState::Succeeded:
+        return StaticMesh;
+    case EAsyncLoadState::Failed:
+        return nullptr;
+    default:
+        return FManagerOBJ::GetPlaceholderStaticMesh();
+    }
+}
+
+FStaticMeshLoadHandle FManagerOBJ::LoadStaticMeshAsync(const FString& PathFileName, std::function<void(UStaticMesh*)> OnLoaded)
+{
+    if (const FStaticMeshLoadHandle* Pending = AsyncLoadMap.Find(PathFileName))
     {
-        for (const FWString& Texture : Textures)
+        if (OnLoaded)
         {
-            if (FEngineLoop::ResourceManager.GetTexture(Texture) == nullptr)
-            {
-                FEngineLoop::ResourceManager.LoadTextureFromFile(FEngineLoop::GraphicDevice.Device, nullptr, Texture.c_str());
-            }
+            (*Pending)->OnLoadedCallbacks.Add(std::move(OnLoaded));
         }
+        return *Pending;
     }
-    else
+
+    FStaticMeshLoadHandle Handle = std::make_shared<FStaticMeshAsyncLoad>(PathFileName);
+    if (ObjStaticMeshMap.Contains(PathFileName))
     {
-        FEngineLoop::ResourceManager.CreateDefaultSampler(FEngineLoop::GraphicDevice.Device, nullptr, L"NoneTexture");
+        Handle->StaticMesh = CreateStaticMesh(PathFileName);
+        Handle->State = Handle->StaticMesh ? EAsyncLoadState::Succeeded : EAsyncLoadState::Failed;
+        if (OnLoaded)
+        {
+            OnLoaded(Handle->StaticMesh);
+        }
+        return Handle;
     }
-    return true;
+
+    if (OnLoaded)
+    {
+        Handle->OnLoadedCallbacks.Add(std::move(OnLoaded));
+    }
+    AsyncLoadMap.Add(PathFileName, Handle);
+
+    FQueuedThreadPool::Get().AddTask([Handle]()
+    {
+        OBJ::FStaticMeshRenderData* RenderData = new OBJ::FStaticMeshRenderData();
+        if (!BuildStaticMeshRenderData(Handle->GetFilePath(), *RenderData))
+        {
+            delete RenderData;
+            RenderData = nullptr;
+        }
+        Handle->RenderData = RenderData;
+
+        {
+            std::lock_guard Lock(CompletedLoadsMutex);
+            CompletedLoads.Add(Handle);
+        }
+        Handle->State.store(EAsyncLoadState::Built, std::memory_order_release);
+        Handle->State.notify_all();
+    });
+
+    return Handle;
 }
 
-UMaterial* FManagerOBJ::CreateMaterial(FObjMaterialInfo materialInfo)
+void FManagerOBJ::ProcessAsyncLoads()
 {
-    if (materialMap[materialInfo.MaterialName] != nullptr)
-        return materialMap[materialInfo.MaterialName];
+    TArray<FStaticMeshLoadHandle> Loads;
+    {
+        std::lock_guard Lock(CompletedLoadsMutex);
+        if (CompletedLoads.IsEmpty())
+        {
+            return;
+        }
+        Loads = std::move(CompletedLoads);
+        CompletedLoads.Empty();
+    }
 
-    UMaterial* newMaterial = FObjectFactory::ConstructObject<UMaterial>(nullptr); // Material은 Outer가 없이 따로 관리되는 객체이므로 Outer가 없음으로 설정. 추후 Garbage Collection이 추가되면 AssetManager를 생성해서 관리.
-    newMaterial->SetMaterialInfo(materialInfo);
-    materialMap.Add(materialInfo.MaterialName, newMaterial);
-    return newMaterial;
+    for (const FStaticMeshLoadHandle& Handle : Loads)
+    {
+        CompleteAsyncLoad(Handle);
+    }
+
+    // 로드 중에 새로 쿠킹한 에셋의 기록은 진행 중인 로드가 모두 끝난 뒤 한 번에 저장
+    if (AsyncLoadMap.IsEmpty())
+    {
+        FCookDatabase::Get().SaveIfDirty();
+    }
 }
 
-UMaterial* FManagerOBJ::GetMaterial(FString name)
+void FManagerOBJ::WaitForAsyncLoad(const FStaticMeshLoadHandle& Handle)
 {
-    return materialMap[name];
+    if (Handle == nullptr)
+    {
+        return;
+    }
+
+    EAsyncLoadState State;
+    while ((State = Handle->GetState()) == EAsyncLoadState::Loading)
+    {
+        Handle->State.wait(State);
+    }
+
+    ProcessAsyncLoads();
 }
 
-UStaticMesh* FManagerOBJ::CreateStaticMesh(const FString& filePath)
+void FManagerOBJ::FlushAsyncLoads()
 {
-    OBJ::FStaticMeshRenderData* StaticMeshRenderData = FManagerOBJ::LoadObjStaticMeshAsset(filePath);
+    TArray<FStaticMeshLoadHandle> Pending;
+    Pending.Reserve(AsyncLoadMap.Num());
+    for (const auto& [PathFileName, Handle] : AsyncLoadMap)
+    {
+        Pending.Add(Handle);
+    }
 
-    if (StaticMeshRenderData == nullptr) return nullptr;
+    for (const FStaticMeshLoadHandle& Handle : Pending)
+    {
+        WaitForAsyncLoad(Handle);
+    }
+}
 
-    UStaticMesh* StaticMesh = GetStaticMesh(StaticMeshRenderData->ObjectName);
-    if (StaticMesh != nullptr)
+void FManagerOBJ::CompleteAsyncLoad(const FStaticMeshLoadHandle& Handle)
+{
+    const FString& PathFileName = Handle->GetFilePath();
+    AsyncLoadMap.Remove(PathFileName);
+
+    UStaticMesh* StaticMesh = nullptr;
+    if (Handle->RenderData != nullptr)
     {
-        return StaticMesh;
+        RegisterStaticMeshRenderData(PathFileName, Handle->RenderData);
+        Handle->RenderData = nullptr;
+        StaticMesh = CreateStaticMesh(PathFileName);
+    }
+    else
+    {
+        UE_LOG(LogLevel::Error, "Failed to load static mesh: %s", *PathFileName);
     }
 
-    StaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr); // TODO: 추후 AssetManager를 생성해서 관리.
-    StaticMesh->SetData(StaticMeshRenderData);
+    Handle->StaticMesh = StaticMesh;
+    Handle->State.store(StaticMesh ? EAsyncLoadState::Succeeded : EAsyncLoadState::Failed, std::memory_order_release);
+    Handle->State.notify_all();
 
-    StaticMeshMap.Add(StaticMeshRenderData->ObjectName, StaticMesh); // TODO: 장기적으로 보면 파일 이름 대신 경로를 Key로 사용하는게 좋음.
-    return StaticMesh;
+    // 콜백 안에서 다시 LoadStaticMeshAsync를 호출해도 안전하도록 옮긴 뒤 호출
+    TArray<std::function<void(UStaticMesh*)>> Callbacks = std::move(Handle->OnLoadedCallbacks);
+    Handle->OnLoadedCallbacks.Empty();
+    for (const std::function<void(UStaticMesh*)>& Callback : Callbacks)
+    {
+        Callback(StaticMesh);
+    }
 }
 
-UStaticMesh* FManagerOBJ::GetStaticMesh(FWString name)
+UStaticMesh* FManagerOBJ::GetPlaceholderStaticMesh()
 {
-    return StaticMeshMap[name];
+    if (PlaceholderStaticMesh == nullptr)
+    {
+        OBJ::FStaticMeshRenderData* RenderData = new OBJ::FStaticMeshRenderData();
+        BuildPlaceholderRenderData(*RenderData);
+        RenderData->BVH = std::make_shared<FStaticMeshBVH>();
+        RenderData->BVH->Build(RenderData->Vertices, RenderData->Indices);
+
+        // StaticMeshMap에는 등록하지 않아 에디터의 메시 목록에 나타나지 않음
+        PlaceholderStaticMesh = FObjectFactory::ConstructObject<UStaticMesh>(nullptr);
+        PlaceholderStaticMesh->SetData(RenderData);
+    }
+    return PlaceholderStaticMesh;
 }
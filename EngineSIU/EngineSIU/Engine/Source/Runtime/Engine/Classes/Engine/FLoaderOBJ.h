@@ -1,20 +1,55 @@
 #pragma once
+#include <mutex>
 
 #include "Define.h"
 #include "EngineLoop.h"
 #include "Container/Map.h"
 #include "HAL/PlatformType.h"
 #include "Serialization/Serializer.h"
+#include "Engine/AsyncStaticMeshLoad.h"
 
 class UStaticMesh;
 struct FManagerOBJ;
 
+enum class EObjParseMode : uint8
+{
+    Stream,         // std::ifstream + std::istringstream 기반의 기존 파서
+    MemoryMapped,   // 파일을 메모리에 매핑하고 직접 토큰화하는 파서
+    Parallel,       // MemoryMapped 파서를 청크 단위로 나눠 워커 스레드에서 실행
+};
+
 struct FLoaderOBJ
 {
+    // ParseOBJBufferParallel이 나누는 청크의 최소 크기, 이보다 작은 청크는 스레드로 나누는 비용이 더 큼
+    static constexpr uint64 MinParallelChunkBytes = 512 * 1024;
+
+    // ParseOBJ가 사용할 파서
+    inline static EObjParseMode ParseMode = EObjParseMode::Parallel;
+
     // Obj Parsing (*.obj to FObjInfo)
     static bool ParseOBJ(const FString& ObjFilePath, FObjInfo& OutObjInfo);
 
-    // Material Parsing (*.obj to MaterialInfo)
+    static bool ParseOBJStream(const FString& ObjFilePath, FObjInfo& OutObjInfo);
+
+    static bool ParseOBJMapped(const FString& ObjFilePath, FObjInfo& OutObjInfo);
+
+    static bool ParseOBJParallel(const FString& ObjFilePath, FObjInfo& OutObjInfo);
+
+    /**
+     * 메모리에 올라온 OBJ 텍스트를 파싱합니다.
+     * 파싱 도중 힙 할당은 미리 Reserve한 배열과 이름 문자열(mtllib, usemtl, g, o)에만 발생합니다.
+     * @param Data OBJ 텍스트의 시작 주소, 널 종료 문자열일 필요는 없습니다.
+     * @param Size 바이트 단위의 크기
+     */
+    static bool ParseOBJBuffer(const char* Data, uint64 Size, FObjInfo& OutObjInfo);
+
+    /**
+     * ParseOBJBuffer와 같은 결과를 만들지만, 텍스트를 줄 경계에서 청크로 나눠 병렬로 파싱한 뒤 합칩니다.
+     * 작은 파일은 청크를 나누지 않고 ParseOBJBuffer로 처리합니다.
+     */
+    static bool ParseOBJBufferParallel(const char* Data, uint64 Size, FObjInfo& OutObjInfo);
+
+    // Material Parsing (*.obj to MaterialInfo), 텍스처 로드는 메인 스레드의 FManagerOBJ가 담당
     static bool ParseMaterial(FObjInfo& OutObjInfo, OBJ::FStaticMeshRenderData& OutFStaticMesh);
 
     // Convert the Raw data to Cooked data (FStaticMeshRenderData)
@@ -25,19 +60,48 @@ struct FLoaderOBJ
     static void ComputeBoundingBox(const TArray<FStaticMeshVertex>& InVertices, FVector& OutMinVector, FVector& OutMaxVector);
 
 private:
+    static void SetupObjInfoPath(const FString& ObjFilePath, FObjInfo& OutObjInfo);
+
     static FVector CalculateTangent(FStaticMeshVertex& PivotVertex, const FStaticMeshVertex& Vertex1, const FStaticMeshVertex& Vertex2);
 };
 
 struct FManagerOBJ
 {
 public:
+    // 파서나 변환 결과가 바뀌면 올려서 쿠킹된 캐시를 모두 다시 만들게 함 (FCookDatabase에 기록됨)
+    static constexpr uint32 ImporterVersion = 1;
+
     static OBJ::FStaticMeshRenderData* LoadObjStaticMeshAsset(const FString& PathFileName);
 
+    /**
+     * 쿠킹된 캐시를 읽거나, 없으면 OBJ/MTL을 파싱해서 렌더 데이터를 만들고 캐시를 저장합니다. 피킹용 BVH도 같이 만듭니다.
+     * GPU 리소스, 텍스처, UObject는 만들지 않으므로 워커 스레드에서 호출할 수 있습니다.
+     */
+    static bool BuildStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData& OutStaticMesh);
+
+    /**
+     * OBJ/MTL을 파싱해서 렌더 데이터를 만들고, 쿠킹된 캐시와 FCookDatabase에 원본, mtllib, 텍스처의 해시를 기록합니다.
+     * BuildStaticMeshRenderData와 같이 워커 스레드에서 호출할 수 있습니다.
+     * @param bOutCacheSaved nullptr가 아니면 캐시 파일을 저장했는지 받음, 저장에 실패해도 렌더 데이터를 만들었으면 true를 반환합니다.
+     */
+    static bool CookStaticMesh(const FString& PathFileName, OBJ::FStaticMeshRenderData& OutStaticMesh, bool* bOutCacheSaved = nullptr);
+
+    /**
+     * Directory 아래의 모든 OBJ 중 바뀐 것만 워커 스레드에서 병렬로 쿠킹합니다.
+     * @param bForce true면 바뀌지 않은 에셋도 모두 다시 쿠킹
+     */
+    static void CookDirectory(const FString& Directory, bool bForce = false);
+
     static void CombineMaterialIndex(OBJ::FStaticMeshRenderData& OutFStaticMesh);
 
-    static bool SaveStaticMeshToBinary(const FWString& FilePath, const OBJ::FStaticMeshRenderData& StaticMesh);
+    /**
+     * 쿠킹된 메시 파일(CookedStaticMesh.h) 저장
+     * @param SourceFileSize, SourceWriteTime 파싱하기 전에 읽은 원본의 크기와 수정 시간, 캐시가 오래되었는지 판단하는 데 사용
+     */
+    static bool SaveStaticMeshToBinary(const FWString& FilePath, uint64 SourceFileSize, int64 SourceWriteTime, const OBJ::FStaticMeshRenderData& StaticMesh);
 
-    static bool LoadStaticMeshFromBinary(const FWString& FilePath, OBJ::FStaticMeshRenderData& OutStaticMesh);
+    // 캐시가 없거나 오래되었거나 손상되었으면 false
+    static bool LoadStaticMeshFromBinary(const FWString& FilePath, const FWString& SourcePath, OBJ::FStaticMeshRenderData& OutStaticMesh);
 
     static UMaterial* CreateMaterial(FObjMaterialInfo materialInfo);
 
@@ -49,14 +113,55 @@ public:
 
     static UStaticMesh* CreateStaticMesh(const FString& filePath);
 
+    /**
+     * 스태틱 메시를 워커 스레드에서 로드합니다.
+     * 결과는 메인 스레드의 ProcessAsyncLoads()에서 StaticMeshMap에 등록된 뒤 OnLoaded로 전달되며, 실패하면 nullptr가 전달됩니다.
+     * 이미 로드된 메시면 OnLoaded를 바로 호출합니다.
+     */
+    static FStaticMeshLoadHandle LoadStaticMeshAsync(const FString& PathFileName, std::function<void(UStaticMesh*)> OnLoaded = nullptr);
+
+    // 워커 스레드에서 끝난 로드 요청을 등록하고 콜백을 호출, 메인 스레드에서 매 프레임 호출
+    static void ProcessAsyncLoads();
+
+    // Handle의 로드가 끝날 때까지 기다린 뒤 등록
+    static void WaitForAsyncLoad(const FStaticMeshLoadHandle& Handle);
+
+    // 진행 중인 모든 로드 요청을 기다린 뒤 등록
+    static void FlushAsyncLoads();
+
+    static int32 GetNumAsyncLoadsInFlight() { return AsyncLoadMap.Num(); }
+
+    // 비동기 로드가 끝나기 전까지 대신 그릴 메시
+    static UStaticMesh* GetPlaceholderStaticMesh();
+
     static const TMap<FWString, UStaticMesh*>& GetStaticMeshes() { return StaticMeshMap; }
 
+    // 워커 스레드에서 로드 중인 메시면 로드가 끝날 때까지 기다림, 없는 메시면 nullptr
     static UStaticMesh* GetStaticMesh(FWString name);
 
     static int GetStaticMeshNum() { return StaticMeshMap.Num(); }
 
+private:
+    // 렌더 데이터의 텍스처와 머티리얼을 만들고 ObjStaticMeshMap에 등록, 메인 스레드 전용
+    static void RegisterStaticMeshRenderData(const FString& PathFileName, OBJ::FStaticMeshRenderData* RenderData);
+
+    static void LoadMaterialTextures(const OBJ::FStaticMeshRenderData& StaticMesh);
+
+    static UStaticMesh* CreateStaticMeshFromRenderData(OBJ::FStaticMeshRenderData* RenderData);
+
+    static void CompleteAsyncLoad(const FStaticMeshLoadHandle& Handle);
+
 private:
     inline static TMap<FString, OBJ::FStaticMeshRenderData*> ObjStaticMeshMap;
     inline static TMap<FWString, UStaticMesh*> StaticMeshMap;
     inline static TMap<FString, UMaterial*> materialMap;
+
+    // 메인 스레드에서만 접근, 등록되기 전까지의 로드 요청
+    inline static TMap<FString, FStaticMeshLoadHandle> AsyncLoadMap;
+
+    // 워커 스레드가 빌드를 끝낸 요청, CompletedLoadsMutex로 보호
+    inline static TArray<FStaticMeshLoadHandle> CompletedLoads;
+    inline static std::mutex CompletedLoadsMutex;
+
+    inline static UStaticMesh* PlaceholderStaticMesh = nullptr;
 };
@@ -0,0 +1,429 @@
+#include "ParticleEmitter.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <emmintrin.h>
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+// 스트림 사이에 더 띄우는 float 수, 캐시 라인 하나
+constexpr int32 StreamPadding = 16;
+}
+
+FParticleEmitter::FParticleEmitter()
+    : RandomStream(std::random_device()())
+{
+}
+
+void FParticleEmitter::SetSettings(const FParticleEmitterSettings& InSettings)
+{
+    Settings = InSettings;
+    Settings.MaxParticles = std::max(Settings.MaxParticles, 0);
+    Settings.SubUVRows = std::max(Settings.SubUVRows, 1);
+    Settings.SubUVColumns = std::max(Settings.SubUVColumns, 1);
+    if (Num() > Settings.MaxParticles)
+    {
+        SetNumParticles(Settings.MaxParticles);
+    }
+}
+
+void FParticleEmitter::Tick(float DeltaTime, const FVector& Origin)
+{
+    bBoundsDirty = true;
+
+    const int32 NumParticles = Num();
+    if (NumParticles > 0)
+    {
+        int32 NumTasks, ParticlesPerTask;
+        GetTaskRange(NumTasks, ParticlesPerTask);
+        ParallelFor(NumTasks, [this, NumParticles, ParticlesPerTask, DeltaTime](int32 Task)
+        {
+            const int32 Begin = Task * ParticlesPerTask;
+            const int32 End = std::min(Begin + ParticlesPerTask, NumParticles);
+            if (Begin < End)
+            {
+                Simulate(Begin, End, DeltaTime);
+            }
+        });
+        KillExpired();
+    }
+
+    SpawnRemainder += Settings.SpawnRate * DeltaTime;
+    const int32 NumToSpawn = static_cast<int32>(SpawnRemainder);
+    SpawnRemainder -= static_cast<float>(NumToSpawn);
+    Spawn(NumToSpawn, Origin);
+}
+
+void FParticleEmitter::Spawn(int32 Count, const FVector& Origin)
+{
+    Count = std::min(Count, Settings.MaxParticles - Num());
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    auto RandomRange = [this](float Min, float Max)
+    {
+        return std::uniform_real_distribution<float>(std::min(Min, Max), std::max(Min, Max))(RandomStream);
+    };
+
+    const FVector& MinVelocity = Settings.MinVelocity;
+    const FVector& MaxVelocity = Settings.MaxVelocity;
+    for (int32 i = 0; i < Count; ++i)
+    {
+        const FVector Velocity(
+            RandomRange(MinVelocity.X, MaxVelocity.X),
+            RandomRange(MinVelocity.Y, MaxVelocity.Y),
+            RandomRange(MinVelocity.Z, MaxVelocity.Z)
+        );
+        SpawnParticle(Origin, Velocity, RandomRange(Settings.MinLifetime, Settings.MaxLifetime));
+    }
+}
+
+bool FParticleEmitter::SpawnParticle(const FVector& Position, const FVector& Velocity, float Lifetime)
+{
+    if (Num() >= Settings.MaxParticles)
+    {
+        return false;
+    }
+
+    const int32 Index = NumParticles;
+    SetNumParticles(NumParticles + 1);
+
+    GetStream(Stream_PositionX)[Index] = Position.X;
+    GetStream(Stream_PositionY)[Index] = Position.Y;
+    GetStream(Stream_PositionZ)[Index] = Position.Z;
+    GetStream(Stream_VelocityX)[Index] = Velocity.X;
+    GetStream(Stream_VelocityY)[Index] = Velocity.Y;
+    GetStream(Stream_VelocityZ)[Index] = Velocity.Z;
+    GetStream(Stream_Age)[Index] = 0.f;
+    // 수명이 0이면 다음 Tick에서 바로 제거
+    GetStream(Stream_InvLifetime)[Index] = Lifetime > 0.f ? 1.f / Lifetime : FLT_MAX;
+    GetStream(Stream_Size)[Index] = Settings.StartSize;
+    GetStream(Stream_ColorR)[Index] = Settings.StartColor.R;
+    GetStream(Stream_ColorG)[Index] = Settings.StartColor.G;
+    GetStream(Stream_ColorB)[Index] = Settings.StartColor.B;
+    GetStream(Stream_ColorA)[Index] = Settings.StartColor.A;
+    GetStream(Stream_SubUVFrame)[Index] = 0.f;
+    return true;
+}
+
+void FParticleEmitter::KillAll()
+{
+    SetNumParticles(0);
+    SpawnRemainder = 0.f;
+}
+
+bool FParticleEmitter::GetBounds(FBoundingBox& OutBounds) const
+{
+    const int32 NumParticles = Num();
+    if (NumParticles == 0)
+    {
+        return false;
+    }
+
+    if (bBoundsDirty)
+    {
+        const float* PX = GetStream(Stream_PositionX);
+        const float* PY = GetStream(Stream_PositionY);
+        const float* PZ = GetStream(Stream_PositionZ);
+
+        __m128 MinX = _mm_set1_ps(FLT_MAX), MinY = MinX, MinZ = MinX;
+        __m128 MaxX = _mm_set1_ps(-FLT_MAX), MaxY = MaxX, MaxZ = MaxX;
+        int32 Index = 0;
+        for (; Index + 4 <= NumParticles; Index += 4)
+        {
+            const __m128 X = _mm_loadu_ps(PX + Index);
+            const __m128 Y = _mm_loadu_ps(PY + Index);
+            const __m128 Z = _mm_loadu_ps(PZ + Index);
+            MinX = _mm_min_ps(MinX, X);
+            MinY = _mm_min_ps(MinY, Y);
+            MinZ = _mm_min_ps(MinZ, Z);
+            MaxX = _mm_max_ps(MaxX, X);
+            MaxY = _mm_max_ps(MaxY, Y);
+            MaxZ = _mm_max_ps(MaxZ, Z);
+        }
+
+        alignas(16) float Lanes[6][4];
+        _mm_store_ps(Lanes[0], MinX);
+        _mm_store_ps(Lanes[1], MinY);
+        _mm_store_ps(Lanes[2], MinZ);
+        _mm_store_ps(Lanes[3], MaxX);
+        _mm_store_ps(Lanes[4], MaxY);
+        _mm_store_ps(Lanes[5], MaxZ);
+
+        FVector Min(FLT_MAX, FLT_MAX, FLT_MAX);
+        FVector Max(-FLT_MAX, -FLT_MAX, -FLT_MAX);
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            Min = FVector(std::min(Min.X, Lanes[0][Lane]), std::min(Min.Y, Lanes[1][Lane]), std::min(Min.Z, Lanes[2][Lane]));
+            Max = FVector(std::max(Max.X, Lanes[3][Lane]), std::max(Max.Y, Lanes[4][Lane]), std::max(Max.Z, Lanes[5][Lane]));
+        }
+        for (; Index < NumParticles; ++Index)
+        {
+            Min = FVector(std::min(Min.X, PX[Index]), std::min(Min.Y, PY[Index]), std::min(Min.Z, PZ[Index]));
+            Max = FVector(std::max(Max.X, PX[Index]), std::max(Max.Y, PY[Index]), std::max(Max.Z, PZ[Index]));
+        }
+
+        // 쿼드의 꼭짓점은 중심에서 크기의 최대 sqrt(2)배만큼 떨어짐
+        const float MaxSize = std::max(std::abs(Settings.StartSize), std::abs(Settings.EndSize));
+        const float Padding = MaxSize * 1.41421356f;
+        Bounds = FBoundingBox(Min - FVector(Padding, Padding, Padding), Max + FVector(Padding, Padding, Padding));
+        bBoundsDirty = false;
+    }
+
+    OutBounds = Bounds;
+    return true;
+}
+
+FVector2D FParticleEmitter::GetSubUVScale() const
+{
+    return FVector2D(1.f / static_cast<float>(Settings.SubUVColumns), 1.f / static_cast<float>(Settings.SubUVRows));
+}
+
+void FParticleEmitter::BuildInstances(FParticleInstance* OutInstances) const
+{
+    const int32 NumParticles = Num();
+    if (NumParticles == 0)
+    {
+        return;
+    }
+
+    int32 NumTasks, ParticlesPerTask;
+    GetTaskRange(NumTasks, ParticlesPerTask);
+    ParallelFor(NumTasks, [this, NumParticles, ParticlesPerTask, OutInstances](int32 Task)
+    {
+        const int32 Begin = Task * ParticlesPerTask;
+        const int32 End = std::min(Begin + ParticlesPerTask, NumParticles);
+        if (Begin < End)
+        {
+            BuildInstances(Begin, End, OutInstances);
+        }
+    });
+}
+
+void FParticleEmitter::BuildInstances(int32 Begin, int32 End, FParticleInstance* OutInstances) const
+{
+    const float* PX = GetStream(Stream_PositionX);
+    const float* PY = GetStream(Stream_PositionY);
+    const float* PZ = GetStream(Stream_PositionZ);
+    const float* Size = GetStream(Stream_Size);
+    const float* R = GetStream(Stream_ColorR);
+    const float* G = GetStream(Stream_ColorG);
+    const float* B = GetStream(Stream_ColorB);
+    const float* A = GetStream(Stream_ColorA);
+    const float* Frames = GetStream(Stream_SubUVFrame);
+
+    const FVector2D UVScale = GetSubUVScale();
+    const int32 Columns = Settings.SubUVColumns;
+
+    const __m128 Columns4 = _mm_set1_ps(static_cast<float>(Columns));
+    const __m128 UVScaleX = _mm_set1_ps(UVScale.X);
+    const __m128 UVScaleY = _mm_set1_ps(UVScale.Y);
+
+    // 성분별 배열 4개씩을 전치해서 파티클 4개의 (Position, Size), Color를 한 번에 씀
+    int32 Index = Begin;
+    for (; Index + 4 <= End; Index += 4)
+    {
+        __m128 X = _mm_loadu_ps(PX + Index);
+        __m128 Y = _mm_loadu_ps(PY + Index);
+        __m128 Z = _mm_loadu_ps(PZ + Index);
+        __m128 S = _mm_loadu_ps(Size + Index);
+        _MM_TRANSPOSE4_PS(X, Y, Z, S);
+
+        __m128 CR = _mm_loadu_ps(R + Index);
+        __m128 CG = _mm_loadu_ps(G + Index);
+        __m128 CB = _mm_loadu_ps(B + Index);
+        __m128 CA = _mm_loadu_ps(A + Index);
+        _MM_TRANSPOSE4_PS(CR, CG, CB, CA);
+
+        // 프레임은 음수가 아닌 정수이므로 나눈 값을 버림하면 행 번호
+        const __m128 Frame = _mm_loadu_ps(Frames + Index);
+        const __m128 Row = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_div_ps(Frame, Columns4)));
+        const __m128 Column = _mm_sub_ps(Frame, _mm_mul_ps(Row, Columns4));
+        const __m128 U = _mm_mul_ps(Column, UVScaleX);
+        const __m128 V = _mm_mul_ps(Row, UVScaleY);
+        const __m128 UV01 = _mm_unpacklo_ps(U, V);
+        const __m128 UV23 = _mm_unpackhi_ps(U, V);
+
+        FParticleInstance* Out = OutInstances + Index;
+        _mm_storeu_ps(&Out[0].Position.X, X);
+        _mm_storeu_ps(&Out[1].Position.X, Y);
+        _mm_storeu_ps(&Out[2].Position.X, Z);
+        _mm_storeu_ps(&Out[3].Position.X, S);
+        _mm_storeu_ps(&Out[0].Color.R, CR);
+        _mm_storeu_ps(&Out[1].Color.R, CG);
+        _mm_storeu_ps(&Out[2].Color.R, CB);
+        _mm_storeu_ps(&Out[3].Color.R, CA);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&Out[0].UVOffset), UV01);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&Out[1].UVOffset), UV01);
+        _mm_storel_pi(reinterpret_cast<__m64*>(&Out[2].UVOffset), UV23);
+        _mm_storeh_pi(reinterpret_cast<__m64*>(&Out[3].UVOffset), UV23);
+    }
+
+    for (; Index < End; ++Index)
+    {
+        const int32 Frame = static_cast<int32>(Frames[Index]);
+        FParticleInstance& Instance = OutInstances[Index];
+        Instance.Position = FVector(PX[Index], PY[Index], PZ[Index]);
+        Instance.Size = Size[Index];
+        Instance.Color = FLinearColor(R[Index], G[Index], B[Index], A[Index]);
+        Instance.UVOffset = FVector2D(static_cast<float>(Frame % Columns) * UVScale.X, static_cast<float>(Frame / Columns) * UVScale.Y);
+    }
+}
+
+void FParticleEmitter::GetTaskRange(int32& OutNumTasks, int32& OutParticlesPerTask) const
+{
+    const int32 NumParticles = Num();
+    OutNumTasks = std::max(NumParticles / MinParticlesPerTask, 1);
+    // 작업 경계가 4의 배수가 되도록 나눔
+    OutParticlesPerTask = ((NumParticles + OutNumTasks - 1) / OutNumTasks + 3) & ~3;
+}
+
+void FParticleEmitter::Simulate(int32 Begin, int32 End, float DeltaTime)
+{
+    float* PX = GetStream(Stream_PositionX);
+    float* PY = GetStream(Stream_PositionY);
+    float* PZ = GetStream(Stream_PositionZ);
+    float* VX = GetStream(Stream_VelocityX);
+    float* VY = GetStream(Stream_VelocityY);
+    float* VZ = GetStream(Stream_VelocityZ);
+    float* Age = GetStream(Stream_Age);
+    const float* InvLifetime = GetStream(Stream_InvLifetime);
+    float* Size = GetStream(Stream_Size);
+    float* R = GetStream(Stream_ColorR);
+    float* G = GetStream(Stream_ColorG);
+    float* B = GetStream(Stream_ColorB);
+    float* A = GetStream(Stream_ColorA);
+    float* Frame = GetStream(Stream_SubUVFrame);
+
+    const FVector DeltaVelocity = Settings.Acceleration * DeltaTime;
+    const float SizeRange = Settings.EndSize - Settings.StartSize;
+    const FLinearColor& StartColor = Settings.StartColor;
+    const FLinearColor ColorRange(
+        Settings.EndColor.R - StartColor.R, Settings.EndColor.G - StartColor.G,
+        Settings.EndColor.B - StartColor.B, Settings.EndColor.A - StartColor.A
+    );
+    const float NumFrames = static_cast<float>(Settings.SubUVRows * Settings.SubUVColumns);
+
+    const __m128 Dt = _mm_set1_ps(DeltaTime);
+    const __m128 One = _mm_set1_ps(1.f);
+    const __m128 DVx = _mm_set1_ps(DeltaVelocity.X);
+    const __m128 DVy = _mm_set1_ps(DeltaVelocity.Y);
+    const __m128 DVz = _mm_set1_ps(DeltaVelocity.Z);
+    const __m128 StartSize4 = _mm_set1_ps(Settings.StartSize);
+    const __m128 SizeRange4 = _mm_set1_ps(SizeRange);
+    const __m128 StartR = _mm_set1_ps(StartColor.R), RangeR = _mm_set1_ps(ColorRange.R);
+    const __m128 StartG = _mm_set1_ps(StartColor.G), RangeG = _mm_set1_ps(ColorRange.G);
+    const __m128 StartB = _mm_set1_ps(StartColor.B), RangeB = _mm_set1_ps(ColorRange.B);
+    const __m128 StartA = _mm_set1_ps(StartColor.A), RangeA = _mm_set1_ps(ColorRange.A);
+    const __m128 NumFrames4 = _mm_set1_ps(NumFrames);
+    const __m128 LastFrame4 = _mm_set1_ps(NumFrames - 1.f);
+
+    int32 Index = Begin;
+    for (; Index + 4 <= End; Index += 4)
+    {
+        const __m128 Vx = _mm_add_ps(_mm_loadu_ps(VX + Index), DVx);
+        const __m128 Vy = _mm_add_ps(_mm_loadu_ps(VY + Index), DVy);
+        const __m128 Vz = _mm_add_ps(_mm_loadu_ps(VZ + Index), DVz);
+        _mm_storeu_ps(VX + Index, Vx);
+        _mm_storeu_ps(VY + Index, Vy);
+        _mm_storeu_ps(VZ + Index, Vz);
+        _mm_storeu_ps(PX + Index, _mm_add_ps(_mm_loadu_ps(PX + Index), _mm_mul_ps(Vx, Dt)));
+        _mm_storeu_ps(PY + Index, _mm_add_ps(_mm_loadu_ps(PY + Index), _mm_mul_ps(Vy, Dt)));
+        _mm_storeu_ps(PZ + Index, _mm_add_ps(_mm_loadu_ps(PZ + Index), _mm_mul_ps(Vz, Dt)));
+
+        const __m128 NewAge = _mm_add_ps(_mm_loadu_ps(Age + Index), Dt);
+        _mm_storeu_ps(Age + Index, NewAge);
+
+        // 수명이 끝난 파티클도 KillExpired 전까지는 끝 값으로 유지
+        const __m128 T = _mm_min_ps(_mm_mul_ps(NewAge, _mm_loadu_ps(InvLifetime + Index)), One);
+        _mm_storeu_ps(Size + Index, _mm_add_ps(StartSize4, _mm_mul_ps(SizeRange4, T)));
+        _mm_storeu_ps(R + Index, _mm_add_ps(StartR, _mm_mul_ps(RangeR, T)));
+        _mm_storeu_ps(G + Index, _mm_add_ps(StartG, _mm_mul_ps(RangeG, T)));
+        _mm_storeu_ps(B + Index, _mm_add_ps(StartB, _mm_mul_ps(RangeB, T)));
+        _mm_storeu_ps(A + Index, _mm_add_ps(StartA, _mm_mul_ps(RangeA, T)));
+        _mm_storeu_ps(Frame + Index, _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_min_ps(_mm_mul_ps(T, NumFrames4), LastFrame4))));
+    }
+
+    // 4개가 안 되는 나머지는 같은 식을 하나씩 계산
+    for (; Index < End; ++Index)
+    {
+        VX[Index] += DeltaVelocity.X;
+        VY[Index] += DeltaVelocity.Y;
+        VZ[Index] += DeltaVelocity.Z;
+        PX[Index] += VX[Index] * DeltaTime;
+        PY[Index] += VY[Index] * DeltaTime;
+        PZ[Index] += VZ[Index] * DeltaTime;
+        Age[Index] += DeltaTime;
+
+        const float T = std::min(Age[Index] * InvLifetime[Index], 1.f);
+        Size[Index] = Settings.StartSize + SizeRange * T;
+        R[Index] = StartColor.R + ColorRange.R * T;
+        G[Index] = StartColor.G + ColorRange.G * T;
+        B[Index] = StartColor.B + ColorRange.B * T;
+        A[Index] = StartColor.A + ColorRange.A * T;
+        Frame[Index] = static_cast<float>(static_cast<int32>(std::min(T * NumFrames, NumFrames - 1.f)));
+    }
+}
+
+void FParticleEmitter::KillExpired()
+{
+    const float* Age = GetStream(Stream_Age);
+    const float* InvLifetime = GetStream(Stream_InvLifetime);
+
+    int32 NumAlive = NumParticles;
+    for (int32 Index = 0; Index < NumAlive;)
+    {
+        if (Age[Index] * InvLifetime[Index] >= 1.f)
+        {
+            --NumAlive;
+            if (Index != NumAlive)
+            {
+                CopyParticle(NumAlive, Index);
+            }
+        }
+        else
+        {
+            ++Index;
+        }
+    }
+
+    NumParticles = NumAlive;
+}
+
+void FParticleEmitter::CopyParticle(int32 From, int32 To)
+{
+    for (int32 Stream = 0; Stream < Stream_Num; ++Stream)
+    {
+        float* Values = GetStream(Stream);
+        Values[To] = Values[From];
+    }
+}
+
+void FParticleEmitter::SetNumParticles(int32 NewNum)
+{
+    if (NewNum > Capacity)
+    {
+        // 간격이 캐시 라인 크기의 배수가 되도록 용량을 맞춤
+        const int32 NewCapacity = (std::max(NewNum, Capacity * 2) + StreamPadding - 1) & ~(StreamPadding - 1);
+        const int32 NewStride = NewCapacity + StreamPadding;
+
+        TArray<float> NewStreams;
+        NewStreams.SetNum(Stream_Num * NewStride);
+        for (int32 Stream = 0; Stream < Stream_Num; ++Stream)
+        {
+            std::copy_n(GetStream(Stream), NumParticles, NewStreams.GetData() + Stream * NewStride);
+        }
+
+        Streams = std::move(NewStreams);
+        StreamStride = NewStride;
+        Capacity = NewCapacity;
+    }
+
+    NumParticles = NewNum;
+    bBoundsDirty = true;
+}
@@ -0,0 +1,148 @@
+#pragma once
+#include <cstddef>
+#include <random>
+
+#include "Define.h"
+
+/** FParticleEmitter가 파티클을 만들고 움직이는 방식 */
+struct FParticleEmitterSettings
+{
+    // 초당 생성할 파티클 수
+    float SpawnRate = 50.f;
+    int32 MaxParticles = 1000;
+
+    float MinLifetime = 1.f;
+    float MaxLifetime = 2.f;
+
+    // 생성될 때의 속도는 두 값 사이에서 성분마다 무작위로 정함
+    FVector MinVelocity = FVector(-20.f, -20.f, 40.f);
+    FVector MaxVelocity = FVector(20.f, 20.f, 80.f);
+    FVector Acceleration = FVector(0.f, 0.f, -9.8f);
+
+    // 수명 동안 시작 값에서 끝 값으로 보간
+    float StartSize = 1.f;
+    float EndSize = 0.2f;
+    FLinearColor StartColor = FLinearColor(1.f, 1.f, 1.f, 1.f);
+    FLinearColor EndColor = FLinearColor(1.f, 1.f, 1.f, 0.f);
+
+    // 텍스처 아틀라스의 셀 수, 수명 동안 왼쪽 위부터 한 번 재생
+    int32 SubUVRows = 1;
+    int32 SubUVColumns = 1;
+};
+
+/** 인스턴스 버퍼에 들어가는 파티클 하나, ParticleShader.hlsl의 입력 레이아웃과 순서가 같아야 함 */
+struct FParticleInstance
+{
+    FVector Position;
+    float Size;
+    FLinearColor Color;
+    FVector2D UVOffset;
+};
+// BuildInstances는 Position과 Size, Color를 각각 float 4개로 한 번에 씀
+static_assert(offsetof(FParticleInstance, Size) == offsetof(FParticleInstance, Position) + 12);
+static_assert(sizeof(FParticleInstance) == 40);
+
+/**
+ * 파티클의 위치, 속도, 나이, 색, SubUV 프레임을 성분별 배열로 담아 4개씩 SIMD로 계산하는 이미터
+ *
+ * 죽은 파티클은 마지막 파티클과 자리를 바꿔 제거하므로 파티클의 순서는 유지되지 않습니다.
+ * 결과는 BuildInstances로 FParticleInstance 배열에 채워 한 번의 인스턴싱 드로우로 그릴 수 있습니다.
+ * GPU 리소스를 사용하지 않으므로 렌더러 없이도 실행할 수 있습니다.
+ */
+class FParticleEmitter
+{
+public:
+    // 한 작업이 맡는 최소 파티클 수, 4의 배수
+    static constexpr int32 MinParticlesPerTask = 4096;
+
+    FParticleEmitter();
+
+    void SetSettings(const FParticleEmitterSettings& InSettings);
+    const FParticleEmitterSettings& GetSettings() const { return Settings; }
+
+    /** 살아있는 파티클을 DeltaTime만큼 움직이고, 수명이 끝난 파티클을 제거한 뒤, SpawnRate에 맞춰 Origin에 새 파티클을 만듭니다. */
+    void Tick(float DeltaTime, const FVector& Origin);
+
+    /** Settings의 범위에서 무작위로 Count개의 파티클을 Origin에 만듭니다. MaxParticles를 넘으면 남은 만큼만 만듭니다. */
+    void Spawn(int32 Count, const FVector& Origin);
+
+    /** 파티클 하나를 만듭니다. MaxParticles에 도달했으면 false를 반환합니다. */
+    bool SpawnParticle(const FVector& Position, const FVector& Velocity, float Lifetime);
+
+    /** 모든 파티클을 제거합니다. */
+    void KillAll();
+
+    int32 Num() const { return NumParticles; }
+
+    /**
+     * 살아있는 모든 파티클의 쿼드를 감싸는 월드 바운딩 박스를 구합니다.
+     * 쿼드는 카메라를 향해 돌아가므로 어느 방향에서 봐도 감싸도록 가장 큰 크기만큼 넓히고, 파티클이 바뀔 때까지 저장해두고 재사용합니다.
+     * @return 파티클이 없으면 false
+     */
+    bool GetBounds(FBoundingBox& OutBounds) const;
+
+    /** 셀 하나의 UV 크기 */
+    FVector2D GetSubUVScale() const;
+
+    /**
+     * 살아있는 파티클을 OutInstances에 Num()개 채웁니다.
+     * 매핑한 GPU 버퍼에 바로 쓸 수 있도록 포인터를 받고, 앞에서부터 차례로 씁니다.
+     */
+    void BuildInstances(FParticleInstance* OutInstances) const;
+
+private:
+    /** [Begin, End) 범위를 적분하고 나이에 따라 크기, 색, SubUV 프레임을 계산합니다. */
+    void Simulate(int32 Begin, int32 End, float DeltaTime);
+
+    /** 수명이 끝난 파티클을 마지막 파티클과 자리를 바꿔 제거합니다. */
+    void KillExpired();
+
+    /** From의 파티클을 To에 덮어씁니다. */
+    void CopyParticle(int32 From, int32 To);
+
+    /** 파티클 수를 NewNum으로 맞춥니다. 용량이 부족하면 블록을 키웁니다. */
+    void SetNumParticles(int32 NewNum);
+
+    float* GetStream(int32 Stream) { return Streams.GetData() + Stream * StreamStride; }
+    const float* GetStream(int32 Stream) const { return Streams.GetData() + Stream * StreamStride; }
+
+    void BuildInstances(int32 Begin, int32 End, FParticleInstance* OutInstances) const;
+
+    /** 작업 하나가 맡을 파티클 수와 작업 수를 구합니다. */
+    void GetTaskRange(int32& OutNumTasks, int32& OutParticlesPerTask) const;
+
+private:
+    FParticleEmitterSettings Settings;
+
+    // 파티클의 성분마다 하나씩 있는 float 배열
+    enum EStream : int32
+    {
+        Stream_PositionX, Stream_PositionY, Stream_PositionZ,
+        Stream_VelocityX, Stream_VelocityY, Stream_VelocityZ,
+        Stream_Age,
+        Stream_InvLifetime,     // 나이에 곱하면 0~1의 정규화된 나이
+        Stream_Size,
+        Stream_ColorR, Stream_ColorG, Stream_ColorB, Stream_ColorA,
+        Stream_SubUVFrame,      // 정수 값을 float으로 저장
+        Stream_Num
+    };
+
+    /**
+     * 모든 스트림을 한 블록에 StreamStride 간격으로 담습니다.
+     * 스트림마다 따로 할당하면 시작 주소가 모두 페이지 경계에 맞춰져 같은 캐시 세트에 몰리므로,
+     * 간격을 캐시 라인 하나만큼 더 벌려 스트림의 시작 위치가 서로 다른 세트에 오도록 합니다.
+     */
+    TArray<float> Streams;
+    int32 StreamStride = 0;
+    int32 Capacity = 0;
+    int32 NumParticles = 0;
+
+    // 1 미만으로 남은 생성 수, 다음 Tick으로 넘김
+    float SpawnRemainder = 0.f;
+
+    // GetBounds의 결과, 파티클이 움직이거나 수가 바뀌면 다시 구함
+    mutable FBoundingBox Bounds;
+    mutable bool bBoundsDirty = true;
+
+    std::mt19937 RandomStream;
+};
@@ -1,8 +1,19 @@
 #include "Console.h"
 #include <cstdarg>
 #include <cstdio>
-
+#include <filesystem>
+#include <sstream>
+
+#include "Components/SceneComponent.h"
+#include "Benchmark/EngineBenchmarks.h"
+#include "D3D11RHI/ConstantBufferUploader.h"
+#include "Engine/FLoaderOBJ.h"
+#include "HAL/FrameArena.h"
+#include "HAL/MallocBinned.h"
+#include "Renderer/StaticMeshRenderPass.h"
 #include "UnrealEd/EditorViewportClient.h"
+#include "UObject/ObjectFactory.h"
+#include "UObject/ObjectPool.h"
 
 
 void StatOverlay::ToggleStat(const std::string& command)
@@ -17,10 +28,22 @@ void StatOverlay::ToggleStat(const std::string& command)
         showMemory = true;
         showRender = true;
     }
+    else if (command == "stat transform")
+    {
+        showTransform = true;
+        showRender = true;
+    }
+    else if (command == "stat draw")
+    {
+        showDraw = true;
+        showRender = true;
+    }
     else if (command == "stat none")
     {
         showFPS = false;
         showMemory = false;
+        showTransform = false;
+        showDraw = false;
         showRender = false;
     }
 }
@@ -57,6 +80,44 @@ void StatOverlay::Render(ID3D11DeviceContext* context, UINT width, UINT height)
         ImGui::Text("Allocated Object Memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Object>());
         ImGui::Text("Allocated Container Count: %llu", FPlatformMemory::GetAllocationCount<EAT_Container>());
         ImGui::Text("Allocated Container memory: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Container>());
+        ImGui::Text("Pooled Object Count: %u", FObjectPool::GetTotalNumAllocated());
+        ImGui::Text("Frame Arena Reserved: %llu B", FPlatformMemory::GetAllocationBytes<EAT_Frame>());
+        const FFrameArena& FrameArena = FFrameArena::Get();
+        ImGui::Text("Frame Arena Last Frame: %llu B, %llu allocs, %llu overflows", FrameArena.GetLastFrameAllocatedBytes(), FrameArena.GetLastFrameAllocationCount(), FrameArena.GetLastFrameOverflowCount());
+        ImGui::Text("Heap Allocations Last Frame: %llu", FrameArena.GetLastFrameHeapAllocationCalls());
+        if (FMallocBinned::IsEnabled())
+        {
+            FMallocBinned::FSizeClassStats BinStats[FMallocBinned::NumSizeClasses];
+            FMallocBinned::GetStats(BinStats);
+            for (const FMallocBinned::FSizeClassStats& Stats : BinStats)
+            {
+                if (Stats.ReservedBytes > 0)
+                {
+                    ImGui::Text("Bin %4u B: %llu live, %llu allocs, %llu B reserved", Stats.BlockSize, Stats.NumLiveBlocks, Stats.NumAllocations, Stats.ReservedBytes);
+                }
+            }
+        }
+        else
+        {
+            ImGui::Text("Binned Malloc: off (run with -binnedmalloc)");
+        }
+    }
+    if (showTransform)
+    {
+        ImGui::Text("World Transform Updates: %u", USceneComponent::GetNumWorldTransformUpdates());
+    }
+    if (showDraw && FEngineLoop::Renderer.StaticMeshRenderPass)
+    {
+        const FDrawListStats& DrawStats = FEngineLoop::Renderer.StaticMeshRenderPass->GetDrawStats();
+        ImGui::Text("Static Mesh Draws: %u", DrawStats.NumDraws);
+        ImGui::Text("Static Mesh State Changes: %u", DrawStats.NumStateChanges);
+        ImGui::Text("Static Mesh Constant Buffer Uploads: %u", DrawStats.NumConstantBufferUploads);
+    }
+    if (showDraw && FEngineLoop::Renderer.BufferManager)
+    {
+        const FConstantBufferStats& ConstantStats = FEngineLoop::Renderer.BufferManager->GetConstantBufferStats();
+        ImGui::Text("Constant Buffer Updates: %u (uploaded %u, skipped %u)", ConstantStats.NumUpdates, ConstantStats.NumUploads, ConstantStats.NumSkippedUploads);
+        ImGui::Text("Constant Buffer Ring Uploads: %u (wraps %u)", ConstantStats.NumTransientUploads, ConstantStats.NumRingWraps);
     }
         ImGui::PopStyleColor();
         ImGui::PopStyleVar();
@@ -134,6 +195,8 @@ Console& Console::GetInstance() {
 
 // 로그 초기화
 void Console::Clear() {
+    std::lock_guard lock(pendingMutex);
+    pendingItems.Empty();
     items.Empty();
 }
 
@@ -145,13 +208,26 @@ void Console::AddLog(LogLevel level, const char* fmt, ...) {
     vsnprintf(buf, sizeof(buf), fmt, args);
     va_end(args);
 
-    items.Add({ level, std::string(buf) });
+    std::lock_guard lock(pendingMutex);
+    pendingItems.Add({ level, std::string(buf) });
+}
+
+void Console::FlushPendingLogs() {
+    std::lock_guard lock(pendingMutex);
+    if (pendingItems.IsEmpty()) return;
+
+    for (LogEntry& entry : pendingItems) {
+        items.Add(std::move(entry));
+    }
+    pendingItems.Empty();
     scrollToBottom = true;
 }
 
 
 // 콘솔 창 렌더링
 void Console::Draw() {
+    FlushPendingLogs();
+
     if (!bWasOpen) return;
     // 창 크기 및 위치 계산
     ImVec2 displaySize = ImGui::GetIO().DisplaySize;
@@ -273,16 +349,323 @@ void Console::ExecuteCommand(const std::string& command)
         AddLog(LogLevel::Display, " - help: Shows available commands");
         AddLog(LogLevel::Display, " - stat fps: Toggle FPS display");
         AddLog(LogLevel::Display, " - stat memory: Toggle Memory display");
+        AddLog(LogLevel::Display, " - stat transform: Show world transform recomputations this frame");
+        AddLog(LogLevel::Display, " - stat draw: Show static mesh draws, state changes and constant buffer uploads this frame");
         AddLog(LogLevel::Display, " - stat none: Hide all stat overlays");
+        AddLog(LogLevel::Display, " - bench all: Run every reference comparison check with small default sizes");
+        AddLog(LogLevel::Display, " - bench obj <path> [iterations]: Compare OBJ parser throughput");
+        AddLog(LogLevel::Display, " - bench asyncmesh [paths...]: Load meshes concurrently and compare with serial loads");
+        AddLog(LogLevel::Display, " - bench bvh <path> [rays]: Compare BVH ray picking with brute force");
+        AddLog(LogLevel::Display, " - bench raytri [triangles] [rays]: Compare scalar and SIMD ray-triangle tests");
+        AddLog(LogLevel::Display, " - bench cull [boxes] [iterations]: Compare per-object and SIMD frustum culling");
+        AddLog(LogLevel::Display, " - bench transform [components]: Compare per-component and batched hierarchy transform updates");
+        AddLog(LogLevel::Display, " - bench uobject [objects]: Compare TSet and chunked object array spawn, iterate and destroy");
+        AddLog(LogLevel::Display, " - bench ischildof [iterations]: Compare super-walk and base-chain IsChildOf");
+        AddLog(LogLevel::Display, " - bench spawn [objects]: Compare heap and pooled object spawn throughput and peak memory");
+        AddLog(LogLevel::Display, " - bench frame [frames] [elements]: Compare heap and frame arena transient arrays");
+        AddLog(LogLevel::Display, " - bench malloc [actors] [frames]: Compare system and binned allocators on container-heavy workloads");
+        AddLog(LogLevel::Display, " - bench flatmap [elements]: Compare TMap/TSet with TFlatMap/TFlatSet insert, find, iterate and remove");
+        AddLog(LogLevel::Display, " - bench fname [names]: Compare legacy and sharded name pool memory per name and concurrent FName construction");
+        AddLog(LogLevel::Display, " - bench projectile [projectiles] [frames]: Compare per-component and SoA projectile simulation");
+        AddLog(LogLevel::Display, " - bench particle [particles] [frames]: Compare AoS and SoA particle simulation and instance buffer packing");
+        AddLog(LogLevel::Display, " - bench meshbatch [components] [meshes] [frames]: Compare per-component and instanced static mesh draw preparation");
+        AddLog(LogLevel::Display, " - bench drawlist [draws] [frames]: Compare unsorted and sort-key ordered state changes, and radix sort with std::stable_sort");
+        AddLog(LogLevel::Display, " - bench cbuffer [objects] [frames]: Compare per-object constant buffer maps by name with handles, deduplication and a ring buffer");
+        AddLog(LogLevel::Display, " - log objects: Toggle logging every constructed object");
+        AddLog(LogLevel::Display, " - cook [directory] [-force]: Cook changed OBJ assets in parallel (default: Contents/)");
     }
     else if (command.starts_with("stat ")) { // stat 명령어 처리
         overlay.ToggleStat(command);
     }
+    else if (command.starts_with("bench ")) {
+        ExecuteBenchCommand(command);
+    }
+    else if (command == "log objects") {
+        FObjectFactory::bLogConstructObject = !FObjectFactory::bLogConstructObject;
+        AddLog(LogLevel::Display, "Object construct logging: %s", FObjectFactory::bLogConstructObject ? "on" : "off");
+    }
+    else if (command == "cook" || command.starts_with("cook ")) {
+        std::istringstream stream(command);
+        std::string cook, argument;
+        std::string directory = "Contents/";
+        bool bForce = false;
+        stream >> cook;
+        while (stream >> argument) {
+            if (argument == "-force") bForce = true;
+            else directory = argument;
+        }
+        FManagerOBJ::CookDirectory(directory, bForce);
+    }
     else {
         AddLog(LogLevel::Error, "Unknown command: %s", command.c_str());
     }
 }
 
+void Console::ExecuteBenchCommand(const std::string& command)
+{
+    std::istringstream stream(command);
+    std::string bench, target;
+    stream >> bench >> target;
+
+    if (target == "all")
+    {
+        EngineBenchmarks::RunAll();
+    }
+    else if (target == "obj")
+    {
+        std::string path;
+        int32 iterations = 5;
+        stream >> path;
+        if (int32 value; stream >> value)
+        {
+            iterations = value;
+        }
+        if (path.empty())
+        {
+            AddLog(LogLevel::Error, "Usage: bench obj <path> [iterations]");
+            return;
+        }
+        EngineBenchmarks::ObjParsing(path, iterations);
+    }
+    else if (target == "asyncmesh")
+    {
+        TArray<FString> paths;
+        for (std::string path; stream >> path;)
+        {
+            paths.Add(path);
+        }
+        // 경로가 없으면 Contents 아래의 모든 메시를 로드
+        if (paths.IsEmpty())
+        {
+            std::error_code errorCode;
+            for (const auto& entry : std::filesystem::recursive_directory_iterator("Contents/", errorCode))
+            {
+                if (entry.is_regular_file() && entry.path().extension() == ".obj")
+                {
+                    paths.Add(entry.path().string());
+                }
+            }
+        }
+        if (paths.IsEmpty())
+        {
+            AddLog(LogLevel::Error, "AsyncMesh Benchmark: No meshes to load");
+            return;
+        }
+        EngineBenchmarks::AsyncMeshLoading(paths, true);
+    }
+    else if (target == "bvh")
+    {
+        std::string path;
+        int32 rays = 10000;
+        stream >> path;
+        if (int32 value; stream >> value)
+        {
+            rays = value;
+        }
+        if (path.empty())
+        {
+            AddLog(LogLevel::Error, "Usage: bench bvh <path> [rays]");
+            return;
+        }
+        const OBJ::FStaticMeshRenderData* renderData = FManagerOBJ::LoadObjStaticMeshAsset(path);
+        if (renderData == nullptr)
+        {
+            AddLog(LogLevel::Error, "Failed to load mesh: %s", path.c_str());
+            return;
+        }
+        EngineBenchmarks::MeshPicking(*renderData, rays);
+    }
+    else if (target == "raytri")
+    {
+        int32 triangles = 4096;
+        int32 rays = 1000;
+        if (int32 value; stream >> value)
+        {
+            triangles = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            rays = value;
+        }
+        EngineBenchmarks::RayTriangleKernel(triangles, rays);
+    }
+    else if (target == "cull")
+    {
+        int32 boxes = 100000;
+        int32 iterations = 20;
+        if (int32 value; stream >> value)
+        {
+            boxes = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            iterations = value;
+        }
+        EngineBenchmarks::FrustumCulling(boxes, iterations);
+    }
+    else if (target == "transform")
+    {
+        int32 components = 100000;
+        if (int32 value; stream >> value)
+        {
+            components = value;
+        }
+        EngineBenchmarks::TransformHierarchy(components);
+    }
+    else if (target == "uobject")
+    {
+        int32 objects = 1000000;
+        if (int32 value; stream >> value)
+        {
+            objects = value;
+        }
+        EngineBenchmarks::UObjectArray(objects);
+    }
+    else if (target == "ischildof")
+    {
+        int32 iterations = 10000;
+        if (int32 value; stream >> value)
+        {
+            iterations = value;
+        }
+        EngineBenchmarks::ClassIsChildOf(iterations);
+    }
+    else if (target == "spawn")
+    {
+        int32 objects = 100000;
+        if (int32 value; stream >> value)
+        {
+            objects = value;
+        }
+        EngineBenchmarks::ObjectSpawning(objects);
+    }
+    else if (target == "frame")
+    {
+        int32 frames = 1000;
+        int32 elements = 256;
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            elements = value;
+        }
+        EngineBenchmarks::FrameArenaAllocation(frames, elements);
+    }
+    else if (target == "malloc")
+    {
+        int32 actors = 20000;
+        int32 frames = 1000;
+        if (int32 value; stream >> value)
+        {
+            actors = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::BinnedMalloc(actors, frames);
+    }
+    else if (target == "flatmap")
+    {
+        int32 elements = 100000;
+        if (int32 value; stream >> value)
+        {
+            elements = value;
+        }
+        EngineBenchmarks::FlatContainers(elements);
+    }
+    else if (target == "fname")
+    {
+        int32 names = 100000;
+        if (int32 value; stream >> value)
+        {
+            names = value;
+        }
+        EngineBenchmarks::NamePool(names);
+    }
+    else if (target == "projectile")
+    {
+        int32 projectiles = 100000;
+        int32 frames = 300;
+        if (int32 value; stream >> value)
+        {
+            projectiles = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::Projectiles(projectiles, frames);
+    }
+    else if (target == "particle")
+    {
+        int32 particles = 100000;
+        int32 frames = 300;
+        if (int32 value; stream >> value)
+        {
+            particles = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::ParticleSimulation(particles, frames);
+    }
+    else if (target == "meshbatch")
+    {
+        int32 components = 10000;
+        int32 meshes = 16;
+        int32 frames = 100;
+        if (int32 value; stream >> value)
+        {
+            components = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            meshes = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::MeshBatching(components, meshes, frames);
+    }
+    else if (target == "drawlist")
+    {
+        int32 draws = 20000;
+        int32 frames = 100;
+        if (int32 value; stream >> value)
+        {
+            draws = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::DrawCommandSorting(draws, frames);
+    }
+    else if (target == "cbuffer")
+    {
+        int32 objects = 10000;
+        int32 frames = 100;
+        if (int32 value; stream >> value)
+        {
+            objects = value;
+        }
+        if (int32 value; stream >> value)
+        {
+            frames = value;
+        }
+        EngineBenchmarks::ConstantBuffers(objects, frames);
+    }
+    else
+    {
+        AddLog(LogLevel::Error, "Unknown benchmark: %s", target.c_str());
+    }
+}
+
 void Console::OnResize(HWND hWnd)
 {
     RECT clientRect;
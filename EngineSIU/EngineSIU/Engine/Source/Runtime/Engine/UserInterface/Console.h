@@ -1,4 +1,6 @@
 #pragma once
+#include <mutex>
+
 #include "Define.h"
 #include "ImGUI/imgui.h"
 #include "PropertyEditor/IWindowToggleable.h"
@@ -17,6 +19,8 @@ class StatOverlay
 public:
     bool showFPS = false;
     bool showMemory = false;
+    bool showTransform = false;
+    bool showDraw = false;
     bool showRender = false;
 
     void ToggleStat(const std::string& command);
@@ -86,6 +90,16 @@ public:
     StatOverlay overlay;
 
 private:
+    // "bench <대상> [인자...]" 형태의 벤치마크 명령어 처리
+    void ExecuteBenchCommand(const std::string& command);
+
+    // 다른 스레드에서 추가된 로그를 items로 옮김, 메인 스레드에서만 호출
+    void FlushPendingLogs();
+
+    // AddLog는 워커 스레드에서도 호출되므로 items 대신 여기에 먼저 쌓음
+    std::mutex pendingMutex;
+    TArray<LogEntry> pendingItems;
+
     bool bExpand = true;
     UINT width;
     UINT height;
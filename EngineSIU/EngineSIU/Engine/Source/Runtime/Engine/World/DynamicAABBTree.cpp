@@ -0,0 +1,268 @@
+#include "DynamicAABBTree.h"
+
+int32 FDynamicAABBTree::CreateProxy(const FBoundingBox& Bounds, void* UserData)
+{
+    const int32 ProxyId = AllocateNode();
+
+    const FVector Margin = (Bounds.max - Bounds.min) * FatBoundsRatio;
+    FNode& Node = Nodes[ProxyId];
+    Node.Bounds = FBoundingBox(Bounds.min - Margin, Bounds.max + Margin);
+    Node.UserData = UserData;
+    Node.Height = 0;
+
+    InsertLeaf(ProxyId);
+    ++NumProxies;
+    return ProxyId;
+}
+
+void FDynamicAABBTree::DestroyProxy(int32 ProxyId)
+{
+    RemoveLeaf(ProxyId);
+    FreeNode(ProxyId);
+    --NumProxies;
+}
+
+bool FDynamicAABBTree::MoveProxy(int32 ProxyId, const FBoundingBox& Bounds)
+{
+    if (Contains(Nodes[ProxyId].Bounds, Bounds))
+    {
+        return false;
+    }
+
+    RemoveLeaf(ProxyId);
+
+    const FVector Margin = (Bounds.max - Bounds.min) * FatBoundsRatio;
+    Nodes[ProxyId].Bounds = FBoundingBox(Bounds.min - Margin, Bounds.max + Margin);
+
+    InsertLeaf(ProxyId);
+    return true;
+}
+
+int32 FDynamicAABBTree::AllocateNode()
+{
+    if (FreeList == INDEX_NONE)
+    {
+        Nodes.Add(FNode());
+        return Nodes.Num() - 1;
+    }
+
+    const int32 NodeId = FreeList;
+    FreeList = Nodes[NodeId].ParentOrNext;
+    Nodes[NodeId] = FNode();
+    return NodeId;
+}
+
+void FDynamicAABBTree::FreeNode(int32 NodeId)
+{
+    FNode& Node = Nodes[NodeId];
+    Node.UserData = nullptr;
+    Node.Child1 = Node.Child2 = INDEX_NONE;
+    Node.Height = -1;
+    Node.ParentOrNext = FreeList;
+    FreeList = NodeId;
+}
+
+void FDynamicAABBTree::InsertLeaf(int32 Leaf)
+{
+    if (Root == INDEX_NONE)
+    {
+        Root = Leaf;
+        Nodes[Root].ParentOrNext = INDEX_NONE;
+        return;
+    }
+
+    // 형제로 붙였을 때 늘어나는 표면적(자신과 조상들이 늘어나는 양)이 가장 작은 노드를 찾음
+    const FBoundingBox LeafBounds = Nodes[Leaf].Bounds;
+    int32 Index = Root;
+    while (!Nodes[Index].IsLeaf())
+    {
+        const FNode& Node = Nodes[Index];
+        const float Area = SurfaceArea(Node.Bounds);
+        const float CombinedArea = SurfaceArea(Union(Node.Bounds, LeafBounds));
+
+        // 여기에 새 부모를 만들어 붙이는 비용과, 더 내려갈 때 이 노드가 커지는 비용
+        const float Cost = 2.f * CombinedArea;
+        const float InheritanceCost = 2.f * (CombinedArea - Area);
+
+        auto GetDescendCost = [&](int32 Child)
+        {
+            const FNode& ChildNode = Nodes[Child];
+            const float NewArea = SurfaceArea(Union(LeafBounds, ChildNode.Bounds));
+            return (ChildNode.IsLeaf() ? NewArea : NewArea - SurfaceArea(ChildNode.Bounds)) + InheritanceCost;
+        };
+        const float Cost1 = GetDescendCost(Node.Child1);
+        const float Cost2 = GetDescendCost(Node.Child2);
+
+        if (Cost < Cost1 && Cost < Cost2)
+        {
+            break;
+        }
+        Index = Cost1 < Cost2 ? Node.Child1 : Node.Child2;
+    }
+
+    const int32 Sibling = Index;
+    const int32 OldParent = Nodes[Sibling].ParentOrNext;
+
+    // AllocateNode가 Nodes를 재할당할 수 있으므로 참조는 이후에 가져옴
+    const int32 NewParent = AllocateNode();
+    FNode& NewParentNode = Nodes[NewParent];
+    NewParentNode.ParentOrNext = OldParent;
+    NewParentNode.Bounds = Union(LeafBounds, Nodes[Sibling].Bounds);
+    NewParentNode.Height = Nodes[Sibling].Height + 1;
+    NewParentNode.Child1 = Sibling;
+    NewParentNode.Child2 = Leaf;
+    Nodes[Sibling].ParentOrNext = NewParent;
+    Nodes[Leaf].ParentOrNext = NewParent;
+
+    if (OldParent == INDEX_NONE)
+    {
+        Root = NewParent;
+    }
+    else if (Nodes[OldParent].Child1 == Sibling)
+    {
+        Nodes[OldParent].Child1 = NewParent;
+    }
+    else
+    {
+        Nodes[OldParent].Child2 = NewParent;
+    }
+
+    RefitAncestors(Nodes[Leaf].ParentOrNext);
+}
+
+void FDynamicAABBTree::RemoveLeaf(int32 Leaf)
+{
+    if (Leaf == Root)
+    {
+        Root = INDEX_NONE;
+        return;
+    }
+
+    const int32 Parent = Nodes[Leaf].ParentOrNext;
+    const int32 GrandParent = Nodes[Parent].ParentOrNext;
+    const int32 Sibling = Nodes[Parent].Child1 == Leaf ? Nodes[Parent].Child2 : Nodes[Parent].Child1;
+
+    // 부모 노드를 없애고 형제를 그 자리로 올림
+    Nodes[Sibling].ParentOrNext = GrandParent;
+    FreeNode(Parent);
+
+    if (GrandParent == INDEX_NONE)
+    {
+        Root = Sibling;
+        return;
+    }
+
+    if (Nodes[GrandParent].Child1 == Parent)
+    {
+        Nodes[GrandParent].Child1 = Sibling;
+    }
+    else
+    {
+        Nodes[GrandParent].Child2 = Sibling;
+    }
+    RefitAncestors(GrandParent);
+}
+
+void FDynamicAABBTree::RefitAncestors(int32 NodeId)
+{
+    int32 Index = NodeId;
+    while (Index != INDEX_NONE)
+    {
+        Index = Balance(Index);
+
+        FNode& Node = Nodes[Index];
+        const FNode& Child1 = Nodes[Node.Child1];
+        const FNode& Child2 = Nodes[Node.Child2];
+        Node.Height = 1 + std::max(Child1.Height, Child2.Height);
+        Node.Bounds = Union(Child1.Bounds, Child2.Bounds);
+
+        Index = Node.ParentOrNext;
+    }
+}
+
+int32 FDynamicAABBTree::Balance(int32 NodeId)
+{
+    const int32 A = NodeId;
+    if (Nodes[A].IsLeaf() || Nodes[A].Height < 2)
+    {
+        return A;
+    }
+
+    const int32 B = Nodes[A].Child1;
+    const int32 C = Nodes[A].Child2;
+    const int32 HeightDifference = Nodes[C].Height - Nodes[B].Height;
+    if (HeightDifference >= -1 && HeightDifference <= 1)
+    {
+        return A;
+    }
+
+    // 높은 쪽 자식(Up)을 A 자리로 올리고, A는 Up의 자식이 됨
+    // Up의 두 자식 중 높은 쪽은 Up에 남고 낮은 쪽은 A로 내려감
+    const bool bRotateChild2 = HeightDifference > 1;
+    const int32 Up = bRotateChild2 ? C : B;
+    const int32 Other = bRotateChild2 ? B : C;
+
+    const int32 F = Nodes[Up].Child1;
+    const int32 G = Nodes[Up].Child2;
+
+    // Up을 A의 자리로 올림
+    const int32 Parent = Nodes[A].ParentOrNext;
+    Nodes[Up].Child1 = A;
+    Nodes[Up].ParentOrNext = Parent;
+    Nodes[A].ParentOrNext = Up;
+
+    if (Parent == INDEX_NONE)
+    {
+        Root = Up;
+    }
+    else if (Nodes[Parent].Child1 == A)
+    {
+        Nodes[Parent].Child1 = Up;
+    }
+    else
+    {
+        Nodes[Parent].Child2 = Up;
+    }
+
+    const bool bKeepF = Nodes[F].Height > Nodes[G].Height;
+    const int32 Keep = bKeepF ? F : G;
+    const int32 Move = bKeepF ? G : F;
+
+    Nodes[Up].Child2 = Keep;
+    if (bRotateChild2)
+    {
+        Nodes[A].Child2 = Move;
+    }
+    else
+    {
+        Nodes[A].Child1 = Move;
+    }
+    Nodes[Move].ParentOrNext = A;
+
+    FNode& NodeA = Nodes[A];
+    NodeA.Bounds = Union(Nodes[Other].Bounds, Nodes[Move].Bounds);
+    NodeA.Height = 1 + std::max(Nodes[Other].Height, Nodes[Move].Height);
+
+    FNode& NodeUp = Nodes[Up];
+    NodeUp.Bounds = Union(NodeA.Bounds, Nodes[Keep].Bounds);
+    NodeUp.Height = 1 + std::max(NodeA.Height, Nodes[Keep].Height);
+
+    return Up;
+}
+
+FBoundingBox FDynamicAABBTree::Union(const FBoundingBox& A, const FBoundingBox& B)
+{
+    return FBoundingBox(A.min.ComponentMin(B.min), A.max.ComponentMax(B.max));
+}
+
+float FDynamicAABBTree::SurfaceArea(const FBoundingBox& Bounds)
+{
+    const FVector Extent = Bounds.max - Bounds.min;
+    return 2.f * (Extent.X * Extent.Y + Extent.Y * Extent.Z + Extent.Z * Extent.X);
+}
+
+bool FDynamicAABBTree::Contains(const FBoundingBox& Outer, const FBoundingBox& Inner)
+{
+    return Outer.min.X <= Inner.min.X && Outer.min.Y <= Inner.min.Y && Outer.min.Z <= Inner.min.Z
+        && Inner.max.X <= Outer.max.X && Inner.max.Y <= Outer.max.Y && Inner.max.Z <= Outer.max.Z;
+}
@@ -0,0 +1,138 @@
+#pragma once
+#include <algorithm>
+#include "Define.h"
+#include "CoreMiscDefines.h"
+
+/**
+ * 움직이는 오브젝트들의 바운딩 박스를 담는 Dynamic AABB Tree
+ *
+ * 각 프록시는 실제 바운딩 박스보다 조금 크게 저장되어, 조금씩 움직일 때는 트리를 고치지 않습니다.
+ * 삽입 시 표면적이 가장 적게 늘어나는 위치를 고르고, 회전으로 높이 균형을 맞춥니다.
+ */
+class FDynamicAABBTree
+{
+public:
+    // 저장되는 바운딩 박스를 실제 크기에 비해 늘리는 비율
+    static constexpr float FatBoundsRatio = 0.1f;
+
+    FDynamicAABBTree() = default;
+
+    /** 새 프록시를 만들고 ID를 반환합니다. */
+    int32 CreateProxy(const FBoundingBox& Bounds, void* UserData);
+
+    void DestroyProxy(int32 ProxyId);
+
+    /**
+     * 프록시의 바운딩 박스를 갱신합니다.
+     * @return 새 바운딩 박스가 저장된 박스를 벗어나 트리에 다시 넣었으면 true
+     */
+    bool MoveProxy(int32 ProxyId, const FBoundingBox& Bounds);
+
+    void* GetUserData(int32 ProxyId) const { return Nodes[ProxyId].UserData; }
+    const FBoundingBox& GetFatBounds(int32 ProxyId) const { return Nodes[ProxyId].Bounds; }
+
+    int32 GetNumProxies() const { return NumProxies; }
+    int32 GetHeight() const { return Root == INDEX_NONE ? 0 : Nodes[Root].Height; }
+
+    /**
+     * 레이와 겹치는 프록시를 레이가 바운딩 박스에 들어가는 거리가 가까운 순서로 방문합니다.
+     * @param Visitor float(void* UserData, float EnterDistance), 이후로 더 방문할 필요가 있는 최대 거리를 반환
+     */
+    template <typename FVisitor>
+    void RaycastSorted(const FVector& RayOrigin, const FVector& RayDirection, FVisitor&& Visitor) const;
+
+private:
+    struct FNode
+    {
+        FBoundingBox Bounds;
+        void* UserData = nullptr;
+
+        // 사용 중이면 부모 노드, 비어있으면 다음 빈 노드
+        int32 ParentOrNext = INDEX_NONE;
+        int32 Child1 = INDEX_NONE;
+        int32 Child2 = INDEX_NONE;
+
+        // 리프는 0, 빈 노드는 -1
+        int32 Height = -1;
+
+        bool IsLeaf() const { return Child1 == INDEX_NONE; }
+    };
+
+    int32 AllocateNode();
+    void FreeNode(int32 NodeId);
+
+    void InsertLeaf(int32 Leaf);
+    void RemoveLeaf(int32 Leaf);
+
+    /** NodeId를 루트로 하는 서브트리의 높이 차이가 1보다 크면 회전하고, 새 서브트리 루트를 반환합니다. */
+    int32 Balance(int32 NodeId);
+
+    /** NodeId부터 루트까지 올라가며 균형을 맞추고 높이와 바운딩 박스를 다시 계산합니다. */
+    void RefitAncestors(int32 NodeId);
+
+    static FBoundingBox Union(const FBoundingBox& A, const FBoundingBox& B);
+    static float SurfaceArea(const FBoundingBox& Bounds);
+    static bool Contains(const FBoundingBox& Outer, const FBoundingBox& Inner);
+
+private:
+    TArray<FNode> Nodes;
+    int32 Root = INDEX_NONE;
+    int32 FreeList = INDEX_NONE;
+    int32 NumProxies = 0;
+};
+
+template <typename FVisitor>
+void FDynamicAABBTree::RaycastSorted(const FVector& RayOrigin, const FVector& RayDirection, FVisitor&& Visitor) const
+{
+    if (Root == INDEX_NONE)
+    {
+        return;
+    }
+
+    struct FEntry
+    {
+        float EnterDistance;
+        int32 NodeId;
+
+        // std::push_heap은 최대 힙이므로 거리가 가까운 것이 앞에 오도록 뒤집음
+        bool operator<(const FEntry& Other) const { return EnterDistance > Other.EnterDistance; }
+    };
+
+    float MaxDistance = FLT_MAX;
+    float EnterDistance;
+    if (!Nodes[Root].Bounds.Intersect(RayOrigin, RayDirection, EnterDistance))
+    {
+        return;
+    }
+
+    TArray<FEntry> Heap;
+    Heap.Add({ EnterDistance, Root });
+    while (!Heap.IsEmpty())
+    {
+        std::pop_heap(Heap.begin(), Heap.end());
+        const FEntry Entry = Heap[Heap.Num() - 1];
+        Heap.RemoveAt(Heap.Num() - 1);
+
+        // 남은 노드는 모두 이보다 멀리 있음
+        if (Entry.EnterDistance > MaxDistance)
+        {
+            break;
+        }
+
+        const FNode& Node = Nodes[Entry.NodeId];
+        if (Node.IsLeaf())
+        {
+            MaxDistance = std::min(MaxDistance, Visitor(Node.UserData, Entry.EnterDistance));
+            continue;
+        }
+
+        for (const int32 ChildId : { Node.Child1, Node.Child2 })
+        {
+            if (Nodes[ChildId].Bounds.Intersect(RayOrigin, RayDirection, EnterDistance) && EnterDistance <= MaxDistance)
+            {
+                Heap.Add({ EnterDistance, ChildId });
+                std::push_heap(Heap.begin(), Heap.end());
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include "PrimitiveSpatialIndex.h"
+
+#include "Components/PrimitiveComponent.h"
+
+FPrimitiveSpatialIndex& FPrimitiveSpatialIndex::Get()
+{
+    static FPrimitiveSpatialIndex Instance;
+    return Instance;
+}
+
+void FPrimitiveSpatialIndex::Register(UPrimitiveComponent* Primitive)
+{
+    if (Primitive->bSpatiallyIndexed)
+    {
+        return;
+    }
+
+    // 등록 시점에는 Transform과 AABB가 아직 정해지지 않았을 수 있으므로 첫 검사 때 트리에 넣음
+    Primitive->bSpatiallyIndexed = true;
+    MarkDirty(Primitive);
+}
+
+void FPrimitiveSpatialIndex::Unregister(UPrimitiveComponent* Primitive)
+{
+    if (!Primitive->bSpatiallyIndexed)
+    {
+        return;
+    }
+
+    if (Primitive->bSpatialIndexDirty)
+    {
+        DirtyPrimitives.Remove(Primitive);
+        Primitive->bSpatialIndexDirty = false;
+    }
+
+    if (Primitive->SpatialProxyId != INDEX_NONE)
+    {
+        Tree.DestroyProxy(Primitive->SpatialProxyId);
+        Primitive->SpatialProxyId = INDEX_NONE;
+    }
+
+    if (Primitive->bSpatiallyUnbounded)
+    {
+        UnboundedPrimitives.Remove(Primitive);
+        Primitive->bSpatiallyUnbounded = false;
+    }
+
+    Primitive->bSpatiallyIndexed = false;
+}
+
+void FPrimitiveSpatialIndex::MarkDirty(UPrimitiveComponent* Primitive)
+{
+    if (!Primitive->bSpatiallyIndexed || Primitive->bSpatialIndexDirty)
+    {
+        return;
+    }
+
+    Primitive->bSpatialIndexDirty = true;
+    DirtyPrimitives.Add(Primitive);
+}
+
+const TArray<UPrimitiveComponent*>& FPrimitiveSpatialIndex::GetUnboundedPrimitives()
+{
+    UpdateDirtyPrimitives();
+    return UnboundedPrimitives;
+}
+
+void FPrimitiveSpatialIndex::UpdateDirtyPrimitives()
+{
+    for (UPrimitiveComponent* Primitive : DirtyPrimitives)
+    {
+        Primitive->bSpatialIndexDirty = false;
+
+        FBoundingBox Bounds;
+        if (Primitive->GetWorldBoundingBox(Bounds))
+        {
+            if (Primitive->bSpatiallyUnbounded)
+            {
+                UnboundedPrimitives.Remove(Primitive);
+                Primitive->bSpatiallyUnbounded = false;
+            }
+
+            if (Primitive->SpatialProxyId == INDEX_NONE)
+            {
+                Primitive->SpatialProxyId = Tree.CreateProxy(Bounds, Primitive);
+            }
+            else
+            {
+                Tree.MoveProxy(Primitive->SpatialProxyId, Bounds);
+            }
+        }
+        else
+        {
+            if (Primitive->SpatialProxyId != INDEX_NONE)
+            {
+                Tree.DestroyProxy(Primitive->SpatialProxyId);
+                Primitive->SpatialProxyId = INDEX_NONE;
+            }
+
+            if (!Primitive->bSpatiallyUnbounded)
+            {
+                UnboundedPrimitives.Add(Primitive);
+                Primitive->bSpatiallyUnbounded = true;
+            }
+        }
+    }
+    DirtyPrimitives.Empty();
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "DynamicAABBTree.h"
+
+class UPrimitiveComponent;
+
+/**
+ * 선택 가능한 UPrimitiveComponent들의 월드 공간 바운딩 박스를 담는 피킹용 공간 인덱스
+ *
+ * 컴포넌트는 InitializeComponent에서 등록되고, Transform이나 AABB가 바뀌면 Dirty로 표시됩니다.
+ * Dirty인 컴포넌트는 다음 레이 검사 직전에 한 번에 갱신됩니다.
+ */
+class FPrimitiveSpatialIndex
+{
+public:
+    static FPrimitiveSpatialIndex& Get();
+
+    // 복사 & 이동 생성자 제거
+    FPrimitiveSpatialIndex(const FPrimitiveSpatialIndex&) = delete;
+    FPrimitiveSpatialIndex& operator=(const FPrimitiveSpatialIndex&) = delete;
+    FPrimitiveSpatialIndex(FPrimitiveSpatialIndex&&) = delete;
+    FPrimitiveSpatialIndex& operator=(FPrimitiveSpatialIndex&&) = delete;
+
+    void Register(UPrimitiveComponent* Primitive);
+    void Unregister(UPrimitiveComponent* Primitive);
+
+    /** Primitive의 월드 바운딩 박스가 바뀌었음을 알립니다. 등록되지 않은 컴포넌트는 무시합니다. */
+    void MarkDirty(UPrimitiveComponent* Primitive);
+
+    /**
+     * 레이와 바운딩 박스가 겹치는 프리미티브를 레이가 바운딩 박스에 들어가는 거리가 가까운 순서로 방문합니다.
+     * @param Visitor float(UPrimitiveComponent* Primitive, float EnterDistance), 이후로 더 방문할 필요가 있는 최대 거리를 반환
+     */
+    template <typename FVisitor>
+    void RaycastSorted(const FVector& RayOrigin, const FVector& RayDirection, FVisitor&& Visitor);
+
+    /** 카메라를 향하는 빌보드처럼 고정된 월드 바운딩 박스가 없어 트리에 넣지 않는 프리미티브들 */
+    const TArray<UPrimitiveComponent*>& GetUnboundedPrimitives();
+
+    int32 GetNumPrimitives() const { return Tree.GetNumProxies() + UnboundedPrimitives.Num(); }
+
+private:
+    FPrimitiveSpatialIndex() = default;
+
+    /** Dirty인 프리미티브들의 바운딩 박스를 트리에 반영합니다. */
+    void UpdateDirtyPrimitives();
+
+private:
+    FDynamicAABBTree Tree;
+    TArray<UPrimitiveComponent*> DirtyPrimitives;
+    TArray<UPrimitiveComponent*> UnboundedPrimitives;
+};
+
+template <typename FVisitor>
+void FPrimitiveSpatialIndex::RaycastSorted(const FVector& RayOrigin, const FVector& RayDirection, FVisitor&& Visitor)
+{
+    UpdateDirtyPrimitives();
+    Tree.RaycastSorted(
+        RayOrigin, RayDirection,
+        [&Visitor](void* UserData, float EnterDistance)
+        {
+            return Visitor(static_cast<UPrimitiveComponent*>(UserData), EnterDistance);
+        }
+    );
+}
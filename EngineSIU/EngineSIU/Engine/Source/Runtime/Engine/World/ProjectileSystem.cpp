@@ -0,0 +1,243 @@
+#include "ProjectileSystem.h"
+
+#include <algorithm>
+#include <cmath>
+#include <xmmintrin.h>
+
+#include "Async/ParallelFor.h"
+#include "Components/ProjectileMovementComponent.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+
+int32 FProjectileSystem::Register(
+    UProjectileMovementComponent* Component, USceneComponent* Target,
+    const FVector& Velocity, float Gravity, float MaxSpeed, float Age, float Lifetime
+)
+{
+    const FVector Location = Target->GetRelativeLocation();
+    Components.Add(Component);
+    Targets.Add(Target);
+    PositionX.Add(Location.X);
+    PositionY.Add(Location.Y);
+    PositionZ.Add(Location.Z);
+    VelocityX.Add(Velocity.X);
+    VelocityY.Add(Velocity.Y);
+    VelocityZ.Add(Velocity.Z);
+    Gravities.Add(Gravity);
+    MaxSpeeds.Add(MaxSpeed);
+    Ages.Add(Age);
+    Lifetimes.Add(Lifetime);
+    ExpiredFlags.Add(0);
+    return Targets.Num() - 1;
+}
+
+void FProjectileSystem::Unregister(int32 Index)
+{
+    if (Targets[Index] != nullptr)
+    {
+        Components[Index] = nullptr;
+        Targets[Index] = nullptr;
+        ++NumDead;
+    }
+}
+
+void FProjectileSystem::SetVelocity(int32 Index, const FVector& Velocity)
+{
+    VelocityX[Index] = Velocity.X;
+    VelocityY[Index] = Velocity.Y;
+    VelocityZ[Index] = Velocity.Z;
+}
+
+void FProjectileSystem::Update(float DeltaTime)
+{
+    // Update 밖에서 제거된 투사체의 자리를 먼저 정리
+    Compact();
+    NumRetiredLastFrame = 0;
+
+    const int32 NumProjectiles = Num();
+    if (NumProjectiles == 0)
+    {
+        return;
+    }
+
+    const int32 NumTasks = std::max(NumProjectiles / MinProjectilesPerTask, 1);
+    // 작업 경계가 4의 배수가 되도록 나눔
+    const int32 ProjectilesPerTask = ((NumProjectiles + NumTasks - 1) / NumTasks + 3) & ~3;
+    ParallelFor(NumTasks, [this, NumProjectiles, ProjectilesPerTask, DeltaTime](int32 Task)
+    {
+        const int32 Begin = Task * ProjectilesPerTask;
+        const int32 End = std::min(Begin + ProjectilesPerTask, NumProjectiles);
+        if (Begin < End)
+        {
+            LoadPositions(Begin, End);
+            Integrate(Begin, End, DeltaTime);
+        }
+    });
+
+    // 컴포넌트에 쓰는 것은 계층 구조의 Dirty 표시를 건드리므로 호출한 스레드에서만 실행
+    for (int32 Index = 0; Index < NumProjectiles; ++Index)
+    {
+        USceneComponent* Target = Targets[Index];
+        if (Target == nullptr)
+        {
+            continue;
+        }
+        Target->SetRelativeLocation(FVector(PositionX[Index], PositionY[Index], PositionZ[Index]));
+
+        if (ExpiredFlags[Index])
+        {
+            ++NumRetiredLastFrame;
+            if (UProjectileMovementComponent* Component = Components[Index])
+            {
+                // Owner가 제거되면 컴포넌트의 EndPlay에서 Unregister가 호출됨
+                if (AActor* Owner = Component->GetOwner())
+                {
+                    Owner->Destroy();
+                }
+            }
+            else
+            {
+                Unregister(Index);
+            }
+        }
+    }
+
+    Compact();
+}
+
+void FProjectileSystem::LoadPositions(int32 Begin, int32 End)
+{
+    // 읽기만 하므로 워커 스레드에서 실행해도 됨
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        if (const USceneComponent* Target = Targets[Index])
+        {
+            const FVector Location = Target->GetRelativeLocation();
+            PositionX[Index] = Location.X;
+            PositionY[Index] = Location.Y;
+            PositionZ[Index] = Location.Z;
+        }
+    }
+}
+
+void FProjectileSystem::Integrate(int32 Begin, int32 End, float DeltaTime)
+{
+    float* PX = PositionX.GetData();
+    float* PY = PositionY.GetData();
+    float* PZ = PositionZ.GetData();
+    float* VX = VelocityX.GetData();
+    float* VY = VelocityY.GetData();
+    float* VZ = VelocityZ.GetData();
+    float* Age = Ages.GetData();
+    const float* Gravity = Gravities.GetData();
+    const float* MaxSpeed = MaxSpeeds.GetData();
+    const float* Lifetime = Lifetimes.GetData();
+    uint8* Expired = ExpiredFlags.GetData();
+
+    const __m128 Dt = _mm_set1_ps(DeltaTime);
+    const __m128 One = _mm_set1_ps(1.f);
+
+    int32 Index = Begin;
+    for (; Index + 4 <= End; Index += 4)
+    {
+        __m128 Vx = _mm_loadu_ps(VX + Index);
+        __m128 Vy = _mm_loadu_ps(VY + Index);
+        __m128 Vz = _mm_loadu_ps(VZ + Index);
+        Vz = _mm_add_ps(Vz, _mm_mul_ps(_mm_loadu_ps(Gravity + Index), Dt));
+
+        // MaxSpeed보다 빠르면 방향을 유지한 채 MaxSpeed로 줄임
+        const __m128 Max = _mm_loadu_ps(MaxSpeed + Index);
+        const __m128 Speed = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(Vx, Vx), _mm_mul_ps(Vy, Vy)), _mm_mul_ps(Vz, Vz)));
+        const __m128 ClampMask = _mm_cmpgt_ps(Speed, Max);
+        const __m128 Scale = _mm_or_ps(_mm_and_ps(ClampMask, _mm_div_ps(Max, Speed)), _mm_andnot_ps(ClampMask, One));
+        Vx = _mm_mul_ps(Vx, Scale);
+        Vy = _mm_mul_ps(Vy, Scale);
+        Vz = _mm_mul_ps(Vz, Scale);
+
+        _mm_storeu_ps(VX + Index, Vx);
+        _mm_storeu_ps(VY + Index, Vy);
+        _mm_storeu_ps(VZ + Index, Vz);
+        _mm_storeu_ps(PX + Index, _mm_add_ps(_mm_loadu_ps(PX + Index), _mm_mul_ps(Vx, Dt)));
+        _mm_storeu_ps(PY + Index, _mm_add_ps(_mm_loadu_ps(PY + Index), _mm_mul_ps(Vy, Dt)));
+        _mm_storeu_ps(PZ + Index, _mm_add_ps(_mm_loadu_ps(PZ + Index), _mm_mul_ps(Vz, Dt)));
+
+        const __m128 NewAge = _mm_add_ps(_mm_loadu_ps(Age + Index), Dt);
+        _mm_storeu_ps(Age + Index, NewAge);
+        const int32 ExpiredMask = _mm_movemask_ps(_mm_cmpge_ps(NewAge, _mm_loadu_ps(Lifetime + Index)));
+        for (int32 Lane = 0; Lane < 4; ++Lane)
+        {
+            Expired[Index + Lane] = static_cast<uint8>((ExpiredMask >> Lane) & 1);
+        }
+    }
+
+    // 4개가 안 되는 나머지는 같은 식을 하나씩 계산
+    for (; Index < End; ++Index)
+    {
+        VZ[Index] += Gravity[Index] * DeltaTime;
+        const float Speed = std::sqrt(VX[Index] * VX[Index] + VY[Index] * VY[Index] + VZ[Index] * VZ[Index]);
+        if (Speed > MaxSpeed[Index])
+        {
+            const float Scale = MaxSpeed[Index] / Speed;
+            VX[Index] *= Scale;
+            VY[Index] *= Scale;
+            VZ[Index] *= Scale;
+        }
+        PX[Index] += VX[Index] * DeltaTime;
+        PY[Index] += VY[Index] * DeltaTime;
+        PZ[Index] += VZ[Index] * DeltaTime;
+        Age[Index] += DeltaTime;
+        Expired[Index] = Age[Index] >= Lifetime[Index] ? 1 : 0;
+    }
+}
+
+void FProjectileSystem::Compact()
+{
+    if (NumDead == 0)
+    {
+        return;
+    }
+
+    int32 NumAlive = 0;
+    for (int32 Index = 0; Index < Num(); ++Index)
+    {
+        if (Targets[Index] == nullptr)
+        {
+            continue;
+        }
+        if (NumAlive != Index)
+        {
+            Components[NumAlive] = Components[Index];
+            Targets[NumAlive] = Targets[Index];
+            PositionX[NumAlive] = PositionX[Index];
+            PositionY[NumAlive] = PositionY[Index];
+            PositionZ[NumAlive] = PositionZ[Index];
+            VelocityX[NumAlive] = VelocityX[Index];
+            VelocityY[NumAlive] = VelocityY[Index];
+            VelocityZ[NumAlive] = VelocityZ[Index];
+            Gravities[NumAlive] = Gravities[Index];
+            MaxSpeeds[NumAlive] = MaxSpeeds[Index];
+            Ages[NumAlive] = Ages[Index];
+            Lifetimes[NumAlive] = Lifetimes[Index];
+            if (UProjectileMovementComponent* Component = Components[NumAlive])
+            {
+                Component->ProjectileIndex = NumAlive;
+            }
+        }
+        ++NumAlive;
+    }
+
+    Components.SetNum(NumAlive);
+    Targets.SetNum(NumAlive);
+    PositionX.SetNum(NumAlive);
+    PositionY.SetNum(NumAlive);
+    PositionZ.SetNum(NumAlive);
+    VelocityX.SetNum(NumAlive);
+    VelocityY.SetNum(NumAlive);
+    VelocityZ.SetNum(NumAlive);
+    Gravities.SetNum(NumAlive);
+    MaxSpeeds.SetNum(NumAlive);
+    Ages.SetNum(NumAlive);
+    Lifetimes.SetNum(NumAlive);
+    ExpiredFlags.SetNum(NumAlive);
+    NumDead = 0;
+}
@@ -0,0 +1,81 @@
+#pragma once
+#include "Define.h"
+
+class UProjectileMovementComponent;
+class USceneComponent;
+
+/**
+ * World에 있는 모든 투사체의 위치, 속도, 수명을 성분별 배열로 담아 한 번에 계산하는 시스템
+ *
+ * UProjectileMovementComponent는 BeginPlay에서 등록되고, 이후에는 TickComponent 대신 Update에서
+ * 4개씩 SIMD로 적분합니다. 적분은 워커 스레드에서 나눠 계산하고, 결과는 프레임마다 한 번 대상 컴포넌트에 씁니다.
+ * 위치는 적분하기 전에 대상 컴포넌트에서 다시 읽으므로, 밖에서 SetRelativeLocation으로 옮긴 투사체는 그 자리에서 이어서 움직입니다.
+ * 수명이 끝난 투사체는 Owner를 제거하고, 빠진 자리는 Update가 끝날 때 한 번에 채웁니다.
+ */
+class FProjectileSystem
+{
+public:
+    // 한 작업이 맡는 최소 투사체 수, 4의 배수
+    static constexpr int32 MinProjectilesPerTask = 4096;
+
+    FProjectileSystem() = default;
+
+    // 컴포넌트가 이 객체를 가리키므로 복사하거나 이동하지 않음
+    FProjectileSystem(const FProjectileSystem&) = delete;
+    FProjectileSystem& operator=(const FProjectileSystem&) = delete;
+    FProjectileSystem(FProjectileSystem&&) = delete;
+    FProjectileSystem& operator=(FProjectileSystem&&) = delete;
+
+    /**
+     * 투사체를 추가하고 인덱스를 반환합니다. 인덱스는 Update에서 빈 자리를 채우면 바뀔 수 있으며, Component의 ProjectileIndex에 반영됩니다.
+     * @param Component 상태를 돌려받을 컴포넌트, 없으면 수명이 끝났을 때 제거만 함
+     * @param Target 위치를 쓸 컴포넌트
+     */
+    int32 Register(
+        UProjectileMovementComponent* Component, USceneComponent* Target,
+        const FVector& Velocity, float Gravity, float MaxSpeed, float Age, float Lifetime
+    );
+
+    /** 투사체를 빈 자리로 표시합니다. 배열은 다음 Update에서 정리합니다. */
+    void Unregister(int32 Index);
+
+    /** 모든 투사체를 DeltaTime만큼 움직이고, 대상 컴포넌트에 위치를 쓰고, 수명이 끝난 투사체를 제거합니다. */
+    void Update(float DeltaTime);
+
+    FVector GetVelocity(int32 Index) const { return FVector(VelocityX[Index], VelocityY[Index], VelocityZ[Index]); }
+    float GetAge(int32 Index) const { return Ages[Index]; }
+
+    void SetVelocity(int32 Index, const FVector& Velocity);
+    void SetGravity(int32 Index, float Gravity) { Gravities[Index] = Gravity; }
+    void SetMaxSpeed(int32 Index, float MaxSpeed) { MaxSpeeds[Index] = MaxSpeed; }
+    void SetLifetime(int32 Index, float Lifetime) { Lifetimes[Index] = Lifetime; }
+
+    /** 빈 자리를 포함한 투사체 수 */
+    int32 Num() const { return Targets.Num(); }
+    int32 GetNumRetiredLastFrame() const { return NumRetiredLastFrame; }
+
+private:
+    /** [Begin, End) 범위의 위치를 대상 컴포넌트에서 다시 읽습니다. Update 밖에서 옮겨진 투사체도 옮겨진 자리에서 이어서 움직입니다. */
+    void LoadPositions(int32 Begin, int32 End);
+
+    /** [Begin, End) 범위를 적분하고 수명이 끝난 투사체를 ExpiredFlags에 표시합니다. */
+    void Integrate(int32 Begin, int32 End, float DeltaTime);
+
+    /** 빈 자리를 뒤의 투사체로 채웁니다. 순서는 유지합니다. */
+    void Compact();
+
+private:
+    TArray<UProjectileMovementComponent*> Components;
+    TArray<USceneComponent*> Targets;           // nullptr이면 빈 자리
+
+    TArray<float> PositionX, PositionY, PositionZ;
+    TArray<float> VelocityX, VelocityY, VelocityZ;
+    TArray<float> Gravities;
+    TArray<float> MaxSpeeds;
+    TArray<float> Ages;
+    TArray<float> Lifetimes;
+    TArray<uint8> ExpiredFlags;
+
+    int32 NumDead = 0;
+    int32 NumRetiredLastFrame = 0;
+};
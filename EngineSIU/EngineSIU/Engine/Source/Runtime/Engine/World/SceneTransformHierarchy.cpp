@@ -0,0 +1,387 @@
+#include "SceneTransformHierarchy.h"
+
+#include "Level.h"
+#include "Async/ParallelFor.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/Casts.h"
+
+namespace
+{
+    // 붙임 구조를 따라 올라간 맨 위 컴포넌트, 중간에 제거 중인(초기화가 풀린) 컴포넌트가 있으면 nullptr
+    USceneComponent* FindTopRoot(USceneComponent* Component)
+    {
+        while (Component && Component->HasBeenInitialized())
+        {
+            USceneComponent* Parent = Component->GetAttachParent();
+            if (Parent == nullptr)
+            {
+                return Component;
+            }
+            Component = Parent;
+        }
+        return nullptr;
+    }
+}
+
+void FSceneTransformHierarchy::Update(const ULevel* Level)
+{
+    if (!bBuilt)
+    {
+        Rebuild(Level);
+    }
+    else if (!PendingRoots.IsEmpty())
+    {
+        ApplyPendingRoots();
+    }
+
+    // 지운 자리가 많아지면 작업마다 빈 항목을 도는 시간이 늘어나므로 앞으로 당김
+    if (NumDeadEntries >= MinEntriesPerTask && NumDeadEntries * 2 > Num())
+    {
+        Compact();
+    }
+
+    UpdateDirtyTransforms();
+}
+
+void FSceneTransformHierarchy::MarkStructureDirty(USceneComponent* Component)
+{
+    if (USceneComponent* OldRoot = RemoveTreeOf(Component))
+    {
+        PendingRoots.Add(OldRoot);
+    }
+    if (USceneComponent* Root = FindTopRoot(Component))
+    {
+        PendingRoots.Add(Root);
+    }
+}
+
+void FSceneTransformHierarchy::RemoveComponent(USceneComponent* Component)
+{
+    MarkStructureDirty(Component);
+
+    // 남은 트리는 다시 추가하지만 Component 자신은 곧 해제되므로 뺌, Component의 자식들은 부모가 없어져 배열에서 빠짐
+    PendingRoots.Remove(Component);
+}
+
+void FSceneTransformHierarchy::AddActor(const AActor* Actor)
+{
+    for (UActorComponent* Component : Actor->GetComponents())
+    {
+        if (USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+        {
+            MarkStructureDirty(SceneComponent);
+        }
+    }
+}
+
+FMatrix FSceneTransformHierarchy::GetWorldMatrix(const USceneComponent* Component)
+{
+    if (const FSceneTransformHierarchy* Hierarchy = Component->TransformHierarchy)
+    {
+        // Rebuild 이후 배열에서 빠진 컴포넌트는 다른 컴포넌트의 자리를 가리킬 수 있으므로 주소로 확인
+        const int32 Index = Component->TransformHierarchyIndex;
+        if (Index < Hierarchy->Num() && Hierarchy->Components[Index] == Component && !Hierarchy->DirtyFlags[Index])
+        {
+            return Hierarchy->WorldMatrices[Index];
+        }
+    }
+    return Component->GetWorldMatrix();
+}
+
+void FSceneTransformHierarchy::MarkDirty(const USceneComponent* Component)
+{
+    const int32 Index = Component->TransformHierarchyIndex;
+    if (Index == INDEX_NONE || Index >= Num() || Components[Index] != Component)
+    {
+        return;
+    }
+
+    Locations[Index] = Component->RelativeLocation;
+    Rotations[Index] = Component->RelativeRotation;
+    Scales[Index] = Component->RelativeScale3D;
+    DirtyFlags[Index] = 1;
+}
+
+void FSceneTransformHierarchy::Rebuild(const ULevel* Level)
+{
+    Components.Empty();
+    ParentIndices.Empty();
+    Locations.Empty();
+    Rotations.Empty();
+    Scales.Empty();
+    DirtyFlags.Empty();
+    ScaleMatrices.Empty();
+    RotationMatrices.Empty();
+    TranslationMatrices.Empty();
+    WorldMatrices.Empty();
+
+    PendingRoots.Empty();
+    NumDeadEntries = 0;
+    bBuilt = true;
+
+    if (Level)
+    {
+        for (const AActor* Actor : Level->Actors)
+        {
+            for (UActorComponent* Component : Actor->GetComponents())
+            {
+                USceneComponent* Root = Cast<USceneComponent>(Component);
+                if (Root && Root->AttachParent == nullptr && Root->HasBeenInitialized())
+                {
+                    AppendTree(Root);
+                }
+            }
+        }
+    }
+
+    BuildTaskRanges();
+}
+
+void FSceneTransformHierarchy::AppendTree(USceneComponent* Root)
+{
+    // 전위 순회로 추가해서 서브트리가 연속하도록 함
+    AppendStack.Add({ Root, INDEX_NONE });
+    while (!AppendStack.IsEmpty())
+    {
+        const auto [SceneComponent, ParentIndex] = AppendStack[AppendStack.Num() - 1];
+        AppendStack.RemoveAt(AppendStack.Num() - 1);
+
+        const int32 Index = AddEntry(
+            SceneComponent, ParentIndex,
+            SceneComponent->RelativeLocation, SceneComponent->RelativeRotation, SceneComponent->RelativeScale3D
+        );
+        SceneComponent->TransformHierarchy = this;
+        SceneComponent->TransformHierarchyIndex = Index;
+
+        // 스택이므로 역순으로 넣어야 AttachChildren 순서대로 추가됨
+        // 제거되는 컴포넌트는 UninitializeComponent에서 부모의 AttachChildren에서 빠짐
+        const TArray<USceneComponent*>& Children = SceneComponent->AttachChildren;
+        for (int32 ChildIndex = Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+        {
+            if (Children[ChildIndex]->HasBeenInitialized())
+            {
+                AppendStack.Add({ Children[ChildIndex], Index });
+            }
+        }
+    }
+}
+
+USceneComponent* FSceneTransformHierarchy::RemoveTree(int32 RootIndex)
+{
+    USceneComponent* Root = Components[RootIndex];
+
+    // 트리는 루트부터 다음 루트나 지운 자리 전까지 이어져 있음
+    int32 Index = RootIndex;
+    do
+    {
+        Components[Index] = nullptr;
+        ParentIndices[Index] = INDEX_NONE;
+        DirtyFlags[Index] = 0;
+        ++NumDeadEntries;
+        ++Index;
+    }
+    while (Index < Num() && ParentIndices[Index] != INDEX_NONE);
+
+    return Root;
+}
+
+USceneComponent* FSceneTransformHierarchy::RemoveTreeOf(const USceneComponent* Component)
+{
+    int32 Index = Component->TransformHierarchyIndex;
+    if (Component->TransformHierarchy != this || Index == INDEX_NONE || Index >= Num() || Components[Index] != Component)
+    {
+        return nullptr;
+    }
+
+    while (ParentIndices[Index] != INDEX_NONE)
+    {
+        Index = ParentIndices[Index];
+    }
+    return RemoveTree(Index);
+}
+
+void FSceneTransformHierarchy::ApplyPendingRoots()
+{
+    const int32 OldNum = Num();
+    for (USceneComponent* Root : PendingRoots)
+    {
+        // 등록한 뒤에 다른 컴포넌트에 붙었으면 그 트리의 루트가 따로 등록되어 있음
+        if (Root->GetAttachParent() != nullptr || !Root->HasBeenInitialized())
+        {
+            continue;
+        }
+
+        RemoveTreeOf(Root);
+        AppendTree(Root);
+    }
+    PendingRoots.Empty();
+
+    ExtendTaskRanges(OldNum);
+}
+
+void FSceneTransformHierarchy::Compact()
+{
+    // 순서를 유지하므로 부모는 여전히 자식보다 앞에 있고 트리도 이어져 있음
+    TArray<int32> NewIndices;
+    NewIndices.SetNum(Num());
+
+    int32 NewNum = 0;
+    for (int32 Index = 0; Index < Num(); ++Index)
+    {
+        if (Components[Index] == nullptr)
+        {
+            NewIndices[Index] = INDEX_NONE;
+            continue;
+        }
+
+        const int32 ParentIndex = ParentIndices[Index];
+        NewIndices[Index] = NewNum;
+        ParentIndices[NewNum] = ParentIndex != INDEX_NONE ? NewIndices[ParentIndex] : INDEX_NONE;
+        Components[NewNum] = Components[Index];
+        Locations[NewNum] = Locations[Index];
+        Rotations[NewNum] = Rotations[Index];
+        Scales[NewNum] = Scales[Index];
+        DirtyFlags[NewNum] = DirtyFlags[Index];
+        ScaleMatrices[NewNum] = ScaleMatrices[Index];
+        RotationMatrices[NewNum] = RotationMatrices[Index];
+        TranslationMatrices[NewNum] = TranslationMatrices[Index];
+        WorldMatrices[NewNum] = WorldMatrices[Index];
+        Components[NewNum]->TransformHierarchyIndex = NewNum;
+        ++NewNum;
+    }
+
+    Components.SetNum(NewNum);
+    ParentIndices.SetNum(NewNum);
+    Locations.SetNum(NewNum);
+    Rotations.SetNum(NewNum);
+    Scales.SetNum(NewNum);
+    DirtyFlags.SetNum(NewNum);
+    ScaleMatrices.SetNum(NewNum);
+    RotationMatrices.SetNum(NewNum);
+    TranslationMatrices.SetNum(NewNum);
+    WorldMatrices.SetNum(NewNum);
+    NumDeadEntries = 0;
+
+    BuildTaskRanges();
+}
+
+int32 FSceneTransformHierarchy::AddEntry(USceneComponent* Component, int32 ParentIndex, const FVector& Location, const FRotator& Rotation, const FVector& Scale)
+{
+    const int32 Index = ParentIndices.Add(ParentIndex);
+    Components.Add(Component);
+    Locations.Add(Location);
+    Rotations.Add(Rotation);
+    Scales.Add(Scale);
+    DirtyFlags.Add(1);
+
+    const int32 NewNum = Index + 1;
+    ScaleMatrices.SetNum(NewNum);
+    RotationMatrices.SetNum(NewNum);
+    TranslationMatrices.SetNum(NewNum);
+    WorldMatrices.SetNum(NewNum);
+    return Index;
+}
+
+void FSceneTransformHierarchy::BuildTaskRanges()
+{
+    TaskBegins.Empty();
+    ExtendTaskRanges(0);
+}
+
+void FSceneTransformHierarchy::ExtendTaskRanges(int32 Begin)
+{
+    // 마지막 원소는 이전 배열의 끝이므로 빼고, 마지막 작업에 이어서 나눔
+    if (TaskBegins.IsEmpty())
+    {
+        TaskBegins.Add(0);
+    }
+    else
+    {
+        TaskBegins.RemoveAt(TaskBegins.Num() - 1);
+    }
+
+    // 루트에서만 나누므로 한 서브트리는 항상 한 작업 안에 들어감
+    for (int32 Index = Begin; Index < Num(); ++Index)
+    {
+        if (ParentIndices[Index] == INDEX_NONE && Index - TaskBegins[TaskBegins.Num() - 1] >= MinEntriesPerTask)
+        {
+            TaskBegins.Add(Index);
+        }
+    }
+    TaskBegins.Add(Num());
+
+    TaskNumUpdated.SetNum(TaskBegins.Num() - 1);
+}
+
+int32 FSceneTransformHierarchy::UpdateRange(int32 Begin, int32 End)
+{
+    int32 NumUpdated = 0;
+    for (int32 Index = Begin; Index < End; ++Index)
+    {
+        const int32 ParentIndex = ParentIndices[Index];
+        if (ParentIndex != INDEX_NONE)
+        {
+            DirtyFlags[Index] |= DirtyFlags[ParentIndex];
+        }
+        if (!DirtyFlags[Index])
+        {
+            continue;
+        }
+
+        ++NumUpdated;
+
+        // USceneComponent::UpdateWorldTransformCache와 같은 순서로 계산해야 같은 값이 나옴
+        const FMatrix ScaleMat = FMatrix::GetScaleMatrix(Scales[Index]);
+        const FMatrix RotationMat = FMatrix::GetRotationMatrix(Rotations[Index]);
+        const FMatrix TranslationMat = FMatrix::GetTranslationMatrix(Locations[Index]);
+        const FMatrix RTMat = RotationMat * TranslationMat;
+
+        if (ParentIndex != INDEX_NONE)
+        {
+            ScaleMatrices[Index] = ScaleMat * ScaleMatrices[ParentIndex];
+            RotationMatrices[Index] = RotationMat * RotationMatrices[ParentIndex];
+            TranslationMatrices[Index] = TranslationMat * TranslationMatrices[ParentIndex];
+
+            const FMatrix ParentRTMat = RotationMatrices[ParentIndex] * TranslationMatrices[ParentIndex];
+            WorldMatrices[Index] = ScaleMatrices[Index] * (RTMat * ParentRTMat);
+        }
+        else
+        {
+            ScaleMatrices[Index] = ScaleMat;
+            RotationMatrices[Index] = RotationMat;
+            TranslationMatrices[Index] = TranslationMat;
+            WorldMatrices[Index] = ScaleMat * RTMat;
+        }
+    }
+
+    // 자식이 부모의 Dirty를 읽은 뒤에 지움
+    if (NumUpdated > 0)
+    {
+        std::fill(DirtyFlags.GetData() + Begin, DirtyFlags.GetData() + End, static_cast<uint8>(0));
+    }
+    return NumUpdated;
+}
+
+void FSceneTransformHierarchy::UpdateDirtyTransforms()
+{
+    const int32 NumTasks = TaskBegins.Num() - 1;
+    if (NumTasks <= 1)
+    {
+        NumUpdatedLastFrame = UpdateRange(0, Num());
+        return;
+    }
+
+    ParallelFor(
+        NumTasks, [this](int32 TaskIndex)
+        {
+            TaskNumUpdated[TaskIndex] = UpdateRange(TaskBegins[TaskIndex], TaskBegins[TaskIndex + 1]);
+        }
+    );
+
+    NumUpdatedLastFrame = 0;
+    for (const int32 TaskUpdated : TaskNumUpdated)
+    {
+        NumUpdatedLastFrame += TaskUpdated;
+    }
+}
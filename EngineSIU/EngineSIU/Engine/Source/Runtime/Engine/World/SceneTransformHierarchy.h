@@ -0,0 +1,130 @@
+#pragma once
+#include "Define.h"
+#include "Container/Set.h"
+#include "Math/Rotator.h"
+
+class AActor;
+class ULevel;
+class USceneComponent;
+
+/**
+ * World에 있는 모든 USceneComponent의 Transform을 부모가 자식보다 앞에 오도록 펼쳐 담은 배열
+ *
+ * 컴포넌트의 Relative Transform이 바뀌면 배열의 값만 갱신하고 Dirty로 표시해 두었다가,
+ * Update에서 Dirty인 항목의 월드 행렬을 앞에서부터 한 번에 다시 계산합니다.
+ * 루트 컴포넌트마다 서브트리가 연속해 있으므로, 서로 다른 서브트리는 워커 스레드에서 나눠 계산합니다.
+ *
+ * 컴포넌트가 추가, 제거되거나 붙임 구조가 바뀌면 그 컴포넌트가 속한 루트의 트리만 배열에서 지우고 Update에서 배열 끝에 다시 추가합니다.
+ * 다시 추가한 트리만 Dirty가 되고, 지운 자리는 배열의 절반을 넘을 때 순서를 유지한 채 앞으로 당깁니다.
+ */
+class FSceneTransformHierarchy
+{
+public:
+    // 한 작업이 맡는 최소 항목 수, 전체가 이보다 적으면 호출한 스레드에서만 계산
+    static constexpr int32 MinEntriesPerTask = 1024;
+
+    FSceneTransformHierarchy() = default;
+
+    // 컴포넌트가 이 객체를 가리키므로 복사하거나 이동하지 않음
+    FSceneTransformHierarchy(const FSceneTransformHierarchy&) = delete;
+    FSceneTransformHierarchy& operator=(const FSceneTransformHierarchy&) = delete;
+    FSceneTransformHierarchy(FSceneTransformHierarchy&&) = delete;
+    FSceneTransformHierarchy& operator=(FSceneTransformHierarchy&&) = delete;
+
+    /**
+     * 처음 호출될 때 Level의 Actor들로부터 배열을 만들고, 이후에는 붙임 구조가 바뀐 트리만 다시 추가한 뒤
+     * Dirty인 항목의 월드 행렬을 다시 계산합니다.
+     */
+    void Update(const ULevel* Level);
+
+    /**
+     * 컴포넌트가 추가되거나 붙임 구조가 바뀔 때, 바꾸기 전과 바꾼 뒤에 한 번씩 호출합니다.
+     * 배열에 있는 컴포넌트면 그 트리를 바로 지우고, 바꾸기 전과 바꾼 뒤의 루트를 Update에서 다시 추가합니다.
+     */
+    void MarkStructureDirty(USceneComponent* Component);
+
+    /** 제거되는 컴포넌트를 배열과 다시 추가할 루트 목록에서 뺍니다. 컴포넌트가 부모에서 떨어지기 전에 호출해야 합니다. */
+    void RemoveComponent(USceneComponent* Component);
+
+    /** 생성자에서 붙임 구조를 만든 뒤 World에 추가된 Actor의 컴포넌트들을 다시 추가할 루트로 등록합니다. */
+    void AddActor(const AActor* Actor);
+
+    /**
+     * 배열에 있는 컴포넌트면 배열의 월드 행렬을, 없거나 아직 갱신되지 않았으면 USceneComponent::GetWorldMatrix를 반환합니다.
+     * 렌더 패스나 피킹처럼 한 프레임에 여러 번 행렬을 읽는 곳에서 사용합니다.
+     */
+    static FMatrix GetWorldMatrix(const USceneComponent* Component);
+
+    /** 컴포넌트의 Relative Transform을 배열에 복사하고 Dirty로 표시합니다. 배열에 없는 컴포넌트는 무시합니다. */
+    void MarkDirty(const USceneComponent* Component);
+
+    int32 Num() const { return ParentIndices.Num(); }
+
+    /** 마지막 Update에서 월드 행렬을 다시 계산한 항목 수 */
+    int32 GetNumUpdatedLastFrame() const { return NumUpdatedLastFrame; }
+
+    /** 지워졌지만 아직 앞으로 당기지 않은 항목 수 */
+    int32 GetNumDeadEntries() const { return NumDeadEntries; }
+
+private:
+    void Rebuild(const ULevel* Level);
+
+    /** 항목을 추가하고 인덱스를 반환합니다. 부모는 먼저 추가되어 있어야 합니다. */
+    int32 AddEntry(USceneComponent* Component, int32 ParentIndex, const FVector& Location, const FRotator& Rotation, const FVector& Scale);
+
+    /** Root와 그 자손들을 전위 순회 순서로 배열 끝에 추가합니다. */
+    void AppendTree(USceneComponent* Root);
+
+    /** RootIndex에서 시작하는 트리의 항목들을 지운 자리로 표시하고, 다시 추가할 수 있도록 루트 컴포넌트를 반환합니다. */
+    USceneComponent* RemoveTree(int32 RootIndex);
+
+    /** 배열에 있으면 Component의 트리를 지우고 그 루트 컴포넌트를 반환합니다. */
+    USceneComponent* RemoveTreeOf(const USceneComponent* Component);
+
+    /** PendingRoots의 트리들을 지우고 배열 끝에 다시 추가합니다. */
+    void ApplyPendingRoots();
+
+    /** 지운 자리를 빼고 남은 항목을 순서대로 앞으로 당깁니다. 계산해 둔 행렬과 Dirty는 그대로 유지합니다. */
+    void Compact();
+
+    /** 루트 항목마다 서브트리가 이어져 있다는 가정으로 작업 범위를 나눕니다. */
+    void BuildTaskRanges();
+
+    /** 마지막 작업 범위를 Begin부터 배열 끝까지 이어서 나눕니다. Begin 앞의 작업 범위는 그대로 둡니다. */
+    void ExtendTaskRanges(int32 Begin);
+
+    /** [Begin, End) 범위를 앞에서부터 계산합니다. 범위 안 항목의 부모는 모두 범위 안에 있어야 합니다. */
+    int32 UpdateRange(int32 Begin, int32 End);
+
+    void UpdateDirtyTransforms();
+
+private:
+    TArray<USceneComponent*> Components;        // 지운 자리는 nullptr
+    TArray<int32> ParentIndices;                // 부모가 없거나 지운 자리면 INDEX_NONE
+
+    // Relative Transform
+    TArray<FVector> Locations;
+    TArray<FRotator> Rotations;
+    TArray<FVector> Scales;
+    TArray<uint8> DirtyFlags;
+
+    // USceneComponent와 같은 방식으로 부모까지 누적한 행렬
+    TArray<FMatrix> ScaleMatrices;
+    TArray<FMatrix> RotationMatrices;
+    TArray<FMatrix> TranslationMatrices;
+    TArray<FMatrix> WorldMatrices;
+
+    // 작업 i는 [TaskBegins[i], TaskBegins[i + 1]) 범위를 계산, 마지막 원소는 Num()
+    TArray<int32> TaskBegins;
+    TArray<int32> TaskNumUpdated;
+
+    // 다음 Update에서 트리를 다시 추가할 루트 컴포넌트
+    TSet<USceneComponent*> PendingRoots;
+
+    // AppendTree에서 매번 할당하지 않도록 유지하는 전위 순회 스택
+    TArray<std::pair<USceneComponent*, int32>> AppendStack;
+
+    bool bBuilt = false;
+    int32 NumDeadEntries = 0;
+    int32 NumUpdatedLastFrame = 0;
+};
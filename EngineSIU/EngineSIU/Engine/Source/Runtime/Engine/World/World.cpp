@@ -46,6 +46,16 @@ void UWorld::Tick(float DeltaTime)
     PendingBeginPlayActors.Empty();
 }
 
+void UWorld::UpdateTransformHierarchy()
+{
+    TransformHierarchy.Update(ActiveLevel);
+}
+
+void UWorld::UpdateProjectiles(float DeltaTime)
+{
+    ProjectileSystem.Update(DeltaTime);
+}
+
 void UWorld::BeginPlay()
 {
     for (AActor* Actor : ActiveLevel->Actors)
@@ -88,6 +98,9 @@ AActor* UWorld::SpawnActor(UClass* InClass)
         // Actor->InitializeComponents();
         ActiveLevel->Actors.Add(NewActor);
         PendingBeginPlayActors.Add(NewActor);
+
+        // 생성자에서 추가된 컴포넌트는 아직 World를 몰라서 등록하지 못했으므로 여기서 등록
+        TransformHierarchy.AddActor(NewActor);
         return NewActor;
     }
     return nullptr;
@@ -5,6 +5,8 @@
 #include "UObject/ObjectMacros.h"
 #include "WorldType.h"
 #include "Level.h"
+#include "SceneTransformHierarchy.h"
+#include "ProjectileSystem.h"
 
 class FObjectFactory;
 class AActor;
@@ -27,6 +29,15 @@ public:
     void Tick(float DeltaTime);
     void BeginPlay();
 
+    /** Actor들의 Tick이 끝난 뒤 호출해서, 이번 프레임에 바뀐 컴포넌트들의 월드 행렬을 한 번에 계산합니다. */
+    void UpdateTransformHierarchy();
+    FSceneTransformHierarchy& GetTransformHierarchy() { return TransformHierarchy; }
+    const FSceneTransformHierarchy& GetTransformHierarchy() const { return TransformHierarchy; }
+
+    /** Actor들의 Tick이 끝난 뒤, UpdateTransformHierarchy 전에 호출해서 등록된 투사체를 한 번에 움직입니다. */
+    void UpdateProjectiles(float DeltaTime);
+    FProjectileSystem& GetProjectileSystem() { return ProjectileSystem; }
+
     void Release();
 
     /**
@@ -65,6 +76,9 @@ private:
     /** Actor가 Spawn되었고, 아직 BeginPlay가 호출되지 않은 Actor들 */
     TArray<AActor*> PendingBeginPlayActors;
 
+    FSceneTransformHierarchy TransformHierarchy;
+
+    FProjectileSystem ProjectileSystem;
 };
 
 
@@ -65,12 +65,12 @@ void UGizmoBaseComponent::TickComponent(float DeltaTime)
             float Scaler = (ViewportClient->ViewTransformPerspective.GetLocation() - GetOwner()->GetActorLocation()).Length();
             
             Scaler *= 0.1f;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
         else
         {
             float Scaler = FEditorViewportClient::orthoSize * 0.1f;
-            RelativeScale3D = FVector(Scaler);
+            SetRelativeScale3D(FVector(Scaler));
         }
     }
 }
@@ -20,7 +20,8 @@ public:
         ScaleZ
     };
 public:
-    UGizmoBaseComponent() = default;
+    // 기즈모는 PickGizmo에서 따로 검사하므로 액터 피킹 대상에서 제외
+    UGizmoBaseComponent() { bSelectable = false; }
 
     virtual int CheckRayIntersection(FVector& rayOrigin, FVector& rayDirection, float& pfNearHitDistance) override;
     virtual void TickComponent(float DeltaTime) override;
@@ -1,6 +1,7 @@
 #pragma once
 #include <cmath>
 #include <algorithm>
+#include <memory>
 #include "Core/Container/String.h"
 #include "Core/Container/Array.h"
 #include "UObject/NameTypes.h"
@@ -116,6 +117,8 @@ struct FObjMaterialInfo
     FWString AlphaTexturePath;
 };
 
+struct FStaticMeshBVH;
+
 // Cooked Data
 namespace OBJ
 {
@@ -135,6 +138,9 @@ namespace OBJ
 
         FVector BoundingBoxMin;
         FVector BoundingBoxMax;
+
+        // 피킹용 삼각형 BVH, FManagerOBJ::BuildStaticMeshRenderData()에서 렌더 데이터와 같이 만들어짐
+        std::shared_ptr<FStaticMeshBVH> BVH;
     };
 }
 
@@ -267,19 +273,15 @@ struct FBoundingBox
         // 중심을 월드 공간으로 변환
         FVector worldCenter = worldMatrix.TransformPosition(center);
 
-        // 행렬의 상위 3x3 부분의 절대값 벡터를 사용하여 각 축에 대한 확장량 계산
-        // (FVector::GetAbs()와 DotProduct() 함수가 사용됨)
-        FVector row0(worldMatrix.M[0][0], worldMatrix.M[0][1], worldMatrix.M[0][2]);
-        FVector row1(worldMatrix.M[1][0], worldMatrix.M[1][1], worldMatrix.M[1][2]);
-        FVector row2(worldMatrix.M[2][0], worldMatrix.M[2][1], worldMatrix.M[2][2]);
-
-        FVector::GetAbs(row0);
-        FVector::GetAbs(row1);
-        FVector::GetAbs(row2);
+        // 행렬의 상위 3x3 부분의 각 열의 절대값 벡터를 사용하여 각 축에 대한 확장량 계산
+        // (행 벡터 * 행렬 규약이므로 월드 X축 확장량은 0번 열과 extents의 내적)
+        const FVector column0 = FVector::GetAbs(FVector(worldMatrix.M[0][0], worldMatrix.M[1][0], worldMatrix.M[2][0]));
+        const FVector column1 = FVector::GetAbs(FVector(worldMatrix.M[0][1], worldMatrix.M[1][1], worldMatrix.M[2][1]));
+        const FVector column2 = FVector::GetAbs(FVector(worldMatrix.M[0][2], worldMatrix.M[1][2], worldMatrix.M[2][2]));
 
-        float worldExtentX = row0.Dot(extents);
-        float worldExtentY = row1.Dot(extents);
-        float worldExtentZ = row2.Dot(extents);
+        float worldExtentX = column0.Dot(extents);
+        float worldExtentY = column1.Dot(extents);
+        float worldExtentZ = column2.Dot(extents);
 
         FVector worldExtents(worldExtentX, worldExtentY, worldExtentZ);
 
@@ -443,6 +445,20 @@ struct FSubUVConstant
     FLinearColor TintColor;
 };
 
+struct FParticleConstants
+{
+    FVector CameraRight;
+    float Pad0;
+    FVector CameraUp;
+    float Pad1;
+};
+
+struct FInstanceConstants
+{
+    uint32 BaseInstance;
+    FVector Pad;
+};
+
 struct FSubMeshConstants {
     float isSelectedSubMesh;
     FVector pad;
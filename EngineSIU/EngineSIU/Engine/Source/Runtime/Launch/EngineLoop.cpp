@@ -3,6 +3,7 @@
 #include "UnrealClient.h"
 #include "World/World.h"
 #include "Camera/CameraComponent.h"
+#include "Components/SceneComponent.h"
 #include "LevelEditor/SLevelEditor.h"
 #include "PropertyEditor/ViewportTypePanel.h"
 #include "Slate/Widgets/Layout/SSplitter.h"
@@ -11,6 +12,10 @@
 #include "D3D11RHI/GraphicDevice.h"
 
 #include "Engine/EditorEngine.h"
+#include "Engine/CookDatabase.h"
+#include "Engine/FLoaderOBJ.h"
+#include "Async/QueuedThreadPool.h"
+#include "HAL/FrameArena.h"
 
 
 extern LRESULT ImGui_ImplWin32_WndProcHandler(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam);
@@ -115,6 +120,8 @@ int32 FEngineLoop::Init(HINSTANCE hInstance)
     /* must be initialized before window. */
     WindowInit(hInstance);
 
+    FQueuedThreadPool::Get().Startup();
+
     UnrealEditor = new UnrealEd();
 
     bufferManager = new FDXDBufferManager();
@@ -193,6 +200,8 @@ void FEngineLoop::Tick()
     {
         QueryPerformanceCounter(&startTime);
 
+        USceneComponent::ResetNumWorldTransformUpdates();
+
         MSG msg;
         while (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
         {
@@ -209,6 +218,10 @@ void FEngineLoop::Tick()
         float DeltaTime = elapsedTime / 1000.f;
 
         Input();
+
+        // 워커 스레드에서 로드가 끝난 스태틱 메시 등록
+        FManagerOBJ::ProcessAsyncLoads();
+
         GEngine->Tick(DeltaTime);
         LevelEditor->Tick(DeltaTime);
         Render();
@@ -223,6 +236,9 @@ void FEngineLoop::Tick()
         GUObjectArray.ProcessPendingDestroyObjects();
 
         GraphicDevice.SwapBuffer();
+
+        // 지난 프레임에 쓴 임시 메모리를 비워서 다음 프레임에 사용
+        FFrameArena::Get().EndFrame();
         do
         {
             Sleep(0);
@@ -268,6 +284,11 @@ void FEngineLoop::Exit()
     ResourceManager.Release(&Renderer);
     Renderer.Release();
     GraphicDevice.Release();
+    FQueuedThreadPool::Get().Shutdown();
+    FFrameArena::Get().ReleaseMemory();
+
+    // 워커 스레드가 모두 끝난 뒤 쿠킹 기록 저장
+    FCookDatabase::Get().SaveIfDirty();
 }
 
 
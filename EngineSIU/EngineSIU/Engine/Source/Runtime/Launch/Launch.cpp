@@ -1,5 +1,8 @@
 #include "Core/HAL/PlatformType.h"
 #include "EngineLoop.h"
+#include "Benchmark/EngineBenchmarks.h"
+
+#include <cstring>
 
 FEngineLoop GEngineLoop;
 
@@ -8,9 +11,14 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine
 {
     // 사용 안하는 파라미터들
     UNREFERENCED_PARAMETER(hPrevInstance);
-    UNREFERENCED_PARAMETER(lpCmdLine);
     UNREFERENCED_PARAMETER(nShowCmd);
 
+    // -bench: 창을 만들지 않고 모든 검사를 실행한 뒤, 실패한 검사 수를 종료 코드로 반환
+    if (lpCmdLine && std::strstr(lpCmdLine, "-bench"))
+    {
+        return EngineBenchmarks::RunAll();
+    }
+
     GEngineLoop.Init(hInstance);
     GEngineLoop.Tick();
     GEngineLoop.Exit();
@@ -42,6 +42,10 @@ void FBillboardRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraph
     BufferManager = InBufferManager;
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
+
+    PerObjectConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FPerObjectConstantBuffer"));
+    SubUVConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FSubUVConstant"));
+
     CreateShader();
 }
 
@@ -70,12 +74,9 @@ void FBillboardRenderPass::CreateShader()
 void FBillboardRenderPass::PrepareRender()
 {
     BillboardObjs.Empty();
-    for (const auto iter : TObjectRange<UBillboardComponent>())
+    for (const auto iter : TObjectRange<UBillboardComponent>(GEngine->ActiveWorld))
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            BillboardObjs.Add(iter);
-        }
+        BillboardObjs.Add(iter);
     }
 }
 
@@ -85,9 +86,8 @@ void FBillboardRenderPass::PrepareTextureShader() const
     Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
-    BufferManager->BindConstantBuffer(TEXT("FPerObjectConstantBuffer"), 0, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FSubUVConstant"), 1, EShaderStage::Vertex);
-    BufferManager->BindConstantBuffer(TEXT("FSubUVConstant"), 1, EShaderStage::Pixel);
+    BufferManager->BindConstantBuffer(SubUVConstantBuffer, 1, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(SubUVConstantBuffer, 1, EShaderStage::Pixel);
 }
 
 void FBillboardRenderPass::PrepareSubUVConstant() const
@@ -102,7 +102,7 @@ void FBillboardRenderPass::UpdateSubUVConstant(FVector2D uvOffset, FVector2D uvS
     data.uvScale = uvScale;
     data.TintColor = tintColor;
 
-    BufferManager->UpdateConstantBuffer(TEXT("FSubUVConstant"), data);
+    BufferManager->UpdateConstantBuffer(SubUVConstantBuffer, data);
 }
 
 void FBillboardRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const
@@ -111,7 +111,8 @@ void FBillboardRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const F
     FMatrix NormalMatrix = RendererHelpers::CalculateNormalMatrix(Model);
     FPerObjectConstantBuffer data(MVP, NormalMatrix, UUIDColor, Selected);
 
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), data);
+    const FTransientConstantBuffer Transient = BufferManager->UploadTransientConstantBuffer(PerObjectConstantBuffer, data);
+    BufferManager->BindTransientConstantBuffer(Transient, 0, EShaderStage::Vertex);
 }
 
 void FBillboardRenderPass::RenderTexturePrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices, ID3D11ShaderResourceView* TextureSRV, ID3D11SamplerState* SamplerState) const
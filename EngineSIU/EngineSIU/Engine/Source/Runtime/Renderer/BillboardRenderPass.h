@@ -5,6 +5,7 @@
 #include "Container/Set.h"
 
 #include "Define.h"
+#include "D3D11RHI/ConstantBufferUploader.h"
 
 class UBillboardComponent;
 class FDXDBufferManager;
@@ -22,6 +23,7 @@ public:
     virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManage) override;
 
     virtual void PrepareRender() override;
+    // 빌보드마다 바뀌므로 링 버퍼에 올리고 버텍스 셰이더의 b0에 바인딩
     void UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const;
 
     virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
@@ -59,6 +61,10 @@ private:
     uint32 Stride;
 
     FDXDBufferManager* BufferManager;
+
+    // Initialize에서 찾아둔 상수 버퍼
+    FConstantBufferHandle PerObjectConstantBuffer;
+    FConstantBufferHandle SubUVConstantBuffer;
     
     FGraphicsDevice* Graphics;
     
@@ -0,0 +1,168 @@
+#include "DrawCommandList.h"
+
+#include <algorithm>
+
+namespace
+{
+constexpr uint64 BitMask(uint32 NumBits)
+{
+    return (uint64(1) << NumBits) - 1;
+}
+}
+
+uint64 FDrawCommandList::MakeSortKey(uint32 ShaderVariant, uint32 MaterialId, uint32 MeshId, uint32 Depth)
+{
+    static_assert(ShaderVariantBits + MaterialBits + MeshBits + DepthBits <= 64);
+
+    uint64 Key = ShaderVariant & BitMask(ShaderVariantBits);
+    Key = (Key << MaterialBits) | (MaterialId & BitMask(MaterialBits));
+    Key = (Key << MeshBits) | (MeshId & BitMask(MeshBits));
+    Key = (Key << DepthBits) | (Depth & BitMask(DepthBits));
+    return Key;
+}
+
+uint32 FDrawCommandList::QuantizeDepth(float Depth, float MaxDepth)
+{
+    if (!(MaxDepth > 0.f) || !(Depth > 0.f))
+    {
+        return 0;
+    }
+    const float Normalized = std::min(Depth / MaxDepth, 1.f);
+    return static_cast<uint32>(Normalized * static_cast<float>(BitMask(DepthBits)));
+}
+
+void FDrawCommandList::Reset()
+{
+    Commands.Empty();
+}
+
+void FDrawCommandList::Add(uint64 SortKey, uint32 BatchIndex, uint32 SubsetIndex)
+{
+    Commands.Add({ SortKey, BatchIndex, SubsetIndex });
+}
+
+void FDrawCommandList::Sort()
+{
+    const int32 NumCommands = Commands.Num();
+    if (NumCommands < 2)
+    {
+        return;
+    }
+
+    // 적으면 히스토그램을 세고 누적하는 비용이 더 크므로 비교 정렬을 사용
+    if (NumCommands < MinRadixSortCommands)
+    {
+        std::stable_sort(Commands.begin(), Commands.end(), [](const FDrawCommand& A, const FDrawCommand& B) { return A.SortKey < B.SortKey; });
+        return;
+    }
+
+    // 모든 자리의 히스토그램을 한 번에 세고, 모든 명령이 같은 값을 가진 자리는 건너뜀
+    constexpr int32 NumDigits = 8;
+    uint32 Histograms[NumDigits][256] = {};
+    for (const FDrawCommand& Command : Commands)
+    {
+        for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+        {
+            ++Histograms[Digit][(Command.SortKey >> (Digit * 8)) & 0xFF];
+        }
+    }
+
+    Scratch.SetNum(NumCommands);
+    FDrawCommand* Source = Commands.GetData();
+    FDrawCommand* Dest = Scratch.GetData();
+    for (int32 Digit = 0; Digit < NumDigits; ++Digit)
+    {
+        uint32* Histogram = Histograms[Digit];
+        const uint32 FirstByte = (Source[0].SortKey >> (Digit * 8)) & 0xFF;
+        if (Histogram[FirstByte] == static_cast<uint32>(NumCommands))
+        {
+            continue;
+        }
+
+        uint32 Offset = 0;
+        for (int32 Bucket = 0; Bucket < 256; ++Bucket)
+        {
+            const uint32 Count = Histogram[Bucket];
+            Histogram[Bucket] = Offset;
+            Offset += Count;
+        }
+        for (int32 Index = 0; Index < NumCommands; ++Index)
+        {
+            Dest[Histogram[(Source[Index].SortKey >> (Digit * 8)) & 0xFF]++] = Source[Index];
+        }
+        std::swap(Source, Dest);
+    }
+
+    if (Source != Commands.GetData())
+    {
+        std::copy(Source, Source + NumCommands, Commands.GetData());
+    }
+}
+
+void FDrawStateTracker::ResetBindings()
+{
+    PixelShader = nullptr;
+    Mesh = nullptr;
+    Material = nullptr;
+    bHasBaseInstance = false;
+    bHasSubMeshSelected = false;
+}
+
+bool FDrawStateTracker::SetPixelShader(const void* InPixelShader)
+{
+    if (PixelShader == InPixelShader)
+    {
+        return false;
+    }
+    PixelShader = InPixelShader;
+    ++Stats.NumStateChanges;
+    return true;
+}
+
+bool FDrawStateTracker::SetMesh(const void* InMesh)
+{
+    if (Mesh == InMesh)
+    {
+        return false;
+    }
+    Mesh = InMesh;
+    ++Stats.NumStateChanges;
+    return true;
+}
+
+bool FDrawStateTracker::SetMaterial(const void* InMaterial)
+{
+    if (Material == InMaterial)
+    {
+        return false;
+    }
+    // 머티리얼 상수를 올리고 텍스처를 바인딩
+    Material = InMaterial;
+    ++Stats.NumStateChanges;
+    ++Stats.NumConstantBufferUploads;
+    return true;
+}
+
+bool FDrawStateTracker::SetBaseInstance(uint32 InBaseInstance)
+{
+    if (bHasBaseInstance && BaseInstance == InBaseInstance)
+    {
+        return false;
+    }
+    BaseInstance = InBaseInstance;
+    bHasBaseInstance = true;
+    ++Stats.NumConstantBufferUploads;
+    return true;
+}
+
+bool FDrawStateTracker::SetSubMeshSelected(bool bSelected)
+{
+    if (bHasSubMeshSelected && bSubMeshSelected == bSelected)
+    {
+        return false;
+    }
+    bSubMeshSelected = bSelected;
+    bHasSubMeshSelected = true;
+    ++Stats.NumConstantBufferUploads;
+    return true;
+}
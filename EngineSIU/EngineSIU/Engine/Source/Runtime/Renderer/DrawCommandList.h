@@ -0,0 +1,104 @@
+#pragma once
+#include "Define.h"
+
+/** 정렬 키와 그릴 배치의 서브셋 하나 */
+struct FDrawCommand
+{
+    uint64 SortKey;
+    uint32 BatchIndex;
+    uint32 SubsetIndex;
+};
+
+/** 드로우와 상태 변경을 센 값 */
+struct FDrawListStats
+{
+    uint32 NumDraws = 0;
+    // 셰이더, 버텍스/인덱스 버퍼, 머티리얼 텍스처 바인딩
+    uint32 NumStateChanges = 0;
+    uint32 NumConstantBufferUploads = 0;
+};
+
+/**
+ * 드로우를 64비트 정렬 키로 정렬하는 목록
+ *
+ * 키는 상위 비트부터 셰이더 변형, 머티리얼, 메시, 깊이 순서로 채워서, 정렬하면 비싼 상태 변경이 적게 일어나도록
+ * 같은 셰이더와 머티리얼을 쓰는 드로우가 모이고, 그 안에서는 가까운 것부터 그려집니다.
+ * 정렬은 바이트 단위 LSD 기수 정렬이며, 키가 같으면 추가한 순서를 유지합니다. 명령이 적으면 std::stable_sort를 사용합니다.
+ */
+class FDrawCommandList
+{
+public:
+    static constexpr uint32 ShaderVariantBits = 4;
+    static constexpr uint32 MaterialBits = 20;
+    static constexpr uint32 MeshBits = 20;
+    static constexpr uint32 DepthBits = 16;
+
+    // 명령이 이보다 적으면 기수 정렬 대신 std::stable_sort를 사용
+    static constexpr int32 MinRadixSortCommands = 1024;
+
+    /** 각 값은 비트 수에 맞게 잘라서 키에 넣습니다. */
+    static uint64 MakeSortKey(uint32 ShaderVariant, uint32 MaterialId, uint32 MeshId, uint32 Depth);
+
+    /** [0, MaxDepth] 범위의 깊이를 DepthBits 비트의 정수로 바꿉니다. 범위를 벗어나면 끝 값으로 자릅니다. */
+    static uint32 QuantizeDepth(float Depth, float MaxDepth);
+
+    /** 명령을 모두 비웁니다. 할당한 메모리는 유지합니다. */
+    void Reset();
+
+    void Add(uint64 SortKey, uint32 BatchIndex, uint32 SubsetIndex);
+
+    /** 키의 오름차순으로 정렬합니다. */
+    void Sort();
+
+    const TArray<FDrawCommand>& GetCommands() const { return Commands; }
+    int32 Num() const { return Commands.Num(); }
+
+private:
+    TArray<FDrawCommand> Commands;
+
+    // 기수 정렬의 각 자리를 옮겨 담는 배열
+    TArray<FDrawCommand> Scratch;
+};
+
+/**
+ * 마지막으로 바인딩한 셰이더, 메시, 머티리얼, 상수 값을 기억해서 같은 값을 다시 바인딩하지 않도록 알려주고
+ * 실제로 일어난 드로우와 상태 변경, 상수 버퍼 업로드 수를 셉니다.
+ *
+ * 값은 비교에만 쓰므로 GPU 리소스 없이도 사용할 수 있습니다.
+ */
+class FDrawStateTracker
+{
+public:
+    /** 기억한 바인딩을 잊습니다. 다른 패스가 상태를 바꿨을 수 있을 때 호출합니다. 통계는 유지합니다. */
+    void ResetBindings();
+
+    /** 통계를 0으로 되돌립니다. */
+    void ResetStats() { Stats = FDrawListStats(); }
+
+    // 아래 함수는 마지막 값과 다르면 값을 기억하고 통계를 늘린 뒤 true를 반환합니다.
+    bool SetPixelShader(const void* PixelShader);
+    bool SetMesh(const void* Mesh);
+    bool SetMaterial(const void* Material);
+    bool SetBaseInstance(uint32 BaseInstance);
+    bool SetSubMeshSelected(bool bSelected);
+
+    void AddDraw() { ++Stats.NumDraws; }
+
+    /** 중복 검사 없이 매번 올리는 상수 버퍼를 셉니다. */
+    void AddConstantBufferUpload() { ++Stats.NumConstantBufferUploads; }
+
+    const FDrawListStats& GetStats() const { return Stats; }
+
+private:
+    const void* PixelShader = nullptr;
+    const void* Mesh = nullptr;
+    const void* Material = nullptr;
+    uint32 BaseInstance = 0;
+    bool bSubMeshSelected = false;
+
+    // 처음 호출하면 이전 값과 상관없이 바인딩해야 함
+    bool bHasBaseInstance = false;
+    bool bHasSubMeshSelected = false;
+
+    FDrawListStats Stats;
+};
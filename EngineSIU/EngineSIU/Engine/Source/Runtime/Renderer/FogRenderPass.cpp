@@ -120,12 +120,9 @@ void FFogRenderPass::CreateSceneSrv()
 
 void FFogRenderPass::PrepareRender()
 {
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
+    for (const auto iter : TObjectRange<UHeightFogComponent>(GEngine->ActiveWorld))
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            FogComponents.Add(iter);
-        }
+        FogComponents.Add(iter);
     }
 }
 
@@ -0,0 +1,150 @@
+#include "FrustumCuller.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/MathSSE.h"
+
+#include <bit>
+
+void FFrustumCuller::SetNum(int32 NewNum)
+{
+    NumBoxes = NewNum;
+
+    // SIMD로 끝까지 읽을 수 있도록 Width의 배수로 할당
+    const int32 PaddedNum = (NewNum + Width - 1) / Width * Width;
+    for (TArray<float>* Array : { &CenterX, &CenterY, &CenterZ, &ExtentX, &ExtentY, &ExtentZ })
+    {
+        Array->SetNum(PaddedNum);
+    }
+}
+
+void FFrustumCuller::SetBounds(int32 Index, const FBoundingBox& WorldBounds)
+{
+    const FVector Center = (WorldBounds.min + WorldBounds.max) * 0.5f;
+    const FVector Extent = (WorldBounds.max - WorldBounds.min) * 0.5f;
+    CenterX[Index] = Center.X;
+    CenterY[Index] = Center.Y;
+    CenterZ[Index] = Center.Z;
+    ExtentX[Index] = Extent.X;
+    ExtentY[Index] = Extent.Y;
+    ExtentZ[Index] = Extent.Z;
+}
+
+void FFrustumCuller::Cull(const Plane Planes[6], TArray<int32>& OutVisibleIndices)
+{
+    OutVisibleIndices.Empty();
+
+    const int32 NumTasks = (NumBoxes + BoxesPerTask - 1) / BoxesPerTask;
+    if (NumTasks <= 1)
+    {
+        CullRange(Planes, 0, NumBoxes, OutVisibleIndices);
+        return;
+    }
+
+    if (TaskVisibleIndices.Num() < NumTasks)
+    {
+        TaskVisibleIndices.SetNum(NumTasks);
+    }
+
+    ParallelFor(
+        NumTasks, [this, Planes](int32 TaskIndex)
+        {
+            TArray<int32>& TaskVisible = TaskVisibleIndices[TaskIndex];
+            TaskVisible.Empty();
+
+            const int32 Begin = TaskIndex * BoxesPerTask;
+            CullRange(Planes, Begin, std::min(Begin + BoxesPerTask, NumBoxes), TaskVisible);
+        }
+    );
+
+    // 작업 순서대로 이어 붙여 인덱스 순서를 유지
+    int32 NumVisible = 0;
+    for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+    {
+        NumVisible += TaskVisibleIndices[TaskIndex].Num();
+    }
+    OutVisibleIndices.Reserve(NumVisible);
+    for (int32 TaskIndex = 0; TaskIndex < NumTasks; ++TaskIndex)
+    {
+        for (const int32 Index : TaskVisibleIndices[TaskIndex])
+        {
+            OutVisibleIndices.Add(Index);
+        }
+    }
+}
+
+void FFrustumCuller::CullRange(const Plane Planes[6], int32 Begin, int32 End, TArray<int32>& OutVisibleIndices) const
+{
+    using namespace SSE;
+
+    // 평면마다 법선 성분과 그 절대값을 4개 레인에 복제
+    VectorRegister4Float NormalX[6], NormalY[6], NormalZ[6], Distance[6];
+    VectorRegister4Float AbsNormalX[6], AbsNormalY[6], AbsNormalZ[6];
+    for (int32 i = 0; i < 6; ++i)
+    {
+        NormalX[i] = VectorSetFloat1(Planes[i].a);
+        NormalY[i] = VectorSetFloat1(Planes[i].b);
+        NormalZ[i] = VectorSetFloat1(Planes[i].c);
+        Distance[i] = VectorSetFloat1(Planes[i].d);
+        AbsNormalX[i] = VectorAbs(NormalX[i]);
+        AbsNormalY[i] = VectorAbs(NormalY[i]);
+        AbsNormalZ[i] = VectorAbs(NormalZ[i]);
+    }
+
+    const float* CenterXData = CenterX.GetData();
+    const float* CenterYData = CenterY.GetData();
+    const float* CenterZData = CenterZ.GetData();
+    const float* ExtentXData = ExtentX.GetData();
+    const float* ExtentYData = ExtentY.GetData();
+    const float* ExtentZData = ExtentZ.GetData();
+    const VectorRegister4Float Zero = VectorSetFloat1(0.f);
+
+    for (int32 Index = Begin; Index < End; Index += Width)
+    {
+        const VectorRegister4Float CX = VectorLoadAligned(CenterXData + Index);
+        const VectorRegister4Float CY = VectorLoadAligned(CenterYData + Index);
+        const VectorRegister4Float CZ = VectorLoadAligned(CenterZData + Index);
+        const VectorRegister4Float EX = VectorLoadAligned(ExtentXData + Index);
+        const VectorRegister4Float EY = VectorLoadAligned(ExtentYData + Index);
+        const VectorRegister4Float EZ = VectorLoadAligned(ExtentZData + Index);
+
+        // 중심의 부호 있는 거리가 박스를 평면 법선에 투영한 반지름보다 더 바깥이면 그 평면 밖에 있음
+        VectorRegister4Float Outside = Zero;
+        for (int32 i = 0; i < 6; ++i)
+        {
+            const VectorRegister4Float Dist = VectorAdd(VectorMultiplyAdd(CZ, NormalZ[i], VectorMultiplyAdd(CY, NormalY[i], VectorMultiply(CX, NormalX[i]))), Distance[i]);
+            const VectorRegister4Float Radius = VectorMultiplyAdd(EZ, AbsNormalZ[i], VectorMultiplyAdd(EY, AbsNormalY[i], VectorMultiply(EX, AbsNormalX[i])));
+            Outside = VectorBitwiseOr(Outside, VectorCompareLT(Dist, VectorSubtract(Zero, Radius)));
+        }
+
+        uint32 VisibleMask = ~VectorMaskBits(Outside) & 0xF;
+        if (End - Index < Width)
+        {
+            VisibleMask &= (1u << (End - Index)) - 1;
+        }
+        for (; VisibleMask != 0; VisibleMask &= VisibleMask - 1)
+        {
+            OutVisibleIndices.Add(Index + std::countr_zero(VisibleMask));
+        }
+    }
+}
+
+void FFrustumCuller::CullScalar(const Plane Planes[6], TArray<int32>& OutVisibleIndices) const
+{
+    OutVisibleIndices.Empty();
+    for (int32 Index = 0; Index < NumBoxes; ++Index)
+    {
+        bool bVisible = true;
+        for (int32 i = 0; i < 6 && bVisible; ++i)
+        {
+            // CullRange와 같은 순서로 연산
+            const Plane& P = Planes[i];
+            const float Dist = CenterX[Index] * P.a + CenterY[Index] * P.b + CenterZ[Index] * P.c + P.d;
+            const float Radius = ExtentX[Index] * fabsf(P.a) + ExtentY[Index] * fabsf(P.b) + ExtentZ[Index] * fabsf(P.c);
+            bVisible = !(Dist < 0.f - Radius);
+        }
+        if (bVisible)
+        {
+            OutVisibleIndices.Add(Index);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Define.h"
+#include "Container/Array.h"
+
+/**
+ * 월드 공간 바운딩 박스들을 중심과 반 크기의 SoA로 담아두고 절두체 컬링하는 단계
+ *
+ * 박스 4개를 한 번에 6개 평면과 검사하며, 박스가 많으면 워커 스레드로 나눠 검사합니다.
+ * D3D 디바이스 없이 동작하므로 렌더링 없이도 사용하고 측정할 수 있습니다.
+ */
+class FFrustumCuller
+{
+public:
+    // 한 번에 검사하는 박스 수
+    static constexpr int32 Width = 4;
+
+    // 워커 스레드 하나가 한 번에 검사하는 박스 수, 박스가 이보다 적으면 호출한 스레드에서만 검사
+    static constexpr int32 BoxesPerTask = 2048;
+
+    FFrustumCuller() = default;
+
+    /** 박스 수를 바꿉니다. 새로 생긴 박스는 SetBounds로 채워야 합니다. */
+    void SetNum(int32 NewNum);
+    int32 Num() const { return NumBoxes; }
+
+    void SetBounds(int32 Index, const FBoundingBox& WorldBounds);
+
+    /**
+     * 절두체와 겹치는 박스의 인덱스를 오름차순으로 OutVisibleIndices에 채웁니다.
+     * 평면의 법선은 절두체 안쪽을 향하는 단위 벡터여야 합니다.
+     */
+    void Cull(const Plane Planes[6], TArray<int32>& OutVisibleIndices);
+
+    /** Cull과 같은 결과를 SIMD와 스레드 없이 구합니다. */
+    void CullScalar(const Plane Planes[6], TArray<int32>& OutVisibleIndices) const;
+
+    /** [Begin, End) 범위의 박스를 호출한 스레드에서 SIMD로 검사해 OutVisibleIndices 뒤에 추가합니다. Begin은 Width의 배수여야 합니다. */
+    void CullRange(const Plane Planes[6], int32 Begin, int32 End, TArray<int32>& OutVisibleIndices) const;
+
+private:
+    int32 NumBoxes = 0;
+
+    // Width의 배수 크기로 할당되며, 남는 자리는 검사 결과에서 제외됨
+    TArray<float> CenterX, CenterY, CenterZ;
+    TArray<float> ExtentX, ExtentY, ExtentZ;
+
+    // 작업마다 따로 모은 결과, 매 프레임 재할당하지 않도록 유지
+    TArray<TArray<int32>> TaskVisibleIndices;
+};
@@ -53,6 +53,11 @@ void FGizmoRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsD
     BufferManager = InBufferManager;
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
+
+    PerObjectConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FPerObjectConstantBuffer"));
+    CameraConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FCameraConstantBuffer"));
+    SubMeshConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FSubMeshConstants"));
+
     CreateShader();
 }
 
@@ -90,12 +95,10 @@ void FGizmoRenderPass::PrepareRenderState() const
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
     // 상수 버퍼 바인딩 예시
-    ID3D11Buffer* PerObjectBuffer = BufferManager->GetConstantBuffer(TEXT("FPerObjectConstantBuffer"));
-    ID3D11Buffer* CameraConstantBuffer = BufferManager->GetConstantBuffer(TEXT("FCameraConstantBuffer"));
-    Graphics->DeviceContext->VSSetConstantBuffers(0, 1, &PerObjectBuffer);
-    Graphics->DeviceContext->VSSetConstantBuffers(1, 1, &CameraConstantBuffer);
+    BufferManager->BindConstantBuffer(PerObjectConstantBuffer, 0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(CameraConstantBuffer, 1, EShaderStage::Vertex);
 
-    TArray<FString> PSBufferKeys = {
+    TArray<FString, FFrameAllocator<FString>> PSBufferKeys = {
                                   TEXT("FPerObjectConstantBuffer"),
                                   TEXT("FMaterialConstants"),
     };
@@ -129,6 +132,11 @@ void FGizmoRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& View
 
 
     PrepareRenderState();
+
+    // 카메라는 기즈모 컴포넌트마다 같으므로 뷰포트마다 한 번만 올림
+    FCameraConstantBuffer CameraData(Viewport->View, Viewport->Projection);
+    BufferManager->UpdateConstantBuffer(CameraConstantBuffer, CameraData);
+
     Graphics->DeviceContext->OMSetDepthStencilState(Graphics->DepthStateDisable, 0);
     Graphics->DeviceContext->RSSetState(FEngineLoop::GraphicDevice.RasterizerStateSOLID);
     ControlMode Mode = Engine->GetEditorPlayer()->GetControlMode();
@@ -199,10 +207,7 @@ void FGizmoRenderPass::RenderGizmoComponent(UGizmoBaseComponent* GizmoComp, cons
 
     FPerObjectConstantBuffer Data(Model, NormalMatrix, UUIDColor, Selected);
 
-    FCameraConstantBuffer CameraData(Viewport->View, Viewport->Projection);
-
-    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), Data);
-    BufferManager->UpdateConstantBuffer(TEXT("FCameraConstantBuffer"), CameraData);
+    BufferManager->UpdateConstantBuffer(PerObjectConstantBuffer, Data);
 
     // Gizmo가 렌더링할 StaticMesh가 없으면 렌더링하지 않음
     if (!GizmoComp->GetStaticMesh())
@@ -233,10 +238,10 @@ void FGizmoRenderPass::RenderGizmoComponent(UGizmoBaseComponent* GizmoComp, cons
             int materialIndex = RenderData->MaterialSubsets[subMeshIndex].MaterialIndex;
 
             FSubMeshConstants SubMeshData = FSubMeshConstants(false);
-            BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
+            BufferManager->UpdateConstantBuffer(SubMeshConstantBuffer, SubMeshData);
 
-            TArray<FStaticMaterial*>Materials = GizmoComp->GetStaticMesh()->GetMaterials();
-            TArray<UMaterial*>OverrideMaterials = GizmoComp->GetOverrideMaterials();
+            const TArray<FStaticMaterial*>& Materials = GizmoComp->GetStaticMesh()->GetMaterials();
+            const TArray<UMaterial*>& OverrideMaterials = GizmoComp->GetOverrideMaterials();
 
             if (OverrideMaterials[materialIndex] != nullptr)
                 MaterialUtils::UpdateMaterial(BufferManager, Graphics, OverrideMaterials[materialIndex]->GetMaterialInfo());
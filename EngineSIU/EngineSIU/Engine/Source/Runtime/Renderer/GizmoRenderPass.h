@@ -4,6 +4,7 @@
 #include "IRenderPass.h"
 #include "EngineBaseTypes.h"
 #include "Container/Set.h"
+#include "D3D11RHI/ConstantBufferUploader.h"
 
 class UGizmoBaseComponent;
 
@@ -42,6 +43,11 @@ private:
     FGraphicsDevice* Graphics;
     FDXDShaderManager* ShaderManager;
 
+    // Initialize에서 찾아둔 상수 버퍼
+    FConstantBufferHandle PerObjectConstantBuffer;
+    FConstantBufferHandle CameraConstantBuffer;
+    FConstantBufferHandle SubMeshConstantBuffer;
+
     ID3D11VertexShader* VertexShader;
 
     ID3D11PixelShader* PixelShader;
@@ -123,7 +123,7 @@ void FLightCullPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewpo
     Graphics->DeviceContext->CSSetUnorderedAccessViews(0, 2, uavs, nullptr);
 
     // 3. 상수버퍼 바인드
-    TArray<FString> PSBufferKeys = {
+    TArray<FString, FFrameAllocator<FString>> PSBufferKeys = {
                                   TEXT("FPerObjectConstantBuffer"),
                                   TEXT("FCameraConstantBuffer"),
                                   TEXT("FScreenConstants"),
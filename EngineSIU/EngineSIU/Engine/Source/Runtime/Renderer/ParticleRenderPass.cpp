@@ -0,0 +1,204 @@
+#include "ParticleRenderPass.h"
+
+#include "D3D11RHI/DXDBufferManager.h"
+#include "D3D11RHI/GraphicDevice.h"
+#include "D3D11RHI/DXDShaderManager.h"
+
+#include "RendererHelpers.h"
+
+#include "UObject/UObjectIterator.h"
+
+#include "UnrealEd/EditorViewportClient.h"
+#include "PropertyEditor/ShowFlags.h"
+
+#include "Components/ParticleSystemComponent.h"
+#include "Engine/EditorEngine.h"
+
+#include "World/World.h"
+
+FParticleRenderPass::FParticleRenderPass()
+    : InstanceBuffer(nullptr)
+    , InstanceBufferCapacity(0)
+    , InputLayout(nullptr)
+    , BufferManager(nullptr)
+    , Graphics(nullptr)
+    , ShaderManager(nullptr)
+    , ParticleVertexShaderKey(0)
+    , ParticlePixelShaderKey(0)
+{
+}
+
+FParticleRenderPass::~FParticleRenderPass()
+{
+    // 셰이더와 입력 레이아웃은 ShaderManager가 소유
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
+}
+
+void FParticleRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager)
+{
+    BufferManager = InBufferManager;
+    Graphics = InGraphics;
+    ShaderManager = InShaderManager;
+    CreateShader();
+}
+
+void FParticleRenderPass::CreateShader()
+{
+    // 슬롯 0은 BufferManager의 쿼드 정점, 슬롯 1은 FParticleInstance
+    D3D11_INPUT_ELEMENT_DESC ParticleLayoutDesc[] = {
+        {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0},
+        {"INSTANCE_POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 1, offsetof(FParticleInstance, Position), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_SIZE", 0, DXGI_FORMAT_R32_FLOAT, 1, offsetof(FParticleInstance, Size), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_COLOR", 0, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, offsetof(FParticleInstance, Color), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+        {"INSTANCE_UVOFFSET", 0, DXGI_FORMAT_R32G32_FLOAT, 1, offsetof(FParticleInstance, UVOffset), D3D11_INPUT_PER_INSTANCE_DATA, 1},
+    };
+
+    HRESULT hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/ParticleShader.hlsl", "MainVS",
+        ParticleLayoutDesc, ARRAYSIZE(ParticleLayoutDesc), EViewModeIndex::VMI_Billboard, ParticleVertexShaderKey);
+
+    hr = ShaderManager->AddPixelShader(L"Shaders/ParticleShader.hlsl", "MainPS", EViewModeIndex::VMI_Billboard, ParticlePixelShaderKey);
+
+    InputLayout = ShaderManager->GetInputLayoutByKey(ParticleVertexShaderKey);
+}
+
+void FParticleRenderPass::PrepareRender()
+{
+    ParticleSystems.Empty();
+    for (const auto iter : TObjectRange<UParticleSystemComponent>(GEngine->ActiveWorld))
+    {
+        if (iter->Texture && iter->GetEmitter().Num() > 0)
+        {
+            ParticleSystems.Add(iter);
+        }
+    }
+}
+
+bool FParticleRenderPass::ReserveInstanceBuffer(uint32 NumInstances)
+{
+    if (InstanceBuffer && NumInstances <= InstanceBufferCapacity)
+    {
+        return true;
+    }
+
+    uint32 NewCapacity = std::max(InstanceBufferCapacity, 1024u);
+    while (NewCapacity < NumInstances)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.ByteWidth = NewCapacity * sizeof(FParticleInstance);
+    Desc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* NewBuffer = nullptr;
+    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Particle instance buffer 생성 실패, HRESULT: 0x%X"), hr);
+        return false;
+    }
+
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
+    InstanceBuffer = NewBuffer;
+    InstanceBufferCapacity = NewCapacity;
+    return true;
+}
+
+void FParticleRenderPass::PrepareParticleShader() const
+{
+    Graphics->DeviceContext->VSSetShader(ShaderManager->GetVertexShaderByKey(ParticleVertexShaderKey), nullptr, 0);
+    Graphics->DeviceContext->PSSetShader(ShaderManager->GetPixelShaderByKey(ParticlePixelShaderKey), nullptr, 0);
+    Graphics->DeviceContext->IASetInputLayout(InputLayout);
+    Graphics->DeviceContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    BufferManager->BindConstantBuffer(TEXT("FPerObjectConstantBuffer"), 0, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(TEXT("FSubUVConstant"), 1, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(TEXT("FParticleConstants"), 2, EShaderStage::Vertex);
+}
+
+void FParticleRenderPass::UpdateParticleConstants(const std::shared_ptr<FEditorViewportClient>& Viewport) const
+{
+    const FMatrix& View = Viewport->GetViewMatrix();
+
+    // 파티클 위치가 이미 월드 공간이므로 Model은 단위 행렬
+    FMatrix ViewProjection = RendererHelpers::CalculateMVP(FMatrix::Identity, View, Viewport->GetProjectionMatrix());
+    FPerObjectConstantBuffer PerObjectData(ViewProjection, FMatrix::Identity, FVector4(), false);
+    BufferManager->UpdateConstantBuffer(TEXT("FPerObjectConstantBuffer"), PerObjectData);
+
+    // 뷰 행렬의 열이 월드 공간에서의 카메라 축
+    FParticleConstants ParticleData;
+    ParticleData.CameraRight = FVector(View.M[0][0], View.M[1][0], View.M[2][0]);
+    ParticleData.Pad0 = 0.f;
+    ParticleData.CameraUp = FVector(View.M[0][1], View.M[1][1], View.M[2][1]);
+    ParticleData.Pad1 = 0.f;
+    BufferManager->UpdateConstantBuffer(TEXT("FParticleConstants"), ParticleData);
+}
+
+void FParticleRenderPass::Render(const std::shared_ptr<FEditorViewportClient>& Viewport)
+{
+    if (!(Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Particles)))
+        return;
+
+    if (ParticleSystems.IsEmpty())
+        return;
+
+    FVertexInfo VertexInfo;
+    FIndexInfo IndexInfo;
+    BufferManager->GetQuadBuffer(VertexInfo, IndexInfo);
+
+    PrepareParticleShader();
+    UpdateParticleConstants(Viewport);
+
+    for (UParticleSystemComponent* ParticleSystem : ParticleSystems)
+    {
+        const FParticleEmitter& Emitter = ParticleSystem->GetEmitter();
+        const uint32 NumInstances = static_cast<uint32>(Emitter.Num());
+        if (NumInstances == 0 || !ReserveInstanceBuffer(NumInstances))
+        {
+            continue;
+        }
+
+        // 파티클을 중간 배열 없이 매핑한 버퍼에 바로 채움
+        D3D11_MAPPED_SUBRESOURCE Mapped;
+        HRESULT hr = Graphics->DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped);
+        if (FAILED(hr))
+        {
+            UE_LOG(LogLevel::Error, TEXT("Particle instance buffer Map 실패, HRESULT: 0x%X"), hr);
+            continue;
+        }
+        Emitter.BuildInstances(static_cast<FParticleInstance*>(Mapped.pData));
+        Graphics->DeviceContext->Unmap(InstanceBuffer, 0);
+
+        FSubUVConstant SubUVData;
+        SubUVData.uvOffset = FVector2D();
+        SubUVData.uvScale = Emitter.GetSubUVScale();
+        SubUVData.TintColor = FLinearColor::White;
+        BufferManager->UpdateConstantBuffer(TEXT("FSubUVConstant"), SubUVData);
+
+        ID3D11Buffer* VertexBuffers[2] = { VertexInfo.VertexBuffer, InstanceBuffer };
+        UINT Strides[2] = { sizeof(QuadVertex), sizeof(FParticleInstance) };
+        UINT Offsets[2] = { 0, 0 };
+        Graphics->DeviceContext->IASetVertexBuffers(0, 2, VertexBuffers, Strides, Offsets);
+        Graphics->DeviceContext->IASetIndexBuffer(IndexInfo.IndexBuffer, DXGI_FORMAT_R16_UINT, 0);
+
+        ID3D11ShaderResourceView* TextureSRV = ParticleSystem->Texture->TextureSRV;
+        ID3D11SamplerState* SamplerState = ParticleSystem->Texture->SamplerState;
+        Graphics->DeviceContext->PSSetShaderResources(0, 1, &TextureSRV);
+        Graphics->DeviceContext->PSSetSamplers(0, 1, &SamplerState);
+
+        Graphics->DeviceContext->DrawIndexedInstanced(IndexInfo.NumIndices, NumInstances, 0, 0, 0);
+    }
+
+    // 다른 패스는 슬롯 0만 바인딩하므로 인스턴스 버퍼를 풀어둠
+    ID3D11Buffer* NullBuffer = nullptr;
+    UINT Zero = 0;
+    Graphics->DeviceContext->IASetVertexBuffers(1, 1, &NullBuffer, &Zero, &Zero);
+}
+
+void FParticleRenderPass::ClearRenderArr()
+{
+    ParticleSystems.Empty();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "IRenderPass.h"
+#include "EngineBaseTypes.h"
+
+#include "Define.h"
+
+class UParticleSystemComponent;
+class FDXDBufferManager;
+class FGraphicsDevice;
+class FDXDShaderManager;
+class FEditorViewportClient;
+
+/**
+ * UParticleSystemComponent의 파티클을 그리는 패스
+ * 이미터의 파티클을 동적 인스턴스 버퍼에 채우고, 쿼드 하나를 파티클 수만큼 인스턴싱해서 이미터마다 한 번에 그립니다.
+ */
+class FParticleRenderPass : public IRenderPass
+{
+public:
+    FParticleRenderPass();
+    virtual ~FParticleRenderPass();
+
+    virtual void Initialize(FDXDBufferManager* InBufferManager, FGraphicsDevice* InGraphics, FDXDShaderManager* InShaderManager) override;
+
+    virtual void PrepareRender() override;
+
+    virtual void Render(const std::shared_ptr<FEditorViewportClient>& Viewport) override;
+
+    virtual void ClearRenderArr() override;
+
+    void CreateShader();
+
+private:
+    /** 인스턴스 버퍼가 NumInstances개를 담을 수 있도록 필요하면 두 배씩 키워서 다시 만듭니다. */
+    bool ReserveInstanceBuffer(uint32 NumInstances);
+
+    void PrepareParticleShader() const;
+    void UpdateParticleConstants(const std::shared_ptr<FEditorViewportClient>& Viewport) const;
+
+private:
+    TArray<UParticleSystemComponent*> ParticleSystems;
+
+    ID3D11Buffer* InstanceBuffer;
+    uint32 InstanceBufferCapacity;
+
+    ID3D11InputLayout* InputLayout;
+
+    FDXDBufferManager* BufferManager;
+
+    FGraphicsDevice* Graphics;
+
+    FDXDShaderManager* ShaderManager;
+
+    size_t ParticleVertexShaderKey;
+    size_t ParticlePixelShaderKey;
+};
@@ -7,6 +7,7 @@
 #include "RendererHelpers.h"
 #include "StaticMeshRenderPass.h"
 #include "BillboardRenderPass.h"
+#include "ParticleRenderPass.h"
 #include "GizmoRenderPass.h"
 #include "UpdateLightBufferPass.h"
 #include "LineRenderPass.h"
@@ -32,6 +33,7 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
 
     StaticMeshRenderPass = new FStaticMeshRenderPass();
     BillboardRenderPass = new FBillboardRenderPass();
+    ParticleRenderPass = new FParticleRenderPass();
     GizmoRenderPass = new FGizmoRenderPass();
     UpdateLightBufferPass = new FUpdateLightBufferPass();
     LineRenderPass = new FLineRenderPass();
@@ -40,8 +42,12 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
     LightCullPass = new FLightCullPass();
 	DebugLightCullPass = new FDebugLightCullPass();
 
+    // 패스가 초기화할 때 상수 버퍼 핸들을 찾아두므로 먼저 생성
+    CreateConstantBuffers();
+
     StaticMeshRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     BillboardRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
+    ParticleRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     GizmoRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
     UpdateLightBufferPass->Initialize(BufferManager, Graphics, ShaderManager);
     LineRenderPass->Initialize(BufferManager, Graphics, ShaderManager);
@@ -52,8 +58,6 @@ void FRenderer::Initialize(FGraphicsDevice* InGraphics, FDXDBufferManager* InBuf
 
     
     ShaderHotReload->CreateShaderHotReloadThread();
-
-    CreateConstantBuffers();
 }
 
 void FRenderer::Release()
@@ -83,6 +87,12 @@ void FRenderer::CreateConstantBuffers()
     UINT subUVBufferSize = sizeof(FSubUVConstant);
     BufferManager->CreateBufferGeneric<FSubUVConstant>("FSubUVConstant", nullptr, subUVBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 
+    UINT particleBufferSize = sizeof(FParticleConstants);
+    BufferManager->CreateBufferGeneric<FParticleConstants>("FParticleConstants", nullptr, particleBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+
+    UINT instanceBufferSize = sizeof(FInstanceConstants);
+    BufferManager->CreateBufferGeneric<FInstanceConstants>("FInstanceConstants", nullptr, instanceBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
+
     UINT materialBufferSize = sizeof(FMaterialConstants);
     BufferManager->CreateBufferGeneric<FMaterialConstants>("FMaterialConstants", nullptr, materialBufferSize, D3D11_BIND_CONSTANT_BUFFER, D3D11_USAGE_DYNAMIC, D3D11_CPU_ACCESS_WRITE);
 
@@ -115,9 +125,12 @@ void FRenderer::ReleaseConstantBuffer()
 
 void FRenderer::PrepareRender()
 {
+    BufferManager->ResetConstantBufferStats();
+
     StaticMeshRenderPass->PrepareRender();
     GizmoRenderPass->PrepareRender();
     BillboardRenderPass->PrepareRender();
+    ParticleRenderPass->PrepareRender();
     UpdateLightBufferPass->PrepareRender();
     FogRenderPass->PrepareRender();
 }
@@ -126,6 +139,7 @@ void FRenderer::ClearRenderArr()
 {
     StaticMeshRenderPass->ClearRenderArr();
     BillboardRenderPass->ClearRenderArr();
+    ParticleRenderPass->ClearRenderArr();
     GizmoRenderPass->ClearRenderArr();
     UpdateLightBufferPass->ClearRenderArr();
     FogRenderPass->ClearRenderArr();
@@ -146,6 +160,7 @@ void FRenderer::Render(const std::shared_ptr<FEditorViewportClient>& ActiveViewp
     StaticMeshRenderPass->SwitchShaderLightingMode(ActiveViewport->GetViewMode());
     StaticMeshRenderPass->Render(ActiveViewport);
     BillboardRenderPass->Render(ActiveViewport);
+    ParticleRenderPass->Render(ActiveViewport);
 
 
     if (IsSceneDepth)
@@ -24,6 +24,7 @@ class FEditorViewportClient;
 
 class FStaticMeshRenderPass;
 class FBillboardRenderPass;
+class FParticleRenderPass;
 class FGizmoRenderPass;
 class FUpdateLightBufferPass;
 class FDepthBufferDebugPass;
@@ -71,6 +72,7 @@ public:
     FLightCullPass* LightCullPass = nullptr;
     FStaticMeshRenderPass* StaticMeshRenderPass = nullptr;
     FBillboardRenderPass* BillboardRenderPass = nullptr;
+    FParticleRenderPass* ParticleRenderPass = nullptr;
     FGizmoRenderPass* GizmoRenderPass = nullptr;
     FUpdateLightBufferPass* UpdateLightBufferPass = nullptr;
     FLineRenderPass* LineRenderPass = nullptr;
@@ -14,7 +14,7 @@ namespace RendererHelpers {
 
 namespace MaterialUtils {
     inline void UpdateMaterial(FDXDBufferManager* BufferManager, FGraphicsDevice* Graphics, const FObjMaterialInfo& MaterialInfo) {
-        FMaterialConstants data;
+        FMaterialConstants data = {};
         data.DiffuseColor = MaterialInfo.Diffuse;
         data.TransparencyScalar = MaterialInfo.TransparencyScalar;
         data.AmbientColor = MaterialInfo.Ambient;
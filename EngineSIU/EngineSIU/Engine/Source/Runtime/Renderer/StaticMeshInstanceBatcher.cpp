@@ -0,0 +1,127 @@
+#include "StaticMeshInstanceBatcher.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "Async/ParallelFor.h"
+
+namespace
+{
+FMatrix CalculateNormalMatrix(const FMatrix& World)
+{
+    return FMatrix::Transpose(FMatrix::Inverse(World));
+}
+
+size_t HashCombine(size_t Seed, size_t Value)
+{
+    return Seed ^ (Value + 0x9e3779b97f4a7c15ull + (Seed << 6) + (Seed >> 2));
+}
+}
+
+bool FStaticMeshBatchKey::operator==(const FStaticMeshBatchKey& Other) const
+{
+    if (Mesh != Other.Mesh || SelectedSubMeshIndex != Other.SelectedSubMeshIndex)
+    {
+        return false;
+    }
+    if (OverrideMaterials == Other.OverrideMaterials)
+    {
+        return true;
+    }
+
+    const int32 NumOverrides = OverrideMaterials ? OverrideMaterials->Num() : 0;
+    const int32 OtherNumOverrides = Other.OverrideMaterials ? Other.OverrideMaterials->Num() : 0;
+    if (NumOverrides != OtherNumOverrides)
+    {
+        return false;
+    }
+    return NumOverrides == 0
+        || std::memcmp(OverrideMaterials->GetData(), Other.OverrideMaterials->GetData(), sizeof(UMaterial*) * NumOverrides) == 0;
+}
+
+size_t std::hash<FStaticMeshBatchKey>::operator()(const FStaticMeshBatchKey& Key) const noexcept
+{
+    size_t Hash = std::hash<const void*>()(Key.Mesh);
+    Hash = HashCombine(Hash, std::hash<int32>()(Key.SelectedSubMeshIndex));
+    if (Key.OverrideMaterials)
+    {
+        for (const UMaterial* Material : *Key.OverrideMaterials)
+        {
+            Hash = HashCombine(Hash, std::hash<const void*>()(Material));
+        }
+    }
+    // 포인터의 std::hash는 값을 그대로 돌려주는 구현이 있으므로 상위 비트까지 섞음
+    Hash ^= Hash >> 33;
+    Hash *= 0xff51afd7ed558ccdull;
+    Hash ^= Hash >> 33;
+    return Hash;
+}
+
+void FStaticMeshInstanceBatcher::Reset()
+{
+    BatchIndices.Empty();
+    Batches.Empty();
+    PendingBatchIndices.Empty();
+    PendingWorlds.Empty();
+}
+
+void FStaticMeshInstanceBatcher::AddInstance(const FStaticMeshBatchKey& Key, const FMatrix& World)
+{
+    int32 BatchIndex;
+    if (const int32* Found = BatchIndices.Find(Key))
+    {
+        BatchIndex = *Found;
+    }
+    else
+    {
+        BatchIndex = Batches.Num();
+        FStaticMeshBatch& Batch = Batches[Batches.Emplace()];
+        Batch.Key = Key;
+        BatchIndices.Add(Key, BatchIndex);
+    }
+
+    ++Batches[BatchIndex].NumInstances;
+    PendingBatchIndices.Add(BatchIndex);
+    PendingWorlds.Add(World);
+}
+
+void FStaticMeshInstanceBatcher::Build()
+{
+    int32 FirstInstance = 0;
+    for (FStaticMeshBatch& Batch : Batches)
+    {
+        Batch.FirstInstance = FirstInstance;
+        FirstInstance += Batch.NumInstances;
+    }
+
+    // 배치마다 다음에 채울 위치를 하나씩 밀면서 각 인스턴스의 자리를 정함
+    const int32 NumPending = PendingWorlds.Num();
+    DestIndices.SetNum(NumPending);
+    {
+        TArray<int32> Cursors;
+        Cursors.SetNum(Batches.Num());
+        for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+        {
+            Cursors[BatchIndex] = Batches[BatchIndex].FirstInstance;
+        }
+        for (int32 Index = 0; Index < NumPending; ++Index)
+        {
+            DestIndices[Index] = Cursors[PendingBatchIndices[Index]]++;
+        }
+    }
+
+    // 노멀 행렬은 인스턴스마다 역행렬을 구하므로 워커 스레드에서 나눠 계산
+    Instances.SetNum(NumPending);
+    const int32 NumTasks = (NumPending + MinInstancesPerTask - 1) / MinInstancesPerTask;
+    ParallelFor(NumTasks, [this, NumPending](int32 Task)
+    {
+        const int32 Begin = Task * MinInstancesPerTask;
+        const int32 End = std::min(Begin + MinInstancesPerTask, NumPending);
+        for (int32 Index = Begin; Index < End; ++Index)
+        {
+            FStaticMeshInstanceData& Instance = Instances[DestIndices[Index]];
+            Instance.World = PendingWorlds[Index];
+            Instance.WorldInverseTranspose = CalculateNormalMatrix(PendingWorlds[Index]);
+        }
+    });
+}
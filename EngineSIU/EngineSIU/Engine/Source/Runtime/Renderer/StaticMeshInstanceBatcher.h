@@ -0,0 +1,83 @@
+#pragma once
+#include "Define.h"
+#include "Container/FlatMap.h"
+
+class UStaticMesh;
+class UMaterial;
+
+/** 같은 배치로 묶을 수 있는 컴포넌트를 가르는 값 */
+struct FStaticMeshBatchKey
+{
+    // 메시가 머티리얼 목록도 결정하므로 메시가 같으면 머티리얼 목록도 같음
+    UStaticMesh* Mesh = nullptr;
+
+    // 컴포넌트가 가진 오버라이드 머티리얼 배열, 배열의 내용으로 비교하며 배치를 만드는 동안만 유효해야 함
+    const TArray<UMaterial*>* OverrideMaterials = nullptr;
+
+    // 선택된 서브메시는 상수 버퍼가 달라지므로 따로 그림
+    int32 SelectedSubMeshIndex = INDEX_NONE;
+
+    bool operator==(const FStaticMeshBatchKey& Other) const;
+};
+
+template<>
+struct std::hash<FStaticMeshBatchKey>
+{
+    size_t operator()(const FStaticMeshBatchKey& Key) const noexcept;
+};
+
+/** 인스턴스 버퍼에 들어가는 인스턴스 하나, UberShader.hlsl의 FInstanceData와 순서가 같아야 함 */
+struct FStaticMeshInstanceData
+{
+    FMatrix World;
+    FMatrix WorldInverseTranspose;
+};
+static_assert(sizeof(FStaticMeshInstanceData) == sizeof(FMatrix) * 2);
+
+/** 인스턴스 버퍼의 [FirstInstance, FirstInstance + NumInstances) 범위를 한 번에 그리는 묶음 */
+struct FStaticMeshBatch
+{
+    FStaticMeshBatchKey Key;
+    int32 FirstInstance = 0;
+    int32 NumInstances = 0;
+};
+
+/**
+ * 보이는 스태틱 메시 컴포넌트를 (메시, 오버라이드 머티리얼, 선택된 서브메시)로 묶고
+ * 인스턴스마다 월드 행렬과 노멀 행렬을 한 배열에 이어 붙이는 단계
+ *
+ * 배치는 처음 나온 순서대로, 배치 안의 인스턴스는 AddInstance를 부른 순서대로 놓입니다.
+ * GPU 리소스를 사용하지 않으므로 렌더러 없이도 실행할 수 있습니다.
+ */
+class FStaticMeshInstanceBatcher
+{
+public:
+    // 노멀 행렬 계산을 한 작업이 맡는 최소 인스턴스 수
+    static constexpr int32 MinInstancesPerTask = 1024;
+
+    /** 이전 프레임의 배치와 인스턴스를 비웁니다. 할당한 메모리는 유지합니다. */
+    void Reset();
+
+    /** Key의 배치에 인스턴스 하나를 추가합니다. 인스턴스 데이터는 Build에서 만듭니다. */
+    void AddInstance(const FStaticMeshBatchKey& Key, const FMatrix& World);
+
+    /** 배치마다 FirstInstance를 정하고, 인스턴스를 배치 순서대로 모아 노멀 행렬을 계산합니다. */
+    void Build();
+
+    const TArray<FStaticMeshBatch>& GetBatches() const { return Batches; }
+    const TArray<FStaticMeshInstanceData>& GetInstances() const { return Instances; }
+    int32 NumInstances() const { return PendingWorlds.Num(); }
+
+private:
+    TFlatMap<FStaticMeshBatchKey, int32> BatchIndices;
+    TArray<FStaticMeshBatch> Batches;
+
+    // AddInstance를 부른 순서대로 쌓은 인스턴스의 배치 인덱스와 월드 행렬
+    TArray<int32> PendingBatchIndices;
+    TArray<FMatrix> PendingWorlds;
+
+    // PendingWorlds의 각 인스턴스가 Instances에서 놓일 위치
+    TArray<int32> DestIndices;
+
+    TArray<FStaticMeshInstanceData> Instances;
+};
@@ -1,5 +1,9 @@
 #include "StaticMeshRenderPass.h"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
 #include "EngineLoop.h"
 #include "World/World.h"
 
@@ -21,12 +25,17 @@
 #include "PropertyEditor/ShowFlags.h"
 
 #include "UnrealEd/EditorViewportClient.h"
+#include "UserInterface/Console.h"
 
 
 FStaticMeshRenderPass::FStaticMeshRenderPass()
     : VertexShader(nullptr)
     , PixelShader(nullptr)
+    , NormalMapPixelShader(nullptr)
     , InputLayout(nullptr)
+    , InstanceBuffer(nullptr)
+    , InstanceSRV(nullptr)
+    , InstanceBufferCapacity(0)
     , Stride(0)
     , BufferManager(nullptr)
     , Graphics(nullptr)
@@ -37,6 +46,8 @@ FStaticMeshRenderPass::FStaticMeshRenderPass()
 FStaticMeshRenderPass::~FStaticMeshRenderPass()
 {
     ReleaseShader();
+    FDXDBufferManager::SafeRelease(InstanceSRV);
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
     if (ShaderManager)
     {
         delete ShaderManager;
@@ -78,6 +89,21 @@ void FStaticMeshRenderPass::CreateShader()
     hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVS",
         StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Unlit, WorldNormalVertexShaderKey);
 
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVSInstanced",
+        StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Lit_Gouraud, GouraudInstancedVertexShaderKey);
+
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVSInstanced",
+        StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Lit_Lambert, LambertInstancedVertexShaderKey);
+
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVSInstanced",
+        StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Lit_Phong, PhongInstancedVertexShaderKey);
+
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVSInstanced",
+        StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Unlit, UnlitInstancedVertexShaderKey);
+
+    hr = ShaderManager->AddVertexShaderAndInputLayout(L"Shaders/UberShader.hlsl", "MainVSInstanced",
+        StaticMeshLayoutDesc, ARRAYSIZE(StaticMeshLayoutDesc), EViewModeIndex::VMI_Unlit, WorldNormalInstancedVertexShaderKey);
+
     hr = ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", EViewModeIndex::VMI_Lit_Lambert, LambertPixelShaderKey);
     hr = ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", EViewModeIndex::VMI_Lit_Phong, PhongPixelShaderKey);
     hr = ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", EViewModeIndex::VMI_Lit_Gouraud, GouraudPixelShaderKey);
@@ -85,7 +111,7 @@ void FStaticMeshRenderPass::CreateShader()
     hr = ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", EViewModeIndex::VMI_WorldNormal, WorldNormalPixelShaderKey);
 
 
-    VertexShader = ShaderManager->GetVertexShaderByKey(PhongVertexShaderKey);
+    VertexShader = ShaderManager->GetVertexShaderByKey(PhongInstancedVertexShaderKey);
 
     PixelShader = ShaderManager->GetPixelShaderByKey(PhongPixelShaderKey);
 
@@ -105,30 +131,37 @@ void FStaticMeshRenderPass::SwitchShaderLightingMode(EViewModeIndex evi)
     switch (evi)
     {
     case EViewModeIndex::VMI_Lit_Gouraud:
-        VertexShader = ShaderManager->GetVertexShaderByKey(GouraudVertexShaderKey);
+        VertexShader = ShaderManager->GetVertexShaderByKey(GouraudInstancedVertexShaderKey);
         PixelShader = ShaderManager->GetPixelShaderByKey(GouraudPixelShaderKey);
         break;
     case EViewModeIndex::VMI_Lit_Lambert:
-        VertexShader = ShaderManager->GetVertexShaderByKey(LambertVertexShaderKey);
+        VertexShader = ShaderManager->GetVertexShaderByKey(LambertInstancedVertexShaderKey);
         PixelShader = ShaderManager->GetPixelShaderByKey(LambertPixelShaderKey);
         break;
     case EViewModeIndex::VMI_Lit_Phong:
-        VertexShader = ShaderManager->GetVertexShaderByKey(PhongVertexShaderKey);
+        VertexShader = ShaderManager->GetVertexShaderByKey(PhongInstancedVertexShaderKey);
         PixelShader = ShaderManager->GetPixelShaderByKey(PhongPixelShaderKey);
         break;
     case VMI_Unlit:
     case VMI_Wireframe:
     case VMI_SceneDepth:
-        VertexShader = ShaderManager->GetVertexShaderByKey(UnlitVertexShaderKey);
+        VertexShader = ShaderManager->GetVertexShaderByKey(UnlitInstancedVertexShaderKey);
         PixelShader = ShaderManager->GetPixelShaderByKey(UnlitPixelShaderKey);
         ViewModeIndex = VMI_Unlit;
         break;
     case VMI_WorldNormal:
-        VertexShader = ShaderManager->GetVertexShaderByKey(WorldNormalVertexShaderKey);
+        VertexShader = ShaderManager->GetVertexShaderByKey(WorldNormalInstancedVertexShaderKey);
         PixelShader = ShaderManager->GetPixelShaderByKey(WorldNormalPixelShaderKey);
         break;
     }
 
+    TArray<D3D_SHADER_MACRO> NormalMapMacros;
+    NormalMapMacros.Add({ "HAS_NORMAL_MAP", "1" });
+
+    size_t NormalMapPixelShaderKey;
+    ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", ViewModeIndex, NormalMapPixelShaderKey, NormalMapMacros);
+    NormalMapPixelShader = ShaderManager->GetPixelShaderByKey(NormalMapPixelShaderKey);
+
     PrepareRenderState();
 
 }
@@ -140,19 +173,52 @@ void FStaticMeshRenderPass::Initialize(FDXDBufferManager* InBufferManager, FGrap
     Graphics = InGraphics;
     ShaderManager = InShaderManager;
 
+    CameraConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FCameraConstantBuffer"));
+    InstanceConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FInstanceConstants"));
+    SubMeshConstantBuffer = BufferManager->GetConstantBufferHandle(TEXT("FSubMeshConstants"));
+
     CreateShader();
 }
 
 void FStaticMeshRenderPass::PrepareRender()
 {
 
-    for (const auto iter : TObjectRange<UStaticMeshComponent>())
+    for (const auto iter : TObjectRange<UStaticMeshComponent>(GEngine->ActiveWorld))
     {
-        if (!Cast<UGizmoBaseComponent>(iter) && iter->GetWorld() == GEngine->ActiveWorld)
+        if (!Cast<UGizmoBaseComponent>(iter))
         {
             StaticMeshObjs.Add(iter);
         }
     }
+
+    UpdateCullingBounds();
+
+    StateTracker.ResetStats();
+}
+
+void FStaticMeshRenderPass::UpdateCullingBounds()
+{
+    const int32 NumObjs = StaticMeshObjs.Num();
+    Culler.SetNum(NumObjs);
+    CulledObjs.SetNum(NumObjs);
+    CulledBoundsRevisions.SetNum(NumObjs);
+
+    for (int32 i = 0; i < NumObjs; ++i)
+    {
+        UStaticMeshComponent* Comp = StaticMeshObjs[i];
+        const uint32 BoundsRevision = Comp->GetBoundsRevision();
+        if (CulledObjs[i] == Comp && CulledBoundsRevisions[i] == BoundsRevision)
+        {
+            continue;
+        }
+
+        CulledObjs[i] = Comp;
+        CulledBoundsRevisions[i] = BoundsRevision;
+
+        FBoundingBox WorldBounds;
+        Comp->GetWorldBoundingBox(WorldBounds);
+        Culler.SetBounds(i, WorldBounds);
+    }
 }
 
 void FStaticMeshRenderPass::PrepareRenderState() const
@@ -161,7 +227,7 @@ void FStaticMeshRenderPass::PrepareRenderState() const
     Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
     Graphics->DeviceContext->IASetInputLayout(InputLayout);
 
-    TArray<FString> VSBufferKeys = {
+    TArray<FString, FFrameAllocator<FString>> VSBufferKeys = {
                               TEXT("FPerObjectConstantBuffer"),
                               TEXT("FCameraConstantBuffer"),
                               TEXT("FLightBuffer"),
@@ -172,9 +238,10 @@ void FStaticMeshRenderPass::PrepareRenderState() const
 
     BufferManager->BindConstantBuffers(VSBufferKeys, 0, EShaderStage::Vertex);
     BufferManager->BindConstantBuffer(TEXT("FScreenConstants"), 6, EShaderStage::Vertex);
+    BufferManager->BindConstantBuffer(InstanceConstantBuffer, 7, EShaderStage::Vertex);
 
 
-    TArray<FString> PSBufferKeys = {
+    TArray<FString, FFrameAllocator<FString>> PSBufferKeys = {
                                   TEXT("FCameraConstantBuffer"),
                                   TEXT("FLightBuffer"),
                                   TEXT("FMaterialConstants"),
@@ -195,46 +262,179 @@ void FStaticMeshRenderPass::UpdatePerObjectConstant(const FMatrix& Model, const
 }
 
 
-void FStaticMeshRenderPass::RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex)
+bool FStaticMeshRenderPass::ReserveInstanceBuffer(uint32 NumInstances)
 {
-    UINT offset = 0;
-    Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &offset);
-    if (RenderData->IndexBuffer)
-        Graphics->DeviceContext->IASetIndexBuffer(RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    if (InstanceBuffer && NumInstances <= InstanceBufferCapacity)
+    {
+        return true;
+    }
 
-    if (RenderData->MaterialSubsets.Num() == 0) {
-        Graphics->DeviceContext->DrawIndexed(RenderData->Indices.Num(), 0, 0);
-        return;
+    uint32 NewCapacity = std::max(InstanceBufferCapacity, 1024u);
+    while (NewCapacity < NumInstances)
+    {
+        NewCapacity *= 2;
+    }
+
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.ByteWidth = NewCapacity * sizeof(FStaticMeshInstanceData);
+    Desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    Desc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+    Desc.StructureByteStride = sizeof(FStaticMeshInstanceData);
+
+    ID3D11Buffer* NewBuffer = nullptr;
+    HRESULT hr = Graphics->Device->CreateBuffer(&Desc, nullptr, &NewBuffer);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Static mesh instance buffer 생성 실패, HRESULT: 0x%X"), hr);
+        return false;
     }
 
-    for (int subMeshIndex = 0; subMeshIndex < RenderData->MaterialSubsets.Num(); subMeshIndex++) {
+    D3D11_SHADER_RESOURCE_VIEW_DESC SRVDesc = {};
+    SRVDesc.Format = DXGI_FORMAT_UNKNOWN;
+    SRVDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+    SRVDesc.Buffer.ElementOffset = 0;
+    SRVDesc.Buffer.NumElements = NewCapacity;
 
-        int materialIndex = RenderData->MaterialSubsets[subMeshIndex].MaterialIndex;
+    ID3D11ShaderResourceView* NewSRV = nullptr;
+    hr = Graphics->Device->CreateShaderResourceView(NewBuffer, &SRVDesc, &NewSRV);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Static mesh instance SRV 생성 실패, HRESULT: 0x%X"), hr);
+        NewBuffer->Release();
+        return false;
+    }
+
+    FDXDBufferManager::SafeRelease(InstanceSRV);
+    FDXDBufferManager::SafeRelease(InstanceBuffer);
+    InstanceBuffer = NewBuffer;
+    InstanceSRV = NewSRV;
+    InstanceBufferCapacity = NewCapacity;
+    return true;
+}
 
-        if (Materials[materialIndex]->Material->GetMaterialInfo().bHasNormalMap)
+UMaterial* FStaticMeshRenderPass::GetSubsetMaterial(const FStaticMeshBatch& Batch, int32 SubsetIndex)
+{
+    const OBJ::FStaticMeshRenderData* RenderData = Batch.Key.Mesh->GetRenderData();
+    const int32 MaterialIndex = RenderData->MaterialSubsets[SubsetIndex].MaterialIndex;
+    if ((*Batch.Key.OverrideMaterials)[MaterialIndex] != nullptr)
+        return (*Batch.Key.OverrideMaterials)[MaterialIndex];
+    return Batch.Key.Mesh->GetMaterials()[MaterialIndex]->Material;
+}
+
+void FStaticMeshRenderPass::BuildDrawCommands(const FVector& CameraLocation, float MaxDepth)
+{
+    DrawCommands.Reset();
+    MaterialIds.Empty();
+    MeshIds.Empty();
+
+    const TArray<FStaticMeshBatch>& Batches = Batcher.GetBatches();
+    const TArray<FStaticMeshInstanceData>& Instances = Batcher.GetInstances();
+    for (int32 BatchIndex = 0; BatchIndex < Batches.Num(); ++BatchIndex)
+    {
+        const FStaticMeshBatch& Batch = Batches[BatchIndex];
+
+        // 배치에서 카메라와 가장 가까운 인스턴스의 거리, 불투명한 메시는 가까운 것부터 그려 가려진 픽셀을 덜 칠함
+        float MinDistanceSquared = FLT_MAX;
+        for (int32 Index = Batch.FirstInstance; Index < Batch.FirstInstance + Batch.NumInstances; ++Index)
         {
-            TArray<D3D_SHADER_MACRO> DynamicMacros;
-            DynamicMacros.Add({ "HAS_NORMAL_MAP", "1" });
+            const FMatrix& World = Instances[Index].World;
+            const FVector Location(World.M[3][0], World.M[3][1], World.M[3][2]);
+            MinDistanceSquared = std::min(MinDistanceSquared, (Location - CameraLocation).LengthSquared());
+        }
+        const uint32 Depth = FDrawCommandList::QuantizeDepth(std::sqrt(MinDistanceSquared), MaxDepth);
 
-            size_t DynamicShaderKey;
-            ShaderManager->AddPixelShader(L"Shaders/UberShader.hlsl", "MainPS", ViewModeIndex, DynamicShaderKey, DynamicMacros);
-            PixelShader = ShaderManager->GetPixelShaderByKey(DynamicShaderKey);
-            Graphics->DeviceContext->PSSetShader(PixelShader, nullptr, 0);
+        uint32 MeshId;
+        if (const uint32* Found = MeshIds.Find(Batch.Key.Mesh))
+        {
+            MeshId = *Found;
+        }
+        else
+        {
+            MeshId = MeshIds.Num();
+            MeshIds.Add(Batch.Key.Mesh, MeshId);
         }
 
-        FSubMeshConstants SubMeshData = (subMeshIndex == SelectedSubMeshIndex) ? FSubMeshConstants(true) : FSubMeshConstants(false);
+        const OBJ::FStaticMeshRenderData* RenderData = Batch.Key.Mesh->GetRenderData();
+        if (RenderData->MaterialSubsets.Num() == 0)
+        {
+            DrawCommands.Add(FDrawCommandList::MakeSortKey(0, 0, MeshId, Depth), BatchIndex, 0);
+            continue;
+        }
+
+        for (int32 SubsetIndex = 0; SubsetIndex < RenderData->MaterialSubsets.Num(); ++SubsetIndex)
+        {
+            UMaterial* Material = GetSubsetMaterial(Batch, SubsetIndex);
+            const uint32 ShaderVariant = Material->GetMaterialInfo().bHasNormalMap ? 1 : 0;
+
+            uint32 MaterialId;
+            if (const uint32* Found = MaterialIds.Find(Material))
+            {
+                MaterialId = *Found;
+            }
+            else
+            {
+                MaterialId = MaterialIds.Num();
+                MaterialIds.Add(Material, MaterialId);
+            }
+
+            DrawCommands.Add(FDrawCommandList::MakeSortKey(ShaderVariant, MaterialId, MeshId, Depth), BatchIndex, SubsetIndex);
+        }
+    }
+}
 
-        BufferManager->UpdateConstantBuffer(TEXT("FSubMeshConstants"), SubMeshData);
+void FStaticMeshRenderPass::RenderDrawCommand(const FDrawCommand& Command)
+{
+    const FStaticMeshBatch& Batch = Batcher.GetBatches()[Command.BatchIndex];
+    OBJ::FStaticMeshRenderData* RenderData = Batch.Key.Mesh->GetRenderData();
 
-        if (OverrideMaterials[materialIndex] != nullptr)
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, OverrideMaterials[materialIndex]->GetMaterialInfo());
-        else
-            MaterialUtils::UpdateMaterial(BufferManager, Graphics, Materials[materialIndex]->Material->GetMaterialInfo());
+    if (StateTracker.SetMesh(RenderData))
+    {
+        UINT offset = 0;
+        Graphics->DeviceContext->IASetVertexBuffers(0, 1, &RenderData->VertexBuffer, &Stride, &offset);
+        if (RenderData->IndexBuffer)
+            Graphics->DeviceContext->IASetIndexBuffer(RenderData->IndexBuffer, DXGI_FORMAT_R32_UINT, 0);
+    }
+
+    if (StateTracker.SetBaseInstance(static_cast<uint32>(Batch.FirstInstance)))
+    {
+        FInstanceConstants InstanceData;
+        InstanceData.BaseInstance = static_cast<uint32>(Batch.FirstInstance);
+        BufferManager->UpdateConstantBuffer(InstanceConstantBuffer, InstanceData);
+    }
+
+    if (RenderData->MaterialSubsets.Num() == 0)
+    {
+        StateTracker.AddDraw();
+        Graphics->DeviceContext->DrawIndexedInstanced(RenderData->Indices.Num(), Batch.NumInstances, 0, 0, 0);
+        return;
+    }
+
+    UMaterial* Material = GetSubsetMaterial(Batch, Command.SubsetIndex);
+    const FObjMaterialInfo& MaterialInfo = Material->GetMaterialInfo();
+
+    ID3D11PixelShader* SubsetPixelShader = MaterialInfo.bHasNormalMap ? NormalMapPixelShader : PixelShader;
+    if (StateTracker.SetPixelShader(SubsetPixelShader))
+    {
+        Graphics->DeviceContext->PSSetShader(SubsetPixelShader, nullptr, 0);
+    }
+
+    const bool bSelected = static_cast<int32>(Command.SubsetIndex) == Batch.Key.SelectedSubMeshIndex;
+    if (StateTracker.SetSubMeshSelected(bSelected))
+    {
+        FSubMeshConstants SubMeshData(bSelected);
+        BufferManager->UpdateConstantBuffer(SubMeshConstantBuffer, SubMeshData);
+    }
 
-        uint64 startIndex = RenderData->MaterialSubsets[subMeshIndex].IndexStart;
-        uint64 indexCount = RenderData->MaterialSubsets[subMeshIndex].IndexCount;
-        Graphics->DeviceContext->DrawIndexed(indexCount, startIndex, 0);
+    if (StateTracker.SetMaterial(Material))
+    {
+        MaterialUtils::UpdateMaterial(BufferManager, Graphics, MaterialInfo);
     }
+
+    const FMaterialSubset& Subset = RenderData->MaterialSubsets[Command.SubsetIndex];
+    StateTracker.AddDraw();
+    Graphics->DeviceContext->DrawIndexedInstanced(Subset.IndexCount, Batch.NumInstances, Subset.IndexStart, 0, 0);
 }
 
 
@@ -272,49 +472,73 @@ void FStaticMeshRenderPass::Render(const std::shared_ptr<FEditorViewportClient>&
     Plane FrustumPlanes[6];
     memcpy(FrustumPlanes, Viewport->frustumPlanes, sizeof(Plane) * 6);
 
-    for (UStaticMeshComponent* Comp : StaticMeshObjs)
+    Culler.Cull(FrustumPlanes, VisibleIndices);
+
+    // 메시와 머티리얼이 같은 컴포넌트를 묶어 배치마다 서브셋 수만큼만 드로우
+    Batcher.Reset();
+    for (const int32 Index : VisibleIndices)
     {
-        if (!Comp || !Comp->GetStaticMesh())
+        UStaticMeshComponent* Comp = StaticMeshObjs[Index];
+        if (!Comp || !Comp->GetStaticMesh() || Comp->GetStaticMesh()->GetRenderData() == nullptr)
             continue;
 
-        FMatrix Model = Comp->GetWorldMatrix();
-
-        bool bFrustum = Comp->GetBoundingBox().TransformWorld(Model).IsIntersectingFrustum(FrustumPlanes);
-        if (!bFrustum) continue;
-
-
-        FVector4 UUIDColor = Comp->EncodeUUID() / 255.0f;
-
-        UEditorEngine* Engine = Cast<UEditorEngine>(GEngine);
-        bool Selected = (Engine && Engine->GetSelectedActor() == Comp->GetOwner());
-
-        UpdatePerObjectConstant(Model, Viewport->GetViewMatrix(), Viewport->GetProjectionMatrix(), UUIDColor, Selected);
-        FCameraConstantBuffer CameraData;
-
-        CameraData.View = Viewport->GetViewMatrix();
-        CameraData.Projection = Viewport->GetProjectionMatrix();
-        CameraData.InvProjection = FMatrix::Inverse(Viewport->GetProjectionMatrix());
-        CameraData.CameraPosition = Viewport->ViewTransformPerspective.GetLocation();
-        CameraData.CameraNear = Viewport->nearPlane;
-        CameraData.CameraFar = Viewport->farPlane;
-
-        BufferManager->UpdateConstantBuffer(TEXT("FCameraConstantBuffer"), CameraData);
+        FMatrix Model = FSceneTransformHierarchy::GetWorldMatrix(Comp);
 
-        OBJ::FStaticMeshRenderData* RenderData = Comp->GetStaticMesh()->GetRenderData();
-
-        if (RenderData == nullptr)
-            continue;
-
-        RenderPrimitive(RenderData, Comp->GetStaticMesh()->GetMaterials(), Comp->GetOverrideMaterials(), Comp->GetselectedSubMeshIndex());
+        FStaticMeshBatchKey Key;
+        Key.Mesh = Comp->GetStaticMesh();
+        Key.OverrideMaterials = &Comp->GetOverrideMaterials();
+        Key.SelectedSubMeshIndex = Comp->GetselectedSubMeshIndex();
+        Batcher.AddInstance(Key, Model);
 
         if (Viewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_AABB))
         {
             FEngineLoop::PrimitiveDrawBatch.AddAABBToBatch(Comp->GetBoundingBox(), Comp->GetWorldLocation(), Model);
         }
-
     }
+    Batcher.Build();
+
+    const TArray<FStaticMeshInstanceData>& Instances = Batcher.GetInstances();
+    if (Instances.IsEmpty() || !ReserveInstanceBuffer(Instances.Num()))
+        return;
 
+    D3D11_MAPPED_SUBRESOURCE Mapped;
+    HRESULT hr = Graphics->DeviceContext->Map(InstanceBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &Mapped);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Static mesh instance buffer Map 실패, HRESULT: 0x%X"), hr);
+        return;
+    }
+    memcpy(Mapped.pData, Instances.GetData(), sizeof(FStaticMeshInstanceData) * Instances.Num());
+    Graphics->DeviceContext->Unmap(InstanceBuffer, 0);
+
+    Graphics->DeviceContext->VSSetShaderResources(5, 1, &InstanceSRV);
+
+    // 중복 검사가 패딩까지 비교하므로 0으로 채움
+    FCameraConstantBuffer CameraData = {};
+    CameraData.View = Viewport->GetViewMatrix();
+    CameraData.Projection = Viewport->GetProjectionMatrix();
+    CameraData.InvProjection = FMatrix::Inverse(Viewport->GetProjectionMatrix());
+    CameraData.CameraPosition = Viewport->ViewTransformPerspective.GetLocation();
+    CameraData.CameraNear = Viewport->nearPlane;
+    CameraData.CameraFar = Viewport->farPlane;
+
+    BufferManager->UpdateConstantBuffer(CameraConstantBuffer, CameraData);
+    StateTracker.AddConstantBufferUpload();
+
+    // 셰이더 변형, 머티리얼, 메시 순으로 정렬해 같은 상태를 쓰는 드로우를 모으고 중복 바인딩을 건너뜀
+    BuildDrawCommands(CameraData.CameraPosition, Viewport->farPlane);
+    DrawCommands.Sort();
+
+    // 다른 패스나 다른 뷰포트에서 바인딩이 바뀌었을 수 있음
+    StateTracker.ResetBindings();
+    for (const FDrawCommand& Command : DrawCommands.GetCommands())
+    {
+        RenderDrawCommand(Command);
+    }
 
+    // 다른 패스가 t5를 다른 용도로 쓰므로 해제
+    ID3D11ShaderResourceView* NullSRV = nullptr;
+    Graphics->DeviceContext->VSSetShaderResources(5, 1, &NullSRV);
 }
 
 void FStaticMeshRenderPass::ClearRenderArr()
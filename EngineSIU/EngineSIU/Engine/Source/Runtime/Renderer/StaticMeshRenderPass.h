@@ -4,6 +4,10 @@
 #include "Container/Set.h"
 
 #include "Define.h"
+#include "FrustumCuller.h"
+#include "StaticMeshInstanceBatcher.h"
+#include "DrawCommandList.h"
+#include "D3D11RHI/ConstantBufferUploader.h"
 
 class FDXDShaderManager;
 
@@ -11,6 +15,8 @@ class UWorld;
 
 class UMaterial;
 
+class UStaticMesh;
+
 class FEditorViewportClient;
 
 class UStaticMeshComponent;
@@ -36,8 +42,6 @@ public:
     
     void UpdatePerObjectConstant(const FMatrix& Model, const FMatrix& View, const FMatrix& Projection, const FVector4& UUIDColor, bool Selected) const;
   
-    void RenderPrimitive(OBJ::FStaticMeshRenderData* RenderData, TArray<FStaticMaterial*> Materials, TArray<UMaterial*> OverrideMaterials, int SelectedSubMeshIndex);
-    
     void RenderPrimitive(ID3D11Buffer* pBuffer, UINT numVertices) const;
 
     void RenderPrimitive(ID3D11Buffer* pVertexBuffer, UINT numVertices, ID3D11Buffer* pIndexBuffer, UINT numIndices) const;
@@ -47,18 +51,70 @@ public:
     void ReleaseShader();
 
     void SwitchShaderLightingMode(EViewModeIndex evi);
+
+    /** PrepareRender 이후 이 패스가 그린 드로우와 상태 변경, 상수 버퍼 업로드 수, 뷰포트가 여럿이면 합한 값 */
+    const FDrawListStats& GetDrawStats() const { return StateTracker.GetStats(); }
+private:
+    /** StaticMeshObjs와 같은 순서로 컬링용 월드 바운딩 박스를 맞추고, 바뀐 컴포넌트만 다시 계산합니다. */
+    void UpdateCullingBounds();
+
+    /** 인스턴스 버퍼가 NumInstances개를 담을 수 있도록 필요하면 두 배씩 키워서 SRV와 함께 다시 만듭니다. */
+    bool ReserveInstanceBuffer(uint32 NumInstances);
+
+    /** Batcher의 배치와 서브셋마다 셰이더 변형, 머티리얼, 메시, 카메라와의 거리로 정렬 키를 만들어 DrawCommands에 추가합니다. */
+    void BuildDrawCommands(const FVector& CameraLocation, float MaxDepth);
+
+    /** 명령 하나를 그립니다. 마지막으로 바인딩한 것과 같은 셰이더, 버퍼, 머티리얼, 상수는 다시 바인딩하지 않습니다. */
+    void RenderDrawCommand(const FDrawCommand& Command);
+
+    /** 서브셋이 그릴 때 쓰는 머티리얼, 오버라이드가 있으면 오버라이드 */
+    static UMaterial* GetSubsetMaterial(const FStaticMeshBatch& Batch, int32 SubsetIndex);
+
 private:
     TArray<UStaticMeshComponent*> StaticMeshObjs;
 
+    FFrustumCuller Culler;
+
+    // Culler의 각 슬롯에 마지막으로 넣은 컴포넌트와 그때의 BoundsRevision, 포인터는 비교에만 사용
+    TArray<UStaticMeshComponent*> CulledObjs;
+    TArray<uint32> CulledBoundsRevisions;
+
+    // 마지막 Render에서 절두체와 겹친 StaticMeshObjs의 인덱스
+    TArray<int32> VisibleIndices;
+
+    // 보이는 컴포넌트를 메시와 머티리얼이 같은 것끼리 묶고 인스턴스 데이터를 채움
+    FStaticMeshInstanceBatcher Batcher;
+
+    // Batcher의 인스턴스 데이터를 담는 StructuredBuffer, 버텍스 셰이더의 t5에 바인딩
+    ID3D11Buffer* InstanceBuffer;
+    ID3D11ShaderResourceView* InstanceSRV;
+    uint32 InstanceBufferCapacity;
+
+    FDrawCommandList DrawCommands;
+    FDrawStateTracker StateTracker;
+
+    // 정렬 키에 넣을 작은 번호, 이번 Render에서 처음 나온 순서대로 매김
+    TFlatMap<UMaterial*, uint32> MaterialIds;
+    TFlatMap<UStaticMesh*, uint32> MeshIds;
+
+    // 인스턴스 버퍼에서 행렬을 읽는 MainVSInstanced
     ID3D11VertexShader* VertexShader;
      
     ID3D11PixelShader* PixelShader;
+
+    // 노멀 맵이 있는 머티리얼에 쓰는 HAS_NORMAL_MAP 변형, 뷰 모드가 바뀔 때 함께 고름
+    ID3D11PixelShader* NormalMapPixelShader;
     
     ID3D11InputLayout* InputLayout;
     
     uint32 Stride;
 
     FDXDBufferManager* BufferManager;
+
+    // Initialize에서 찾아둔 상수 버퍼
+    FConstantBufferHandle CameraConstantBuffer;
+    FConstantBufferHandle InstanceConstantBuffer;
+    FConstantBufferHandle SubMeshConstantBuffer;
     
     FGraphicsDevice* Graphics;
     
@@ -76,5 +132,11 @@ private:
     size_t WorldNormalVertexShaderKey;
     size_t WorldNormalPixelShaderKey;
 
+    size_t UnlitInstancedVertexShaderKey;
+    size_t GouraudInstancedVertexShaderKey;
+    size_t LambertInstancedVertexShaderKey;
+    size_t PhongInstancedVertexShaderKey;
+    size_t WorldNormalInstancedVertexShaderKey;
+
     EViewModeIndex ViewModeIndex;
 };
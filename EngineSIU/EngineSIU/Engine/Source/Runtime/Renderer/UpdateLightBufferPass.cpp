@@ -43,21 +43,18 @@ void FUpdateLightBufferPass::Initialize(FDXDBufferManager* InBufferManager, FGra
 
 void FUpdateLightBufferPass::PrepareRender()
 {
-    for (const auto iter : TObjectRange<ULightComponentBase>())
+    for (const auto iter : TObjectRange<ULightComponentBase>(GEngine->ActiveWorld))
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
+        if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
         {
-            if (UPointLightComponent* PointLight = Cast<UPointLightComponent>(iter))
-            {
-                PointLights.Add(PointLight);
-            }
-            else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
-            {
-                SpotLights.Add(SpotLight);
-            }
-            else if (UDirectionalLightComponent* DirLight = Cast<UDirectionalLightComponent>(iter)) {
-                DirLights.Add(DirLight);
-            }
+            PointLights.Add(PointLight);
+        }
+        else if (USpotLightComponent* SpotLight = Cast<USpotLightComponent>(iter))
+        {
+            SpotLights.Add(SpotLight);
+        }
+        else if (UDirectionalLightComponent* DirLight = Cast<UDirectionalLightComponent>(iter)) {
+            DirLights.Add(DirLight);
         }
     }
 }
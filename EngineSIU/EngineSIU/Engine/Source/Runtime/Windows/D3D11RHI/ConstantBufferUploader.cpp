@@ -0,0 +1,372 @@
+#include "ConstantBufferUploader.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "DXDBufferManager.h"
+#include "UserInterface/Console.h"
+
+namespace
+{
+constexpr uint32 BytesPerConstant = 16;
+
+constexpr uint32 AlignUp(uint32 Value, uint32 Alignment)
+{
+    return (Value + Alignment - 1) & ~(Alignment - 1);
+}
+}
+
+FD3D11ConstantBufferDevice::~FD3D11ConstantBufferDevice()
+{
+    Release();
+}
+
+void FD3D11ConstantBufferDevice::Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext)
+{
+    Device = InDevice;
+    DeviceContext = InDeviceContext;
+
+    // 범위 바인딩과 상수 버퍼의 NoOverwrite Map은 D3D11.1 런타임과 드라이버가 모두 지원해야 함
+    D3D11_FEATURE_DATA_D3D11_OPTIONS Options = {};
+    HRESULT hr = Device->CheckFeatureSupport(D3D11_FEATURE_D3D11_OPTIONS, &Options, sizeof(Options));
+    if (SUCCEEDED(hr) && Options.ConstantBufferOffsetting && Options.MapNoOverwriteOnDynamicConstantBuffer)
+    {
+        hr = DeviceContext->QueryInterface(__uuidof(ID3D11DeviceContext1), reinterpret_cast<void**>(&DeviceContext1));
+        if (FAILED(hr))
+        {
+            DeviceContext1 = nullptr;
+        }
+    }
+    UE_LOG(LogLevel::Display, TEXT("Constant buffer offsets: %s"), DeviceContext1 ? TEXT("supported") : TEXT("not supported"));
+}
+
+void FD3D11ConstantBufferDevice::Release()
+{
+    if (DeviceContext1)
+    {
+        DeviceContext1->Release();
+        DeviceContext1 = nullptr;
+    }
+}
+
+ID3D11Buffer* FD3D11ConstantBufferDevice::CreateConstantBuffer(uint32 ByteWidth)
+{
+    D3D11_BUFFER_DESC Desc = {};
+    Desc.ByteWidth = ByteWidth;
+    Desc.Usage = D3D11_USAGE_DYNAMIC;
+    Desc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    Desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+
+    ID3D11Buffer* Buffer = nullptr;
+    HRESULT hr = Device->CreateBuffer(&Desc, nullptr, &Buffer);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Error Create Constant Buffer!"));
+        return nullptr;
+    }
+    return Buffer;
+}
+
+void FD3D11ConstantBufferDevice::ReleaseConstantBuffer(ID3D11Buffer* Buffer)
+{
+    if (Buffer)
+    {
+        Buffer->Release();
+    }
+}
+
+void* FD3D11ConstantBufferDevice::Map(ID3D11Buffer* Buffer, EConstantBufferMapMode Mode)
+{
+    const D3D11_MAP MapType = Mode == EConstantBufferMapMode::Discard ? D3D11_MAP_WRITE_DISCARD : D3D11_MAP_WRITE_NO_OVERWRITE;
+
+    D3D11_MAPPED_SUBRESOURCE MappedResource;
+    HRESULT hr = DeviceContext->Map(Buffer, 0, MapType, 0, &MappedResource);
+    if (FAILED(hr))
+    {
+        UE_LOG(LogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
+        return nullptr;
+    }
+    return MappedResource.pData;
+}
+
+void FD3D11ConstantBufferDevice::Unmap(ID3D11Buffer* Buffer)
+{
+    DeviceContext->Unmap(Buffer, 0);
+}
+
+void FD3D11ConstantBufferDevice::Bind(EShaderStage Stage, uint32 Slot, ID3D11Buffer* Buffer, uint32 FirstConstant, uint32 NumConstants)
+{
+    if (NumConstants == 0 || !DeviceContext1)
+    {
+        switch (Stage)
+        {
+        case EShaderStage::Vertex:
+            DeviceContext->VSSetConstantBuffers(Slot, 1, &Buffer);
+            break;
+        case EShaderStage::Pixel:
+            DeviceContext->PSSetConstantBuffers(Slot, 1, &Buffer);
+            break;
+        case EShaderStage::Compute:
+            DeviceContext->CSSetConstantBuffers(Slot, 1, &Buffer);
+            break;
+        }
+        return;
+    }
+
+    // 같은 버퍼를 범위만 바꿔 다시 바인딩하면 범위를 갱신하지 않는 런타임이 있으므로 먼저 해제
+    ID3D11Buffer* NullBuffer = nullptr;
+    switch (Stage)
+    {
+    case EShaderStage::Vertex:
+        DeviceContext1->VSSetConstantBuffers(Slot, 1, &NullBuffer);
+        DeviceContext1->VSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+        break;
+    case EShaderStage::Pixel:
+        DeviceContext1->PSSetConstantBuffers(Slot, 1, &NullBuffer);
+        DeviceContext1->PSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+        break;
+    case EShaderStage::Compute:
+        DeviceContext1->CSSetConstantBuffers(Slot, 1, &NullBuffer);
+        DeviceContext1->CSSetConstantBuffers1(Slot, 1, &Buffer, &FirstConstant, &NumConstants);
+        break;
+    }
+}
+
+FMockConstantBufferDevice::FMockConstantBufferDevice(bool bInSupportsOffsets)
+    : bSupportsOffsets(bInSupportsOffsets)
+{
+}
+
+ID3D11Buffer* FMockConstantBufferDevice::CreateConstantBuffer(uint32 ByteWidth)
+{
+    const int32 Index = Buffers.Emplace();
+    Buffers[Index].SetNum(static_cast<int32>(ByteWidth));
+    ++Counters.NumCreates;
+    return reinterpret_cast<ID3D11Buffer*>(static_cast<uintptr_t>(Buffers.Num()));
+}
+
+void FMockConstantBufferDevice::ReleaseConstantBuffer(ID3D11Buffer* Buffer)
+{
+    // 포인터로 쓰는 인덱스가 바뀌지 않도록 메모리만 비움
+    const uintptr_t BufferId = reinterpret_cast<uintptr_t>(Buffer);
+    if (BufferId != 0 && BufferId <= static_cast<uintptr_t>(Buffers.Num()))
+    {
+        Buffers[static_cast<int32>(BufferId - 1)].Empty();
+    }
+}
+
+void* FMockConstantBufferDevice::Map(ID3D11Buffer* Buffer, EConstantBufferMapMode Mode)
+{
+    const uintptr_t BufferId = reinterpret_cast<uintptr_t>(Buffer);
+    if (BufferId == 0 || BufferId > static_cast<uintptr_t>(Buffers.Num()))
+    {
+        return nullptr;
+    }
+    ++Counters.NumMaps;
+    if (Mode == EConstantBufferMapMode::Discard)
+    {
+        ++Counters.NumDiscardMaps;
+    }
+    return Buffers[static_cast<int32>(BufferId - 1)].GetData();
+}
+
+void FMockConstantBufferDevice::Bind(EShaderStage Stage, uint32 Slot, ID3D11Buffer* Buffer, uint32 FirstConstant, uint32 NumConstants)
+{
+    const uint32 StageIndex = static_cast<uint32>(Stage);
+    if (StageIndex >= MaxStages || Slot >= MaxSlots)
+    {
+        return;
+    }
+    if (!bSupportsOffsets)
+    {
+        FirstConstant = 0;
+        NumConstants = 0;
+    }
+    Bindings[StageIndex][Slot] = { reinterpret_cast<uintptr_t>(Buffer), FirstConstant, NumConstants };
+    ++Counters.NumBinds;
+}
+
+const uint8* FMockConstantBufferDevice::GetBoundData(EShaderStage Stage, uint32 Slot, uint32& OutSize) const
+{
+    OutSize = 0;
+    const uint32 StageIndex = static_cast<uint32>(Stage);
+    if (StageIndex >= MaxStages || Slot >= MaxSlots)
+    {
+        return nullptr;
+    }
+
+    const FBinding& Binding = Bindings[StageIndex][Slot];
+    if (Binding.BufferId == 0 || Binding.BufferId > static_cast<uintptr_t>(Buffers.Num()))
+    {
+        return nullptr;
+    }
+
+    const TArray<uint8>& Memory = Buffers[static_cast<int32>(Binding.BufferId - 1)];
+    const uint32 Offset = Binding.FirstConstant * BytesPerConstant;
+    const uint32 Size = Binding.NumConstants != 0 ? Binding.NumConstants * BytesPerConstant : static_cast<uint32>(Memory.Num());
+    if (Offset + Size > static_cast<uint32>(Memory.Num()))
+    {
+        return nullptr;
+    }
+    OutSize = Size;
+    return Memory.GetData() + Offset;
+}
+
+FConstantBufferUploader::~FConstantBufferUploader()
+{
+    Release();
+}
+
+void FConstantBufferUploader::Initialize(IConstantBufferDevice* InDevice, uint32 InRingBufferSize)
+{
+    Release();
+    Device = InDevice;
+
+    if (Device->SupportsConstantBufferOffsets())
+    {
+        RingBufferSize = AlignUp(std::max(InRingBufferSize, TransientAlignment), TransientAlignment);
+        RingBuffer = Device->CreateConstantBuffer(RingBufferSize);
+        if (!RingBuffer)
+        {
+            RingBufferSize = 0;
+        }
+    }
+    RingBufferOffset = 0;
+}
+
+void FConstantBufferUploader::Release()
+{
+    if (!Device)
+    {
+        return;
+    }
+
+    for (FEntry& Entry : Entries)
+    {
+        Device->ReleaseConstantBuffer(Entry.Buffer);
+    }
+    Entries.Empty();
+    EntryIndices.Empty();
+
+    if (RingBuffer)
+    {
+        Device->ReleaseConstantBuffer(RingBuffer);
+        RingBuffer = nullptr;
+    }
+    RingBufferSize = 0;
+    RingBufferOffset = 0;
+}
+
+FConstantBufferHandle FConstantBufferUploader::Create(const FString& Name, uint32 ByteWidth)
+{
+    if (const int32* Index = EntryIndices.Find(Name))
+    {
+        return { *Index };
+    }
+
+    ID3D11Buffer* Buffer = Device->CreateConstantBuffer(ByteWidth);
+    if (!Buffer)
+    {
+        return {};
+    }
+
+    const int32 Index = Entries.Emplace();
+    Entries[Index].Buffer = Buffer;
+    Entries[Index].ByteWidth = ByteWidth;
+    EntryIndices.Add(Name, Index);
+    return { Index };
+}
+
+FConstantBufferHandle FConstantBufferUploader::Find(const FString& Name) const
+{
+    const int32* Index = EntryIndices.Find(Name);
+    return Index ? FConstantBufferHandle{ *Index } : FConstantBufferHandle{};
+}
+
+ID3D11Buffer* FConstantBufferUploader::GetBuffer(FConstantBufferHandle Handle) const
+{
+    return Handle.Index >= 0 && Handle.Index < Entries.Num() ? Entries[Handle.Index].Buffer : nullptr;
+}
+
+bool FConstantBufferUploader::Update(FConstantBufferHandle Handle, const void* Data, uint32 Size)
+{
+    if (Handle.Index < 0 || Handle.Index >= Entries.Num())
+    {
+        return false;
+    }
+
+    FEntry& Entry = Entries[Handle.Index];
+    if (Size > Entry.ByteWidth)
+    {
+        UE_LOG(LogLevel::Error, TEXT("상수 버퍼보다 큰 값을 올리려고 했습니다: %u > %u"), Size, Entry.ByteWidth);
+        return false;
+    }
+
+    ++Stats.NumUpdates;
+    if (Entry.Shadow.Num() == static_cast<int32>(Size) && std::memcmp(Entry.Shadow.GetData(), Data, Size) == 0)
+    {
+        ++Stats.NumSkippedUploads;
+        return false;
+    }
+
+    void* Mapped = Device->Map(Entry.Buffer, EConstantBufferMapMode::Discard);
+    if (!Mapped)
+    {
+        return false;
+    }
+    std::memcpy(Mapped, Data, Size);
+    Device->Unmap(Entry.Buffer);
+
+    Entry.Shadow.SetNum(static_cast<int32>(Size));
+    std::memcpy(Entry.Shadow.GetData(), Data, Size);
+
+    ++Stats.NumUploads;
+    Stats.NumBytesUploaded += Size;
+    return true;
+}
+
+void FConstantBufferUploader::Bind(FConstantBufferHandle Handle, uint32 Slot, EShaderStage Stage) const
+{
+    Device->Bind(Stage, Slot, GetBuffer(Handle), 0, 0);
+}
+
+FTransientConstantBuffer FConstantBufferUploader::UploadTransient(FConstantBufferHandle Fallback, const void* Data, uint32 Size)
+{
+    const uint32 AllocationSize = AlignUp(Size, TransientAlignment);
+    if (!RingBuffer || AllocationSize > RingBufferSize)
+    {
+        // 범위 바인딩을 못 쓰면 버퍼 하나를 매번 덮어씀
+        Update(Fallback, Data, Size);
+        return { GetBuffer(Fallback), 0, 0 };
+    }
+
+    if (RingBufferOffset + AllocationSize > RingBufferSize)
+    {
+        RingBufferOffset = 0;
+        ++Stats.NumRingWraps;
+    }
+
+    // 처음부터 다시 쓸 때만 Discard로 새 메모리를 받고, 그 외에는 GPU가 아직 읽지 않은 앞부분을 건드리지 않고 뒤에 이어서 씀
+    const EConstantBufferMapMode Mode = RingBufferOffset == 0 ? EConstantBufferMapMode::Discard : EConstantBufferMapMode::NoOverwrite;
+    uint8* Mapped = static_cast<uint8*>(Device->Map(RingBuffer, Mode));
+    if (!Mapped)
+    {
+        return {};
+    }
+    std::memcpy(Mapped + RingBufferOffset, Data, Size);
+    Device->Unmap(RingBuffer);
+
+    const FTransientConstantBuffer Transient = { RingBuffer, RingBufferOffset / BytesPerConstant, AllocationSize / BytesPerConstant };
+    RingBufferOffset += AllocationSize;
+
+    ++Stats.NumUpdates;
+    ++Stats.NumUploads;
+    ++Stats.NumTransientUploads;
+    Stats.NumBytesUploaded += Size;
+    return Transient;
+}
+
+void FConstantBufferUploader::BindTransient(const FTransientConstantBuffer& Transient, uint32 Slot, EShaderStage Stage) const
+{
+    Device->Bind(Stage, Slot, Transient.Buffer, Transient.FirstConstant, Transient.NumConstants);
+}
@@ -0,0 +1,217 @@
+#pragma once
+#define _TCHAR_DEFINED
+#include "Define.h"
+#include <d3d11_1.h>
+#include "Container/String.h"
+#include "Container/Array.h"
+#include "Container/FlatMap.h"
+
+enum class EShaderStage;
+
+enum class EConstantBufferMapMode : uint8
+{
+    // 이전 내용을 버리고 새 메모리를 받음
+    Discard,
+    // GPU가 쓰고 있는 영역은 건드리지 않는다고 약속하고 같은 메모리에 이어서 씀
+    NoOverwrite,
+};
+
+/**
+ * FConstantBufferUploader가 상수 버퍼를 만들고, 쓰고, 바인딩할 때 부르는 장치
+ *
+ * D3D11 장치 대신 CPU 메모리를 쓰는 FMockConstantBufferDevice를 넣으면 창 없이도 업로드 수를 셀 수 있습니다.
+ */
+class IConstantBufferDevice
+{
+public:
+    virtual ~IConstantBufferDevice() = default;
+
+    /** CPU에서 쓸 수 있는 동적 상수 버퍼를 만듭니다. */
+    virtual ID3D11Buffer* CreateConstantBuffer(uint32 ByteWidth) = 0;
+    virtual void ReleaseConstantBuffer(ID3D11Buffer* Buffer) = 0;
+
+    /** 실패하면 nullptr을 반환합니다. */
+    virtual void* Map(ID3D11Buffer* Buffer, EConstantBufferMapMode Mode) = 0;
+    virtual void Unmap(ID3D11Buffer* Buffer) = 0;
+
+    /** NumConstants가 0이면 버퍼 전체를, 아니면 16바이트 상수 단위로 [FirstConstant, FirstConstant + NumConstants) 범위를 바인딩합니다. */
+    virtual void Bind(EShaderStage Stage, uint32 Slot, ID3D11Buffer* Buffer, uint32 FirstConstant, uint32 NumConstants) = 0;
+
+    /** 상수 버퍼 일부를 바인딩하고 NoOverwrite로 Map할 수 있는지 */
+    virtual bool SupportsConstantBufferOffsets() const = 0;
+};
+
+/**
+ * ID3D11DeviceContext로 상수 버퍼를 다루는 장치
+ *
+ * 범위 바인딩은 D3D11.1 런타임의 ID3D11DeviceContext1과 D3D11_FEATURE_D3D11_OPTIONS가 모두 지원할 때만 사용합니다.
+ */
+class FD3D11ConstantBufferDevice : public IConstantBufferDevice
+{
+public:
+    FD3D11ConstantBufferDevice() = default;
+    virtual ~FD3D11ConstantBufferDevice() override;
+
+    void Initialize(ID3D11Device* InDevice, ID3D11DeviceContext* InDeviceContext);
+    void Release();
+
+    virtual ID3D11Buffer* CreateConstantBuffer(uint32 ByteWidth) override;
+    virtual void ReleaseConstantBuffer(ID3D11Buffer* Buffer) override;
+    virtual void* Map(ID3D11Buffer* Buffer, EConstantBufferMapMode Mode) override;
+    virtual void Unmap(ID3D11Buffer* Buffer) override;
+    virtual void Bind(EShaderStage Stage, uint32 Slot, ID3D11Buffer* Buffer, uint32 FirstConstant, uint32 NumConstants) override;
+    virtual bool SupportsConstantBufferOffsets() const override { return DeviceContext1 != nullptr; }
+
+private:
+    ID3D11Device* Device = nullptr;
+    ID3D11DeviceContext* DeviceContext = nullptr;
+
+    // 범위 바인딩을 지원하지 않으면 nullptr
+    ID3D11DeviceContext1* DeviceContext1 = nullptr;
+};
+
+/** GPU 없이 CPU 메모리에 쓰고 호출 수를 세는 장치 */
+class FMockConstantBufferDevice : public IConstantBufferDevice
+{
+public:
+    static constexpr uint32 MaxStages = 3;
+    static constexpr uint32 MaxSlots = 14;
+
+    struct FCounters
+    {
+        uint32 NumCreates = 0;
+        uint32 NumMaps = 0;
+        uint32 NumDiscardMaps = 0;
+        uint32 NumBinds = 0;
+    };
+
+    explicit FMockConstantBufferDevice(bool bInSupportsOffsets);
+
+    virtual ID3D11Buffer* CreateConstantBuffer(uint32 ByteWidth) override;
+    virtual void ReleaseConstantBuffer(ID3D11Buffer* Buffer) override;
+    virtual void* Map(ID3D11Buffer* Buffer, EConstantBufferMapMode Mode) override;
+    virtual void Unmap(ID3D11Buffer* Buffer) override {}
+    virtual void Bind(EShaderStage Stage, uint32 Slot, ID3D11Buffer* Buffer, uint32 FirstConstant, uint32 NumConstants) override;
+    virtual bool SupportsConstantBufferOffsets() const override { return bSupportsOffsets; }
+
+    /** 셰이더가 Stage의 Slot에서 읽게 될 메모리와 크기, 바인딩된 버퍼가 없으면 nullptr */
+    const uint8* GetBoundData(EShaderStage Stage, uint32 Slot, uint32& OutSize) const;
+
+    const FCounters& GetCounters() const { return Counters; }
+    void ResetCounters() { Counters = FCounters(); }
+
+private:
+    struct FBinding
+    {
+        // Buffers의 인덱스 + 1, 0이면 바인딩 없음
+        uintptr_t BufferId = 0;
+        uint32 FirstConstant = 0;
+        uint32 NumConstants = 0;
+    };
+
+    bool bSupportsOffsets;
+
+    // 버퍼 포인터는 Buffers의 인덱스 + 1을 주소처럼 사용
+    TArray<TArray<uint8>> Buffers;
+    FBinding Bindings[MaxStages][MaxSlots];
+
+    FCounters Counters;
+};
+
+/** FConstantBufferUploader에 만든 상수 버퍼를 가리키는 값, 초기화할 때 한 번 찾아두고 문자열 조회 없이 사용 */
+struct FConstantBufferHandle
+{
+    int32 Index = INDEX_NONE;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
+/** 링 버퍼에 올린 상수를 바인딩할 범위 */
+struct FTransientConstantBuffer
+{
+    ID3D11Buffer* Buffer = nullptr;
+
+    // 16바이트 상수 단위, NumConstants가 0이면 버퍼 전체
+    uint32 FirstConstant = 0;
+    uint32 NumConstants = 0;
+};
+
+/** ResetStats 이후 업로드한 값을 센 값 */
+struct FConstantBufferStats
+{
+    // Update와 UploadTransient를 부른 수
+    uint32 NumUpdates = 0;
+    // 실제로 Map/Unmap한 수
+    uint32 NumUploads = 0;
+    // 이전에 올린 값과 같아서 건너뛴 수
+    uint32 NumSkippedUploads = 0;
+    // 링 버퍼에 올린 수와 끝에 닿아 처음으로 돌아간 수
+    uint32 NumTransientUploads = 0;
+    uint32 NumRingWraps = 0;
+    uint64 NumBytesUploaded = 0;
+};
+
+/**
+ * 이름 붙은 상수 버퍼와 오브젝트마다 바뀌는 상수를 올리는 링 버퍼를 관리합니다.
+ *
+ * Update는 마지막으로 올린 값을 CPU에 복사해 두고 같은 값이 오면 Map하지 않습니다.
+ * UploadTransient는 큰 링 버퍼를 256바이트 단위로 나눠 NoOverwrite로 이어서 쓰고, 끝에 닿으면 Discard로 처음부터 다시 씁니다.
+ * 장치가 범위 바인딩을 지원하지 않으면 대신 Fallback 버퍼를 Update합니다.
+ */
+class FConstantBufferUploader
+{
+public:
+    // 범위 바인딩의 시작 위치와 크기는 16개 상수(256바이트)의 배수여야 함
+    static constexpr uint32 TransientAlignment = 256;
+    static constexpr uint32 DefaultRingBufferSize = 1024 * 1024;
+
+    FConstantBufferUploader() = default;
+    ~FConstantBufferUploader();
+
+    FConstantBufferUploader(const FConstantBufferUploader&) = delete;
+    FConstantBufferUploader& operator=(const FConstantBufferUploader&) = delete;
+
+    void Initialize(IConstantBufferDevice* InDevice, uint32 InRingBufferSize = DefaultRingBufferSize);
+
+    /** 모든 상수 버퍼와 링 버퍼를 해제합니다. 이전에 받은 핸들은 더 이상 쓸 수 없습니다. */
+    void Release();
+
+    /** 이름이 이미 있으면 기존 핸들을 반환합니다. */
+    FConstantBufferHandle Create(const FString& Name, uint32 ByteWidth);
+    FConstantBufferHandle Find(const FString& Name) const;
+
+    ID3D11Buffer* GetBuffer(FConstantBufferHandle Handle) const;
+
+    /** Data를 버퍼에 올립니다. 마지막으로 올린 값과 같으면 건너뛰고 false를 반환합니다. */
+    bool Update(FConstantBufferHandle Handle, const void* Data, uint32 Size);
+
+    void Bind(FConstantBufferHandle Handle, uint32 Slot, EShaderStage Stage) const;
+
+    /** 드로우 하나에만 쓸 상수를 링 버퍼에 올리고 바인딩할 범위를 반환합니다. */
+    FTransientConstantBuffer UploadTransient(FConstantBufferHandle Fallback, const void* Data, uint32 Size);
+    void BindTransient(const FTransientConstantBuffer& Transient, uint32 Slot, EShaderStage Stage) const;
+
+    void ResetStats() { Stats = FConstantBufferStats(); }
+    const FConstantBufferStats& GetStats() const { return Stats; }
+
+private:
+    struct FEntry
+    {
+        ID3D11Buffer* Buffer = nullptr;
+        uint32 ByteWidth = 0;
+
+        // 마지막으로 올린 값, 아직 올린 적이 없으면 비어 있음
+        TArray<uint8> Shadow;
+    };
+
+    IConstantBufferDevice* Device = nullptr;
+
+    TArray<FEntry> Entries;
+    TFlatMap<FString, int32> EntryIndices;
+
+    ID3D11Buffer* RingBuffer = nullptr;
+    uint32 RingBufferSize = 0;
+    uint32 RingBufferOffset = 0;
+
+    FConstantBufferStats Stats;
+};
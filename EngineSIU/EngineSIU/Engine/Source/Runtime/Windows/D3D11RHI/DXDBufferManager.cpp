@@ -7,6 +7,8 @@ void FDXDBufferManager::Initialize(ID3D11Device* InDXDevice, ID3D11DeviceContext
 {
     DXDevice = InDXDevice;
     DXDeviceContext = InDXDeviceContext;
+    ConstantBufferDevice.Initialize(DXDevice, DXDeviceContext);
+    ConstantBuffers.Initialize(&ConstantBufferDevice);
     CreateQuadBuffer();
 }
 
@@ -35,51 +37,22 @@ void FDXDBufferManager::ReleaseBuffers()
 
 void FDXDBufferManager::ReleaseConstantBuffer()
 {
-    for (auto& Pair : ConstantBufferPool)
-    {
-        if (Pair.Value)
-        {
-            Pair.Value->Release();
-            Pair.Value = nullptr;
-        }
-    }
-    ConstantBufferPool.Empty();
+    ConstantBuffers.Release();
+    ConstantBufferDevice.Release();
 }
-void FDXDBufferManager::BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const
+void FDXDBufferManager::BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const
 {
-    const int Count = Keys.Num();
-    TArray<ID3D11Buffer*> Buffers;
-    Buffers.Reserve(Count);
-    for (const FString& Key : Keys)
-    {
-        ID3D11Buffer* Buffer = GetConstantBuffer(Key);
-        Buffers.Add(Buffer);
-    }
+    ConstantBuffers.Bind(ConstantBuffers.Find(Key), StartSlot, Stage);
+}
 
-    switch (Stage)
-    {
-    case EShaderStage::Vertex:
-        DXDeviceContext->VSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
-        break;
-    case EShaderStage::Pixel:
-        DXDeviceContext->PSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
-        break;
-    case EShaderStage::Compute:
-        DXDeviceContext->CSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
-        break;
-    default:
-        // !TODO : 차후 추가될 셰이더에 맞는 cb 바인딩 처리
-        break;
-    }
+void FDXDBufferManager::BindConstantBuffer(FConstantBufferHandle Handle, UINT StartSlot, EShaderStage Stage) const
+{
+    ConstantBuffers.Bind(Handle, StartSlot, Stage);
 }
 
-void FDXDBufferManager::BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const
+void FDXDBufferManager::BindTransientConstantBuffer(const FTransientConstantBuffer& Transient, UINT StartSlot, EShaderStage Stage) const
 {
-    ID3D11Buffer* Buffer = GetConstantBuffer(Key);
-    if (Stage == EShaderStage::Vertex)
-        DXDeviceContext->VSSetConstantBuffers(StartSlot, 1, &Buffer);
-    else if (Stage == EShaderStage::Pixel)
-        DXDeviceContext->PSSetConstantBuffers(StartSlot, 1, &Buffer);
+    ConstantBuffers.BindTransient(Transient, StartSlot, Stage);
 }
 
 FVertexInfo FDXDBufferManager::GetVertexBuffer(const FString& InName) const
@@ -115,10 +88,12 @@ FIndexInfo FDXDBufferManager::GetTextIndexBuffer(const FWString& InName) const
 
 ID3D11Buffer* FDXDBufferManager::GetConstantBuffer(const FString& InName) const
 {
-    if (ConstantBufferPool.Contains(InName))
-        return ConstantBufferPool[InName];
+    return ConstantBuffers.GetBuffer(ConstantBuffers.Find(InName));
+}
 
-    return nullptr;
+FConstantBufferHandle FDXDBufferManager::GetConstantBufferHandle(const FString& InName) const
+{
+    return ConstantBuffers.Find(InName);
 }
 
 void FDXDBufferManager::CreateQuadBuffer()
@@ -6,8 +6,10 @@
 #include "Container/String.h"
 #include "Container/Array.h"
 #include "Container/Map.h"
+#include "Container/FlatMap.h"
 #include "Engine/Texture.h"
 #include "GraphicDevice.h"
+#include "ConstantBufferUploader.h"
 
 // ShaderStage 열거형
 enum class EShaderStage
@@ -60,17 +62,28 @@ public:
     void ReleaseBuffers();
     void ReleaseConstantBuffer();
 
+    // 상수 버퍼는 FConstantBufferUploader가 만들고 관리하므로 bindFlags는 D3D11_BIND_CONSTANT_BUFFER, usage는 D3D11_USAGE_DYNAMIC이어야 함
     template<typename T>
     HRESULT CreateBufferGeneric(const FString& KeyName, T* data, UINT byteWidth, UINT bindFlags, D3D11_USAGE usage, UINT cpuAccessFlags);
 
+    // 마지막으로 올린 값과 같으면 Map하지 않음
     template<typename T>
-    void UpdateConstantBuffer(const FString& key, const T& data) const;
+    void UpdateConstantBuffer(const FString& key, const T& data);
+    template<typename T>
+    void UpdateConstantBuffer(FConstantBufferHandle Handle, const T& data);
+
+    // 드로우 하나에만 쓰는 상수를 링 버퍼에 올림, 범위 바인딩을 지원하지 않으면 Fallback 버퍼를 갱신
+    template<typename T>
+    FTransientConstantBuffer UploadTransientConstantBuffer(FConstantBufferHandle Fallback, const T& data);
+    void BindTransientConstantBuffer(const FTransientConstantBuffer& Transient, UINT StartSlot, EShaderStage Stage) const;
 
     template<typename T>
     void UpdateDynamicVertexBuffer(const FString& KeyName, const TArray<T>& vertices) const;
 
-    void BindConstantBuffers(const TArray<FString>& Keys, UINT StartSlot, EShaderStage Stage) const;
+    template <typename AllocatorType>
+    void BindConstantBuffers(const TArray<FString, AllocatorType>& Keys, UINT StartSlot, EShaderStage Stage) const;
     void BindConstantBuffer(const FString& Key, UINT StartSlot, EShaderStage Stage) const;
+    void BindConstantBuffer(FConstantBufferHandle Handle, UINT StartSlot, EShaderStage Stage) const;
 
     template<typename T>
     static void SafeRelease(T*& comObject);
@@ -82,6 +95,13 @@ public:
     FIndexInfo GetTextIndexBuffer(const FWString& InName) const;
     ID3D11Buffer* GetConstantBuffer(const FString& InName) const;
 
+    // 패스를 초기화할 때 한 번 찾아두고 매 프레임 이름 대신 사용
+    FConstantBufferHandle GetConstantBufferHandle(const FString& InName) const;
+
+    // 이전 ResetConstantBufferStats 이후 상수 버퍼를 갱신하고 실제로 올린 수
+    const FConstantBufferStats& GetConstantBufferStats() const { return ConstantBuffers.GetStats(); }
+    void ResetConstantBufferStats() { ConstantBuffers.ResetStats(); }
+
     void GetQuadBuffer(FVertexInfo& OutVertexInfo, FIndexInfo& OutIndexInfo);
     void GetTextBuffer(const FWString& Text, FVertexInfo& OutVertexInfo, FIndexInfo& OutIndexInfo);
     void CreateQuadBuffer();
@@ -94,7 +114,8 @@ private:
 
     TMap<FString, FVertexInfo> VertexBufferPool;
     TMap<FString, FIndexInfo> IndexBufferPool;
-    TMap<FString, ID3D11Buffer*> ConstantBufferPool;
+    FD3D11ConstantBufferDevice ConstantBufferDevice;
+    FConstantBufferUploader ConstantBuffers;
 
     TMap<FWString, FBufferInfo> TextAtlasBufferPool;
     TMap<FWString, FVertexInfo> TextAtlasVertexBufferPool;
@@ -250,49 +271,50 @@ HRESULT FDXDBufferManager::CreateDynamicVertexBuffer(const FString& KeyName, con
 template<typename T>
 HRESULT FDXDBufferManager::CreateBufferGeneric(const FString& KeyName, T* data, UINT byteWidth, UINT bindFlags, D3D11_USAGE usage, UINT cpuAccessFlags)
 {
-    byteWidth = Align16(byteWidth);
-
-    D3D11_BUFFER_DESC desc = {};
-    desc.ByteWidth = byteWidth;
-    desc.Usage = usage;
-    desc.BindFlags = bindFlags;
-    desc.CPUAccessFlags = cpuAccessFlags;
+    if (bindFlags != D3D11_BIND_CONSTANT_BUFFER || usage != D3D11_USAGE_DYNAMIC || !(cpuAccessFlags & D3D11_CPU_ACCESS_WRITE))
+    {
+        UE_LOG(LogLevel::Error, TEXT("CreateBufferGeneric 호출: 키 %s는 동적 상수 버퍼가 아닙니다."), *KeyName);
+        return E_INVALIDARG;
+    }
 
-    D3D11_SUBRESOURCE_DATA initData = {};
-    initData.pSysMem = data;
+    byteWidth = Align16(byteWidth);
 
-    ID3D11Buffer* buffer = nullptr;
-    HRESULT hr = DXDevice->CreateBuffer(&desc, data ? &initData : nullptr, &buffer);
-    if (FAILED(hr))
+    FConstantBufferHandle Handle = ConstantBuffers.Create(KeyName, byteWidth);
+    if (!Handle.IsValid())
     {
-        UE_LOG(LogLevel::Error, TEXT("Error Create Constant Buffer!"));
-        return hr;
+        return E_FAIL;
     }
 
-    ConstantBufferPool.Add(KeyName, buffer);
+    if (data)
+    {
+        ConstantBuffers.Update(Handle, data, sizeof(T));
+    }
     return S_OK;
 }
 
 template<typename T>
-void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T& data) const
+void FDXDBufferManager::UpdateConstantBuffer(const FString& key, const T& data)
 {
-    ID3D11Buffer* buffer = GetConstantBuffer(key);
-    if (!buffer)
+    FConstantBufferHandle Handle = ConstantBuffers.Find(key);
+    if (!Handle.IsValid())
     {
         UE_LOG(LogLevel::Error, TEXT("UpdateConstantBuffer 호출: 키 %s에 해당하는 buffer가 없습니다."), *key);
         return;
     }
 
-    D3D11_MAPPED_SUBRESOURCE mappedResource;
-    HRESULT hr = DXDeviceContext->Map(buffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-    if (FAILED(hr))
-    {
-        UE_LOG(LogLevel::Error, TEXT("Buffer Map 실패, HRESULT: 0x%X"), hr);
-        return;
-    }
+    ConstantBuffers.Update(Handle, &data, sizeof(T));
+}
+
+template<typename T>
+void FDXDBufferManager::UpdateConstantBuffer(FConstantBufferHandle Handle, const T& data)
+{
+    ConstantBuffers.Update(Handle, &data, sizeof(T));
+}
 
-    memcpy(mappedResource.pData, &data, sizeof(T));
-    DXDeviceContext->Unmap(buffer, 0);
+template<typename T>
+FTransientConstantBuffer FDXDBufferManager::UploadTransientConstantBuffer(FConstantBufferHandle Fallback, const T& data)
+{
+    return ConstantBuffers.UploadTransient(Fallback, &data, sizeof(T));
 }
 
 template<typename T>
@@ -327,3 +349,31 @@ void FDXDBufferManager::SafeRelease(T*& comObject)
     }
 }
 
+template <typename AllocatorType>
+void FDXDBufferManager::BindConstantBuffers(const TArray<FString, AllocatorType>& Keys, UINT StartSlot, EShaderStage Stage) const
+{
+    const int Count = Keys.Num();
+    TArray<ID3D11Buffer*, FFrameAllocator<ID3D11Buffer*>> Buffers;
+    Buffers.Reserve(Count);
+    for (const FString& Key : Keys)
+    {
+        ID3D11Buffer* Buffer = GetConstantBuffer(Key);
+        Buffers.Add(Buffer);
+    }
+
+    switch (Stage)
+    {
+    case EShaderStage::Vertex:
+        DXDeviceContext->VSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
+        break;
+    case EShaderStage::Pixel:
+        DXDeviceContext->PSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
+        break;
+    case EShaderStage::Compute:
+        DXDeviceContext->CSSetConstantBuffers(StartSlot, Count, Buffers.GetData());
+        break;
+    default:
+        // !TODO : 차후 추가될 셰이더에 맞는 cb 바인딩 처리
+        break;
+    }
+}
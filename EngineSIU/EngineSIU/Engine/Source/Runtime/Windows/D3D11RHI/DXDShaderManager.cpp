@@ -191,7 +191,7 @@ HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& FileName, const st
 
 HRESULT FDXDShaderManager::AddPixelShader(const std::wstring& FileName, const std::string& EntryPoint, EViewModeIndex ViewMode, size_t& OutShaderKey, const TArray<D3D_SHADER_MACRO>& DynamicMacros)
 {
-    TArray<D3D_SHADER_MACRO> FinalDefines;
+    TArray<D3D_SHADER_MACRO, FFrameAllocator<D3D_SHADER_MACRO>> FinalDefines;
 
     const D3D_SHADER_MACRO* BaseDefines = GetShaderMacro(ViewMode);
     for (; BaseDefines->Name != nullptr; ++BaseDefines) {
@@ -360,13 +360,10 @@ void FGraphicsDevice::Prepare(const std::shared_ptr<FEditorViewportClient>& Acti
 {
     Prepare();
     //TODO: 다른 곳으로 빼자
-    TArray<UHeightFogComponent*> Fogs;
-    for (const auto iter : TObjectRange<UHeightFogComponent>())
+    TArray<UHeightFogComponent*, FFrameAllocator<UHeightFogComponent*>> Fogs;
+    for (const auto iter : TObjectRange<UHeightFogComponent>(GEngine->ActiveWorld))
     {
-        if (iter->GetWorld() == GEngine->ActiveWorld)
-        {
-            Fogs.Add(iter);
-        }
+        Fogs.Add(iter);
     }
     if ((ActiveViewport->GetShowFlag() & static_cast<uint64>(EEngineShowFlags::SF_Fog)) && Fogs.Num() > 0)
         PrepareTexture();
@@ -0,0 +1,77 @@
+Texture2D gTexture : register(t0);
+SamplerState gSampler : register(s0);
+
+cbuffer constants : register(b0)
+{
+    row_major float4x4 ViewProjection;
+    float Flag;
+}
+
+cbuffer SubUVConstant : register(b1)
+{
+    float2 uvOffset; // 파티클마다 인스턴스 데이터로 받으므로 사용하지 않음
+    float2 uvScale;  // sub UV 셀의 크기 (예: 1/CellsPerColumn, 1/CellsPerRow)
+    float4 TintColor;
+}
+
+cbuffer ParticleConstants : register(b2)
+{
+    float3 CameraRight;
+    float ParticlePad0;
+    float3 CameraUp;
+    float ParticlePad1;
+}
+
+struct VSInput
+{
+    // 쿼드 정점 (슬롯 0)
+    float3 position : POSITION;
+    float2 texCoord : TEXCOORD;
+
+    // 파티클마다 하나씩 (슬롯 1), FParticleInstance와 같은 순서
+    float3 instancePosition : INSTANCE_POSITION;
+    float instanceSize : INSTANCE_SIZE;
+    float4 instanceColor : INSTANCE_COLOR;
+    float2 instanceUVOffset : INSTANCE_UVOFFSET;
+};
+
+struct PSInput
+{
+    float4 position : SV_POSITION;
+    float2 texCoord : TEXCOORD;
+    float4 color : COLOR;
+};
+
+PSInput MainVS(VSInput input)
+{
+    PSInput output;
+
+    // 카메라를 향하도록 카메라의 오른쪽, 위 방향으로 쿼드를 펼침
+    float3 worldPosition = input.instancePosition
+        + (CameraRight * input.position.x + CameraUp * input.position.y) * input.instanceSize;
+    output.position = mul(float4(worldPosition, 1.0f), ViewProjection);
+
+    output.texCoord = input.texCoord * uvScale + input.instanceUVOffset;
+    output.color = input.instanceColor * TintColor;
+
+    return output;
+}
+
+float4 MainPS(PSInput input) : SV_TARGET
+{
+    float4 col = gTexture.Sample(gSampler, input.texCoord);
+    float threshold = 0.1f;
+
+    // BillboardShader와 같이 검은 배경은 버림
+    if (col.r < threshold && col.g < threshold && col.b < threshold)
+    {
+        discard;
+    }
+
+    col *= input.color;
+    if (col.a <= 0.0f)
+    {
+        discard;
+    }
+    return col;
+}
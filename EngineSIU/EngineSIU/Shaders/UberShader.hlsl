@@ -275,6 +275,24 @@ float4 Lighting(float3 vPosition, float3 vNormal)
 /////////////////////////////////////////////////////////////
 // 구조체 정의 (정점 및 픽셀)
 /////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////
+// 인스턴싱
+/////////////////////////////////////////////////////////////
+// FStaticMeshInstanceData와 순서가 같아야 함
+struct FInstanceData
+{
+    row_major float4x4 World;
+    row_major float4x4 WorldInverseTranspose;
+};
+
+StructuredBuffer<FInstanceData> InstanceData : register(t5);
+
+cbuffer InstanceConstants : register(b7)
+{
+    uint BaseInstance;
+    float3 InstancePad;
+};
+
 struct VS_INPUT
 {
     float3 position : POSITION;
@@ -300,13 +318,13 @@ struct PS_INPUT
 /////////////////////////////////////////////////////////////
 // 정점 쉐이더
 /////////////////////////////////////////////////////////////
-PS_INPUT MainVS(VS_INPUT input)
+PS_INPUT TransformVertex(VS_INPUT input, row_major float4x4 World, row_major float4x4 WorldInverseTranspose)
 {
     PS_INPUT output;
     output.materialIndex = input.materialIndex;
     
     // 월드 변환
-    float4 worldPosition = mul(float4(input.position, 1.0), Model);
+    float4 worldPosition = mul(float4(input.position, 1.0), World);
     output.worldPos = worldPosition.xyz;
     
     // 뷰 및 프로젝션 변환
@@ -314,7 +332,7 @@ PS_INPUT MainVS(VS_INPUT input)
     output.position = mul(viewPosition, Projection);
     
     // 월드 공간 노멀 계산
-    output.normal = normalize(mul(input.normal, (float3x3) MInverseTranspose));
+    output.normal = normalize(mul(input.normal, (float3x3) WorldInverseTranspose));
     
     // 기본 색상 전달 (버텍스 컬러)
     output.color = input.color;
@@ -333,6 +351,18 @@ PS_INPUT MainVS(VS_INPUT input)
     return output;
 }
 
+PS_INPUT MainVS(VS_INPUT input)
+{
+    return TransformVertex(input, Model, MInverseTranspose);
+}
+
+// 같은 메시를 DrawIndexedInstanced로 그릴 때 사용, SV_InstanceID는 StartInstanceLocation을 포함하지 않으므로 BaseInstance를 더함
+PS_INPUT MainVSInstanced(VS_INPUT input, uint instanceID : SV_InstanceID)
+{
+    FInstanceData instance = InstanceData[BaseInstance + instanceID];
+    return TransformVertex(input, instance.World, instance.WorldInverseTranspose);
+}
+
 /////////////////////////////////////////////////////////////
 // 픽셀 쉐이더
 /////////////////////////////////////////////////////////////